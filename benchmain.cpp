@@ -0,0 +1,44 @@
+/******************************************************************************
+** Copyright (C) 2018 Laird
+**
+** Project: UwVSP-OTA
+**
+** Module: benchmain.cpp
+**
+** Notes:
+**
+** License: This program is free software: you can redistribute it and/or
+**          modify it under the terms of the GNU General Public License as
+**          published by the Free Software Foundation, version 3.
+**
+**          This program is distributed in the hope that it will be useful,
+**          but WITHOUT ANY WARRANTY; without even the implied warranty of
+**          MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+**          GNU General Public License for more details.
+**
+**          You should have received a copy of the GNU General Public License
+**          along with this program.  If not, see http://www.gnu.org/licenses/
+**
+*******************************************************************************/
+#include "otabenchmark.h"
+#include <QCoreApplication>
+
+//=============================================================================
+//=============================================================================
+int
+main(
+    int argc,
+    char *argv[]
+    )
+{
+    //Start benchmark execution
+    QCoreApplication a(argc, argv);
+    a.setApplicationName("vspota-bench");
+    a.setApplicationVersion(APP_VERSION);
+    OtaBenchmark w;
+    return w.Run(a);
+}
+
+/******************************************************************************/
+// END OF FILE
+/******************************************************************************/
@@ -0,0 +1,451 @@
+/******************************************************************************
+** Copyright (C) 2018 Laird
+**
+** Project: UwVSP-OTA
+**
+** Module: blevsptransport.cpp
+**
+** Notes:
+**
+** License: This program is free software: you can redistribute it and/or
+**          modify it under the terms of the GNU General Public License as
+**          published by the Free Software Foundation, version 3.
+**
+**          This program is distributed in the hope that it will be useful,
+**          but WITHOUT ANY WARRANTY; without even the implied warranty of
+**          MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+**          GNU General Public License for more details.
+**
+**          You should have received a copy of the GNU General Public License
+**          along with this program.  If not, see http://www.gnu.org/licenses/
+**
+*******************************************************************************/
+#include "blevsptransport.h"
+
+//=============================================================================
+//=============================================================================
+BleVspTransport::BleVspTransport(const QBluetoothDeviceInfo &bdiNewDeviceInfo, QObject *parent) : VspTransport(parent)
+{
+    //Constructor
+    bdiDeviceInfo = bdiNewDeviceInfo;
+    strServiceUuid = SETTINGS_VALUE_UUID;
+    strTXOffset = SETTINGS_VALUE_TX_OFFSET;
+    strRXOffset = SETTINGS_VALUE_RX_OFFSET;
+    strMOOffset = SETTINGS_VALUE_MO_OFFSET;
+    strMIOffset = SETTINGS_VALUE_MI_OFFSET;
+    bActive = false;
+    bHasModem = false;
+    nLastWriteSize = 0;
+    lecBLEController = NULL;
+    blesvcVSPService = NULL;
+}
+
+//=============================================================================
+//=============================================================================
+BleVspTransport::~BleVspTransport(
+    )
+{
+    //Destructor
+    if (lecBLEController != NULL)
+    {
+        disconnect(lecBLEController, 0, this, 0);
+        lecBLEController->disconnectFromDevice();
+    }
+}
+
+//=============================================================================
+//=============================================================================
+void
+BleVspTransport::Open(
+    )
+{
+    //Connects to the module
+    if (lecBLEController != NULL)
+    {
+        return;
+    }
+
+    bActive = true;
+    baWritePending.clear();
+    lecBLEController = new QLowEnergyController(bdiDeviceInfo, this);
+    connect(lecBLEController, SIGNAL(connected()), this, SLOT(BLEConnected()));
+    connect(lecBLEController, SIGNAL(disconnected()), this, SLOT(BLEDisconnected()));
+    connect(lecBLEController, SIGNAL(discoveryFinished()), this, SLOT(BLEDiscoveryFinished()));
+    connect(lecBLEController, SIGNAL(error(QLowEnergyController::Error)), this, SLOT(BLEError(QLowEnergyController::Error)));
+#if QT_VERSION >= 0x050B00
+    connect(lecBLEController, SIGNAL(mtuChanged(int)), this, SLOT(ReportMTU(int)));
+#endif
+    lecBLEController->connectToDevice();
+}
+
+//=============================================================================
+//=============================================================================
+void
+BleVspTransport::Close(
+    )
+{
+    //Disconnects from the module, no further errors are reported
+    bActive = false;
+    if (lecBLEController != NULL)
+    {
+        lecBLEController->disconnectFromDevice();
+    }
+}
+
+//=============================================================================
+//=============================================================================
+void
+BleVspTransport::Write(
+    const QByteArray &baData
+    )
+{
+    //Writes a packet to the RX characteristic
+    if (blesvcVSPService == NULL)
+    {
+        return;
+    }
+    nLastWriteSize = baData.length();
+    baWritePending = baData;
+    blesvcVSPService->writeCharacteristic(blechrRXChar, baData);
+}
+
+//=============================================================================
+//=============================================================================
+bool
+BleVspTransport::CanStream(
+    )
+{
+    //Packets can only be streamed if the module can stop the flow and the RX characteristic accepts writes without response
+    return (blesvcVSPService != NULL && bHasModem == true && (blechrRXChar.properties() & QLowEnergyCharacteristic::WriteNoResponse));
+}
+
+//=============================================================================
+//=============================================================================
+void
+BleVspTransport::Stream(
+    const QByteArray &baData
+    )
+{
+    //Writes a packet to the RX characteristic without response, the data is copied as the Bluetooth stack may still hold it after the caller's buffer has changed
+    if (blesvcVSPService == NULL)
+    {
+        return;
+    }
+    QByteArray baPacket = baData;
+    baPacket.detach();
+    nLastWriteSize = baPacket.length();
+    blesvcVSPService->writeCharacteristic(blechrRXChar, baPacket, QLowEnergyService::WriteWithoutResponse);
+}
+
+//=============================================================================
+//=============================================================================
+void
+BleVspTransport::SetCharacteristics(
+    const QString &strNewServiceUuid,
+    const QString &strNewTXOffset,
+    const QString &strNewRXOffset,
+    const QString &strNewMOOffset,
+    const QString &strNewMIOffset
+    )
+{
+    //Sets the VSP service UUID and the offsets of its characteristics, which must be done before Open()
+    strServiceUuid = strNewServiceUuid;
+    strTXOffset = strNewTXOffset;
+    strRXOffset = strNewRXOffset;
+    strMOOffset = strNewMOOffset;
+    strMIOffset = strNewMIOffset;
+}
+
+//=============================================================================
+//=============================================================================
+void
+BleVspTransport::BLEConnected(
+    )
+{
+    //Connected to Bluetooth device
+    if (bActive == true)
+    {
+        emit Connected();
+        lecBLEController->discoverServices();
+    }
+}
+
+//=============================================================================
+//=============================================================================
+void
+BleVspTransport::BLEDisconnected(
+    )
+{
+    //Bluetooth device disconnected
+    bActive = false;
+    emit Closed();
+}
+
+//=============================================================================
+//=============================================================================
+void
+BleVspTransport::BLEDiscoveryFinished(
+    )
+{
+    //Bluetooth service discovery complete
+    if (bActive == false)
+    {
+        return;
+    }
+
+    blesvcVSPService = lecBLEController->createServiceObject(QBluetoothUuid(strServiceUuid), this);
+    if (blesvcVSPService == NULL)
+    {
+        //Service not found
+        Fail("VSP service not found, disconnecting...");
+        return;
+    }
+
+    //Connect VSP service signals
+    connect(blesvcVSPService, SIGNAL(characteristicChanged(QLowEnergyCharacteristic,QByteArray)), this, SLOT(VSPServiceCharacteristicChanged(QLowEnergyCharacteristic,QByteArray)));
+    connect(blesvcVSPService, SIGNAL(characteristicWritten(QLowEnergyCharacteristic,QByteArray)), this, SLOT(VSPServiceCharacteristicWritten(QLowEnergyCharacteristic,QByteArray)));
+    connect(blesvcVSPService, SIGNAL(descriptorWritten(QLowEnergyDescriptor,QByteArray)), this, SLOT(VSPServiceDescriptorWritten(QLowEnergyDescriptor,QByteArray)));
+    connect(blesvcVSPService, SIGNAL(error(QLowEnergyService::ServiceError)), this, SLOT(VSPServiceError(QLowEnergyService::ServiceError)));
+    connect(blesvcVSPService, SIGNAL(stateChanged(QLowEnergyService::ServiceState)), this, SLOT(VSPServiceStateChanged(QLowEnergyService::ServiceState)));
+
+#if QT_VERSION >= 0x050B00
+    //Get the negotiated MTU, later changes are reported through the mtuChanged signal
+    ReportMTU(lecBLEController->mtu());
+#endif
+
+    //Discover service details
+    blesvcVSPService->discoverDetails();
+}
+
+//=============================================================================
+//=============================================================================
+void
+BleVspTransport::BLEError(
+    QLowEnergyController::Error nErrorCode
+    )
+{
+    //Bluetooth Low Energy error
+    if (nErrorCode == QLowEnergyController::NoError)
+    {
+        return;
+    }
+
+    if (nErrorCode == QLowEnergyController::UnknownRemoteDeviceError)
+    {
+        //Remote device cannot be found
+        Fail("Remote Bluetooth device was not found.");
+    }
+    else if (nErrorCode == QLowEnergyController::NetworkError)
+    {
+        //Failed to read from/write to the remote device
+        Fail("Failed reading from/writing to remote device.");
+    }
+    else if (nErrorCode == QLowEnergyController::InvalidBluetoothAdapterError)
+    {
+        //Issue with Bluetooth adapter
+        Fail("Error with Bluetooth Adapter.");
+    }
+    else if (nErrorCode == QLowEnergyController::ConnectionError)
+    {
+        //Failed to connect to device
+        Fail("Failed to connect to Bluetooth device or connection interrupted during communication.");
+    }
+#if QT_VERSION >= 0x050A00
+    //Function was added in Qt 5.10
+    else if (nErrorCode == QLowEnergyController::RemoteHostClosedError)
+    {
+        //Remote device closed the connection
+        Fail("Remote Bluetooth device closed connection.");
+    }
+#endif
+    else
+    {
+        //Unknown error
+        Fail("Unknown Bluetooth Error.");
+    }
+}
+
+//=============================================================================
+//=============================================================================
+void
+BleVspTransport::VSPServiceStateChanged(
+    QLowEnergyService::ServiceState nNewState
+    )
+{
+    //Service state changed, once the details are known notifications are enabled (modem out first so the flow is controlled before any data is sent)
+    if (nNewState != QLowEnergyService::ServiceDiscovered || bActive == false)
+    {
+        return;
+    }
+
+    blechrTXChar = blesvcVSPService->characteristic(CharacteristicUuid(strTXOffset));
+    blechrRXChar = blesvcVSPService->characteristic(CharacteristicUuid(strRXOffset));
+    blechrMOChar = blesvcVSPService->characteristic(CharacteristicUuid(strMOOffset));
+    blechrMIChar = blesvcVSPService->characteristic(CharacteristicUuid(strMIOffset));
+    bHasModem = blechrMOChar.isValid();
+
+    const QLowEnergyDescriptor descTXDesc = blechrTXChar.descriptor(QBluetoothUuid::ClientCharacteristicConfiguration);
+    if (!blechrRXChar.isValid() || !blechrTXChar.isValid() || !descTXDesc.isValid())
+    {
+        //Missing characteristic or descriptor
+        Fail("VSP service is missing characteristics - ensure the module is in hardware command mode VSP.");
+        return;
+    }
+
+    if (bHasModem == true)
+    {
+        //Enable notifications for MO, the modem in characteristic is part of the same pair
+        const QLowEnergyDescriptor descMODesc = blechrMOChar.descriptor(QBluetoothUuid::ClientCharacteristicConfiguration);
+        if (!blechrMIChar.isValid())
+        {
+            //MI characteristic missing
+            Fail("VSP modem in characteristic is missing - ensure the module is in hardware command mode VSP.");
+            return;
+        }
+        else if (!descMODesc.isValid())
+        {
+            //MO descriptor missing
+            Fail("VSP modem out descriptor is missing.");
+            return;
+        }
+        blesvcVSPService->writeDescriptor(descMODesc, QByteArray::fromHex("0100"));
+    }
+
+    //Enable Tx descriptor notifications
+    blesvcVSPService->writeDescriptor(descTXDesc, QByteArray::fromHex("0100"));
+}
+
+//=============================================================================
+//=============================================================================
+void
+BleVspTransport::VSPServiceCharacteristicChanged(
+    QLowEnergyCharacteristic lecCharacteristic,
+    QByteArray baData
+    )
+{
+    //VSP characteristic data received
+    if (lecCharacteristic == blechrTXChar)
+    {
+        //Module output
+        emit DataReceived(baData);
+    }
+    else if (bHasModem == true && lecCharacteristic == blechrMOChar && !baData.isEmpty())
+    {
+        //Modem characteristic update, 0x00 stops the flow and 0x01 allows it
+        if (baData.at(0) == 0x01)
+        {
+            emit FlowChanged(false);
+        }
+        else if (baData.at(0) == 0x00)
+        {
+            emit FlowChanged(true);
+        }
+    }
+}
+
+//=============================================================================
+//=============================================================================
+void
+BleVspTransport::VSPServiceCharacteristicWritten(
+    QLowEnergyCharacteristic lecCharacteristic,
+    QByteArray baData
+    )
+{
+    //VSP characteristic written. Some platforms also report packets written without response, which are ignored as they were accounted for when streamed
+    if (lecCharacteristic == blechrRXChar && !baWritePending.isEmpty() && (baData.isEmpty() || baData == baWritePending))
+    {
+        qint32 nLength = baWritePending.length();
+        baWritePending.clear();
+        emit DataWritten(nLength);
+    }
+}
+
+//=============================================================================
+//=============================================================================
+void
+BleVspTransport::VSPServiceDescriptorWritten(
+    QLowEnergyDescriptor ledDescriptor,
+    QByteArray baData
+    )
+{
+    //VSP descriptor written, Tx notifications are enabled last
+    if (bActive == true && ledDescriptor == blechrTXChar.descriptor(QBluetoothUuid::ClientCharacteristicConfiguration))
+    {
+        emit Opened();
+    }
+}
+
+//=============================================================================
+//=============================================================================
+void
+BleVspTransport::VSPServiceError(
+    QLowEnergyService::ServiceError nErrorCode
+    )
+{
+    //VSP Service error
+    if (nErrorCode == QLowEnergyService::NoError || nErrorCode == QLowEnergyService::OperationError)
+    {
+        return;
+    }
+
+    if (nErrorCode == QLowEnergyService::CharacteristicReadError)
+    {
+        //Failed to read characteristic
+        Fail("Characteristic read failed - Ensure device is in hardware command VSP mode, try reconnecting again then disable/re-enable Bluetooth from settings to clear the cache.");
+    }
+    else if (nErrorCode == QLowEnergyService::CharacteristicWriteError)
+    {
+        //Failed to write characteristic, a larger packet may not be supported by the module
+        QString strMessage = "Characteristic write failed - Ensure device is in hardware command VSP mode, try reconnecting again then disable/re-enable Bluetooth from settings to clear the cache.";
+        if (nLastWriteSize > (BLE_DEFAULT_MTU - BLE_ATT_HEADER_SIZE))
+        {
+            strMessage.append(QString("\r\nA larger packet size (%1) is set, ensure you have correctly configured the module and that it supports this size packet.").arg(nLastWriteSize));
+        }
+        Fail(strMessage);
+    }
+    else if (nErrorCode == QLowEnergyService::DescriptorReadError)
+    {
+        //Failed to read descriptor
+        Fail("Descriptor read failed - Ensure device is in hardware command VSP mode, try reconnecting again then disable/re-enable Bluetooth from settings to clear the cache.");
+    }
+    else if (nErrorCode == QLowEnergyService::DescriptorWriteError)
+    {
+        //Failed to write descriptor
+        Fail("Descriptor write failed - Ensure device is in hardware command VSP mode, try reconnecting again then disable/re-enable Bluetooth from settings to clear the cache.");
+    }
+    else
+    {
+        //Unknown error
+        Fail("Unknown Bluetooth service error occured.");
+    }
+}
+
+//=============================================================================
+//=============================================================================
+QBluetoothUuid
+BleVspTransport::CharacteristicUuid(
+    const QString &strOffset
+    )
+{
+    //Returns the UUID of a VSP characteristic, which is the service UUID with the offset in place of its second 16-bit field
+    return QBluetoothUuid(QString(strServiceUuid.left(4)).append(strOffset).append(strServiceUuid.right(28)));
+}
+
+//=============================================================================
+//=============================================================================
+void
+BleVspTransport::Fail(
+    const QString &strMessage
+    )
+{
+    //Reports an error whilst the transport is in use, errors after it has been closed are expected and ignored
+    if (bActive == true)
+    {
+        bActive = false;
+        emit Error(strMessage);
+    }
+}
+
+/******************************************************************************/
+// END OF FILE
+/******************************************************************************/
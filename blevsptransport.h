@@ -0,0 +1,147 @@
+/******************************************************************************
+** Copyright (C) 2018 Laird
+**
+** Project: UwVSP-OTA
+**
+** Module: blevsptransport.h
+**
+** Notes:
+**
+** License: This program is free software: you can redistribute it and/or
+**          modify it under the terms of the GNU General Public License as
+**          published by the Free Software Foundation, version 3.
+**
+**          This program is distributed in the hope that it will be useful,
+**          but WITHOUT ANY WARRANTY; without even the implied warranty of
+**          MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+**          GNU General Public License for more details.
+**
+**          You should have received a copy of the GNU General Public License
+**          along with this program.  If not, see http://www.gnu.org/licenses/
+**
+*******************************************************************************/
+#ifndef BLEVSPTRANSPORT_H
+#define BLEVSPTRANSPORT_H
+
+/******************************************************************************/
+// Include Files
+/******************************************************************************/
+#include <QObject>
+#include <QBluetoothDeviceInfo>
+#include <QBluetoothUuid>
+#include <QLowEnergyController>
+#include <QLowEnergyService>
+#include "vsptransport.h"
+#include "target.h"
+
+/******************************************************************************/
+// Class definitions
+/******************************************************************************/
+class BleVspTransport : public VspTransport
+{
+    Q_OBJECT
+public:
+    explicit
+    BleVspTransport(
+        const QBluetoothDeviceInfo &bdiNewDeviceInfo,
+        QObject *parent = nullptr
+        );
+    ~BleVspTransport(
+        );
+    void
+    Open(
+        ) override;
+    void
+    Close(
+        ) override;
+    void
+    Write(
+        const QByteArray &baData
+        ) override;
+    bool
+    CanStream(
+        ) override;
+    void
+    Stream(
+        const QByteArray &baData
+        ) override;
+    void
+    SetCharacteristics(
+        const QString &strNewServiceUuid,
+        const QString &strNewTXOffset,
+        const QString &strNewRXOffset,
+        const QString &strNewMOOffset,
+        const QString &strNewMIOffset
+        );
+
+private slots:
+    void
+    BLEConnected(
+        );
+    void
+    BLEDisconnected(
+        );
+    void
+    BLEDiscoveryFinished(
+        );
+    void
+    BLEError(
+        QLowEnergyController::Error nErrorCode
+        );
+    void
+    VSPServiceStateChanged(
+        QLowEnergyService::ServiceState nNewState
+        );
+    void
+    VSPServiceCharacteristicChanged(
+        QLowEnergyCharacteristic lecCharacteristic,
+        QByteArray baData
+        );
+    void
+    VSPServiceCharacteristicWritten(
+        QLowEnergyCharacteristic lecCharacteristic,
+        QByteArray baData
+        );
+    void
+    VSPServiceDescriptorWritten(
+        QLowEnergyDescriptor ledDescriptor,
+        QByteArray baData
+        );
+    void
+    VSPServiceError(
+        QLowEnergyService::ServiceError nErrorCode
+        );
+
+private:
+    QBluetoothUuid
+    CharacteristicUuid(
+        const QString &strOffset
+        );
+    void
+    Fail(
+        const QString &strMessage
+        );
+
+    QBluetoothDeviceInfo bdiDeviceInfo;
+    QString strServiceUuid; //VSP service UUID and characteristic offsets, the application settings may change them from the defaults
+    QString strTXOffset;
+    QString strRXOffset;
+    QString strMOOffset;
+    QString strMIOffset;
+    bool bActive;          //True from Open() until the connection is closed or fails
+    bool bHasModem;
+    qint32 nLastWriteSize; //Size of the packet being written, for reporting write failures
+    QByteArray baWritePending; //Packet written with response which has not completed, empty if none
+    QLowEnergyController *lecBLEController;
+    QLowEnergyService *blesvcVSPService;
+    QLowEnergyCharacteristic blechrRXChar;
+    QLowEnergyCharacteristic blechrTXChar;
+    QLowEnergyCharacteristic blechrMOChar;
+    QLowEnergyCharacteristic blechrMIChar;
+};
+
+#endif // BLEVSPTRANSPORT_H
+
+/******************************************************************************/
+// END OF FILE
+/******************************************************************************/
@@ -22,11 +22,98 @@
 *******************************************************************************/
 #include "checksumcalculator.h"
 
+/******************************************************************************/
+// Local Functions or Private Members
+/******************************************************************************/
+struct ChecksumTables
+{
+    ChecksumTables(
+        );
+    quint16 unByteTable[256];                          //Single byte table
+    quint16 unSliceTables[CHECKSUM_SLICE_SIZE][256];   //Slice-by-8 tables, [0] is the first byte of a block
+};
+
+//=============================================================================
+//=============================================================================
+static inline quint16
+ChecksumTableStep(
+    const quint16 *punByteTable,
+    quint16 unState,
+    unsigned char ucChar
+    )
+{
+    //Advances the checksum by one byte. The bit-serial calculation inverts and byte-swaps the CRC after every byte, which means the high byte of the state is only ever XORed and the inverted, byte-swapped CRC of the low byte can be looked up directly
+    return (unState & 0xFF00) ^ punByteTable[(unState ^ ucChar) & 0xFF];
+}
+
+//=============================================================================
+//=============================================================================
+ChecksumTables::ChecksumTables(
+    )
+{
+    //Generate the single byte table from the bit-serial algorithm
+    quint16 i = 0;
+    while (i < 256)
+    {
+        quint16 unCrc = i;
+        quint8 unBit = 0;
+        while (unBit < 8)
+        {
+            unCrc = ((unCrc & 0x0001) ? ((unCrc >> 1) ^ CHECKSUM_POLYNOMIAL) : (unCrc >> 1));
+            ++unBit;
+        }
+        unCrc = ~unCrc;
+        unByteTable[i] = (quint16)((unCrc << 8) | (unCrc >> 8));
+        ++i;
+    }
+
+    //The byte step is affine, so the result of a block is the XOR of the contribution of each byte position and a constant (the result of an all-zero block)
+    quint16 unConstant = 0;
+    quint8 unPosition = 0;
+    while (unPosition < CHECKSUM_SLICE_SIZE)
+    {
+        unConstant = ChecksumTableStep(unByteTable, unConstant, 0);
+        ++unPosition;
+    }
+
+    //Generate the slice tables, the constant is left in the last table so a block only needs one lookup per byte
+    unPosition = 0;
+    while (unPosition < CHECKSUM_SLICE_SIZE)
+    {
+        i = 0;
+        while (i < 256)
+        {
+            quint16 unState = 0;
+            quint8 unByte = 0;
+            while (unByte < CHECKSUM_SLICE_SIZE)
+            {
+                unState = ChecksumTableStep(unByteTable, unState, (unByte == unPosition ? i : 0));
+                ++unByte;
+            }
+            unSliceTables[unPosition][i] = (unPosition == (CHECKSUM_SLICE_SIZE - 1) ? unState : (unState ^ unConstant));
+            ++i;
+        }
+        ++unPosition;
+    }
+}
+
+//=============================================================================
+//=============================================================================
+static const ChecksumTables *
+GetChecksumTables(
+    )
+{
+    //Returns the lookup tables, these are generated once on first use
+    static const ChecksumTables tblTables;
+    return &tblTables;
+}
+
 //=============================================================================
 //=============================================================================
 ChecksumCalculator::ChecksumCalculator(QObject *parent) : QObject(parent)
 {
     //Constructor
+    ptblTables = GetChecksumTables();
     ResetChecksum();
 }
 
@@ -82,23 +169,59 @@ ChecksumCalculator::AddByte(
     )
 {
     //Calculates checksum of a byte
-    quint8 i;
-    quint16 usData;
+    unCrcVal = ChecksumTableStep(ptblTables->unByteTable, unCrcVal, ucChar);
+}
 
-    for(i=0, usData=(quint32)0xff & ucChar++; i < 8; i++, usData >>= 1)
+//=============================================================================
+//=============================================================================
+void
+ChecksumCalculator::AddBlock(
+    const char *pData,
+    qint32 nLength
+    )
+{
+    //Calculates checksum of a block of data
+#ifdef CHECKSUM_SLICE_BY_8
+    AddBlockSliceBy8(pData, nLength);
+#else
+    const unsigned char *pucData = (const unsigned char *)pData;
+    const unsigned char *pucEnd = pucData + nLength;
+    quint16 unState = unCrcVal;
+    while (pucData < pucEnd)
     {
-        if ((unCrcVal & 0x0001) ^ (usData & 0x0001))
-        {
-            unCrcVal = (unCrcVal >> 1) ^ 0x8408;
-        }
-        else
-        {
-            unCrcVal >>= 1;
-        }
+        unState = ChecksumTableStep(ptblTables->unByteTable, unState, *pucData);
+        ++pucData;
+    }
+    unCrcVal = unState;
+#endif
+}
+
+//=============================================================================
+//=============================================================================
+void
+ChecksumCalculator::AddBlockSliceBy8(
+    const char *pData,
+    qint32 nLength
+    )
+{
+    //Calculates checksum of a block of data, 8 bytes at a time
+    const unsigned char *pucData = (const unsigned char *)pData;
+    const unsigned char *pucEnd = pucData + nLength;
+    const quint16 (*punSlice)[256] = ptblTables->unSliceTables;
+    quint16 unState = unCrcVal;
+    while ((pucEnd - pucData) >= CHECKSUM_SLICE_SIZE)
+    {
+        unState = (unState & 0xFF00) ^ punSlice[0][(unState ^ pucData[0]) & 0xFF] ^ punSlice[1][pucData[1]] ^ punSlice[2][pucData[2]] ^ punSlice[3][pucData[3]] ^ punSlice[4][pucData[4]] ^ punSlice[5][pucData[5]] ^ punSlice[6][pucData[6]] ^ punSlice[7][pucData[7]];
+        pucData += CHECKSUM_SLICE_SIZE;
+    }
+
+    //Remaining bytes
+    while (pucData < pucEnd)
+    {
+        unState = ChecksumTableStep(ptblTables->unByteTable, unState, *pucData);
+        ++pucData;
     }
-    unCrcVal = ~unCrcVal;
-    usData = unCrcVal;
-    unCrcVal = (unCrcVal << 8) | (usData >> 8 & 0xff);
+    unCrcVal = unState;
 }
 
 /******************************************************************************/
@@ -33,6 +33,13 @@
 // Constants
 /******************************************************************************/
 const quint16 CHECKSUM_DEFAULT = 0xFFFF;
+const quint16 CHECKSUM_POLYNOMIAL = 0x8408;
+const quint8  CHECKSUM_SLICE_SIZE = 8;
+
+/******************************************************************************/
+// Forward declaration of Class, Struct & Unions
+/******************************************************************************/
+struct ChecksumTables;
 
 /******************************************************************************/
 // Class definitions
@@ -60,9 +67,20 @@ public:
     AddByte(
         unsigned char ucChar
         );
+    void
+    AddBlock(
+        const char *pData,
+        qint32 nLength
+        );
+    void
+    AddBlockSliceBy8(
+        const char *pData,
+        qint32 nLength
+        );
 
 private:
     quint16 unCrcVal;
+    const ChecksumTables *ptblTables; //Shared lookup tables
 };
 
 #endif // CHECKSUMCALCULATOR_H
@@ -0,0 +1,167 @@
+/******************************************************************************
+** Copyright (C) 2018 Laird
+**
+** Project: UwVSP-OTA
+**
+** Module: checksumtest.cpp
+**
+** Notes:
+**
+** License: This program is free software: you can redistribute it and/or
+**          modify it under the terms of the GNU General Public License as
+**          published by the Free Software Foundation, version 3.
+**
+**          This program is distributed in the hope that it will be useful,
+**          but WITHOUT ANY WARRANTY; without even the implied warranty of
+**          MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+**          GNU General Public License for more details.
+**
+**          You should have received a copy of the GNU General Public License
+**          along with this program.  If not, see http://www.gnu.org/licenses/
+**
+*******************************************************************************/
+#include "checksumtest.h"
+
+//=============================================================================
+//=============================================================================
+quint16
+ChecksumTest::BitSerialChecksum(
+    const QByteArray &baData
+    )
+{
+    //Returns the checksum of the data from the bit-serial calculation which ChecksumCalculator originally used
+    quint16 unCrcVal = CHECKSUM_DEFAULT;
+    for (qint32 nPosition = 0; nPosition < baData.length(); ++nPosition)
+    {
+        quint8 i;
+        quint16 usData;
+        for (i = 0, usData = (quint32)0xff & (unsigned char)baData.at(nPosition); i < 8; i++, usData >>= 1)
+        {
+            if ((unCrcVal & 0x0001) ^ (usData & 0x0001))
+            {
+                unCrcVal = (unCrcVal >> 1) ^ 0x8408;
+            }
+            else
+            {
+                unCrcVal >>= 1;
+            }
+        }
+        unCrcVal = ~unCrcVal;
+        usData = unCrcVal;
+        unCrcVal = (unCrcVal << 8) | (usData >> 8 & 0xff);
+    }
+    return unCrcVal;
+}
+
+//=============================================================================
+//=============================================================================
+QByteArray
+ChecksumTest::RandomData(
+    qint32 nSize,
+    quint32 unSeed
+    )
+{
+    //Returns pseudo-random data, the same seed always gives the same data so a failure can be repeated
+    QByteArray baData(nSize, 0);
+    quint32 unRandom = unSeed;
+    for (qint32 i = 0; i < nSize; ++i)
+    {
+        unRandom = unRandom * 1103515245 + 12345;
+        baData[i] = (char)(unRandom >> 16);
+    }
+    return baData;
+}
+
+//=============================================================================
+//=============================================================================
+void
+ChecksumTest::ByteMatchesBitSerial(
+    )
+{
+    //Every byte value added one at a time, from a state which has already seen every byte value
+    QByteArray baData;
+    for (qint32 i = 0; i < 256; ++i)
+    {
+        baData.append((char)i);
+    }
+    baData.append(baData);
+
+    ChecksumCalculator ccChecksum;
+    for (qint32 i = 0; i < baData.length(); ++i)
+    {
+        ccChecksum.AddByte((unsigned char)baData.at(i));
+        QCOMPARE(ccChecksum.GetChecksum(), BitSerialChecksum(baData.left(i + 1)));
+    }
+}
+
+//=============================================================================
+//=============================================================================
+void
+ChecksumTest::BlockMatchesBitSerial_data(
+    )
+{
+    //Lengths either side of a slice, then random buffers of larger sizes
+    QTest::addColumn<QByteArray>("baData");
+    QTest::newRow("0 bytes") << QByteArray();
+    QTest::newRow("1 byte") << RandomData(1, 1);
+    QTest::newRow("7 bytes") << RandomData(7, 7);
+    QTest::newRow("8 bytes") << RandomData(8, 8);
+    QTest::newRow("9 bytes") << RandomData(9, 9);
+    QTest::newRow("8 bytes of 0x00") << QByteArray(8, (char)0x00);
+    QTest::newRow("9 bytes of 0xFF") << QByteArray(9, (char)0xFF);
+    const qint32 nSizes[] = {15, 16, 17, 255, 1021, 4096, 65537, 262147};
+    for (quint32 i = 0; i < sizeof(nSizes) / sizeof(nSizes[0]); ++i)
+    {
+        QTest::newRow(QString("random %1 bytes").arg(nSizes[i]).toUtf8().constData()) << RandomData(nSizes[i], i + 100);
+    }
+}
+
+//=============================================================================
+//=============================================================================
+void
+ChecksumTest::BlockMatchesBitSerial(
+    )
+{
+    //The checksum of a whole block is the same from each calculation
+    QFETCH(QByteArray, baData);
+    quint16 unExpected = BitSerialChecksum(baData);
+
+    ChecksumCalculator ccTable;
+    ccTable.AddBlock(baData.constData(), baData.length());
+    QCOMPARE(ccTable.GetChecksum(), unExpected);
+
+    ChecksumCalculator ccSliceBy8;
+    ccSliceBy8.AddBlockSliceBy8(baData.constData(), baData.length());
+    QCOMPARE(ccSliceBy8.GetChecksum(), unExpected);
+    QCOMPARE(ccSliceBy8.GetChecksumHexString(), QString("%1").arg(unExpected, 4, 16, QChar('0')).toUpper());
+}
+
+//=============================================================================
+//=============================================================================
+void
+ChecksumTest::SplitBlocksMatchBitSerial(
+    )
+{
+    //A file is checksummed a packet at a time, so blocks which do not start or end on a slice boundary carry the state between them
+    QByteArray baData = RandomData(4099, 4099);
+    quint16 unExpected = BitSerialChecksum(baData);
+    for (qint32 nBlockSize = 1; nBlockSize <= 20; ++nBlockSize)
+    {
+        ChecksumCalculator ccTable;
+        ChecksumCalculator ccSliceBy8;
+        for (qint32 nOffset = 0; nOffset < baData.length(); nOffset += nBlockSize)
+        {
+            qint32 nLength = qMin(nBlockSize, baData.length() - nOffset);
+            ccTable.AddBlock(baData.constData() + nOffset, nLength);
+            ccSliceBy8.AddBlockSliceBy8(baData.constData() + nOffset, nLength);
+        }
+        QCOMPARE(ccTable.GetChecksum(), unExpected);
+        QCOMPARE(ccSliceBy8.GetChecksum(), unExpected);
+    }
+}
+
+QTEST_GUILESS_MAIN(ChecksumTest)
+
+/******************************************************************************/
+// END OF FILE
+/******************************************************************************/
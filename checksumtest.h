@@ -0,0 +1,71 @@
+/******************************************************************************
+** Copyright (C) 2018 Laird
+**
+** Project: UwVSP-OTA
+**
+** Module: checksumtest.h
+**
+** Notes:
+**
+** License: This program is free software: you can redistribute it and/or
+**          modify it under the terms of the GNU General Public License as
+**          published by the Free Software Foundation, version 3.
+**
+**          This program is distributed in the hope that it will be useful,
+**          but WITHOUT ANY WARRANTY; without even the implied warranty of
+**          MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+**          GNU General Public License for more details.
+**
+**          You should have received a copy of the GNU General Public License
+**          along with this program.  If not, see http://www.gnu.org/licenses/
+**
+*******************************************************************************/
+#ifndef CHECKSUMTEST_H
+#define CHECKSUMTEST_H
+
+/******************************************************************************/
+// Include Files
+/******************************************************************************/
+#include <QObject>
+#include <QtTest>
+#include "checksumcalculator.h"
+
+/******************************************************************************/
+// Class definitions
+/******************************************************************************/
+//Compares the table-driven and slice-by-8 checksum calculations with the bit-serial calculation they replaced
+class ChecksumTest : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    void
+    ByteMatchesBitSerial(
+        );
+    void
+    BlockMatchesBitSerial(
+        );
+    void
+    BlockMatchesBitSerial_data(
+        );
+    void
+    SplitBlocksMatchBitSerial(
+        );
+
+private:
+    static quint16
+    BitSerialChecksum(
+        const QByteArray &baData
+        );
+    static QByteArray
+    RandomData(
+        qint32 nSize,
+        quint32 unSeed
+        );
+};
+
+#endif // CHECKSUMTEST_H
+
+/******************************************************************************/
+// END OF FILE
+/******************************************************************************/
@@ -0,0 +1,194 @@
+/******************************************************************************
+** Copyright (C) 2018 Laird
+**
+** Project: UwVSP-OTA
+**
+** Module: commandpipeline.cpp
+**
+** Notes:
+**
+** License: This program is free software: you can redistribute it and/or
+**          modify it under the terms of the GNU General Public License as
+**          published by the Free Software Foundation, version 3.
+**
+**          This program is distributed in the hope that it will be useful,
+**          but WITHOUT ANY WARRANTY; without even the implied warranty of
+**          MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+**          GNU General Public License for more details.
+**
+**          You should have received a copy of the GNU General Public License
+**          along with this program.  If not, see http://www.gnu.org/licenses/
+**
+*******************************************************************************/
+#include "commandpipeline.h"
+
+//=============================================================================
+//=============================================================================
+CommandPipeline::CommandPipeline(QObject *parent) : QObject(parent)
+{
+    //Constructor
+    nAcknowledged = 0;
+    unWindow = 0;
+}
+
+//=============================================================================
+//=============================================================================
+CommandPipeline::~CommandPipeline(
+    )
+{
+    //Destructor
+}
+
+//=============================================================================
+//=============================================================================
+void
+CommandPipeline::SetCommands(
+    const QVector<EncodedCommand> &vecNewCommands,
+    quint8 unNewWindow
+    )
+{
+    //Sets the commands which are about to be sent and how many can be outstanding at once
+    vecCommands = vecNewCommands;
+    nAcknowledged = 0;
+    unWindow = unNewWindow;
+}
+
+//=============================================================================
+//=============================================================================
+void
+CommandPipeline::Clear(
+    )
+{
+    //Stops tracking commands
+    vecCommands.clear();
+    nAcknowledged = 0;
+}
+
+//=============================================================================
+//=============================================================================
+bool
+CommandPipeline::Acknowledge(
+    )
+{
+    //Records a success response, responses arrive in the order commands were sent. Returns true if it was for one of the tracked commands rather than a command sent after them
+    ++nAcknowledged;
+    return (nAcknowledged <= vecCommands.count());
+}
+
+//=============================================================================
+//=============================================================================
+qint32
+CommandPipeline::TrailingAcknowledged(
+    )
+{
+    //Returns the number of success responses received for commands sent after the tracked commands
+    return (nAcknowledged > vecCommands.count() ? nAcknowledged - vecCommands.count() : 0);
+}
+
+//=============================================================================
+//=============================================================================
+qint32
+CommandPipeline::SendLimit(
+    )
+{
+    //Returns the output offset which data can be sent up to without exceeding the window, -1 if there is no limit
+    if (unWindow == 0 || nAcknowledged + unWindow >= vecCommands.count())
+    {
+        return -1;
+    }
+    return vecCommands.at(nAcknowledged + unWindow - 1).nEnd;
+}
+
+//=============================================================================
+//=============================================================================
+qint32
+CommandPipeline::StreamLimit(
+    qint32 nCredit
+    )
+{
+    //Returns the output offset which data can be streamed up to: nCredit bytes past the end of the last acknowledged command, and at least the whole of the next
+    //command so the module can always acknowledge it. -1 if every command has been acknowledged
+    if (nAcknowledged >= vecCommands.count())
+    {
+        return -1;
+    }
+    qint32 nLimit = (nAcknowledged > 0 ? vecCommands.at(nAcknowledged - 1).nEnd : 0) + nCredit;
+    return (nLimit > vecCommands.at(nAcknowledged).nEnd ? nLimit : vecCommands.at(nAcknowledged).nEnd);
+}
+
+//=============================================================================
+//=============================================================================
+qint32
+CommandPipeline::Acknowledged(
+    )
+{
+    //Returns the number of commands which the module has acknowledged
+    return (nAcknowledged < vecCommands.count() ? nAcknowledged : vecCommands.count());
+}
+
+//=============================================================================
+//=============================================================================
+qint32
+CommandPipeline::Outstanding(
+    )
+{
+    //Returns the number of commands which have not yet been acknowledged
+    return (nAcknowledged < vecCommands.count() ? vecCommands.count() - nAcknowledged : 0);
+}
+
+//=============================================================================
+//=============================================================================
+qint32
+CommandPipeline::FailedFileOffset(
+    )
+{
+    //Returns the file offset written by the first unacknowledged command, which is the one an error response belongs to, or -1 if it does not write file data
+    if (nAcknowledged >= vecCommands.count())
+    {
+        return -1;
+    }
+    return vecCommands.at(nAcknowledged).nFileOffset;
+}
+
+//=============================================================================
+//=============================================================================
+qint32
+CommandPipeline::AcknowledgedFileOffset(
+    qint32 nFileLength
+    )
+{
+    //Returns how much of the file the module has acknowledged writing, or -1 if the file open has not been acknowledged yet
+    if (nAcknowledged >= vecCommands.count())
+    {
+        return (vecCommands.isEmpty() ? -1 : nFileLength);
+    }
+    return vecCommands.at(nAcknowledged).nFileOffset;
+}
+
+//=============================================================================
+//=============================================================================
+QVector<qint32>
+CommandPipeline::WrittenFileOffsets(
+    qint32 nSentOffset,
+    qint32 nFileLength
+    )
+{
+    //Returns the offsets which the file on the module may have been written up to, in order: the end of the acknowledged data, then the end of each write command
+    //sent (up to output offset nSentOffset) after it, as the module may have run commands whose responses were lost. Empty if the file open has not been acknowledged
+    QVector<qint32> vecOffsets;
+    qint32 nOffset = AcknowledgedFileOffset(nFileLength);
+    if (nOffset < 0)
+    {
+        return vecOffsets;
+    }
+    vecOffsets.append(nOffset);
+    for (qint32 i = nAcknowledged; i < vecCommands.count() && vecCommands.at(i).nEnd <= nSentOffset; ++i)
+    {
+        vecOffsets.append(i + 1 < vecCommands.count() ? vecCommands.at(i + 1).nFileOffset : nFileLength);
+    }
+    return vecOffsets;
+}
+
+/******************************************************************************/
+// END OF FILE
+/******************************************************************************/
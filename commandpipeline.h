@@ -0,0 +1,98 @@
+/******************************************************************************
+** Copyright (C) 2018 Laird
+**
+** Project: UwVSP-OTA
+**
+** Module: commandpipeline.h
+**
+** Notes:
+**
+** License: This program is free software: you can redistribute it and/or
+**          modify it under the terms of the GNU General Public License as
+**          published by the Free Software Foundation, version 3.
+**
+**          This program is distributed in the hope that it will be useful,
+**          but WITHOUT ANY WARRANTY; without even the implied warranty of
+**          MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+**          GNU General Public License for more details.
+**
+**          You should have received a copy of the GNU General Public License
+**          along with this program.  If not, see http://www.gnu.org/licenses/
+**
+*******************************************************************************/
+#ifndef COMMANDPIPELINE_H
+#define COMMANDPIPELINE_H
+
+/******************************************************************************/
+// Include Files
+/******************************************************************************/
+#include <QObject>
+#include <QByteArray>
+#include <QVector>
+#include "otacommandencoder.h"
+#include "target.h"
+
+/******************************************************************************/
+// Class definitions
+/******************************************************************************/
+class CommandPipeline : public QObject
+{
+    Q_OBJECT
+public:
+    explicit
+    CommandPipeline(
+        QObject *parent = nullptr
+        );
+    ~CommandPipeline(
+        );
+    void
+    SetCommands(
+        const QVector<EncodedCommand> &vecNewCommands,
+        quint8 unNewWindow
+        );
+    void
+    Clear(
+        );
+    bool
+    Acknowledge(
+        );
+    qint32
+    TrailingAcknowledged(
+        );
+    qint32
+    SendLimit(
+        );
+    qint32
+    StreamLimit(
+        qint32 nCredit
+        );
+    qint32
+    Acknowledged(
+        );
+    qint32
+    Outstanding(
+        );
+    qint32
+    FailedFileOffset(
+        );
+    qint32
+    AcknowledgedFileOffset(
+        qint32 nFileLength
+        );
+    QVector<qint32>
+    WrittenFileOffsets(
+        qint32 nSentOffset,
+        qint32 nFileLength
+        );
+
+private:
+    QVector<EncodedCommand> vecCommands; //Commands which are being sent
+    qint32 nAcknowledged;                //Number of success responses received, including any for commands sent after the tracked ones
+    quint8 unWindow;                     //Number of commands which can be outstanding, 0 for no limit
+};
+
+#endif // COMMANDPIPELINE_H
+
+/******************************************************************************/
+// END OF FILE
+/******************************************************************************/
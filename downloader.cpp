@@ -22,7 +22,7 @@
 *******************************************************************************/
 #include "downloader.h"
 
-Downloader::Downloader(QWidget *parent) : QWidget(parent)
+Downloader::Downloader(QObject *parent) : QObject(parent)
 {
     //Constructor
     nmManager = new QNetworkAccessManager();
@@ -42,11 +42,10 @@ Downloader::Downloader(QWidget *parent) : QWidget(parent)
 #endif
 
     //Disable SSL by default
-    baFileData = NULL;
     bEnableSSL = false;
 
-    //No pending request
-    nmrLastRequest = NULL;
+    //No pending requests, 0 is never used as a request ID
+    unNextRequestID = 1;
 }
 
 //=============================================================================
@@ -55,11 +54,7 @@ Downloader::~Downloader(
     )
 {
     //Destructor
-    if (baFileData != NULL)
-    {
-        baFileData->clear();
-        delete baFileData;
-    }
+    hshRequests.clear();
     disconnect(nmManager, 0, 0, 0);
     delete nmManager;
 
@@ -94,25 +89,12 @@ Downloader::sslErrors(
 #endif
         nrReply->ignoreSslErrors(lstSSLErrors);
     }
-    else
+    else if (hshRequests.contains(nrReply))
     {
-        //Certificate error
-        nmrLastRequest = NULL;
-        if (unDownloaderMode == DOWNLOAD_MODE_DEV_SUPPORTED || unDownloaderMode == DOWNLOAD_MODE_XCOMPILE)
-        {
-            emit XCompileComplete(false, DOWNLOAD_SSL_CERT_ERROR, NULL);
-        }
-        else if (unDownloaderMode == DOWNLOAD_MODE_DOWNLOAD_FILE)
-        {
-            emit FileDownloaded(false, DOWNLOAD_SSL_CERT_ERROR, NULL);
-        }
-        else if (unDownloaderMode == DOWNLOAD_MODE_LATEST_FIRMWARE)
-        {
-            emit FirmwareResponse(false, DOWNLOAD_SSL_CERT_ERROR, NULL);
-        }
-
-        //Set status back to idle
-        unDownloaderMode = DOWNLOAD_MODE_IDLE;
+        //Certificate error, the request is finished here so the reply is ignored once it has been aborted
+        DownloaderRequest dlrRequest = hshRequests.take(nrReply);
+        Fail(dlrRequest, DOWNLOAD_SSL_CERT_ERROR, NULL);
+        nrReply->abort();
     }
 }
 #endif
@@ -124,19 +106,19 @@ Downloader::replyFinished(
     QNetworkReply* nrReply
     )
 {
-    //Response received from server regarding online XCompilation
-    nmrLastRequest = NULL;
+    //Response received from server, replies to cancelled or failed requests are discarded
+    QHash<QNetworkReply *, DownloaderRequest>::iterator itRequest = hshRequests.find(nrReply);
+    if (itRequest == hshRequests.end())
+    {
+        nrReply->deleteLater();
+        return;
+    }
+    DownloaderRequest dlrRequest = itRequest.value();
+    hshRequests.erase(itRequest);
+
     if (nrReply->error() != QNetworkReply::NoError && nrReply->error() != QNetworkReply::ServiceUnavailableError)
     {
         //An error occured
-        if (baFileData != NULL)
-        {
-            //Clean up
-            baFileData->clear();
-            delete baFileData;
-            baFileData = NULL;
-        }
-
 #ifdef ENABLE_DEBUG
         qDebug() << nrReply->error();
         qDebug() << nrReply->errorString();
@@ -144,25 +126,11 @@ Downloader::replyFinished(
 #endif
 
         //Pass back error to parent
-        if (unDownloaderMode == DOWNLOAD_MODE_DEV_SUPPORTED || unDownloaderMode == DOWNLOAD_MODE_XCOMPILE)
-        {
-            emit XCompileComplete(false, DOWNLOAD_GENERAL_ERROR, nrReply->errorString().toUtf8());
-        }
-        else if (unDownloaderMode == DOWNLOAD_MODE_DOWNLOAD_FILE)
-        {
-            emit FileDownloaded(false, DOWNLOAD_GENERAL_ERROR, nrReply->errorString().toUtf8());
-        }
-        else if (unDownloaderMode == DOWNLOAD_MODE_LATEST_FIRMWARE)
-        {
-            emit FirmwareResponse(false, DOWNLOAD_GENERAL_ERROR, nrReply->errorString());
-        }
-
-        //Set status back to idle
-        unDownloaderMode = DOWNLOAD_MODE_IDLE;
+        Fail(dlrRequest, DOWNLOAD_GENERAL_ERROR, nrReply->errorString().toUtf8());
     }
     else
     {
-        if (unDownloaderMode == DOWNLOAD_MODE_DEV_SUPPORTED)
+        if (dlrRequest.unMode == DOWNLOAD_MODE_DEV_SUPPORTED)
         {
             //Check if device is supported
             QJsonParseError jpeJsonError;
@@ -182,16 +150,13 @@ Downloader::replyFinished(
                     if (joJsonObject["Result"].toString() == "-3")
                     {
                         //Unsupported device/firmware
-                        emit XCompileComplete(false, DOWNLOAD_UNSUPPORTED_ERROR, "Your device and/or firmware are not supported.");
+                        emit XCompileComplete(dlrRequest.unRequestID, false, DOWNLOAD_UNSUPPORTED_ERROR, "Your device and/or firmware are not supported.");
                     }
                     else
                     {
                         //Other error
-                        emit XCompileComplete(false, DOWNLOAD_UNSUPPORTED_ERROR, joJsonObject["Error"].toString().toUtf8());
+                        emit XCompileComplete(dlrRequest.unRequestID, false, DOWNLOAD_UNSUPPORTED_ERROR, joJsonObject["Error"].toString().toUtf8());
                     }
-
-                    //Set status back to idle
-                    unDownloaderMode = DOWNLOAD_MODE_IDLE;
                 }
                 else if (nrReply->attribute(QNetworkRequest::HttpStatusCodeAttribute).toInt() == 200)
                 {
@@ -199,24 +164,23 @@ Downloader::replyFinished(
                     if (joJsonObject["Result"].toString() == "1")
                     {
                         //Device supported, XCompile application
-                        QNetworkRequest nrThisReq(QUrl(QString((bEnableSSL == true ? WEB_PROTOCOL_SSL : WEB_PROTOCOL_NORMAL)).append("://").append(XCOMPILE_SERVER_HOSTNAME).append("/xcompile.php?JSON=1")));
+                        QNetworkRequest nrThisReq = ServerRequest(dlrRequest.bSSL, "/xcompile.php?JSON=1");
                         QByteArray baPostData;
                         baPostData.append("-----------------------------17192614014659\r\nContent-Disposition: form-data; name=\"file_XComp\"\r\n\r\n").append(joJsonObject["ID"].toString()).append("\r\n");
                         baPostData.append("-----------------------------17192614014659\r\nContent-Disposition: form-data; name=\"file_sB\"; filename=\"test.sb\"\r\nContent-Type: application/octet-stream\r\n\r\n");
 
-                        //Set the mode
-                        unDownloaderMode = DOWNLOAD_MODE_XCOMPILE;
-
                         //Append the data to the POST request
-                        baPostData.append(*baFileData);
+                        baPostData.append(dlrRequest.baSourceData);
                         baPostData.append("\r\n-----------------------------17192614014659--\r\n");
                         nrThisReq.setRawHeader("Content-Type", "multipart/form-data; boundary=---------------------------17192614014659");
-                        nrThisReq.setRawHeader("Content-Length", QString(baPostData.length()).toUtf8());
-                        nmrLastRequest = nmManager->post(nrThisReq, baPostData);
+                        nrThisReq.setRawHeader("Content-Length", QByteArray::number(baPostData.length()));
+
+                        //The XCompile keeps the ID of the support check
+                        Track(nmManager->post(nrThisReq, baPostData), DOWNLOAD_MODE_XCOMPILE, dlrRequest.bSSL, dlrRequest.unRequestID);
 #ifdef ENABLE_DEBUG
                         qDebug() << "Sent XCompile request...";
 #endif
-                        emit StatusChanged(DOWNLOAD_MODE_XCOMPILE);
+                        emit StatusChanged(dlrRequest.unRequestID, DOWNLOAD_MODE_XCOMPILE);
                     }
                     else
                     {
@@ -224,7 +188,7 @@ Downloader::replyFinished(
 #ifdef ENABLE_DEBUG
                         qDebug() << "Device should be supported but something went wrong";
 #endif
-                        emit XCompileComplete(false, DOWNLOAD_UNKNOWN_ERROR, NULL);
+                        emit XCompileComplete(dlrRequest.unRequestID, false, DOWNLOAD_UNKNOWN_ERROR, NULL);
                     }
                 }
                 else
@@ -233,7 +197,7 @@ Downloader::replyFinished(
 #ifdef ENABLE_DEBUG
                     qDebug() << "Server response is not known.";
 #endif
-                    emit XCompileComplete(false, DOWNLOAD_UNKNOWN_ERROR, NULL);
+                    emit XCompileComplete(dlrRequest.unRequestID, false, DOWNLOAD_UNKNOWN_ERROR, NULL);
                 }
             }
             else
@@ -242,18 +206,12 @@ Downloader::replyFinished(
 #ifdef ENABLE_DEBUG
                 qDebug() << "Error whilst decoding JSON";
 #endif
-                emit XCompileComplete(false, DOWNLOAD_JSON_ERROR, NULL);
+                emit XCompileComplete(dlrRequest.unRequestID, false, DOWNLOAD_JSON_ERROR, NULL);
             }
-
-            //Clean up
-            baFileData->clear();
-            delete baFileData;
-            baFileData = NULL;
         }
-        else if (unDownloaderMode == DOWNLOAD_MODE_XCOMPILE)
+        else if (dlrRequest.unMode == DOWNLOAD_MODE_XCOMPILE)
         {
             //XCompile result
-            unDownloaderMode = DOWNLOAD_MODE_IDLE;
             if (nrReply->attribute(QNetworkRequest::HttpStatusCodeAttribute).toInt() == 503)
             {
 #ifdef ENABLE_DEBUG
@@ -274,7 +232,7 @@ Downloader::replyFinished(
 #ifdef ENABLE_DEBUG
                         qDebug() << "  -> Error: " << joJsonObject["Error"].toString() << " - " << joJsonObject["Description"].toString();
 #endif
-                        emit XCompileComplete(false, DOWNLOAD_XCOMPILE_ERROR, QString("Failed to compile ").append(joJsonObject["Result"].toString()).append("; ").append(joJsonObject["Error"].toString().append("\r\n").append(joJsonObject["Description"].toString())).toUtf8());
+                        emit XCompileComplete(dlrRequest.unRequestID, false, DOWNLOAD_XCOMPILE_ERROR, QString("Failed to compile ").append(joJsonObject["Result"].toString()).append("; ").append(joJsonObject["Error"].toString().append("\r\n").append(joJsonObject["Description"].toString())).toUtf8());
                     }
                     else
                     {
@@ -282,7 +240,7 @@ Downloader::replyFinished(
 #ifdef ENABLE_DEBUG
                         qDebug() << "  -> Server error: " << joJsonObject["Result"].toString() << " - " << joJsonObject["Error"].toString();
 #endif
-                        emit XCompileComplete(false, DOWNLOAD_SERVER_ERROR, QString("Server responded with error code ").append(joJsonObject["Result"].toString()).append("; ").append(joJsonObject["Error"].toString()).toUtf8());
+                        emit XCompileComplete(dlrRequest.unRequestID, false, DOWNLOAD_SERVER_ERROR, QString("Server responded with error code ").append(joJsonObject["Result"].toString()).append("; ").append(joJsonObject["Error"].toString()).toUtf8());
                     }
                 }
                 else
@@ -291,7 +249,7 @@ Downloader::replyFinished(
 #ifdef ENABLE_DEBUG
                     qDebug() << "  -> Error decoding JSON response";
 #endif
-                    emit XCompileComplete(false, DOWNLOAD_JSON_ERROR, NULL);
+                    emit XCompileComplete(dlrRequest.unRequestID, false, DOWNLOAD_JSON_ERROR, NULL);
                 }
             }
             else if (nrReply->attribute(QNetworkRequest::HttpStatusCodeAttribute).toInt() == 200)
@@ -299,9 +257,8 @@ Downloader::replyFinished(
                 //Compiled - save file
 #ifdef ENABLE_DEBUG
                 qDebug() << "XCompilation complete";
-//                qDebug() << "File data: " << *baFileData;
 #endif
-                emit XCompileComplete(true, 0, nrReply->readAll());
+                emit XCompileComplete(dlrRequest.unRequestID, true, 0, nrReply->readAll());
             }
             else
             {
@@ -309,13 +266,12 @@ Downloader::replyFinished(
 #ifdef ENABLE_DEBUG
                 qDebug() << "XCompilation failed with unknown response.";
 #endif
-                emit XCompileComplete(false, nrReply->attribute(QNetworkRequest::HttpStatusCodeAttribute).toInt(), nrReply->readAll());
+                emit XCompileComplete(dlrRequest.unRequestID, false, nrReply->attribute(QNetworkRequest::HttpStatusCodeAttribute).toInt(), nrReply->readAll());
             }
         }
-        else if (unDownloaderMode == DOWNLOAD_MODE_DOWNLOAD_FILE)
+        else if (dlrRequest.unMode == DOWNLOAD_MODE_DOWNLOAD_FILE)
         {
             //Download remote file
-            unDownloaderMode = DOWNLOAD_MODE_IDLE;
 #ifdef ENABLE_DEBUG
             qDebug() << "Remote file download:";
 #endif
@@ -330,7 +286,7 @@ Downloader::replyFinished(
 #ifdef ENABLE_DEBUG
                     qDebug() << "Remote file download:";
 #endif
-                    emit FileDownloaded(true, 0, nrReply->readAll());
+                    emit FileDownloaded(dlrRequest.unRequestID, true, 0, nrReply->readAll());
                 }
                 else
                 {
@@ -338,7 +294,7 @@ Downloader::replyFinished(
 #ifdef ENABLE_DEBUG
                     qDebug() << "  -> Filesize too big/small, got: " << nrReply->size() << ", expected " << FILESIZE_MIN << "-" << FILESIZE_MAX;
 #endif
-                    emit FileDownloaded(false, DOWNLOAD_FILESIZE_ERROR, NULL);
+                    emit FileDownloaded(dlrRequest.unRequestID, false, DOWNLOAD_FILESIZE_ERROR, NULL);
                 }
             }
             else
@@ -347,20 +303,19 @@ Downloader::replyFinished(
 #ifdef ENABLE_DEBUG
                 qDebug() << "  -> Error downloading file: " << nrReply->attribute(QNetworkRequest::HttpStatusCodeAttribute).toInt();
 #endif
-                emit FileDownloaded(false, nrReply->attribute(QNetworkRequest::HttpStatusCodeAttribute).toInt(), NULL);
+                emit FileDownloaded(dlrRequest.unRequestID, false, nrReply->attribute(QNetworkRequest::HttpStatusCodeAttribute).toInt(), NULL);
             }
         }
-        else if (unDownloaderMode == DOWNLOAD_MODE_LATEST_FIRMWARE)
+        else if (dlrRequest.unMode == DOWNLOAD_MODE_LATEST_FIRMWARE)
         {
             //Firmware version response
-            unDownloaderMode = DOWNLOAD_MODE_IDLE;
             if (nrReply->attribute(QNetworkRequest::HttpStatusCodeAttribute).toInt() == 503)
             {
 #ifdef ENABLE_DEBUG
                 qDebug() << "Unsupported/invalid device/firmware";
 #endif
                 //Unsupported/invalid device/firmware
-                emit FirmwareResponse(false, DOWNLOAD_JSON_ERROR, NULL);
+                emit FirmwareResponse(dlrRequest.unRequestID, false, DOWNLOAD_JSON_ERROR, NULL);
             }
             else if (nrReply->attribute(QNetworkRequest::HttpStatusCodeAttribute).toInt() == 200)
             {
@@ -379,18 +334,18 @@ Downloader::replyFinished(
                     if (joJsonObject["Result"].toString().toInt() == FIRMWARE_CHECK_OLD || joJsonObject["Result"].toString().toInt() == FIRMWARE_CHECK_CURRENT || joJsonObject["Result"].toString().toInt() == FIRMWARE_CHECK_TEST)
                     {
                         //Supported, pass back to parent
-                        emit FirmwareResponse(true, joJsonObject["Result"].toString().toInt(), (joJsonObject["Result"].toString().toInt() == FIRMWARE_CHECK_OLD ? joJsonObject["Firmware"].toString() : NULL));
+                        emit FirmwareResponse(dlrRequest.unRequestID, true, joJsonObject["Result"].toString().toInt(), (joJsonObject["Result"].toString().toInt() == FIRMWARE_CHECK_OLD ? joJsonObject["Firmware"].toString() : NULL));
                     }
                     else
                     {
                         //Unsupported
-                        emit FirmwareResponse(true, FIRMWARE_CHECK_UNSUPPORTED, NULL);
+                        emit FirmwareResponse(dlrRequest.unRequestID, true, FIRMWARE_CHECK_UNSUPPORTED, NULL);
                     }
                 }
                 else
                 {
                     //JSON decoding failed
-                    emit FirmwareResponse(false, DOWNLOAD_JSON_ERROR, NULL);
+                    emit FirmwareResponse(dlrRequest.unRequestID, false, DOWNLOAD_JSON_ERROR, NULL);
                 }
             }
             else
@@ -399,7 +354,7 @@ Downloader::replyFinished(
 #ifdef ENABLE_DEBUG
                 qDebug() << "Firmware response failed with unknown response.";
 #endif
-                emit FirmwareResponse(false, nrReply->attribute(QNetworkRequest::HttpStatusCodeAttribute).toInt(), nrReply->readAll());
+                emit FirmwareResponse(dlrRequest.unRequestID, false, nrReply->attribute(QNetworkRequest::HttpStatusCodeAttribute).toInt(), nrReply->readAll());
             }
         }
     }
@@ -410,7 +365,7 @@ Downloader::replyFinished(
 
 //=============================================================================
 //=============================================================================
-void
+quint32
 Downloader::XCompileFile(
     QString strDevID,
     QString strLanguageHashA,
@@ -418,11 +373,10 @@ Downloader::XCompileFile(
     QByteArray *baSourceFileData
     )
 {
-    //Send request to check if XCompiler exists
-    unDownloaderMode = DOWNLOAD_MODE_DEV_SUPPORTED;
-    baFileData = new QByteArray(*baSourceFileData);
-    nmrLastRequest = nmManager->get(QNetworkRequest(QUrl(QString((bEnableSSL == true ? WEB_PROTOCOL_SSL : WEB_PROTOCOL_NORMAL)).append("://").append(XCOMPILE_SERVER_HOSTNAME).append("/supported.php?JSON=1&Dev=").append(strDevID).append("&HashA=").append(strLanguageHashA).append("&HashB=").append(strLanguageHashB))));
-    emit StatusChanged(DOWNLOAD_MODE_DEV_SUPPORTED);
+    //Send request to check if XCompiler exists, the source is kept with the request until it is posted to the XCompiler
+    quint32 unRequestID = Track(nmManager->get(ServerRequest(bEnableSSL, QString("/supported.php?JSON=1&Dev=").append(strDevID).append("&HashA=").append(strLanguageHashA).append("&HashB=").append(strLanguageHashB))), DOWNLOAD_MODE_DEV_SUPPORTED, bEnableSSL, 0, *baSourceFileData);
+    emit StatusChanged(unRequestID, DOWNLOAD_MODE_DEV_SUPPORTED);
+    return unRequestID;
 }
 
 //=============================================================================
@@ -432,7 +386,7 @@ Downloader::SetSSLSupport(
     bool bNewEnableSSL
     )
 {
-    //Set SSL status
+    //Set SSL status, used by requests made after this call
 #ifndef QT_NO_SSL
     bEnableSSL = bNewEnableSSL;
 #endif
@@ -440,53 +394,148 @@ Downloader::SetSSLSupport(
 
 //=============================================================================
 //=============================================================================
-void
+quint32
 Downloader::DownloadFile(
     QString strDownloadURL
     )
 {
     //Downloads a file
-    unDownloaderMode = DOWNLOAD_MODE_DOWNLOAD_FILE;
 #ifdef QT_NO_SSL
     //Check if URL requires SSL
     if (strDownloadURL.length() > 6 && strDownloadURL.left(6).toLower() == "https:")
     {
-        //SSL URL detected without SSL support being active - fail
-        emit FileDownloaded(false, DOWNLOAD_SSL_SUPPORT_ERROR, NULL);
-        return;
+        //SSL URL detected without SSL support being active - fail once the caller has the request ID
+        quint32 unRequestID = unNextRequestID++;
+        QMetaObject::invokeMethod(this, "FileDownloaded", Qt::QueuedConnection, Q_ARG(quint32, unRequestID), Q_ARG(bool, false), Q_ARG(qint16, DOWNLOAD_SSL_SUPPORT_ERROR), Q_ARG(QByteArray, QByteArray()));
+        return unRequestID;
     }
 #endif
-    nmrLastRequest = nmManager->get(QNetworkRequest(QUrl(strDownloadURL)));
-    emit StatusChanged(DOWNLOAD_MODE_DOWNLOAD_FILE);
+    QNetworkRequest nrThisReq = QNetworkRequest(QUrl(strDownloadURL));
+#if QT_VERSION >= QT_VERSION_CHECK(5, 8, 0)
+    nrThisReq.setAttribute(QNetworkRequest::HTTP2AllowedAttribute, true);
+#endif
+    quint32 unRequestID = Track(nmManager->get(nrThisReq), DOWNLOAD_MODE_DOWNLOAD_FILE, false);
+    emit StatusChanged(unRequestID, DOWNLOAD_MODE_DOWNLOAD_FILE);
+    return unRequestID;
 }
 
 //=============================================================================
 //=============================================================================
 void
 Downloader::CancelRequest(
+    quint32 unRequestID
     )
 {
-    //Cancels a pending web requests
-    if (nmrLastRequest != NULL)
+    //Cancels a pending web request, no signal is emitted for it
+    QHash<QNetworkReply *, DownloaderRequest>::iterator itRequest = hshRequests.begin();
+    while (itRequest != hshRequests.end())
     {
-        nmrLastRequest->abort();
-        nmrLastRequest->deleteLater();
-        unDownloaderMode = DOWNLOAD_MODE_IDLE;
+        if (itRequest.value().unRequestID == unRequestID)
+        {
+            QNetworkReply *nrReply = itRequest.key();
+            hshRequests.erase(itRequest);
+            nrReply->abort();
+            return;
+        }
+        ++itRequest;
     }
 }
 
 //=============================================================================
 //=============================================================================
-void
+quint32
 Downloader::CheckLatestFirmware(
     QString strDevID,
     QString strFirmwareVersion
     )
 {
-    //Checks if the firmware for a module is the latest version
-    unDownloaderMode = DOWNLOAD_MODE_LATEST_FIRMWARE;
-    nmrLastRequest = nmManager->get(QNetworkRequest(QUrl(QString((bEnableSSL == true ? WEB_PROTOCOL_SSL : WEB_PROTOCOL_NORMAL)).append("://").append(XCOMPILE_SERVER_HOSTNAME).append("/latest_firmware.php?JSON=1&Dev=").append(strDevID).append("&FW=").append(strFirmwareVersion))));
-    emit StatusChanged(DOWNLOAD_MODE_LATEST_FIRMWARE);
+    //Checks if the firmware for a module is the latest version, this can be outstanding at the same time as other requests
+    quint32 unRequestID = Track(nmManager->get(ServerRequest(bEnableSSL, QString("/latest_firmware.php?JSON=1&Dev=").append(strDevID).append("&FW=").append(strFirmwareVersion))), DOWNLOAD_MODE_LATEST_FIRMWARE, bEnableSSL);
+    emit StatusChanged(unRequestID, DOWNLOAD_MODE_LATEST_FIRMWARE);
+    return unRequestID;
+}
+
+//=============================================================================
+//=============================================================================
+void
+Downloader::ConnectToServer(
+    )
+{
+    //Opens the connection to the XCompile server ahead of a request, so the connection (and SSL) set up overlaps with querying the module
+#ifndef QT_NO_SSL
+    if (bEnableSSL == true)
+    {
+        nmManager->connectToHostEncrypted(XCOMPILE_SERVER_HOSTNAME);
+        return;
+    }
+#endif
+    nmManager->connectToHost(XCOMPILE_SERVER_HOSTNAME);
+}
+
+//=============================================================================
+//=============================================================================
+QNetworkRequest
+Downloader::ServerRequest(
+    bool bSSL,
+    const QString &strPath
+    )
+{
+    //Returns a request to the XCompile server, requests to the same server reuse one kept-alive connection (or HTTP/2 where supported)
+    QNetworkRequest nrThisReq(QUrl(QString((bSSL == true ? WEB_PROTOCOL_SSL : WEB_PROTOCOL_NORMAL)).append("://").append(XCOMPILE_SERVER_HOSTNAME).append(strPath)));
+#if QT_VERSION >= QT_VERSION_CHECK(5, 8, 0)
+    nrThisReq.setAttribute(QNetworkRequest::HTTP2AllowedAttribute, true);
+#endif
+    return nrThisReq;
+}
+
+//=============================================================================
+//=============================================================================
+quint32
+Downloader::Track(
+    QNetworkReply *nrReply,
+    quint8 unMode,
+    bool bSSL,
+    quint32 unRequestID,
+    const QByteArray &baSourceData
+    )
+{
+    //Adds a reply to the outstanding requests, a new ID is allocated unless the reply continues an existing request
+    DownloaderRequest dlrRequest;
+    dlrRequest.unRequestID = (unRequestID == 0 ? unNextRequestID++ : unRequestID);
+    if (unNextRequestID == 0)
+    {
+        //Skip 0 when wrapping around
+        unNextRequestID = 1;
+    }
+    dlrRequest.unMode = unMode;
+    dlrRequest.bSSL = bSSL;
+    dlrRequest.baSourceData = baSourceData;
+    hshRequests.insert(nrReply, dlrRequest);
+    return dlrRequest.unRequestID;
+}
+
+//=============================================================================
+//=============================================================================
+void
+Downloader::Fail(
+    const DownloaderRequest &dlrRequest,
+    qint16 nErrorCode,
+    const QByteArray &baMessage
+    )
+{
+    //Passes an error back to the parent using the signal for the type of request
+    if (dlrRequest.unMode == DOWNLOAD_MODE_DEV_SUPPORTED || dlrRequest.unMode == DOWNLOAD_MODE_XCOMPILE)
+    {
+        emit XCompileComplete(dlrRequest.unRequestID, false, nErrorCode, baMessage);
+    }
+    else if (dlrRequest.unMode == DOWNLOAD_MODE_DOWNLOAD_FILE)
+    {
+        emit FileDownloaded(dlrRequest.unRequestID, false, nErrorCode, baMessage);
+    }
+    else if (dlrRequest.unMode == DOWNLOAD_MODE_LATEST_FIRMWARE)
+    {
+        emit FirmwareResponse(dlrRequest.unRequestID, false, nErrorCode, QString(baMessage));
+    }
 }
 
 /******************************************************************************/
@@ -32,26 +32,39 @@
 #include <QJsonDocument>
 #include <QJsonObject>
 #include <QUrl>
-#include <QWidget>
+#include <QObject>
+#include <QHash>
 #include "target.h"
 #ifdef UseSSL
 #include <QFile>
 #endif
 
+/******************************************************************************/
+// Structures
+/******************************************************************************/
+//A request awaiting a reply from the server, an XCompile keeps its ID through both of its replies
+struct DownloaderRequest
+{
+    quint32 unRequestID;
+    quint8 unMode;
+    bool bSSL;
+    QByteArray baSourceData; //Application source, only held whilst checking XCompiler support
+};
+
 /******************************************************************************/
 // Class definitions
 /******************************************************************************/
-class Downloader : public QWidget
+class Downloader : public QObject
 {
     Q_OBJECT
 
 public:
     Downloader(
-        QWidget *parent = 0
+        QObject *parent = 0
         );
     ~Downloader(
         );
-    void
+    quint32
     XCompileFile(
         QString strDevID,
         QString strLanguageHashA,
@@ -62,18 +75,22 @@ public:
     SetSSLSupport(
         bool bNewEnableSSL
         );
-    void
+    quint32
     DownloadFile(
         QString strDownloadURL
         );
     void
     CancelRequest(
+        quint32 unRequestID
         );
-    void
+    quint32
     CheckLatestFirmware(
         QString strDevID,
         QString strFirmwareVersion
         );
+    void
+    ConnectToServer(
+        );
 
 private slots:
     void
@@ -91,36 +108,59 @@ private slots:
 signals:
     void
     XCompileComplete(
+        quint32 unRequestID,
         bool bSuccess,
         qint16 nErrorCode,
         QByteArray baFileData
         );
     void
     FileDownloaded(
+        quint32 unRequestID,
         bool bSuccess,
         qint16 nErrorCode,
         QByteArray baFileData
         );
     void
     FirmwareResponse(
+        quint32 unRequestID,
         bool bSuccess,
         qint16 nErrorCode,
         QString strLatestFirmware
         );
     void
     StatusChanged(
+        quint32 unRequestID,
         quint8 unStatus
         );
 
 private:
+    QNetworkRequest
+    ServerRequest(
+        bool bSSL,
+        const QString &strPath
+        );
+    quint32
+    Track(
+        QNetworkReply *nrReply,
+        quint8 unMode,
+        bool bSSL,
+        quint32 unRequestID = 0,
+        const QByteArray &baSourceData = QByteArray()
+        );
+    void
+    Fail(
+        const DownloaderRequest &dlrRequest,
+        qint16 nErrorCode,
+        const QByteArray &baMessage
+        );
+
     QNetworkAccessManager *nmManager;
-    QByteArray *baFileData;
-    quint8 unDownloaderMode;
     bool bEnableSSL;
 #ifdef UseSSL
     QSslCertificate *sslcLairdSSL = NULL; //Holds the Laird SSL certificate
 #endif
-    QNetworkReply *nmrLastRequest;
+    QHash<QNetworkReply *, DownloaderRequest> hshRequests; //Outstanding requests, several can share the connection to the server
+    quint32 unNextRequestID;
 };
 
 #endif // DOWNLOADER_H
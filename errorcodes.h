@@ -0,0 +1,1570 @@
+/******************************************************************************
+** Copyright (C) 2018 Laird
+**
+** Project: UwVSP-OTA
+**
+** Module: errorcodes.h
+**
+** Notes: Generated from codes.csv by generate_errorcodes.py, do not edit.
+**
+** License: This program is free software: you can redistribute it and/or
+**          modify it under the terms of the GNU General Public License as
+**          published by the Free Software Foundation, version 3.
+**
+**          This program is distributed in the hope that it will be useful,
+**          but WITHOUT ANY WARRANTY; without even the implied warranty of
+**          MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+**          GNU General Public License for more details.
+**
+**          You should have received a copy of the GNU General Public License
+**          along with this program.  If not, see http://www.gnu.org/licenses/
+**
+*******************************************************************************/
+#ifndef ERRORCODES_H
+#define ERRORCODES_H
+
+/******************************************************************************/
+// Include Files
+/******************************************************************************/
+#include <QtGlobal>
+
+/******************************************************************************/
+// Structures
+/******************************************************************************/
+struct ErrorCodeEntry
+{
+    qint32 nCode;
+    const char *strMessage;
+};
+
+/******************************************************************************/
+// Constants
+/******************************************************************************/
+//Version of codes.csv the table was generated from
+constexpr char ERROR_CODE_DATABASE_VERSION[] = "1.04";
+
+//Error codes and their messages, sorted by code
+constexpr ErrorCodeEntry ERROR_CODE_TABLE[] = {
+    {512, "GENERIC_FAIL: There is a generic error whilst attempting to store a string due to its length."},
+    {513, "MALLOC_FAIL: An error occured whilst trying to allocate memory, there is insufficient memory on the device for this operation."},
+    {514, "NULL_POINTER: A null pointer was returned, there will be a problem whilst running this application."},
+    {515, "TIMEOUT: A timeout has occured."},
+    {516, "CODE_TOBE_WRITTEN: This function has not yet been implemented."},
+    {517, "RESOURCE_FULL: "},
+    {518, "RESOURCE_EMPTY: "},
+    {519, "RESOURCE_DELETED: "},
+    {520, "ACCESS_DENIED: "},
+    {521, "INCORRECT_MODE: The mode of the device does not allow you to perform this action, this is most commonly seen when the filesystem is full and a download is initiated, use 'atz' to reset the module and try again."},
+    {522, "EOF: "},
+    {523, "OPEN_FAIL: "},
+    {524, "INVALID_HANDLE: An invalid handle was provided to a timer start function."},
+    {525, "IGNORED: "},
+    {526, "PARAM_CLIPPED: A parameter supplied was too long and only a portion of it has been read/stored, using a shorter parameter will fix this."},
+    {527, "NOT_IMPLEMENTED: The function being used is not implemented on the device or its current firmware revision. Please check the device specific manual for further details."},
+    {528, "INVALID_KEY_SIZE: "},
+    {529, "INVALID_PARAM: A parameter supplied is not valid, for example if a configuration key accepts 0= 1 or 2 and 5 was supplied, this error will be emitted."},
+    {530, "INVALID_LICENCE: The license code for your module is not valid, as a result device functionality is severely limited until a valid license is entered to the module."},
+    {1024, "TOK_FILE_READ_ERROR_moved_to_TKS: "},
+    {1025, "TOK_SCRIPTNAME_TOO_LONG: The filename of an application being downloaded is too long,to download to the device the name will need to be shortened."},
+    {1026, "TOK_PCODE_WRITE_OVERRUN: "},
+    {1027, "TOK_PCODE_WRITE_ERROR: "},
+    {1028, "TOK_UNTERMINATED_STRING: A string variable supplied was not properly terminated, strings must be between double quotes at both ends e.g. \"test\"."},
+    {1029, "TOK_UNKNOWN_KEYWORD: "},
+    {1030, "TOK_NOT_PRIMARY_KEYWORD: "},
+    {1031, "TOK_INCOMPLETE_STATEMENT: "},
+    {1032, "TOK_NOT_ARRAY_BRACKET: "},
+    {1033, "TOK_MISSING_NAME: "},
+    {1034, "TOK_VARIABLE_NAME_IS_KEYWORD: "},
+    {1035, "TOK_VARIABLE_NAME_TOO_LONG: "},
+    {1036, "TOK_ILLEGAL_NAME: "},
+    {1037, "TOK_UNKNOWN_VARIABLE_TYPE: "},
+    {1038, "TOK_VARIABLE_UNKNOWN_moved_to_TKS: "},
+    {1039, "TOK_FILE_SEEK_ERROR: "},
+    {1040, "TOK_ARRAY_INDEX_TOO_LARGE: The specific index in an array is too large, please check the device manual for the array size limit."},
+    {1041, "TOK_INVALID_CONSTANT_CHAR: "},
+    {1042, "TOK_ARRAY_INDEX_NEGATIVE: An array cannot have a negative index."},
+    {1043, "TOK_ARRAY_INDEX_0_OR_1"},
+    {1044, "TOK_ARRAY_NOT_ALLOWED: "},
+    {1045, "TOK_MISSING_CLOSING_SQUARE_BRACKET: "},
+    {1046, "TOK_NOT_END_OF_STATEMENT: "},
+    {1047, "TOK_UNEXPECTED_CLOSE_BRACKET: "},
+    {1048, "TOK_MISSING_OPEN_BRACKET: "},
+    {1049, "TOK_MISSING_CLOSE_BRACKET: "},
+    {1050, "TOK_BRACKET_MISMATCH: "},
+    {1051, "TOK_UNEXPECTED_WHITESPACE_IN_CONST: "},
+    {1052, "TOK_EMPTY: "},
+    {1053, "TOK_INCOMPLETE_VAR_LIST: "},
+    {1054, "TOK_LABEL_MISSING: "},
+    {1055, "TOK_BUFFER_TOO_SMALL_moved_to_tks: "},
+    {1056, "TOK_DUPLICATE_LABEL: "},
+    {1057, "TOK_NESTED_ROUTINE_BLOCK: "},
+    {1058, "TOK_ORPHAN_END_EXIT: "},
+    {1059, "TOK_NAME_REDEFINITION: A previously defined function, subroutine or variable already and cannot be defined twice."},
+    {1060, "TOK_PCODEFILE_INVALID_moved_to_TKS: "},
+    {1061, "TOK_HEADER_POS_NOT_AS_EXPECTED: "},
+    {1062, "TOK_EMPTY_EXPRESSION: "},
+    {1063, "TOK_INVALID_EXPRESSION_TYPE: "},
+    {1064, "TOK_CONSTANT_OUTOF_RANGE: "},
+    {1065, "TOK_TYPE_MISMATCH: "},
+    {1066, "TOK_VARIABLE_NOT_AN_ARRAY: A variable being manipulated is not an array but an attempt is being made to address it as one."},
+    {1067, "TOK_VARIABLE_IS_ARRAY: An array being manipulated is an array but an attempt is being made to address it as a singular variable."},
+    {1068, "TOK_TOO_FEW_EXPR: Too few expressions have been provided."},
+    {1069, "TOK_INVALID_LINE_POSITION: The provided line position is invalid."},
+    {1070, "TOK_UNEXPECTED_OPERATOR: An operator was encountered where it should not be."},
+    {1071, "TOK_EXPRESSION_INCOMPLETE: An expression has not been written fully and therefore is incomplete."},
+    {1072, "TOK_NOT_CONSTANT: "},
+    {1073, "TOK_CONST_STACK_OVERFLOW: An overflow occured whilst pushing a constant to the cache stack."},
+    {1074, "TOK_EXPRESSION_NOT_CONSTANT: "},
+    {1075, "TOK_UNEXPECTED_TOKEN_IN_EXPR: In an expression, a token was encountered that should not be there."},
+    {1076, "TOK_UNEXPECTED_OPERATOR_IN_EXPR: In an expression, an operator was encountered that should not be there."},
+    {1077, "TOK_EXPR_TOO_COMPLEX: The expression is too complex to evaluate, try to split it into multiple expressions."},
+    {1078, "TOK_EXPR_RPN_UNDERFLOW: An underflow occured whilst processing an operator in an expression."},
+    {1079, "TOK_EXPR_RPN_OVERFLOW: An overflow occured whilst processing an operator in an expression."},
+    {1080, "TOK_CONST_EXPR_ERROR: "},
+    {1081, "TOK_ARRINDEX_OUTOF_RANGE: An array was addressed out of its defined range."},
+    {1082, "TOK_VAR_MEMSPACE_OVERFLOW: An overflow occured whilst adding an additional variable (too many variables)."},
+    {1083, "TOK_TOKEN_IS_NOT_SUBROUTINE: A token was encountered that is not a subroutine."},
+    {1084, "TOK_MISSING_COMMA: A token was encountered that is missing a comma."},
+    {1085, "TOK_MISSING_EQUAL: A token was encountered that is missing an equals expression."},
+    {1086, "TOK_MISSING_OPEN_SQUARE_BRACKET: A token was encountered that is missing an open bracked ({)."},
+    {1087, "TOK_UNKNOWN_VARTYPE_INBUILTIN: "},
+    {1088, "TOK_VARIABLE_EXPECTED: A variable was expected but was not found."},
+    {1089, "TOK_INVALID_STRING: The string provided is not valid."},
+    {1090, "TOK_UNEXPECTED_ARRAY: An array handle was provided where it was not expected."},
+    {1091, "TOK_CANNOT_END_IN_ROUTINE_BLOCK: "},
+    {1092, "TOK_BUILTIN_FNC_LHS_NOTALLOWED: A function cannot be assigned to an expression, a variable must be assigned to the return of a function."},
+    {1093, "TOK_FUNCTION_MUST_RETURN_TYPE: "},
+    {1094, "TOK_TOKEN_IS_NOT_FUNCTION: The token encountered is not a valid function."},
+    {1095, "TOK_UNKNOWN_TOKENISER_CMD: "},
+    {1096, "TOK_UNEXPECTED_TOKEN_IN_CMD: There is an unexpected token in the command."},
+    {1097, "TOK_INVALID_TOKENISER_CMD: "},
+    {1098, "TOK_UNKNOWN_TOKENISER_CMDID: "},
+    {1099, "TOK_INVALID_TOKENISER_CMDVAL: "},
+    {1100, "TOK_MISSING_THEN: The expression is missing its 'then' term, e.g. if (var -- 1) then...."},
+    {1101, "TOK_IF_NESTING_OVERFLOW: An overflow occured whilst returning from an IF statement."},
+    {1102, "TOK_IF_NESTING_UNDERFLOW: An underflow occured whilst returning from an IF statement."},
+    {1103, "TOK_OPEN_CODE_BLOCK: "},
+    {1104, "TOK_ROUTINE_LOCATION: "},
+    {1105, "TOK_BLOCK_END_MISMATCH: "},
+    {1106, "TOK_INVALID_EVENT_NUMBER: "},
+    {1107, "TOK_UNKNOWN_EVENTFUNC: "},
+    {1108, "TOK_INCOMPATIBLE_ROUTINE: "},
+    {1109, "TOK_SYNTAX_ERROR: There is a syntax error that prevents the application from being compiled."},
+    {1110, "TOK_UNEXPECTED_BREAK: There is an unexpected break command where it was not expected."},
+    {1111, "TOK_UNEXPECTED_CONTINUE: There is an unexpected continue command where it was not expected."},
+    {1112, "TOK_EXPECTED_TO_OR_DOWNTO: "},
+    {1113, "TOK_EXPECTING_STEP: A 'step' command call was not found when it was expected."},
+    {1114, "TOK_VARINDEX_NOT_ALLOWED: "},
+    {1115, "TOK_LOCAL_SIMPLE_FRAME_OVERFLOW: "},
+    {1116, "TOK_LOCAL_COMPLEX_FRAME_OVERFLOW: "},
+    {1117, "TOK_DIVIDE_BY_0_IN_CONST_EXPR: An attempt to divide by 0 was found in a constant."},
+    {1118, "TOK_EXPECTED_ENDSUB: An 'endsub' command call was not found when it was expected."},
+    {1119, "TOK_EXPECTED_ENDFUNC: An 'endfunc' command call was not found when it was expected."},
+    {1120, "TOK_EXPECTED_EXITSUB: An 'exitsub' command call was not found when it was expected."},
+    {1121, "TOK_EXPECTED_EXITFUNC: An 'exitfunc' command call was not found when it was expected."},
+    {1122, "TOK_MISSING_CASE_ELSE: A 'case else' command call was not found when it was expected."},
+    {1123, "TOK_UNEXPECTED_CASE: An unexpected case command call was found when it was not expected."},
+    {1124, "TOK_RANGE_ERROR: "},
+    {1125, "TOK_ILLEGAL_PRINT_WIDTH: "},
+    {1126, "TOK_DISK_FULL: "},
+    {1127, "TOK_FP_NULL_moved_to_TKS: "},
+    {1128, "TOK_MISSING_CASE_XX: "},
+    {1129, "TOK_ILLEGAL_CASE_RANGE: "},
+    {1130, "TOK_EXPRESSION_NOT_TYPED: "},
+    {1131, "TOK_IS_SUBROUTINE: "},
+    {1132, "TOK_SUBROUTINE_IN_EXPR: "},
+    {1133, "TOK_VALUE_OUT_OF_BOUND: "},
+    {1134, "TOK_UNKNOWN_SYMBOL: "},
+    {1135, "TOK_EMPTY_STRING: "},
+    {1136, "TOK_NOT_BUILTIN_ROUTINE: "},
+    {1137, "TOK_CHANNEL_NOT_ALLOWED: "},
+    {1138, "TOK_UNKNOWN_ERRHANDLER: "},
+    {1139, "TOK_INVALID_FILENAME: "},
+    {1140, "TOK_CANNOT_REOPEN: "},
+    {1141, "TOK_FILEWRITE_TRUNCATED_moved_to_TKS: "},
+    {1142, "TOK_INVALID_APP_PARM: "},
+    {1143, "TOK_NOT_VALID_moved_to_TKS: "},
+    {1144, "TOK_CHANNEL_MISSING: "},
+    {1145, "TOK_CASE_DUPLICATE: There are at least 2 case types with the same match."},
+    {1146, "TOK_FILE_OPEN_ERROR: "},
+    {1147, "TOK_HASH_MISMATCH: "},
+    {1148, "TOK_TO_BE_CODED: "},
+    {1149, "TOK_UNEXPECTED_TOKEN_IN_VARDEC: "},
+    {1150, "TOK_UNEXPECTED_BYXXX: "},
+    {1151, "TOK_NAME_DUPLICATEorCOLLISION: This token name already exists or a CRC collision has occured, please rename the variable and try again."},
+    {1536, "RUN_NONFATAL: A non-fatal runtime error has occured."},
+    {1537, "RUN_INDEX_TOO_LARGE: The array index provided is too large for the array."},
+    {1538, "RUN_DIVIDE_BY_0=An attempt was made to divide a number by 0."},
+    {1539, "RUN_CONTINUE: "},
+    {1540, "RUN_STRING_ODDSIZE: The string provided is an odd size and is not valid."},
+    {1541, "RUN_STRING_TOOLONG: The string provided is too long and is not valid."},
+    {1542, "RUN_INDEX_NEGATIVE: An array cannot have a negative index."},
+    {1543, "RUN_INV_PARM_1: The first parameter supplied to the function is not valid."},
+    {1544, "RUN_INV_PARM_2: The second parameter supplied to the function is not valid."},
+    {1545, "RUN_INV_PARM_3: The third parameter supplied to the function is not valid."},
+    {1546, "RUN_INV_PARM_4: The forth parameter supplied to the function is not valid."},
+    {1547, "RUN_INV_PARM_5: The fifth parameter supplied to the function is not valid."},
+    {1548, "RUN_INV_PARM_6: The sixth parameter supplied to the function is not valid."},
+    {1549, "RUN_INV_PARM_7: The seventh parameter supplied to the function is not valid."},
+    {1550, "RUN_INV_PARM_8: The eigth parameter supplied to the function is not valid."},
+    {1551, "RUN_INV_PARM_9: The ninth parameter supplied to the function is not valid."},
+    {1552, "RUN_INV_PARM_10: The tenth parameter supplied to the function is not valid."},
+    {1553, "RUN_INV_PARM_11: The eleventh parameter supplied to the function is not valid."},
+    {1554, "RUN_INV_PARM_12: The twelth parameter supplied to the function is not valid."},
+    {1555, "RUN_INV_PARM_13: The thirteenth parameter supplied to the function is not valid."},
+    {1556, "RUN_INV_PARM_14: The fourteenth parameter supplied to the function is not valid."},
+    {1557, "RUN_INV_PARM_15: The fifteenth parameter supplied to the function is not valid."},
+    {1558, "RUN_INV_PARM_16: The sixteenth parameter supplied to the function is not valid."},
+    {1664, "RUN_NONFATAL_TAR: There has been a non-fatal error."},
+    {1665, "NON-FATAL TAR ERROR 0x01 (1): There has been a non-fatal error."},
+    {1666, "NON-FATAL TAR ERROR 0x02 (2): There has been a non-fatal error."},
+    {1667, "NON-FATAL TAR ERROR 0x03 (3): There has been a non-fatal error."},
+    {1668, "NON-FATAL TAR ERROR 0x04 (4): There has been a non-fatal error."},
+    {1669, "NON-FATAL TAR ERROR 0x05 (5): There has been a non-fatal error."},
+    {1670, "NON-FATAL TAR ERROR 0x06 (6): There has been a non-fatal error."},
+    {1671, "NON-FATAL TAR ERROR 0x07 (7): There has been a non-fatal error."},
+    {1672, "NON-FATAL TAR ERROR 0x08 (8): There has been a non-fatal error."},
+    {1673, "NON-FATAL TAR ERROR 0x09 (9): There has been a non-fatal error."},
+    {1674, "NON-FATAL TAR ERROR 0x0A (10): There has been a non-fatal error."},
+    {1675, "NON-FATAL TAR ERROR 0x0B (11): There has been a non-fatal error."},
+    {1676, "NON-FATAL TAR ERROR 0x0C (12): There has been a non-fatal error."},
+    {1677, "NON-FATAL TAR ERROR 0x0D (13): There has been a non-fatal error."},
+    {1678, "NON-FATAL TAR ERROR 0x0E (14): There has been a non-fatal error."},
+    {1679, "NON-FATAL TAR ERROR 0x0F (15): There has been a non-fatal error."},
+    {1680, "NON-FATAL TAR ERROR 0x10 (16): There has been a non-fatal error."},
+    {1681, "NON-FATAL TAR ERROR 0x11 (17): There has been a non-fatal error."},
+    {1682, "NON-FATAL TAR ERROR 0x12 (18): There has been a non-fatal error."},
+    {1683, "NON-FATAL TAR ERROR 0x13 (19): There has been a non-fatal error."},
+    {1684, "NON-FATAL TAR ERROR 0x14 (20): There has been a non-fatal error."},
+    {1685, "NON-FATAL TAR ERROR 0x15 (21): There has been a non-fatal error."},
+    {1686, "NON-FATAL TAR ERROR 0x16 (22): There has been a non-fatal error."},
+    {1687, "NON-FATAL TAR ERROR 0x17 (23): There has been a non-fatal error."},
+    {1688, "NON-FATAL TAR ERROR 0x18 (24): There has been a non-fatal error."},
+    {1689, "NON-FATAL TAR ERROR 0x19 (25): There has been a non-fatal error."},
+    {1690, "NON-FATAL TAR ERROR 0x1A (26): There has been a non-fatal error."},
+    {1691, "NON-FATAL TAR ERROR 0x1B (27): There has been a non-fatal error."},
+    {1692, "NON-FATAL TAR ERROR 0x1C (28): There has been a non-fatal error."},
+    {1693, "NON-FATAL TAR ERROR 0x1D (29): There has been a non-fatal error."},
+    {1694, "NON-FATAL TAR ERROR 0x1E (30): There has been a non-fatal error."},
+    {1695, "NON-FATAL TAR ERROR 0x1F (31): There has been a non-fatal error."},
+    {1696, "NON-FATAL TAR ERROR 0x20 (32): There has been a non-fatal error."},
+    {1697, "NON-FATAL TAR ERROR 0x21 (33): There has been a non-fatal error."},
+    {1698, "NON-FATAL TAR ERROR 0x22 (34): There has been a non-fatal error."},
+    {1699, "NON-FATAL TAR ERROR 0x23 (35): There has been a non-fatal error."},
+    {1700, "NON-FATAL TAR ERROR 0x24 (36): There has been a non-fatal error."},
+    {1701, "NON-FATAL TAR ERROR 0x25 (37): There has been a non-fatal error."},
+    {1702, "NON-FATAL TAR ERROR 0x26 (38): There has been a non-fatal error."},
+    {1703, "NON-FATAL TAR ERROR 0x27 (39): There has been a non-fatal error."},
+    {1704, "NON-FATAL TAR ERROR 0x28 (40): There has been a non-fatal error."},
+    {1705, "NON-FATAL TAR ERROR 0x29 (41): There has been a non-fatal error."},
+    {1706, "NON-FATAL TAR ERROR 0x2A (42): There has been a non-fatal error."},
+    {1707, "NON-FATAL TAR ERROR 0x2B (43): There has been a non-fatal error."},
+    {1708, "NON-FATAL TAR ERROR 0x2C (44): There has been a non-fatal error."},
+    {1709, "NON-FATAL TAR ERROR 0x2D (45): There has been a non-fatal error."},
+    {1710, "NON-FATAL TAR ERROR 0x2E (46): There has been a non-fatal error."},
+    {1711, "NON-FATAL TAR ERROR 0x2F (47): There has been a non-fatal error."},
+    {1712, "NON-FATAL TAR ERROR 0x30 (48): There has been a non-fatal error."},
+    {1713, "NON-FATAL TAR ERROR 0x31 (49): There has been a non-fatal error."},
+    {1714, "NON-FATAL TAR ERROR 0x32 (50): There has been a non-fatal error."},
+    {1715, "NON-FATAL TAR ERROR 0x33 (51): There has been a non-fatal error."},
+    {1716, "NON-FATAL TAR ERROR 0x34 (52): There has been a non-fatal error."},
+    {1717, "NON-FATAL TAR ERROR 0x35 (53): There has been a non-fatal error."},
+    {1718, "NON-FATAL TAR ERROR 0x36 (54): There has been a non-fatal error."},
+    {1719, "NON-FATAL TAR ERROR 0x37 (55): There has been a non-fatal error."},
+    {1720, "NON-FATAL TAR ERROR 0x38 (56): There has been a non-fatal error."},
+    {1721, "NON-FATAL TAR ERROR 0x39 (57): There has been a non-fatal error."},
+    {1722, "NON-FATAL TAR ERROR 0x3A (58): There has been a non-fatal error."},
+    {1723, "NON-FATAL TAR ERROR 0x3B (59): There has been a non-fatal error."},
+    {1724, "NON-FATAL TAR ERROR 0x3C (60): There has been a non-fatal error."},
+    {1725, "NON-FATAL TAR ERROR 0x3D (61): There has been a non-fatal error."},
+    {1726, "NON-FATAL TAR ERROR 0x3E (62): There has been a non-fatal error."},
+    {1727, "NON-FATAL TAR ERROR 0x3F (63): There has been a non-fatal error."},
+    {1728, "NON-FATAL TAR ERROR 0x40 (64): There has been a non-fatal error."},
+    {1729, "NON-FATAL TAR ERROR 0x41 (65): There has been a non-fatal error."},
+    {1730, "NON-FATAL TAR ERROR 0x42 (66): There has been a non-fatal error."},
+    {1731, "NON-FATAL TAR ERROR 0x43 (67): There has been a non-fatal error."},
+    {1732, "NON-FATAL TAR ERROR 0x44 (68): There has been a non-fatal error."},
+    {1733, "NON-FATAL TAR ERROR 0x45 (69): There has been a non-fatal error."},
+    {1734, "NON-FATAL TAR ERROR 0x46 (70): There has been a non-fatal error."},
+    {1735, "NON-FATAL TAR ERROR 0x47 (71): There has been a non-fatal error."},
+    {1736, "NON-FATAL TAR ERROR 0x48 (72): There has been a non-fatal error."},
+    {1737, "NON-FATAL TAR ERROR 0x49 (73): There has been a non-fatal error."},
+    {1738, "NON-FATAL TAR ERROR 0x4A (74): There has been a non-fatal error."},
+    {1739, "NON-FATAL TAR ERROR 0x4B (75): There has been a non-fatal error."},
+    {1740, "NON-FATAL TAR ERROR 0x4C (76): There has been a non-fatal error."},
+    {1741, "NON-FATAL TAR ERROR 0x4D (77): There has been a non-fatal error."},
+    {1742, "NON-FATAL TAR ERROR 0x4E (78): There has been a non-fatal error."},
+    {1743, "NON-FATAL TAR ERROR 0x4F (79): There has been a non-fatal error."},
+    {1744, "NON-FATAL TAR ERROR 0x50 (80): There has been a non-fatal error."},
+    {1745, "NON-FATAL TAR ERROR 0x51 (81): There has been a non-fatal error."},
+    {1746, "NON-FATAL TAR ERROR 0x52 (82): There has been a non-fatal error."},
+    {1747, "NON-FATAL TAR ERROR 0x53 (83): There has been a non-fatal error."},
+    {1748, "NON-FATAL TAR ERROR 0x54 (84): There has been a non-fatal error."},
+    {1749, "NON-FATAL TAR ERROR 0x55 (85): There has been a non-fatal error."},
+    {1750, "NON-FATAL TAR ERROR 0x56 (86): There has been a non-fatal error."},
+    {1751, "NON-FATAL TAR ERROR 0x57 (87): There has been a non-fatal error."},
+    {1752, "NON-FATAL TAR ERROR 0x58 (88): There has been a non-fatal error."},
+    {1753, "NON-FATAL TAR ERROR 0x59 (89): There has been a non-fatal error."},
+    {1754, "NON-FATAL TAR ERROR 0x5A (90): There has been a non-fatal error."},
+    {1755, "NON-FATAL TAR ERROR 0x5B (91): There has been a non-fatal error."},
+    {1756, "NON-FATAL TAR ERROR 0x5C (92): There has been a non-fatal error."},
+    {1757, "NON-FATAL TAR ERROR 0x5D (93): There has been a non-fatal error."},
+    {1758, "NON-FATAL TAR ERROR 0x5E (94): There has been a non-fatal error."},
+    {1759, "NON-FATAL TAR ERROR 0x5F (95): There has been a non-fatal error."},
+    {1760, "NON-FATAL TAR ERROR 0x60 (96) CORE_START: There has been a non-fatal error with the core start module."},
+    {1761, "NON-FATAL TAR ERROR 0x61 (97) STRING_DEESCAPE: There has been a non-fatal error whilst deescaping a string."},
+    {1762, "NON-FATAL TAR ERROR 0x62 (98) OUT_OF_RANGE: There has been a non-fatal error (out of range)."},
+    {1763, "NON-FATAL TAR ERROR 0x63 (99) INCORRECT_MODE: There has been a non-fatal error, the device is in the wrong mode."},
+    {1764, "NON-FATAL TAR ERROR 0x64 (100) OUT_OF_MEMORY: There has been a non-fatal error, the device is out of memory."},
+    {1765, "NON-FATAL TAR ERROR 0x65 (101) NOT_IMPLEMENTED: There has been a non-fatal error, the function used is not implemented."},
+    {1766, "NON-FATAL TAR ERROR 0x66 (102) TABLE_FULL: There has been a non-fatal error, the table is full and cannot accept more entries."},
+    {1767, "NON-FATAL TAR ERROR 0x67 (103) RESOURCE_UNAVAILABLE: There has been a non-fatal error, the resource is currently unavailable."},
+    {1768, "NON-FATAL TAR ERROR 0x68 (104) STRING_FAIL: There has been a non-fatal error whilst creating a string."},
+    {1769, "NON-FATAL TAR ERROR 0x69 (105) INVALID_TIMER: There has been a non-fatal error, the timer used is invalid."},
+    {1770, "NON-FATAL TAR ERROR 0x6A (106) INVALID_INTERVAL: There has been a non-fatal error, the interval set for a timer is invalid."},
+    {1771, "NON-FATAL TAR ERROR 0x6B (107) SHAREMEM_ACCESS: There has been a non-fatal error whilst accessing shared memory."},
+    {1772, "NON-FATAL TAR ERROR 0x6C (108) UART_NOT_OPEN: There has been a non-fatal error, the UART is not open."},
+    {1773, "NON-FATAL TAR ERROR 0x6D (109) UART_MATCH_ERROR: There has been a non-fatal error whilst matching characters with data received from the UART."},
+    {1774, "NON-FATAL TAR ERROR 0x6E (110) TIMER_NOTSTARTED: There has been a non-fatal error, a timer has not started."},
+    {1775, "NON-FATAL TAR ERROR 0x6F (111) STRING_DEHEX: There has been a non-fatal error whilst dehexing a string."},
+    {1776, "NON-FATAL TAR ERROR 0x70 (112): There has been a non-fatal error."},
+    {1777, "NON-FATAL TAR ERROR 0x71 (113): There has been a non-fatal error."},
+    {1778, "NON-FATAL TAR ERROR 0x72 (114): There has been a non-fatal error."},
+    {1779, "NON-FATAL TAR ERROR 0x73 (115): There has been a non-fatal error."},
+    {1780, "NON-FATAL TAR ERROR 0x74 (116): There has been a non-fatal error."},
+    {1781, "NON-FATAL TAR ERROR 0x75 (117): There has been a non-fatal error."},
+    {1782, "NON-FATAL TAR ERROR 0x76 (118): There has been a non-fatal error."},
+    {1783, "NON-FATAL TAR ERROR 0x77 (119): There has been a non-fatal error."},
+    {1784, "NON-FATAL TAR ERROR 0x78 (120): There has been a non-fatal error."},
+    {1785, "NON-FATAL TAR ERROR 0x79 (121): There has been a non-fatal error."},
+    {1786, "NON-FATAL TAR ERROR 0x7A (122): There has been a non-fatal error."},
+    {1787, "NON-FATAL TAR ERROR 0x7B (123): There has been a non-fatal error."},
+    {1788, "NON-FATAL TAR ERROR 0x7C (124): There has been a non-fatal error."},
+    {1789, "NON-FATAL TAR ERROR 0x7D (125): There has been a non-fatal error."},
+    {1790, "NON-FATAL TAR ERROR 0x7E (126): There has been a non-fatal error."},
+    {1791, "NON-FATAL TAR ERROR 0x7F (127): There has been a non-fatal error."},
+    {1792, "RUN_FATAL: A fatal run error has occured."},
+    {1793, "RUN_END: The application has finished executing."},
+    {1794, "RUN_STOP: The application has been stopped."},
+    {1795, "RUN_BREAKPOINT: A breakpoint in the application has been encountered and program execution is paused."},
+    {1796, "RUN_UNDEFINED_PCODE: An undefined PCode was encountered whilst running the application."},
+    {1797, "RUN_NOT_DIRECT_ADDRESSABLE: An attempt was made to directly access memory which is not allowed."},
+    {1798, "RUN_INVALID_CONTEXT: "},
+    {1799, "RUN_CORRUPT_FILE: The specified file cannot run because it is corrupt."},
+    {1800, "RUN_UNKNOWN_VAR_TYPE: The variable type is not known."},
+    {1801, "RUN_UNKNOWN_VAR_SPACE: "},
+    {1802, "RUN_INVALID_VAR_OFFSET: "},
+    {1803, "RUN_SUPERSPACE_MISSING: "},
+    {1804, "RUN_VERSION_MISMATCH: There is a version mismatch between the file try to execute and the firmware version, please recompile and download this program to the device using the correct XCompiler."},
+    {1805, "RUN_NOGLOBALS_TO_PROMOTE: "},
+    {1806, "RUN_SIMPLESTACK_OVERFLOW: An overflow occured whilst running the application."},
+    {1807, "RUN_SIMPLESTACK_UNDERFLOW: An underflow occured whilst running the application."},
+    {1808, "RUN_COMPLEXSTACK_OVERFLOW: An overflow occured whilst running the application."},
+    {1809, "RUN_COMPLEXSTACK_UNDERFLOW: An underflow occured whilst running the application."},
+    {1810, "RUN_CANNOT_DEREFERENCE: "},
+    {1811, "RUN_USER_RTN_NEST_OVERFLOW: An overflow occured whilst returning from a function."},
+    {1812, "RUN_USER_RTN_NEST_UNDERFLOW: An underflow occured whilst returning from a function."},
+    {1813, "RUN_SIMPLE_LOCALFRAME_OVERFLOW: "},
+    {1814, "RUN_COMPLEX_LOCALFRAME_OVERFLOW: "},
+    {1815, "RUN_TYPE_MISMATCH: "},
+    {1816, "RUN_REFTYPE_EXPECTED: "},
+    {1817, "RUN_UNKNOWN_OPERATION: "},
+    {1818, "RUN_UNTESTED_PCODE: The PCODE used here has not been tested."},
+    {1819, "RUN_CANNOT_RESUME: Execution cannot resume from this point."},
+    {1820, "RUN_CACHE_FAIL: There is a problem reading data from the cache."},
+    {1821, "RUN_FILE_READ_ERROR: An error was encountered whilst the file was being read."},
+    {1822, "RUN_ABORTED_FILE: The file is empty, too large or was marked as aborted."},
+    {1823, "RUN_UNEXPECTED_END: The file unexpectidly ended before an end was expected."},
+    {1824, "RUN_TOCODE: "},
+    {1825, "RUN_RUNSCRIPT_not_used_anymore: "},
+    {1826, "RUN_CANNOT_NEST_RUNSCRIPT: "},
+    {1827, "RUN_MEMACCESS_EXCEPTION: There was an exception trying to access a part of memory."},
+    {1828, "RUN_AUTORUN_ERROR: There is an error with the autorun script, which has not executed."},
+    {1829, "RUN_INVALID_TIMER: "},
+    {1830, "RUN_RUNSCRIPT_BLOCK: "},
+    {1831, "RUN_RUNSCRIPT_ASYNC: "},
+    {1832, "RUN_SCRIPT_ASYNC_NOFILE: "},
+    {1833, "RUN_APPID_INVALID: The application ID of a sub-file is not valid."},
+    {1834, "RUN_SINGLE_APP_ONLY: "},
+    {1835, "RUN_APP_CONTEXT_BUSY: "},
+    {1836, "RUN_NOT_PARENTAPP: "},
+    {1837, "RUN_RESOURCE_FAIL: "},
+    {1838, "RUN_FACTORY_CLONE_FAIL: "},
+    {1839, "RUN_RUNASYNC_DISABLED: "},
+    {1840, "RUN_RUNASYNC_KILLED: "},
+    {1841, "RUN_FUNC_DISABLED: "},
+    {1842, "RUN_ILLEGAL_LOGCHAN: "},
+    {1843, "RUN_INV_MSG_QUEUE: "},
+    {1844, "RUN_INV_MSG_ID: "},
+    {1845, "RUN_NO_MSG_HANDLER: "},
+    {1846, "RUN_MSGQUEUE_FULL: "},
+    {1847, "RUN_NO_SPI_HANDLES: "},
+    {1848, "RUN_INV_SPI_PIO: "},
+    {1849, "RUN_INV_SPI_MODE: "},
+    {1850, "RUN_INV_SPI_HANDLE: "},
+    {1851, "RUN_INV_SPI_IOCTL: "},
+    {1852, "RUN_NO_FREE_HANDLES: "},
+    {1853, "RUN_INV_CIRCBUF_HANDLE: "},
+    {1854, "RUN_COMPILER_MISMATCH: There is a mismatch between the compiler used to generate this script and the firmware version, please recompile the application using the correct XCompiler."},
+    {1855, "RUN_INV_ADC_RESOLUTION: The supplied ADC resolution is not valid."},
+    {1856, "RUN_INV_ADC_ACQUIRE_TIME: The supplied ADC acquisition time is not valid."},
+    {1919, "RUN_COMPILER_MISMATCH: There is a mismatch between the compiler used to generate this script and the firmware version, please recompile the application using the correct XCompiler."},
+    {1920, "RUN_FATAL_TAR: There has been a fatal error."},
+    {1921, "FATAL TAR ERROR = 0x01 (1): There has been a fatal error."},
+    {1922, "FATAL TAR ERROR = 0x02 (2): There has been a fatal error."},
+    {1923, "FATAL TAR ERROR = 0x03 (3): There has been a fatal error."},
+    {1924, "FATAL TAR ERROR = 0x04 (4): There has been a fatal error."},
+    {1925, "FATAL TAR ERROR = 0x05 (5): There has been a fatal error."},
+    {1926, "FATAL TAR ERROR = 0x06 (6): There has been a fatal error."},
+    {1927, "FATAL TAR ERROR = 0x07 (7): There has been a fatal error."},
+    {1928, "FATAL TAR ERROR = 0x08 (8): There has been a fatal error."},
+    {1929, "FATAL TAR ERROR = 0x09 (9): There has been a fatal error."},
+    {1930, "FATAL TAR ERROR = 0x0A (10): There has been a fatal error."},
+    {1931, "FATAL TAR ERROR = 0x0B (11): There has been a fatal error."},
+    {1932, "FATAL TAR ERROR = 0x0C (12): There has been a fatal error."},
+    {1933, "FATAL TAR ERROR = 0x0D (13): There has been a fatal error."},
+    {1934, "FATAL TAR ERROR = 0x0E (14): There has been a fatal error."},
+    {1935, "FATAL TAR ERROR = 0x0F (15): There has been a fatal error."},
+    {1936, "FATAL TAR ERROR = 0x10 (16): There has been a fatal error."},
+    {1937, "FATAL TAR ERROR = 0x11 (17): There has been a fatal error."},
+    {1938, "FATAL TAR ERROR = 0x12 (18): There has been a fatal error."},
+    {1939, "FATAL TAR ERROR = 0x13 (19): There has been a fatal error."},
+    {1940, "FATAL TAR ERROR = 0x14 (20): There has been a fatal error."},
+    {1941, "FATAL TAR ERROR = 0x15 (21): There has been a fatal error."},
+    {1942, "FATAL TAR ERROR = 0x16 (22): There has been a fatal error."},
+    {1943, "FATAL TAR ERROR = 0x17 (23): There has been a fatal error."},
+    {1944, "FATAL TAR ERROR = 0x18 (24): There has been a fatal error."},
+    {1945, "FATAL TAR ERROR = 0x19 (25): There has been a fatal error."},
+    {1946, "FATAL TAR ERROR = 0x1A (26): There has been a fatal error."},
+    {1947, "FATAL TAR ERROR = 0x1B (27): There has been a fatal error."},
+    {1948, "FATAL TAR ERROR = 0x1C (28): There has been a fatal error."},
+    {1949, "FATAL TAR ERROR = 0x1D (29): There has been a fatal error."},
+    {1950, "FATAL TAR ERROR = 0x1E (30): There has been a fatal error."},
+    {1951, "FATAL TAR ERROR = 0x1F (31): There has been a fatal error."},
+    {1952, "FATAL TAR ERROR = 0x20 (32): There has been a fatal error."},
+    {1953, "FATAL TAR ERROR = 0x21 (33): There has been a fatal error."},
+    {1954, "FATAL TAR ERROR = 0x22 (34): There has been a fatal error."},
+    {1955, "FATAL TAR ERROR = 0x23 (35): There has been a fatal error."},
+    {1956, "FATAL TAR ERROR = 0x24 (36): There has been a fatal error."},
+    {1957, "FATAL TAR ERROR = 0x25 (37): There has been a fatal error."},
+    {1958, "FATAL TAR ERROR = 0x26 (38): There has been a fatal error."},
+    {1959, "FATAL TAR ERROR = 0x27 (39): There has been a fatal error."},
+    {1960, "FATAL TAR ERROR = 0x28 (40): There has been a fatal error."},
+    {1961, "FATAL TAR ERROR = 0x29 (41): There has been a fatal error."},
+    {1962, "FATAL TAR ERROR = 0x2A (42): There has been a fatal error."},
+    {1963, "FATAL TAR ERROR = 0x2B (43): There has been a fatal error."},
+    {1964, "FATAL TAR ERROR = 0x2C (44): There has been a fatal error."},
+    {1965, "FATAL TAR ERROR = 0x2D (45): There has been a fatal error."},
+    {1966, "FATAL TAR ERROR = 0x2E (46): There has been a fatal error."},
+    {1967, "FATAL TAR ERROR = 0x2F (47): There has been a fatal error."},
+    {1968, "FATAL TAR ERROR = 0x30 (48): There has been a fatal error."},
+    {1969, "FATAL TAR ERROR = 0x31 (49): There has been a fatal error."},
+    {1970, "FATAL TAR ERROR = 0x32 (50): There has been a fatal error."},
+    {1971, "FATAL TAR ERROR = 0x33 (51): There has been a fatal error."},
+    {1972, "FATAL TAR ERROR = 0x34 (52): There has been a fatal error."},
+    {1973, "FATAL TAR ERROR = 0x35 (53): There has been a fatal error."},
+    {1974, "FATAL TAR ERROR = 0x36 (54): There has been a fatal error."},
+    {1975, "FATAL TAR ERROR = 0x37 (55): There has been a fatal error."},
+    {1976, "FATAL TAR ERROR = 0x38 (56): There has been a fatal error."},
+    {1977, "FATAL TAR ERROR = 0x39 (57): There has been a fatal error."},
+    {1978, "FATAL TAR ERROR = 0x3A (58): There has been a fatal error."},
+    {1979, "FATAL TAR ERROR = 0x3B (59): There has been a fatal error."},
+    {1980, "FATAL TAR ERROR = 0x3C (60): There has been a fatal error."},
+    {1981, "FATAL TAR ERROR = 0x3D (61): There has been a fatal error."},
+    {1982, "FATAL TAR ERROR = 0x3E (62): There has been a fatal error."},
+    {1983, "FATAL TAR ERROR = 0x3F (63): There has been a fatal error."},
+    {1984, "FATAL TAR ERROR = 0x40 (64): There has been a fatal error."},
+    {1985, "FATAL TAR ERROR = 0x41 (65): There has been a fatal error."},
+    {1986, "FATAL TAR ERROR = 0x42 (66): There has been a fatal error."},
+    {1987, "FATAL TAR ERROR = 0x43 (67): There has been a fatal error."},
+    {1988, "FATAL TAR ERROR = 0x44 (68): There has been a fatal error."},
+    {1989, "FATAL TAR ERROR = 0x45 (69): There has been a fatal error."},
+    {1990, "FATAL TAR ERROR = 0x46 (70): There has been a fatal error."},
+    {1991, "FATAL TAR ERROR = 0x47 (71): There has been a fatal error."},
+    {1992, "FATAL TAR ERROR = 0x48 (72): There has been a fatal error."},
+    {1993, "FATAL TAR ERROR = 0x49 (73): There has been a fatal error."},
+    {1994, "FATAL TAR ERROR = 0x4A (74): There has been a fatal error."},
+    {1995, "FATAL TAR ERROR = 0x4B (75): There has been a fatal error."},
+    {1996, "FATAL TAR ERROR = 0x4C (76): There has been a fatal error."},
+    {1997, "FATAL TAR ERROR = 0x4D (77): There has been a fatal error."},
+    {1998, "FATAL TAR ERROR = 0x4E (78): There has been a fatal error."},
+    {1999, "FATAL TAR ERROR = 0x4F (79): There has been a fatal error."},
+    {2000, "FATAL TAR ERROR = 0x50 (80): There has been a fatal error."},
+    {2001, "FATAL TAR ERROR = 0x51 (81): There has been a fatal error."},
+    {2002, "FATAL TAR ERROR = 0x52 (82): There has been a fatal error."},
+    {2003, "FATAL TAR ERROR = 0x53 (83): There has been a fatal error."},
+    {2004, "FATAL TAR ERROR = 0x54 (84): There has been a fatal error."},
+    {2005, "FATAL TAR ERROR = 0x55 (85): There has been a fatal error."},
+    {2006, "FATAL TAR ERROR = 0x56 (86): There has been a fatal error."},
+    {2007, "FATAL TAR ERROR = 0x57 (87): There has been a fatal error."},
+    {2008, "FATAL TAR ERROR = 0x58 (88): There has been a fatal error."},
+    {2009, "FATAL TAR ERROR = 0x59 (89): There has been a fatal error."},
+    {2010, "FATAL TAR ERROR = 0x5A (90): There has been a fatal error."},
+    {2011, "FATAL TAR ERROR = 0x5B (91): There has been a fatal error."},
+    {2012, "FATAL TAR ERROR = 0x5C (92): There has been a fatal error."},
+    {2013, "FATAL TAR ERROR = 0x5D (93): There has been a fatal error."},
+    {2014, "FATAL TAR ERROR = 0x5E (94): There has been a fatal error."},
+    {2015, "FATAL TAR ERROR = 0x5F (95): There has been a fatal error."},
+    {2016, "FATAL TAR ERROR = 0x60 (96): There has been a fatal error."},
+    {2017, "FATAL TAR ERROR = 0x61 (97): There has been a fatal error."},
+    {2018, "FATAL TAR ERROR = 0x62 (98): There has been a fatal error."},
+    {2019, "FATAL TAR ERROR = 0x63 (99): There has been a fatal error."},
+    {2020, "FATAL TAR ERROR = 0x64 (100): There has been a fatal error."},
+    {2021, "FATAL TAR ERROR = 0x65 (101): There has been a fatal error."},
+    {2022, "FATAL TAR ERROR = 0x66 (102): There has been a fatal error."},
+    {2023, "FATAL TAR ERROR = 0x67 (103): There has been a fatal error."},
+    {2024, "FATAL TAR ERROR = 0x68 (104): There has been a fatal error."},
+    {2025, "FATAL TAR ERROR = 0x69 (105): There has been a fatal error."},
+    {2026, "FATAL TAR ERROR = 0x6A (106): There has been a fatal error."},
+    {2027, "FATAL TAR ERROR = 0x6B (107): There has been a fatal error."},
+    {2028, "FATAL TAR ERROR = 0x6C (108): There has been a fatal error."},
+    {2029, "FATAL TAR ERROR = 0x6D (109): There has been a fatal error."},
+    {2030, "FATAL TAR ERROR = 0x6E (110): There has been a fatal error."},
+    {2031, "FATAL TAR ERROR = 0x6F (111): There has been a fatal error."},
+    {2032, "FATAL TAR ERROR = 0x70 (112): There has been a fatal error."},
+    {2033, "FATAL TAR ERROR = 0x71 (113): There has been a fatal error."},
+    {2034, "FATAL TAR ERROR = 0x72 (114): There has been a fatal error."},
+    {2035, "FATAL TAR ERROR = 0x73 (115): There has been a fatal error."},
+    {2036, "FATAL TAR ERROR = 0x74 (116): There has been a fatal error."},
+    {2037, "FATAL TAR ERROR = 0x75 (117): There has been a fatal error."},
+    {2038, "FATAL TAR ERROR = 0x76 (118): There has been a fatal error."},
+    {2039, "FATAL TAR ERROR = 0x77 (119): There has been a fatal error."},
+    {2040, "FATAL TAR ERROR = 0x78 (120): There has been a fatal error."},
+    {2041, "FATAL TAR ERROR = 0x79 (121): There has been a fatal error."},
+    {2042, "FATAL TAR ERROR = 0x7A (122): There has been a fatal error."},
+    {2043, "FATAL TAR ERROR = 0x7B (123): There has been a fatal error."},
+    {2044, "FATAL TAR ERROR = 0x7C (124): There has been a fatal error."},
+    {2045, "FATAL TAR ERROR = 0x7D (125): There has been a fatal error."},
+    {2046, "FATAL TAR ERROR = 0x7E (126): There has been a fatal error."},
+    {2047, "FATAL TAR ERROR = 0x7F (127): There has been a fatal error."},
+    {4096, "CFG_READ_ERROR: There was an error whilst trying to read a configuration key."},
+    {4097, "CFG_UNKNOWN_KEY: The specified configuration key is not valid."},
+    {4098, "CFG_RECORD_TOO_SMALL: "},
+    {4099, "CFG_RECORD_TOO_BIG: "},
+    {4100, "CFG_INVALID_USER_KEY: The specified user configuration key is not valid."},
+    {4101, "CFG_NOT_PARSING_CONFIG: "},
+    {4102, "CFG_INV_LOG_KEYTYPE: There is a problem with the configuration database."},
+    {4103, "CFG_INV_LOG_KEYID: "},
+    {4104, "CFG_INV_LOG_SEGMENT: "},
+    {4105, "CFG_NO_ACCESS_RIGHTS: "},
+    {4106, "CFG_KEY_MISMATCH: "},
+    {4107, "CFG_INV_PARAMETER: "},
+    {4108, "CFG_PSWD_FAIL: "},
+    {4608, "STR_EMPTY: The provided string is empty, configuration keys do not allow empty strings."},
+    {4609, "STR_SIZE_LIMIT: "},
+    {5376, "TKN_UNTERMINATED_STRING: A quote () was provided as the start of a string, but no end quote mark was found."},
+    {5377, "TKN_UNEXPECTED_WHITESPACE_IN_CONST: "},
+    {5378, "TKN_INVALID_CONSTANT_CHAR: "},
+    {5379, "TKN_CONSTANT_TOO_BIG: The provided constant in a string is too large to be converted to an integer."},
+    {5380, "TKN_END_OF_LINE: The end of a line was encountered when a constant was expected."},
+    {5381, "TKN_UNEXPECTED_WHITESPACE: There was unexpected whitespace detected in a string."},
+    {5632, "UWL_TYPE_MISMATCH: "},
+    {5633, "UWL_UNKNOWN_VAR_TYPE: "},
+    {5634, "UWL_UNKNOWN_VAR_SPACE: "},
+    {5888, "IMM_INCOMPLETE_COMMAND: "},
+    {5889, "IMM_PARM_NOT_STRING: "},
+    {5890, "IMM_UNEXPECTED_ARGS: "},
+    {5891, "IMM_PARM_NOT_INTEGER: "},
+    {5892, "IMM_UNEXPECTED_TOKEN: "},
+    {5893, "IMM_CONSTANT_NOT_WORD: "},
+    {5894, "IMM_OUTPUT_FILE_EXISTS: "},
+    {5895, "IMM_SOURCE_FILE_MISSING: "},
+    {5896, "IMM_RUNCONTEXT_FAIL: "},
+    {5897, "IMM_SVAR_ARGx_MISSING: "},
+    {5898, "IMM_INVALID_NVR_TYPE: "},
+    {5899, "IMM_INVALID_NVR_KEY: "},
+    {5900, "IMM_INV_PSWRD_TYPE: "},
+    {5901, "IMM_CMD_UNAVIALABLE: "},
+    {5902, "IMM_INV_KEY_TYPE: "},
+    {5903, "IMM_KEYTYPE_EXPECTED: "},
+    {5904, "IMM_UNEXPECTED_PARM: "},
+    {5905, "IMM_INV_STRING: "},
+    {5906, "IMM_WRITEONLY: "},
+    {5907, "IMM_KEY_PROTECTED: "},
+    {5908, "IMM_INVALID_DICTIONARYID: "},
+    {5909, "IMM_INVALID_DICTIONARY_KEY: "},
+    {5910, "IMM_INVALID_WORM_KEY: "},
+    {5936, "IMM_FUNC_UNAVAILABLE: "},
+    {6144, "FSA_FILENAME_INVALID_CHR: There is an invalid character in the specified filename."},
+    {6145, "FSA_FILENAME_EMPTY: The filename provided is empty."},
+    {6146, "FSA_FILENAME_UNTERMINATED: The filename provided did not have a closing quote ()."},
+    {6147, "FSA_FILENAME_TOO_LONG: The provided filename is too long to be stored, use a shorter filename."},
+    {6148, "FSA_OPENMODE_NOTALLOWED: The provided open file type is not valid."},
+    {6149, "FSA_MEDIA_FULL: "},
+    {6150, "FSA_OPEN_FAIL: There was an error whilst attempting to open a file on the device."},
+    {6151, "FSA_ERASE_FAIL: There was an error whilst attempting to erase a file from the device, the file may be locked or in use, append a plug (+) on the end to forcefully delete the file."},
+    {6152, "FSA_NO_FREE_HANDLES: There was an error whilst opening the specified file becasue there are no free file handles available."},
+    {6153, "FSA_FAIL_OPENFILE: There was an error whilst opening the specified file, it might already be open or in use."},
+    {6154, "FSA_FILE_MISSING: The specified file does not exist."},
+    {6155, "FSA_FFS_FULL: "},
+    {6156, "FSA_RENAME_ERROR: There was an error whilst attempting to rename a file, the filename might already exist or the file might be locked."},
+    {6157, "FSA_FAT_FULL: The filesystem on the device is full and there is no space for the operation to complete."},
+    {6158, "FSA_FILE_CORRUPT: The specified file is corrupt and cannot be successfully read or written."},
+    {6159, "FSA_SEEK_ERROR: There was an error trying to seek to the specified position in the file."},
+    {6160, "FSA_TELL_ERROR: "},
+    {6161, "FSA_INVALID_FILEHANDLE: A provided file handle is not valid."},
+    {6400, "NVO_NO_ANCHOR: "},
+    {6401, "NVO_SECTOR_FULL: This non-volotile sector is full."},
+    {6402, "NVO_INVALID_SEGMENT: The specified non-volotile segment does not exist."},
+    {6403, "NVO_DELETED_OBJECT_ACCESS: "},
+    {6404, "NVO_NO_MORE_CHILDREN: "},
+    {6405, "NVO_NO_MORE_SIBLINGS: "},
+    {6406, "NVO_NO_MORE_CHANGED: "},
+    {6407, "NVO_ORPHANED: "},
+    {6408, "NVO_SEARCH_FAIL: No match was found in the non-volotile storage."},
+    {6409, "NVO_LINK_NOT_EMPTY: The link in the non-volotile storage is not empty."},
+    {6410, "NVO_FIRST_FILEDATA_MISSING: "},
+    {6411, "NVO_CHANGE_NOT_ALLOWED: The specified non-volotile sector cannot be changed."},
+    {6412, "NVO_WRITEOPEN_TOOMANY: There are too many non-volotile storage file handles open."},
+    {6413, "NVO_OPEN_TOOMANY: There are too many non-volotile storage file handles open."},
+    {6414, "NVO_FILE_EXISTS: A file with this name already exists and cannot be opened for writing."},
+    {6415, "NVO_TAGTYPE_MISMATCH: "},
+    {6416, "NVO_FILE_MISSING: The specified file does not exist."},
+    {6417, "NVO_INVALID_FILE_HANDLE: The specified file handle is not valid."},
+    {6418, "NVO_FILE_NOTOPEN: The specified file in the non-volotile storage system is not open."},
+    {6419, "NVO_FILE_READOPEN: The specified data cannot be written as the file is open for reading only."},
+    {6420, "NVO_FILE_POS_ERROR: The specified position in the file does not exist."},
+    {6421, "NVO_FILE_TOO_BIG: The specified file is too big , the data has not been written."},
+    {6422, "NVO_FILE_CORRUPT: The specified file is corrupt and cannot be read or written."},
+    {6423, "NVO_OPEN_FOR_WRITE: The specified file is already open for writing and cannot be opened for reading."},
+    {6424, "NVO_OBJECT_MISSING: "},
+    {6425, "NVO_END_OF_OBJECT: "},
+    {6426, "NVO_INV_CONFIG_ITEM_ID: "},
+    {6427, "NVO_NO_CONFIG_ITEM_ID: "},
+    {6428, "NVO_UNEXPECTED_TAGID: "},
+    {6429, "NVO_CONFIG_ITEM_CREATE_FAIL: "},
+    {6430, "NVO_CONFIG_ITEM_TOO_BIG: "},
+    {6431, "NVO_SEGMENT_CORRUPT: This segment of non-volotile storage is corrupt."},
+    {6432, "NVO_SEGMENT_FULL: "},
+    {6433, "NVO_LOC_NOT_FREE: Unable to write to this location as it is not free."},
+    {6434, "NVO_NOT_FIRST_CHILD: The provided address is not the first child."},
+    {6435, "NVO_NVHEAP_SIZE_INVALID: "},
+    {6436, "NVO_NVHEAP_INVALID_ID: "},
+    {6437, "NVO_NVHEAP_NOFREE_BLOCKS: "},
+    {6438, "NVO_NVHEAP_SEGMENT_FULL: "},
+    {6439, "NVO_NVHEAP_BUSY: "},
+    {6440, "NVO_NVWORM_INVALID_ID: The provided WORM ID is not valid."},
+    {6441, "NVO_NVWORM_TOO_BIG: The provided WORM size is too large."},
+    {6442, "NVO_NVWORM_EXISTS: The WORM segment already exists and cannot be re-created."},
+    {6443, "NVO_NVWORM_SEGMENT_FULL: There is insufficient space remainging in the WORM for this operation."},
+    {6444, "NVO_NVWORM_SIZE_INVALID: The size of the WORM segment is not valid."},
+    {6445, "NVO_CONFIG_CORRUPT: The specified configuration key is corrupt."},
+    {6446, "NVO_CONFIG_ITEM_ILLEGAL: The configuration item ID provided is not valid."},
+    {6447, "NVO_FATSEGMENT_FULL: The file-system is full, therefore there is no space to create new files."},
+    {6448, "NVO_SEQFILE_CORRUPT: "},
+    {6449, "NVO_SEQFILE_ILLEGAL_LEN: "},
+    {6450, "NVO_INVALID_STATE: "},
+    {6451, "NVO_INVALID_DICTIONARYID: "},
+    {6529, "NVOSF_SEGMENT_FULL: "},
+    {6530, "NVOSF_FILEID_EXHAUSTED: "},
+    {6531, "NVOSF_NOFREE_HANDLES: "},
+    {6532, "NVOSF_BLOCK_WRITE_FAIL: "},
+    {6533, "NVOSF_FILE_EXISTS: "},
+    {6534, "NVOSF_INVALID_FILETYPE: "},
+    {6535, "NVOSF_INVALID_HANDLE: "},
+    {6536, "NVOSF_FILE_NOT_OPEN: "},
+    {6537, "NVOSF_NULL_POINTER: "},
+    {6538, "NVOSF_FILE_MISSING: "},
+    {6539, "NVOSF_FILE_OPEN: "},
+    {6540, "NVOSF_FILE_UNCAPPED: "},
+    {6541, "NVOSF_NOT_FILEINFO: "},
+    {6542, "NVOSF_EOF: "},
+    {6543, "NVOSF_NOT_WRITE_MODE: "},
+    {6544, "NVOSF_NOT_READ_MODE: "},
+    {6545, "NVOSF_SECTOR_ERASE_FAIL: "},
+    {6546, "NVOSF_BLOCK_TOO_BIG: "},
+    {6547, "NVOSF_MALLOC_FAIL: "},
+    {6548, "NVOSF_CACHE_TOO_SMALL: "},
+    {6549, "NVOSF_CACHE_TOO_BIG: "},
+    {6550, "NVOSF_CACHE_GRANULARITY: "},
+    {6551, "NVOSF_ILLEGAL_USERDATA: "},
+    {6552, "NVOSF_ILLEGAL_MODE: "},
+    {6553, "NVOSF_NOTOPEN: "},
+    {6592, "NVOTC_WRITE_BUSY: "},
+    {6593, "NVOTC_INVALID_GROUP: "},
+    {6594, "NVOTC_WRITE_CLOSED: "},
+    {6595, "NVOTC_GROUP_MISMATCH: "},
+    {6596, "NVOTC_KEY_EXISTS: "},
+    {6597, "NVOTC_KEYOPEN_BUSY: "},
+    {6598, "NVOTC_TOO_MANY_ITEMS: "},
+    {6599, "NVOTC_KEY_MISSING: "},
+    {6600, "NVOTC_INDEX_TOO_LARGE: "},
+    {6601, "NVOTC_GROUP_NOT_OPEN: "},
+    {6602, "NVOTC_INVALID_KEYID: "},
+    {6656, "FDV_NOT_ACCESSIBLE: "},
+    {6657, "FDV_WRITE_FAIL: There was an error whilst attempting to write to the flash device."},
+    {6658, "FDV_WRITE_BLOCK_BOUND: "},
+    {6659, "FDV_READ_BLOCK_BOUND: "},
+    {6660, "FDV_SECTOR_ERASE_FAIL: "},
+    {6661, "FDV_WRITE_TO_INV_ADDR: The specified address is not valid and so data has not been written."},
+    {6662, "FDV_READ_FROM_INV_ADDR: The specified address is not valid and so data has not been read."},
+    {6663, "FDV_ERASE_FAIL: "},
+    {6664, "FDV_ERASE_TIMEOUT: "},
+    {6665, "FDV_WRITE_TIMEOUT: "},
+    {6666, "FDV_ERASE_VPP_INV: "},
+    {6667, "FDV_WRITE_VPP_INV: "},
+    {6668, "FDV_ERASE_PROTECTED: An attempt was made to deleted a protected part on a flash device."},
+    {6669, "FDV_WRITE_PROTECTED: An attempt was made to write to a protected part on a flash device."},
+    {6670, "FDV_ERASE_SEQ_ERR: "},
+    {6671, "FDV_UNLOCK_FAIL: "},
+    {6672, "FDV_LOCKED_DOWN: "},
+    {6673, "FDV_READ_FAIL: There was an error whilst attempting to read from a flash device."},
+    {6674, "FDV_READ_TIMEOUT: An operation timed out whilst attempting to read from a flash device."},
+    {6784, "FDV_SOME_ERROR_APP: "},
+    {7000, "CPA_OK: No error."},
+    {7001, "CPA_NO_MEM: Out of memory."},
+    {7002, "CPA_BAD_ARGS: Illegal arguments."},
+    {7003, "CPA_PERM_DENIED: Access violation."},
+    {7004, "CPA_NOT_IMPL: Feature is not implemented."},
+    {7005, "CPA_NOT_FOUND: Not found."},
+    {7006, "CPA_SYS_ERR: General system error."},
+    {7007, "CPA_TIMEOUT: Operation timed out."},
+    {7008, "CPA_INVAL: Invalid input."},
+    {7009, "CPA_PERM: Operation not permitted."},
+    {7010, "CPA_NOENT: No such file or directory."},
+    {7011, "CPA_SRCH: No such process."},
+    {7012, "CPA_INTR: Interrupted system call."},
+    {7013, "CPA_IO: Input/output error."},
+    {7014, "CPA_NXIO: Device not configured."},
+    {7015, "CPA_FAULT: Bad address."},
+    {7016, "CPA_EXIST: File exists."},
+    {7017, "CPA_NODEV: Operation not supported by device."},
+    {7018, "CPA_NOSPC: No space left on device."},
+    {7019, "CPA_UPDATED: List changed between iterator calls."},
+    {7020, "CPA_RANGE: Result too large (range error)."},
+    {8192, "APP_INVALID_BRIDGE: "},
+    {8193, "APP_INVALID_APPID: "},
+    {8194, "APP_CONTEXT_BUSY: "},
+    {8195, "APP_NOT_RUNNING: "},
+    {8196, "APPCONTEXT_CORRUPT: "},
+    {8197, "APP_INVALID_PARAM: "},
+    {8198, "APP_ERASE_FFS_NOT_ALLOWED: Unable to erase the module filesystem, please ensure the module is wired for VSP command line mode to use this function."},
+    {8199, "APP_CFGKEY_WRITE_DISALLOWED: "},
+    {9216, "MSC_INVALID_STRING: A string provided was not valid."},
+    {9217, "MSC_INVALID_PRIORITY: "},
+    {9218, "MSC_SUBST_NOARGC: "},
+    {9219, "MSC_SUBST_OVERFLOW: "},
+    {9220, "MSC_CONTINUE: "},
+    {9221, "MSC_SUBST_INV_CHAR: "},
+    {9222, "MSC_SUBST_INV_INDEX: "},
+    {9223, "MSC_DEESC_ERROR: "},
+    {9224, "MSC_CONSTANT_TOO_BIG: "},
+    {9225, "MSC_INVALID_CONSTANT_CHAR: "},
+    {9226, "MSC_INVALID_HEXSTRING: A hex-string provided was not valid."},
+    {10752, "NVW_WORM_MISSING: The module WORM is missing, please contact Laird support."},
+    {11520, "PPR_NOT_OPEN: "},
+    {11521, "PPR_ALREADY_OPEN: "},
+    {11522, "PPR_DEFNAME_EMPTY: "},
+    {11523, "PPR_MALLOC_FAIL: "},
+    {11524, "PPR_DEFINE_VALUE_DIFF: "},
+    {11525, "PPR_MISSING_NAME: "},
+    {11526, "PPR_INVALID_DEFINE_NAME: "},
+    {11527, "PPR_INVALID_DEFINE_VAL: "},
+    {11528, "PPR_LINE_TOO_BIG: "},
+    {11529, "PPR_EXPANSION_OVERRUN: "},
+    {11530, "PPR_ABSORBED_COMMAND: "},
+    {11531, "PPR_INCLUDE_FILE_MISSING: "},
+    {12032, "ENC_BLOCKSIZE_ERROR: "},
+    {13824, "VSF_INVALID_HANDLE: "},
+    {13825, "VSF_FILE_NOT_OPEN: "},
+    {13826, "VSF_NO_FREE_HANDLES: "},
+    {13827, "VSF_NOT_WRITEMODE: "},
+    {13828, "VSF_NOT_READMODE: "},
+    {13829, "VSF_BLOCK_TOO_LARGE: "},
+    {13830, "VSF_WRITE_OVERRUN: "},
+    {13831, "VSF_FILE_MISSING: "},
+    {13832, "VSF_EOF_DONOTUSE: "},
+    {13833, "VSF_NOT_COMMITTED: "},
+    {13834, "VSF_NOTHING_TO_COMMIT: "},
+    {13835, "VSF_NO_FREE_SPACE: "},
+    {13836, "VSF_INVALID_TYPE: "},
+    {15360, "SYS_NO_SHUTDOWN_LIST: "},
+    {15361, "SYS_SHUTDOWN_FAIL: "},
+    {15362, "SYS_SHAREOBJ_ACCESS_ERR: "},
+    {15363, "SYS_SHAREOBJ_ISFREE: "},
+    {20480, "TKS_FP_NULL: "},
+    {20481, "TKS_NOT_VALID: "},
+    {20482, "TKS_FILEWRITE_TRUNCATED: "},
+    {20483, "TKS_FILE_READ_ERROR: "},
+    {20484, "TKS_PCODEFILE_INVALID: "},
+    {20485, "TKS_FILE_SEEK_ERROR: "},
+    {20486, "TKS_VARIABLE_UNKNOWN: "},
+    {20736, "RBF_INVALID_LEN: "},
+    {20737, "RBF_WRAP_BUF_FULL: "},
+    {20738, "RBF_WRAP_BUF_EMPTY: "},
+    {20739, "RBF_WRAP_BUF_WAS_FULL: "},
+    {20992, "DRIVER_NOT_FOUND: The specified hardware device was not found."},
+    {20993, "DRIVER_NOT_OPEN: The specified hardware device is not open, it needs to be opened before it can be manipulated."},
+    {20994, "DRIVER_INVALID_PINS: The specified GPIO either does not exist or does not support the selected functionality."},
+    {20995, "DRIVER_BAD_CONFIGPARMS: The configuration parameters for the specified hardware device are incorrect."},
+    {20996, "DRIVER_FEATURE_UNAVAILABLE: This feature is not available for this hardware device."},
+    {20997, "DRIVER_UNKNOWN_IOCTL: The provided GPIO line cannot be used in IOCTL functions."},
+    {20998, "DRIVER_BUFFER_FULL: The specified hardware device's buffer is currently full."},
+    {20999, "DRIVER_ALREADY_OPEN: An attempt was made to open a hardware device which is already open."},
+    {21000, "DRIVER_UART_INV_BAUD: An attempt was made to open the UART with an invalid baud rate."},
+    {21001, "DRIVER_UART_INV_PARITY: An attempt was made to open the UART with an invalid parity mode."},
+    {21002, "DRIVER_UART_INV_DATABITS: An attempt was made to open the UART with an invalid number of data bits."},
+    {21003, "DRIVER_UART_INV_STOPBITS: An attempt was made to open the UART with an invalid number of stop bits."},
+    {21004, "DRIVER_UART_CANNOT_BE_DTE: "},
+    {21005, "DRIVER_UART_CANNOT_BE_DCE: "},
+    {21006, "DRIVER_UART_INV_FLOWCTRL: An attempt was made to open the UART with an invalid type of flow control."},
+    {21007, "DRIVER_UART_INV_DTE_DCE: The provided UART configuration string is not valid."},
+    {21008, "DRIVER_INV_OPTION_STRLEN: The provided UART configuration string is not the correct length"},
+    {21009, "DRIVER_INV_TXBUFLEN: An attempt was made to open the UART with an invalid TX buffer length."},
+    {21010, "DRIVER_INV_RXBUFLEN: An attempt was made to open the UART with an invalid RX buffer length."},
+    {21011, "DRIVER_GENERIC_HW_ERR: There is a generic error with the hardware reported by the low level driver."},
+    {21012, "DRIVER_UART_NOCTSRTS_PINS: There are no RTS/CTS pins on this UART interface, hardware flow control cannot be used."},
+    {21013, "DRIVER_TIMEOUT_TOOLARGE: A timeout value provided is too large to be used."},
+    {21014, "DRIVER_REPEAT_TOUT_TOOSMALL: The specified repeat timeout is too small."},
+    {21015, "DRIVER_SIGNUM_INVALID: The GPIO number specified is not valid."},
+    {21016, "DRIVER_SIGFUNC_NOTALLOWED: The GPIO function type cannot be used on this GPIO line."},
+    {21017, "DRIVER_SIGSUBFUNC_NOTALLOWED: "},
+    {21018, "DRIVER_SIG_NOTCOMPATIBLE: The specified GPIO number cannot be read."},
+    {21019, "DRIVER_SIG_NOFREE_SCHEVENTS: "},
+    {21020, "DRIVER_SCHEVENT_ALREADY_USED: The specified bind/assign ID has already been used."},
+    {21021, "DRIVER_RESOURCE_UNAVAILABLE: The hardware interface is currently unavailable."},
+    {21022, "DRIVER_LOWLEVEL_ERROR: An error has been reported with the low level interface of a hardware driver."},
+    {21023, "DRIVER_INV_ADDRESS: The provided I2C address is not valid."},
+    {21024, "DRIVER_INV_HANDLE: The provided signal handle is not valid."},
+    {21025, "DRIVER_I2C_ERROR: There is a generic error with the I2C driver."},
+    {21026, "DRIVER_INV_WRITELEN: The specified write data length for an I2C operation is not valid."},
+    {21027, "DRIVER_INV_READLEN: The specified read data length for an I2C operation is not valid."},
+    {21028, "DRIVER_STR_NEXTBLOCK_EXISTS: "},
+    {21029, "DRIVER_INVALID_FREQ: The specified frequency/baud rate is not valid."},
+    {21030, "DRIVER_NOFREE_PPI_CHANNEL: "},
+    {21031, "DRIVER_I2C_STUCK_SLAVE: A slave device on the I2C bus is stuck, try resetting all devices and repeating the operation."},
+    {21032, "DRIVER_I2C_ADDRESS_NACK: The I2C address byte was not acknowledged."},
+    {21033, "DRIVER_I2C_DATA_NACK: The I2C data byte was not acknowledged."},
+    {21034, "DRIVER_I2C_INV_REGADDR: An attempt was made to communicate with an I2C slave that isn't connected or responding."},
+    {21035, "DRIVER_INVALID_MODE: The specified I2C mode is not valid."},
+    {21036, "DRIVER_NOFREE_GPIOTE_CHANNEL: "},
+    {21037, "DRIVER_NOFREE_PWMFREQ_CONTEXT: "},
+    {21038, "DRIVER_PWM_UNCONFIGURABLE: The specified GPIO cannot be configured for frequency/PWM output."},
+    {21039, "DRIVER_CLOSED: "},
+    {21040, "DRIVER_TIMER_NOT_CREATED: "},
+    {21041, "DRIVER_BUFFERS_NOT_EMPTY: The UART buffer was not empty when an attempt was made to close it."},
+    {21042, "DRIVER_INV_TIMEOUT: "},
+    {21043, "DRIVER_INV_CHANNEL: An invalid channel was used to assign an event to."},
+    {21044, "DRIVER_CHANNEL_ALREADY_USED: The specified assign/bind channel has already been used."},
+    {21045, "DRIVER_SIG_NOFREE_CHANNELS: "},
+    {21046, "DRIVER_GPIO_ALREADY_BOUND: The specificed GPIO line is already bound to an event."},
+    {21047, "DRIVER_SIG_NOTSENSE_ENABLED: "},
+    {21048, "DRIVER_SIG_SENSE_BUSY: Wake-up pin configuration has already been set."},
+    {21049, "DRIVER_INV_POLARITY: "},
+    {21050, "DRIVER_I2C_TIMEOUT: A timeout has occured with the I2C hardware driver."},
+    {21051, "DRIVER_SIG_NOT_OUTPUT: "},
+    {21052, "DRIVER_INVALID_PORT: "},
+    {21053, "DRIVER_INVALID_MFSI_CHANNEL: An invalid SPI channel was specified."},
+    {21054, "DRIVER_INVALID_ERASETYPE: "},
+    {21055, "DRIVER_INVALID_POLARITY: The polarity specified for an assign/bind event is invalid."},
+    {21056, "DRIVER_TIMER_NOT_CONFIGURED: "},
+    {21057, "DRIVER_BUFFER_NOMATCH: An invalid buffer ID was specified."},
+    {21058, "DRIVER_INVALID_FLAG: An invalid flag was used when opening an SPI handle."},
+    {21059, "DRIVER_CHANNEL_OPENED: "},
+    {21060, "DRIVER_SIG_NOTCHANGEBLE: The function of this GPIO pin cannot be changed."},
+    {21061, "DRIVER_SIG_SENSE_NOTAVAILABLE: An invalid GPIO port has been used as a wake-up pin."},
+    {21062, "DRIVER_INVALID_ALARM_SETTING: The provided alarm setting is invalid."},
+    {21063, "DRIVER_INVALID_RTC_MONTHVALUE: The provided RTC month is invalid."},
+    {21064, "DRIVER_I2C_INCORRECT_RXLEN: The provided I2C receive length is invalid."},
+    {21065, "DRIVER_I2C_INVALID_SYSCLK: The provided I2C clock speed is invalid."},
+    {21066, "DRIVER_INVALID_PERIPH_INSTANCE: "},
+    {21067, "DRIVER_SERIALFLASH_NOTPRESENT: "},
+    {21068, "DRIVER_SERIALFLASH_UNKNOWN: "},
+    {21069, "DRIVER_PWM_IS_ACTIVE: "},
+    {21070, "DRIVER_PWM_MAXVAL_TOO_LOW: "},
+    {21072, "DRIVER_LOWLEVEL_ERR_00: "},
+    {21073, "DRIVER_LOWLEVEL_ERR_01: "},
+    {21074, "DRIVER_LOWLEVEL_ERR_02: "},
+    {21075, "DRIVER_LOWLEVEL_ERR_03: "},
+    {21076, "DRIVER_LOWLEVEL_ERR_04: "},
+    {21077, "DRIVER_LOWLEVEL_ERR_05: "},
+    {21078, "DRIVER_LOWLEVEL_ERR_06: "},
+    {21079, "DRIVER_LOWLEVEL_ERR_07: "},
+    {21080, "DRIVER_LOWLEVEL_ERR_08: "},
+    {21081, "DRIVER_LOWLEVEL_ERR_09: "},
+    {21082, "DRIVER_LOWLEVEL_ERR_0A: "},
+    {21083, "DRIVER_LOWLEVEL_ERR_0B: "},
+    {21084, "DRIVER_LOWLEVEL_ERR_0C: "},
+    {21085, "DRIVER_LOWLEVEL_ERR_0D: "},
+    {21086, "DRIVER_LOWLEVEL_ERR_0E: "},
+    {21087, "DRIVER_LOWLEVEL_ERR_0F: "},
+    {21248, "SCH_SOME_ERROR: "},
+    {21760, "LIC_INV_LICENCE_LEN: The license code for your module is not valid, as a result, device functionality is severely limited until a valid license is entered to the module."},
+    {22016, "FUP_TXBUFFER_NOSPACE: "},
+    {22017, "FUP_UNKNOWN_CMD: "},
+    {22018, "FUP_PROTECTED_MEMORY: "},
+    {22272, "BTC_INV_INDEX: The provided index for a BTC function is not valid."},
+    {22273, "BTC_ALREADY_INQUIRING: A classic Bluetooth inquiry is already in progress"},
+    {22274, "BTC_INQUIRY_REPORT_QUE_EMPTY: There are no BTC inquiry reports in the queue."},
+    {22275, "BTC_NO_MORE_EIR_ELEMENTS: There are no more BTC EIR elements in the inquiry report."},
+    {22276, "BTC_INV_EIRPACKET_TAG: The specified EIR packet tag is not valid."},
+    {22277, "BTC_SPP_ALREADY_CONNECTING: A SPP connection is already currently in progress."},
+    {22278, "BTC_INV_MAC_ADDRESS: The specified Bluetooth address is not valid."},
+    {22279, "BTC_NO_DATA_WAITING: There is no data waiting for the specified BTC handle."},
+    {22280, "BTC_SPP_INV_HANDLE: The supplied SPP handle is not valid."},
+    {22281, "BTC_SPP_PORT_OUTOFRANGE: The specified SPP port is not valid."},
+    {22282, "BTC_SPP_SERVER_MALLOC_FAIL: There was a problem allocating memory for an SPP server, try to free device memory by using smaller/less resources and try again."},
+    {22283, "BTC_SPP_SERVER_SDP_REG_FAILED: An error occured whilst registering an SPP server instance on the SDP."},
+    {22284, "BTC_SPP_PORT_MALLOC_FAIL: There was a problem allocating memory for an SPP client connect, try to free device memory by using smaller/less resources and try again."},
+    {22285, "BTC_INV_PIN: The provided pin for a classic Bluetooth pairing is not valid."},
+    {22286, "BTC_INV_DATABASE_TABLEID: The specified BTC bonding database table ID is not valid."},
+    {22287, "BTC_KEY_NOT_IN_TABLE: There is no entry for the provided Bluetooth address in the classic Bluetooth database."},
+    {22288, "BTC_LINK_KEY_MISSING: There is no link key for the provided Bluetooth address in the classic Bluetooth database."},
+    {22289, "BTC_TRUSTED_DATABASE_FULL: Both the temporary and persistent BTC trusted databases are full and cannot accept additional entries."},
+    {22290, "BTC_TRUSTED_TABLE_FULL: The temporary or persistent BTC trusted database table is full and cannot accept additional entries."},
+    {22291, "BTC_TRUSTED_DATABASE_NOMORE: There are no more BTC trusted database entries to iterate over."},
+    {22292, "BTC_CORRUPT_TABLEINDEX: The BTC trusted database table is corrupt, data contained within it will be inaccessable."},
+    {22293, "BTC_CORRUPT_BONDINFO: An entry in the BTC trusted database table is corrupt."},
+    {22294, "BTC_TOO_MANY_PERSISTENT: The BTC persistent trusted database is full and cannot accept any additional entries."},
+    {22295, "BTC_UNKNOWN_LINK_KEY_TYPE: The provided classic Bluetooth link key type is not valid."},
+    {22296, "BTC_INV_LINK_KEY: A provided BTC link key is not valid."},
+    {22297, "BTC_INV_NAME_LENGTH: The provided classic Bluetooth name is not valid."},
+    {22298, "BTC_NOT_PAIRABLE: The device cannot pair using classic Bluetooth because pairing is set to disable."},
+    {22299, "BTC_INV_PAIR_OPTION: The provided classic Bluetooth pairing option is not valid."},
+    {22300, "BTC_INVALID_MODE: The provided classic Bluetooth mode is not valid."},
+    {22301, "BTC_INVALID_LIMITED_TIMOUT: The provided classic Bluetooth limited timeout is not valid."},
+    {22302, "BTC_SPP_QUEUE_FULL: Unable to send SPP data, the queue is currently full."},
+    {22303, "BTC_MAX_SPP_CONNECTIONS: The maximum number of SPP connections has been reached."},
+    {22304, "BTC_INV_IOCAPABILITY: The provided BTC IO capability is not valid."},
+    {22305, "BTC_INV_PASSKEY: The provided BTC passkey is not valid."},
+    {22306, "BTC_INV_OOB_HASH: The provided BTC Out-Of-Band pairing hash is not valid."},
+    {22307, "BTC_INV_OOB_RANDOMISER: The provided BTC Out-Of-Band pairing randomiser is not valid."},
+    {22308, "BTC_SPP_PORTS_ESTABLISHED: "},
+    {22309, "BTC_SPP_MAX_SERVERS: The maximum number of SPP servers have been created, no more can be created."},
+    {22310, "BTC_HID_DESC_ALLOC_FAIL: "},
+    {22311, "BTC_HID_DESC_INV_FORMAT: "},
+    {22312, "BTC_HID_DEVICE_REG_FAIL: "},
+    {22313, "BTC_HID_DEVICE_NAME_ALLOC: "},
+    {22314, "BTC_HID_DEVICE_SDP_FAIL: "},
+    {22315, "BTC_HID_ALREADY_CONNECTING: "},
+    {22316, "BTC_HID_DEVICE_OPEN: "},
+    {22317, "BTC_HID_HOST_OPEN: "},
+    {22318, "BTC_HID_NOT_OPENED: HID has not been opened, it must first be opened before being used."},
+    {22319, "BTC_HID_CONTROL_NOT_ALLOWED: "},
+    {22320, "BTC_HID_CONTROL_INVALID: "},
+    {22321, "BTC_INV_OOBPREF: The provided BTC Out-Of-Band pairing preference is not valid."},
+    {22322, "BTC_DIS_INVSRC: "},
+    {22323, "BTC_HID_INV_HANDLE: The provided HID handle is not valid."},
+    {22324, "BTC_HID_REPORT_BUF_ALLOC: "},
+    {22325, "BTC_HID_NO_REPORTS_WAITING: There are no HID reports waiting in the queue."},
+    {22326, "BTC_HID_REPORT_ALLOC: "},
+    {22327, "BTC_HID_QUEUE_FULL: "},
+    {22328, "BTC_IAP_INVALID_PARMS: "},
+    {22329, "BTC_IAP_INFO_NOT_SET: "},
+    {22330, "BTC_IAP_NOT_ALLOWED: "},
+    {22331, "BTC_SNIFF_INVALID_PARAMS: "},
+    {22332, "BTC_INVALID_ACL_HANDLE: "},
+    {22333, "BTC_INVALID_BDADDR: "},
+    {22334, "BTC_ACL_RECORD_FAILED: "},
+    {22335, "BTC_SNIFF_DISABLED: "},
+    {22336, "BTC_SUBRATE_INVALID_PARAMS: "},
+    {22337, "BTC_HID_INVALID_PROTOCOL: "},
+    {22528, "BTS_IEEE_MACADDR_MISSING: There is no IEEE Bluetooth address on this module."},
+    {22784, "CRYPTO_INV_KEY_LEN: The provided key for a crypto function is an invalid length."},
+    {22785, "CRYPTO_INV_INITVECT_LEN: The initiation vector for the cryptographic module is invalid."},
+    {22786, "CRYPTO_INV_INDATABLOCK_LEN: Data in to a crypto function is an invalid length"},
+    {22787, "CRYPTO_INV_MODE: The specified mode for the cryptographic module is invalid."},
+    {22788, "CRYPTO_INV_BLOCK_SIZE: The block size supplied to a crypto function is invalid."},
+    {22789, "CRYPTO_CONTEXT_UNINITIALISED: No key has been supplied to the crytographic module."},
+    {22790, "CRYPTO_DH_INTERNAL_ERROR: "},
+    {23040, "NFC_INVALID_INTERFACEID: "},
+    {23041, "NFC_UNKNOWN_TARGET_ERR: "},
+    {23042, "NFC_INVALID_OOBLEN: "},
+    {23043, "NFC_NOTOPEN: An attempt has been made to use the NFC module before it was opened."},
+    {23044, "NFC_NOTAVAILABLE: An attempt was made to use NFC but it is not available on this module."},
+    {23045, "NFC_DISABLE_FAIL: "},
+    {23046, "NFC_ENABLE_FAIL: "},
+    {23047, "NFC_REBOOT_REQUIRED: "},
+    {23048, "NFC_INVALID_MAXRECORDS: "},
+    {23049, "NFC_INVALID_MAXMEMORY: "},
+    {23050, "NFC_NO_MEMORY: "},
+    {23051, "NFC_NO_METADATA_OBJECT: "},
+    {23052, "NFC_INVALID_MDATA_HANDLE: "},
+    {23053, "NFC_NDEF_TOOMANY_RECS: "},
+    {23054, "NFC_NDEF_TOOFEW_RECS: "},
+    {23055, "NFC_INVALID_LANGCODE: "},
+    {23056, "NFC_INVALID_PAYLOAD: "},
+    {23057, "NFC_INCONSISTENT_NDEFMSG: "},
+    {23058, "NFC_NDEF_MSG_IS_EMPTY: "},
+    {23059, "NFC_INV_DEVNAME_LEN: "},
+    {23060, "NFC_INV_APPEARANCE: "},
+    {23061, "NFC_INV_ROLE: "},
+    {23062, "NFC_INV_TEMPKEY: "},
+    {23063, "NFC_INV_FLAGS: "},
+    {23064, "NFC_INV_TNF: "},
+    {23065, "NFC_INV_PAYLOAD_HANDLE: "},
+    {23066, "NFC_NDEF_IS_COMMITED: "},
+    {23067, "NFC_TYPE_IS_EMPTY: "},
+    {23068, "NFC_TYPE_IS_TOO_LONG: "},
+    {23069, "NFC_ID_IS_TOO_LONG: "},
+    {23264, "NFC_RETVAL_ERROR: "},
+    {23265, "NFC_RETVAL_INVALID_STATE: "},
+    {23266, "NFC_RETVAL_INVALID_SIZE: "},
+    {23267, "NFC_RETVAL_INVALID_ARGUMENT: "},
+    {23276, "NFC_RETVAL_DATA_SIZE: "},
+    {24576, "BLE_NOT_INITIALISED: "},
+    {24577, "BLE_INV_APPEARANCE: The provided BLE device appearance is not valid."},
+    {24578, "BLE_INV_MINCONN_INTERVAL: The provided BLE minimum connection interval is not valid."},
+    {24579, "BLE_INV_MAXCONN_INTERVAL: The provided BLE maximum connection interval is not valid."},
+    {24580, "BLE_MIN_GE_MAX: The provided BLE maximum connection interval is less than the provided BLE minimum connection interval."},
+    {24581, "BLE_INV_SPRVSN_TIMEOUT: The provided BLE supervision timeout is not valid."},
+    {24582, "BLE_INV_DEVNAME: The provided BLE device name is not valid."},
+    {24583, "BLE_INV_SLAVE_LATENCY: The provided BLE slave latency is not valid."},
+    {24584, "BLE_ADVERT_NOSPACE: There is insufficient space available in the advert to store this data. Try to use less information or store the information as a scan response instead."},
+    {24585, "BLE_LINBUF_BUSY: "},
+    {24586, "BLE_AD_PRESENT: The device name already exists in the BLE advert report."},
+    {24587, "BLE_UUIDLIST_EMPTY: The provided BLE UUID list is not valid."},
+    {24588, "BLE_STRING_NOT_REPORT: "},
+    {24589, "BLE_INV_KEYSIZE: The provided BLE security manager encryption key is not valid."},
+    {24590, "BLE_INV_IOCAPABILITY: The provided BLE IO Capability is not valid."},
+    {24591, "BLE_INV_PAIRING_TOUT: The provided BLE pairing timeout is not valid."},
+    {24592, "BLE_INV_ADV_INTERVAL: The provided BLE advertising interval is not valid."},
+    {24593, "BLE_INV_ADV_TYPE: The provided BLE advert type is not valid."},
+    {24594, "BLE_INV_FILTER_POLICY: The provided BLE filter policy is not valid."},
+    {24595, "BLE_INV_BATTLEVEL: The provided battery level value is not valid."},
+    {24596, "BLE_INV_TEMPERATURE: The provided temperature value is not valid."},
+    {24597, "BLE_INV_TXPOWER: The provided BLE TX power setting is not valid."},
+    {24598, "BLE_IND_PENDING: "},
+    {24599, "BLE_SVC_NOT_REGISTERED: "},
+    {24600, "BLE_SVC_REGISTERED: "},
+    {24601, "BLE_INV_TEMPERATURE_TYPE: The provided temperature type is not valid."},
+    {24602, "BLE_INV_LINKLOSS_PARM: The provided link-loss parameter is not valid."},
+    {24603, "BLE_INV_MAC_ADDRESS: The BLE Bluetooth address is not valid."},
+    {24604, "BLE_INV_MAC_ADDRESS_TYPE: The BLE Bluetooth address type is not valid."},
+    {24605, "BLE_INV_SYSTEMID: "},
+    {24606, "BLE_INV_PNPID: "},
+    {24607, "BLE_INV_BPS_FEATURE: "},
+    {24608, "BLE_INV_BPS_UNITS: The provided blood pressure unit is not valid."},
+    {24609, "BLE_INV_HEARTRATE: The provided heartrate is not valid."},
+    {24610, "BLE_INV_TIMESTAMP: The provided timestamp is not valid."},
+    {24611, "BLE_WAITING_IND_CFM: "},
+    {24612, "BLE_INV_TEMPERATURE_UNITS: The provided temperature unit is not valid."},
+    {24613, "BLE_INV_RR_INTERVAL: The provided RR interval is not valid."},
+    {24614, "BLE_INV_CONN_HANDLE: The provided BLE connection handle is not valid."},
+    {24615, "BLE_INV_PARAMETER: A parameter provided to a BLE function is not valid."},
+    {24616, "BLE_CONNPARMS_BUSY: "},
+    {24617, "BLE_INV_RR_ARRAY_FULL: "},
+    {24618, "BLE_INV_FLAGS_AD: The provided BLE AD flags are not valid."},
+    {24619, "BLE_INV_INDEX: The provided BLE index is not valid."},
+    {24620, "BLE_CONN_NOT_ENCRYPTED: "},
+    {24621, "BLE_INV_ADPACKET_TAG: The provided BLE AD tag is not valid."},
+    {24622, "BLE_INV_ADPACKET_LEN: The provided BLE AD tag length is not valid."},
+    {24623, "BLE_INV_UUID: The provided BLE UUID is not valid."},
+    {24624, "BLE_DESCRIPTOR_NOTALLOWED: "},
+    {24625, "BLE_INV_ATTR_VALUE_LEN: The provided BLE GATT attribute length is not valid."},
+    {24626, "BLE_INV_CHAR_OBJ_UNDEFINED: The provided BLE GATT characteristic object is not valid (Check it has been initialised using BleCharNew())."},
+    {24627, "BLE_INV_DESCRIPTOR_VALUE: "},
+    {24628, "BLE_CHAR_PROP_DONT_MATCH: "},
+    {24629, "BLE_INV_FORMAT: The provided BLE presentation format is not valid."},
+    {24630, "BLE_INV_EXPONENT: The provided exponent element is not valid."},
+    {24631, "BLE_INV_UNIT: The provided unit is not valid."},
+    {24632, "BLE_INV_NAMESPACE: The provided BLE namespace is not valid."},
+    {24633, "BLE_INV_NAMEPACE_DESC: The provided BLE namespace description is not valid."},
+    {24634, "BLE_DUPLICATE_DESC_NOTALLOWED: The provided BLE namespace description already exists and cannot be duplicated."},
+    {24635, "BLE_INV_DESCRIPTOR_UUID: "},
+    {24636, "BLE_INV_ATTR_RD_ACCESS_RIGHT: The provided BLE read attribute access right is not valid"},
+    {24637, "BLE_INV_ATTR_WR_ACCESS_RIGHT: The provided BLE write attribute access right is not valid"},
+    {24638, "BLE_INV_SERVICE_HANDLE: The provided BLE service hande is not valid"},
+    {24639, "BLE_INV_ATTR_ACCESS_RIGHT: The provided BLE read access right is not valid"},
+    {24640, "BLE_INV_SERVICE_TYPE: The provided BLE service type is not valid"},
+    {24641, "BLE_INV_WRITEACCESS_NONE: "},
+    {24642, "BLE_INV_CHAR_HANDLE: The provided BLE characteristic hande is not valid"},
+    {24643, "BLE_ATTR_VALUE_EMPTY: The provided BLE attribute value is empty."},
+    {24644, "BLE_CHAR_DESC_UNREADABLE: "},
+    {24645, "BLE_MANTISSA_TOO_BIG: The provided mantissa element is too large."},
+    {24646, "BLE_EXPONENT_TOO_BIG: The provided exponent element is too large."},
+    {24647, "BLE_INV_UUID_HANDLE: The provided BLE UUID handle is not valid."},
+    {24648, "BLE_SERIALSVC_EXISTS: "},
+    {24649, "BLE_SERIALSVC_INV_HANDLES: "},
+    {24650, "BLE_SERIALSVC_INV_STATE: "},
+    {24651, "BLE_SERIALSVC_REGISTERED: "},
+    {24652, "BLE_IS_CONNECTED: The device is in a BLE connection and cannot perform some commands."},
+    {24653, "BLE_BASEBAND_NOT_IDLE: The BLE baseband is current busy with another operation."},
+    {24654, "BLE_SERIALSVC_INV_BUFSIZE: "},
+    {24655, "BLE_MINxSLAVELATENCY_LE_MAX: "},
+    {24656, "BLE_INV_ATTR_HANDLE: The provided BLE attribute handle is not valid."},
+    {24657, "BLE_GATT_CLIENT_NOT_IDLE: The BLE GATT client is current busy."},
+    {24658, "BLE_GATTC_NO_MORE_DATA: The BLE GATT client has indicated there is no more data."},
+    {24659, "BLE_CONN_HANDLE_UNKNOWN: The provided BLE connection handle is unknown."},
+    {24660, "BLE_GATTC_NO_CACHED_DATA: The BLE GATT client has indicated there is no cached data."},
+    {24661, "BLE_INV_ATTR_OFFSET: The provided BLE attribute offset is not valid."},
+    {24662, "BLE_GATTC_NO_DATA_TOSEND: The provided BLE GATT client data to send is empty."},
+    {24663, "BLE_NO_TXBUFFER: "},
+    {24664, "BLE_NOTIFY_QUE_EMPTY: The BLE notify queue is empty."},
+    {24665, "BLE_GATTCLIENT_NOTOPEN: The BLE GATT client has not been opened, thus GATT client functions cannot be used."},
+    {24666, "BLE_INV_INSTANCE: A BLE instance parameter provided is not valid."},
+    {24667, "BLE_INV_DESC_HANDLE: A BLE descriptor handle provided is not valid."},
+    {24668, "BLE_ADVERT_REPORT_QUE_EMPTY: The BLE advert report queue is empty."},
+    {24669, "BLE_INV_WHITELIST_HANDLE: The provided BLE whitelist handle is not valid."},
+    {24670, "BLE_WHITELIST_FULL: The BLE whitelist is full and cannot accept additional entries."},
+    {24671, "BLE_INVALID_KEY: "},
+    {24672, "BLE_NO_MORE_AD_ELEMENTS: There are no more BLE AD elements left to parse."},
+    {24673, "BLE_ALREADY_SCANNING: There is already a BLE scan in progress."},
+    {24674, "BLE_ALREADY_CONNECTING: There is already a BLE connection in progress."},
+    {24675, "BLE_NO_DIRECT_IND_ADDR: "},
+    {24676, "BLE_NOT_SCANNING: A BLE scan request cannot be cancelled as no scan is in progress."},
+    {24677, "BLE_NOT_CONNECTING: A BLE connection attempt cannot be cancelled as no connection attempt is in progress."},
+    {24678, "BLE_MAX_CONNECTIONS: No more BLE connections can be made as the maximum number of connections has been reached."},
+    {24679, "BLE_MISSING_LOCAL_IRK: "},
+    {24680, "BLE_GATTC_LENGTH_EXCEEDED: The BLE GATT write failed as the request is too long."},
+    {24681, "BLE_CHAR_LENGTH_EXCEEDED: The BLE GATT characteristic write failed as the data is too long."},
+    {24682, "BLE_INV_DATABASE_TABLEID: "},
+    {24683, "BLE_KEY_NOT_IN_TABLE: "},
+    {24684, "BLE_LINK_KEY_MISSING: "},
+    {24685, "BLE_TRUSTED_DATABASE_FULL: The BLE bonding database is full."},
+    {24686, "BLE_TRUSTED_TABLE_FULL: The BLE trusted database table is full and cannot accept additional entries."},
+    {24687, "BLE_TRUSTED_DATABASE_NOMORE: There are no more entries in the BLE bonding database."},
+    {24688, "BLE_CORRUPT_TABLEINDEX: "},
+    {24689, "BLE_CORRUPT_BONDINFO: "},
+    {24690, "BLE_TOO_MANY_PERSISTENT: There are too many persistent BLE bonds, an attempt to add another has failed."},
+    {24691, "BLE_UNKNOWN_LINK_KEY_TYPE: "},
+    {24692, "BLE_INV_LINK_KEY: The provided BLE link key is not valid."},
+    {24693, "BLE_INV_NAME_LENGTH: The provided BLE device name is not valid and must be shorter in length."},
+    {24694, "BLE_CORRUPT_BOND_ADDR: The BLE Bluetooth address in the bonding database is corrupt."},
+    {24695, "BLE_CORRUPT_BOND_LTK: The BLE LTK in the bonding database for this Bluetooth address is corrupt."},
+    {24696, "BLE_CORRUPT_BOND_IRK: The BLE IRK in the bonding database for this Bluetooth address is corrupt."},
+    {24697, "BLE_CORRUPT_BOND_CSRK: The BLE CRSK in the bonding database for this Bluetooth address is corrupt."},
+    {24698, "BLE_CORRUPT_BOND_EDIVRAND: The BLE EDIV in the bonding database for this Bluetooth address is corrupt."},
+    {24699, "BLE_ADDR_NOT_RESOLVABLE: The BLE Bluetooth address provided is not resolvable."},
+    {24700, "BLE_ADDR_DID_NOT_RESOLVABLE: "},
+    {24701, "BLE_NULL_SUPPLIED: A provided BLE variable is null."},
+    {24702, "BLE_INV_RAND: "},
+    {24703, "BLE_INVALID_LTK_SIZE: The provided BLE LTK is not valid."},
+    {24704, "BLE_INV_IRK_KEY: The provided BLE IRK is not valid."},
+    {24705, "BLE_INV_CSRK_KEY: The provided BLE CRSK is not valid."},
+    {24706, "BLE_INVALID_EDIV: The provided BLE EDIV is not valid."},
+    {24707, "BLE_NOT_BONDED: "},
+    {24708, "BLE_BOND_ROLE_NOT_ALLOWED: "},
+    {24709, "BLE_INV_PASSKEY: The provided BLE passkey is not valid."},
+    {24710, "BLE_LTK_MISSING: "},
+    {24711, "BLE_LTK_NO_MITM_AUTH: "},
+    {24712, "BLE_LTK_TOO_SMALL: The size of the LTK to use is too small to use to encrypt this BLE connection."},
+    {24713, "BLE_CONNECTED_AS_SLAVE: "},
+    {24714, "BLE_CONNECTED_AS_MASTER: "},
+    {24715, "BLE_CCCD_TABLE_MISMATCH: "},
+    {24716, "BLE_INV_CONN_CONTEXT: "},
+    {24717, "BLE_INV_BOND_INDEX: "},
+    {24718, "BLE_INV_BOND_ADDRINFO: "},
+    {24719, "BLE_IS_NOT_CONNECTED: There are currently no active BLE connections."},
+    {24720, "BLE_ALL_CHAN_DISABLED: "},
+    {24721, "BLE_INV_INFOID: "},
+    {24722, "BLE_INV_OOBPREF: The provided BLE OOB (Out-of-bound) preference is invalid."},
+    {24723, "BLE_INV_OOB_LENGTH: The provided BLE OOB (Out-of-bound) length is invalid."},
+    {24724, "BLE_NO_IEEE_MAC_ADDRESS: "},
+    {24725, "BLE_INV_ADDRESS_CYLE: "},
+    {24726, "BLE_EMPTY_SERVICE: "},
+    {24727, "BLE_INVALID_CID: "},
+    {24728, "BLE_EMPTY_L2CAP: "},
+    {24729, "BLE_INV_PACKET_LENGTH: "},
+    {24730, "BLE_INV_ATTR_MTU_SIZE: "},
+    {24731, "BLE_INV_ROLE: "},
+    {24732, "BLE_PING_INV_AUTH_TIMEOUT: "},
+    {24733, "BLE_INV_PHY_CONFIG: "},
+    {24768, "BLE_MESH_INVALID_OPCODEID: "},
+    {24769, "BLE_MESH_TOO_MANY_MODELS: "},
+    {24770, "BLE_MESH_OPCODE_TABLE_FULL: "},
+    {24771, "BLE_MESH_MODEL_NOT_ADDED: "},
+    {24772, "BLE_MESH_PREV_MODEL_EMPTY: "},
+    {24773, "BLE_MESH_PREV_ELEMENT_EMPTY: "},
+    {24774, "BLE_MESH_CURRENT_MODEL_EMPTY: "},
+    {24775, "BLE_MESH_TOO_MANY_ELEMENTS: "},
+    {24776, "BLE_MESH_TABLE_EMPTY: "},
+    {24777, "BLE_MESH_LAST_MODEL_EMPTY: "},
+    {24778, "BLE_MESH_DUPLICATE_OPCODEID: "},
+    {24779, "BLE_MESH_INVALID_MODELHANDLE: "},
+    {24780, "BLE_MESH_INVALID_MODELINDEX: "},
+    {24781, "BLE_MESH_INVALID_PACKEDOPCODE: "},
+    {24782, "BLE_MESH_INVALID_REPLYINFO: "},
+    {24783, "BLE_MESH_ALREADY_STARTED: "},
+    {24784, "BLE_MESH_CANNOT_BE_PROVISIONER: "},
+    {24785, "BLE_MESH_INVALID_DATALEN: "},
+    {24786, "BLE_MESH_INVALID_TIMEOUT: "},
+    {25088, "BLE_VENDOR_START: "},
+    {25089, "BLE_SVC_HANDLER_MISSING: "},
+    {25090, "BLE_SOFTDEVICE_NOT_ENABLED: "},
+    {25091, "BLE_INTERNAL: "},
+    {25092, "BLE_NO_MEM: "},
+    {25093, "BLE_NOT_FOUND: "},
+    {25094, "BLE_NOT_SUPPORTED: "},
+    {25095, "BLE_INVALID_PARAM: "},
+    {25096, "BLE_INVALID_STATE: "},
+    {25097, "BLE_INVALID_LENGTH: "},
+    {25098, "BLE_INVALID_FLAGS: "},
+    {25099, "BLE_INVALID_DATA: "},
+    {25100, "BLE_DATA_SIZE: "},
+    {25101, "BLE_TIMEOUT: "},
+    {25102, "BLE_NULL: A string provided to a BLE function contains is null."},
+    {25103, "BLE_FORBIDDEN: "},
+    {25104, "BLE_INVALID_ADDR: "},
+    {25105, "BLE_BUSY: "},
+    {25106, "CONN_COUNT: "},
+    {25107, "RESOURCES: "},
+    {25344, "BTS_SS1_ERROR_INVALID_PARAMETER: The Bluetooth stack has reported that a supplied parameter is not valid."},
+    {25345, "BTS_SS1_ERROR_INVALID_BLUETOOTH_STACK_ID: The Bluetooth stack has reported that the Bluetooth stack ID is not valid."},
+    {25346, "BTS_SS1_ERROR_STACK_INITIALIZATION_ERROR: The Bluetooth stack has reported that there was a problem initialising the stack."},
+    {25347, "BTS_SS1_ERROR_HCI_INITIALIZATION_ERROR: The Bluetooth stack has reported that there was a problem initialising HCI."},
+    {25348, "BTS_SS1_ERROR_GAP_INITIALIZATION_ERROR: The Bluetooth stack has reported that there was a problem initialising GAP."},
+    {25349, "BTS_SS1_ERROR_SCO_INITIALIZATION_ERROR: The Bluetooth stack has reported that there was a problem initialising SCO."},
+    {25350, "BTS_SS1_ERROR_L2CAP_INITIALIZATION_ERROR: The Bluetooth stack has reported that there was a problem initialising L2CAP."},
+    {25351, "BTS_SS1_ERROR_RFCOMM_INITIALIZATION_ERROR: The Bluetooth stack has reported that there was a problem initialising RFCOMM."},
+    {25352, "BTS_SS1_ERROR_SDP_INITIALIZATION_ERROR: The Bluetooth stack has reported that there was a problem initialising SDP."},
+    {25353, "BTS_SS1_ERROR_SPP_INITIALIZATION_ERROR: The Bluetooth stack has reported that there was a problem initialising SPP."},
+    {25354, "BTS_SS1_ERROR_GOEP_INITIALIZATION_ERROR: The Bluetooth stack has reported that there was a problem initialising GOEP."},
+    {25355, "BTS_SS1_ERROR_OTP_INITIALIZATION_ERROR: The Bluetooth stack has reported that there was a problem initialising OTP."},
+    {25356, "BTS_SS1_ERROR_DEBUG_CALLBACK_ALREADY_INSTALLED: The Bluetooth stack has reported that a debug callback is already instancised."},
+    {25357, "BTS_SS1_ERROR_HCI_DRIVER_ERROR: The Bluetooth stack has reported that there is a HCI driver error."},
+    {25358, "BTS_SS1_ERROR_DEVICE_RESET_ERROR: The Bluetooth stack has reported that there is a device reset error."},
+    {25359, "BTS_SS1_ERROR_HCI_RESPONSE_ERROR: The Bluetooth stack has reported that there is a HCI response error."},
+    {25360, "BTS_SS1_ERROR_HCI_TIMEOUT_ERROR: The Bluetooth stack has reported that there is a problem with a HCI timeout."},
+    {25361, "BTS_SS1_ERROR_UNSUPPORTED_HCI_VERSION: The Bluetooth stack has reported that the HCI version is not supported."},
+    {25362, "BTS_SS1_ERROR_UNKNOWN_SUPPORTED_FEATURES: The Bluetooth stack has reported that the target's features are unknown."},
+    {25363, "BTS_SS1_ERROR_UNKNOWN_HCI_BUFFER_SIZE: The Bluetooth stack has reported that there is a problem with the HCI buffer size."},
+    {25364, "BTS_SS1_ERROR_UNABLE_TO_REGISTER_EVENT_CALLBACK: The Bluetooth stack has reported that it is unable to register an event callback."},
+    {25365, "BTS_SS1_ERROR_UNABLE_TO_REGISTER_ACL_CALLBACK: The Bluetooth stack has reported that it is unable to register an ACL callback."},
+    {25366, "BTS_SS1_ERROR_UNABLE_TO_REGISTER_SCO_CALLBACK: The Bluetooth stack has reported that it is unable to register an SCO callback."},
+    {25367, "BTS_SS1_ERROR_SIGNALLING_MTU_EXCEEDED: "},
+    {25368, "BTS_SS1_ERROR_UNABLE_TO_REGISTER_PSM: "},
+    {25369, "BTS_SS1_ERROR_L2CAP_NOT_INITIALIZED: The Bluetooth stack has reported that the L2CAP is not initialised."},
+    {25370, "BTS_SS1_ERROR_UNABLE_TO_UNREGISTER_PSM: "},
+    {25371, "BTS_SS1_ERROR_PSM_NOT_REGISTERED: "},
+    {25372, "BTS_SS1_ERROR_ATTEMPTING_CONNECTION_TO_DEVICE: "},
+    {25373, "BTS_SS1_ERROR_ACCEPTING_CONNECTION_FROM_DEVICE: "},
+    {25374, "BTS_SS1_ERROR_INVALID_FLUSH_TIMEOUT_VALUE: "},
+    {25375, "BTS_SS1_ERROR_INVALID_STATE_FOR_CONFIG: "},
+    {25376, "BTS_SS1_ERROR_ADDING_CID_INFORMATION: "},
+    {25377, "BTS_SS1_ERROR_ADDING_CONNECTION_INFORMATION: "},
+    {25378, "BTS_SS1_ERROR_ADDING_IDENTIFIER_INFORMATION: "},
+    {25379, "BTS_SS1_ERROR_INVALID_CONNECTION_STATE: The Bluetooth stack has reported that it is in an invalid connection state."},
+    {25380, "BTS_SS1_ERROR_CHANNEL_NOT_IN_OPEN_STATE: "},
+    {25381, "BTS_SS1_ERROR_INVALID_CID: "},
+    {25382, "BTS_SS1_ERROR_WRITING_DATA_TO_DEVICE: "},
+    {25383, "BTS_SS1_ERROR_MEMORY_ALLOCATION_ERROR: There was an error allocating memory for the Bluetooth stack, try using less resources and repeat the operation."},
+    {25384, "BTS_SS1_ERROR_NEGOTIATED_MTU_EXCEEDED: The negotiated MTU size has been exceeded."},
+    {25385, "BTS_SS1_ERROR_CONECTIONLESS_MTU_EXCEEDED: "},
+    {25386, "BTS_SS1_ERROR_CID_NOT_GROUP_CID: "},
+    {25387, "BTS_SS1_ERROR_GROUP_MEMBER_ALREADY_EXISTS: "},
+    {25388, "BTS_SS1_ERROR_GROUP_MEMBER_NOT_FOUND: "},
+    {25389, "BTS_SS1_ERROR_CONNECTION_TO_DEVICE_LOST: A connection to a target device has been lost."},
+    {25390, "BTS_SS1_ERROR_INVALID_CID_TYPE: "},
+    {25391, "BTS_SS1_ERROR_SDP_DATA_ELEMENT_EXPECTED: The Bluetooth stack has reported that an SDP data element was expected but was not found."},
+    {25392, "BTS_SS1_ERROR_SDP_INVALID_DATA_ELEMENT_LENGTH: The Bluetooth stack has reported that an SDP data element length is not valid."},
+    {25393, "BTS_SS1_ERROR_SDP_NOT_INITIALIZED: The Bluetooth stack has reported that SDP is not initialised."},
+    {25394, "BTS_SS1_ERROR_SDP_INVALID_DATA_ELEMENT: The Bluetooth stack has reported that an SDP data element is not valid."},
+    {25395, "BTS_SS1_ERROR_ADDING_SERVICE_ATTRIBUTE: "},
+    {25396, "BTS_SS1_ERROR_DELETING_SERVICE_RECORD: "},
+    {25397, "BTS_SS1_ERROR_EXPECTED_UUID_ENTRY: The Bluetooth stack has reported that it was expecting a UUID but one wasn't provided."},
+    {25398, "BTS_SS1_ERROR_SDP_INVALID_DATA_TYPE: "},
+    {25399, "BTS_SS1_ERROR_GAP_NOT_INITIALIZED: The GAP service has not been initialised in the Bluetooth stack."},
+    {25400, "BTS_SS1_ERROR_DEVICE_HCI_ERROR: There has been an HCI error with the Bluetooth stack."},
+    {25401, "BTS_SS1_ERROR_INVALID_MODE: The specified mode for the Bluetooth stack is not valid."},
+    {25402, "BTS_SS1_ERROR_ADDING_CALLBACK_INFORMATION: "},
+    {25403, "BTS_SS1_ERROR_DELETING_CALLBACK_INFORMATION: "},
+    {25404, "BTS_SS1_ERROR_NO_CALLBACK_REGISTERED: "},
+    {25405, "BTS_SS1_ERROR_SCO_NOT_INITIALIZED: The Bluetooth stack has reported that SCO is not initialised."},
+    {25406, "BTS_SS1_ERROR_MAX_SCO_CONNECTIONS: The Bluetooth stack has reported that the maximum number of SCO connections has been reached."},
+    {25407, "BTS_SS1_ERROR_INTERNAL_ERROR: An internal error has occured with the Bluetooth stack."},
+    {25408, "BTS_SS1_ERROR_INSUFFICIENT_BUFFER_SPACE: There is insufficient space available for a buffer for the Bluetooth stack."},
+    {25409, "BTS_SS1_ERROR_INSUFFICIENT_RESOURCES: The device does not have enough resources for the Bluetooth stack to perform this operation."},
+    {25410, "BTS_SS1_ERROR_RFCOMM_NOT_INITIALIZED: SPP has not been initialised, therefore it cannot be used."},
+    {25411, "BTS_SS1_ERROR_RFCOMM_ADDING_SERVER_INFORMATION: "},
+    {25412, "BTS_SS1_ERROR_RFCOMM_REMOVING_SERVER_INFORMATION: "},
+    {25413, "BTS_SS1_ERROR_RFCOMM_UNABLE_TO_ADD_CONNECTION_INFORMATION: "},
+    {25414, "BTS_SS1_ERROR_RFCOMM_UNABLE_TO_ADD_CHANNEL_INFORMATION: "},
+    {25415, "BTS_SS1_ERROR_RFCOMM_UNABLE_TO_CONNECT_TO_REMOTE_DEVICE: There was an error trying to connect with the target device over an SPP connection."},
+    {25416, "BTS_SS1_ERROR_RFCOMM_UNABLE_TO_COMMUNICATE_WITH_REMOTE_DEVICE: There was an error trying to communicate with the target device over an SPP connection."},
+    {25417, "BTS_SS1_ERROR_RFCOMM_INVALID_TEI: "},
+    {25418, "BTS_SS1_ERROR_RFCOMM_INVALID_DLCI: "},
+    {25419, "BTS_SS1_ERROR_RFCOMM_DISC_ALREADY_PENDING: An SPP disconnect event is currently already pending."},
+    {25420, "BTS_SS1_ERROR_RFCOMM_TEI_IS_DISCONNECTING: "},
+    {25421, "BTS_SS1_ERROR_RFCOMM_CONTROL_MESSAGE_CURRENTLY_PENDING: An SPP control message is currently already pending."},
+    {25422, "BTS_SS1_ERROR_RFCOMM_FLOW_IS_DISABLED: "},
+    {25423, "BTS_SS1_ERROR_RFCOMM_INVALID_MAX_FRAME_SIZE: The specified maximum frame size for SPP is not valid."},
+    {25424, "BTS_SS1_ERROR_RFCOMM_COMMAND_NOT_ALLOWED: "},
+    {25425, "BTS_SS1_ERROR_RFCOMM_ADDING_MESSAGE_INFORMATION: "},
+    {25426, "BTS_SS1_ERROR_RFCOMM_INVALID_FLOW_STATE: "},
+    {25427, "BTS_SS1_ERROR_RFCOMM_MAX_FRAME_SIZE_EXCEEDED: The Bluetooth stack has reported that the RFCOMM (SPP) maximum frame size has been exceeded."},
+    {25428, "BTS_SS1_ERROR_SPP_NOT_INITIALIZED: The Bluetooth stack has reported that SPP is not initialised."},
+    {25429, "BTS_SS1_ERROR_SPP_PORT_NOT_OPENED: The Bluetooth stack has reported that the SPP port is not currently open."},
+    {25430, "BTS_SS1_ERROR_SPP_BUFFER_FULL: The Bluetooth stack has reported that the SPP buffer is full and should be read out."},
+    {25431, "BTS_SS1_ERROR_OUTSTANDING_TRANSACTION: The Bluetooth stack has reported that there is currently an ongoing transaction."},
+    {25432, "BTS_SS1_ERROR_TIMER_VALUE_OUT_OF_RANGE: The Bluetooth stack has reported that a timer value is out of range."},
+    {25433, "BTS_SS1_ERROR_GOEP_NOT_INITIALIZED: "},
+    {25434, "BTS_SS1_ERROR_GOEP_COMMAND_NOT_ALLOWED: "},
+    {25435, "BTS_SS1_ERROR_OTP_NOT_INITIALIZED: "},
+    {25436, "BTS_SS1_ERROR_OTP_REQUEST_OUTSTANDING: "},
+    {25437, "BTS_SS1_ERROR_OTP_ERROR_PARSING_DATA: "},
+    {25438, "BTS_SS1_ERROR_OTP_ALREADY_CONNECTED: "},
+    {25439, "BTS_SS1_ERROR_OTP_NO_CONNECTION: "},
+    {25440, "BTS_SS1_ERROR_OTP_ACTION_NOT_ALLOWED: "},
+    {25441, "BTS_SS1_ERROR_DEVICE_NOT_CONNECTED: "},
+    {25442, "BTS_SS1_ERROR_ACTION_NOT_ALLOWED: "},
+    {25443, "BTS_SS1_ERROR_SPP_BUFFER_EMPTY: "},
+    {25444, "BTS_SS1_ERROR_VS_HCI_ERROR: "},
+    {25445, "BTS_SS1_ERROR_ALREADY_OUTSTANDING: "},
+    {25446, "BTS_SS1_ERROR_FEATURE_NOT_AVAILABLE: The Bluetooth stack has reported that this feature is not available."},
+    {25447, "BTS_SS1_ERROR_LOCAL_CONTROLLER_DOES_NOT_SUPPORT_LE: The Bluetooth stack has reported that the local controller does not support Bluetooth Low Energy."},
+    {25448, "BTS_SS1_ERROR_SCAN_ACTIVE: The Bluetooth stack has reported that there is currently an ongoing scan."},
+    {25449, "BTS_SS1_ERROR_SLAVE_CONNECTION_PRESENT: "},
+    {25450, "BTS_SS1_ERROR_INVALID_DEVICE_ROLE_MODE: "},
+    {25451, "BTS_SS1_ERROR_DEVICE_IS_SLAVE: "},
+    {25452, "BTS_SS1_ERROR_INVALID_CONNECTION_HANDLE: "},
+    {25453, "BTS_SS1_ERROR_READ_REMOTE_FEATURES_OUTSTANDING: The Bluetooth stack has reported that there is currently an ongoing remote feature read request."},
+    {25454, "BTS_SS1_ERROR_CREATE_CONNECTION_OUTSTANDING: The Bluetooth stack has reported that there is currently an ongoing connection attempt."},
+    {25455, "BTS_SS1_ERROR_INVALID_CONNECTION_PARAMETERS: "},
+    {25456, "BTS_SS1_ERROR_WHITE_LIST_SIZE_EXCEEDED: The Bluetooth stack has reported that the maximum size of the whitelist has been reached."},
+    {25457, "BTS_SS1_ERROR_WHITE_LIST_IN_USE: The Bluetooth stack has reported that whitelist is currently in use and therefore locked."},
+    {25458, "BTS_SS1_ERROR_INVALID_RANDOM_ADDRESS: The Bluetooth stack has reported that the random Bluetooth address is not valid."},
+    {25459, "BTS_SS1_ERROR_RANDOM_ADDRESS_IN_USE: The Bluetooth stack has reported that the random Bluetooth address is in use."},
+    {25460, "BTS_SS1_ERROR_PAIRING_ACTIVE: The Bluetooth stack is currently busy with a pairing request."},
+    {25461, "BTS_SS1_ERROR_PAIRING_NOT_ACTIVE: The Bluetooth stack can only respond to a pair request when a pairing is in progress."},
+    {25462, "BTS_SS1_ERROR_INVALID_STATE: "},
+    {25463, "BTS_SS1_ERROR_FEATURE_NOT_CURRENTLY_ACTIVE: The Bluetooth stack has reported that this feature is currently not active."},
+    {25536, "BTS_SS1_GATT_ERROR_INVALID_PARAMETER: The Bluetooth stack has reported that the specified GATT parameter is not valid."},
+    {25537, "BTS_SS1_GATT_ERROR_NOT_INITIALIZED: "},
+    {25538, "BTS_SS1_GATT_ERROR_CONTEXT_ALREADY_EXISTS: "},
+    {25539, "BTS_SS1_GATT_ERROR_INVALID_BLUETOOTH_STACK_ID: "},
+    {25540, "BTS_SS1_GATT_ERROR_INSUFFICIENT_RESOURCES: "},
+    {25541, "BTS_SS1_GATT_ERROR_INVALID_RESPONSE: "},
+    {25542, "BTS_SS1_GATT_ERROR_INVALID_OPERATION: The Bluetooth stack has reported that the specified GATT operation is not valid."},
+    {25543, "BTS_SS1_GATT_ERROR_INVALID_HANDLE_VALUE: The Bluetooth stack has reported that the specified GATT handle is not valid."},
+    {25544, "BTS_SS1_GATT_ERROR_INVALID_CONNECTION_ID: The Bluetooth stack has reported that the specified GATT connection is not valid."},
+    {25545, "BTS_SS1_GATT_ERROR_OUTSTANDING_REQUEST_EXISTS: The Bluetooth stack has reported that there is currently an ongoing GATT request."},
+    {25546, "BTS_SS1_GATT_ERROR_INVALID_SERVICE_TABLE_FORMAT: "},
+    {25547, "BTS_SS1_GATT_ERROR_INVALID_TRANSACTION_ID: "},
+    {25548, "BTS_SS1_GATT_ERROR_INSUFFICIENT_HANDLES: "},
+    {25549, "BTS_SS1_GATT_ERROR_INSUFFICIENT_HANDLES: "},
+    {25552, "BTS_SS1_HID_ERROR_INVALID_PARAMETER: "},
+    {25553, "BTS_SS1_HID_ERROR_NOT_INITIALIZED: "},
+    {25554, "BTS_SS1_HID_ERROR_INVALID_BLUETOOTH_STACK_ID: "},
+    {25555, "BTS_SS1_HID_ERROR_DUMMY: "},
+    {25556, "BTS_SS1_HID_ERROR_INSUFFICIENT_RESOURCES: "},
+    {25557, "BTS_SS1_HID_ERROR_INVALID_OPERATION: "},
+    {25558, "BTS_SS1_HID_ERROR_REQUEST_OUTSTANDING: "},
+    {25600, "BLE_SDM_LFCLK_SOURCE_UNKNOWN: "},
+    {25601, "BLE_SDM_INCORRECT_INTERRUPT_CONFIG: "},
+    {25602, "BLE_INCORRECT_CLENR0"},
+    {26112, "BLE_SOC_MUTEX_ALREADY_TAKEN: "},
+    {26113, "BLE_SOC_NVIC_INTERRUPT_NOT_AVAILABLE: "},
+    {26114, "BLE_SOC_NVIC_INTERRUPT_PRIORITY_NOT_ALLOWED: "},
+    {26115, "BLE_SOC_NVIC_SHOULD_NOT_RETURN: "},
+    {26116, "BLE_SOC_POWER_MODE_UNKNOWN: "},
+    {26117, "BLE_SOC_POWER_POF_THRESHOLD_UNKNOWN: "},
+    {26118, "BLE_SOC_POWER_OFF_SHOULD_NOT_RETURN: "},
+    {26119, "BLE_SOC_RAND_NOT_ENOUGH_VALUES: "},
+    {26120, "BLE_SOC_PPI_INVALID_CHANNEL: "},
+    {26121, "BLE_SOC_PPI_INVALID_GROUP: "},
+    {26625, "BLE_NOT_ENABLED: "},
+    {26626, "BLE_INVALID_CONN_HANDLE: The provided BLE connection handle is not valid."},
+    {26627, "BLE_INVALID_ATTR_HANDLE: The provided BLE attribute handle is not valid."},
+    {26628, "BLE_NO_TX_BUFFERS: "},
+    {26629, "BLE_INVALID_ROLE: "},
+    {26880, "BLE_L2CAP_CID_IN_USE: "},
+    {27136, "BLE_GAP_UUID_LIST_MISMATCH: "},
+    {27137, "BLE_GAP_DISCOVERABLE_WITH_WHITELIST: "},
+    {27138, "BLE_GAP_INVALID_BLE_ADDR: "},
+    {27392, "BLE_GATTC_PROC_NOT_PERMITTED: "},
+    {27648, "BLE_GATTS_INVALID_ATTR_TYPE: "},
+    {27649, "BLE_GATTS_SYS_ATTR_MISSING: "},
+    {27904, "BTS_HCI_STATUS_CODE_UNKNOWN_BTLE_COMMAND: "},
+    {27905, "BTS_HCI_STATUS_CODE_UNKNOWN_CONNECTION_IDENTIFIER: "},
+    {27906, "BTS_HCI_HARDWARE_FAILURE: "},
+    {27907, "BTS_HCI_PAGE_TIMEOUT: "},
+    {27908, "BTS_HCI_AUTHENTICATION_FAILURE: "},
+    {27909, "BTS_HCI_STATUS_CODE_PIN_OR_KEY_MISSING: "},
+    {27910, "BTS_HCI_MEMORY_CAPACITY_EXCEEDED: "},
+    {27911, "BTS_HCI_CONNECTION_TIMEOUT: "},
+    {27912, "BTS_HCI_CONNECTION_LIMIT_EXCEEDED: "},
+    {27913, "BTS_HCI_SYNC_CONN_LIMI_TO_A_DEVICE_EXCEEDED: "},
+    {27914, "BTS_HCI_ACL_CONNECTION_ALREADY_EXISTS: "},
+    {27915, "BTS_HCI_STATUS_CODE_COMMAND_DISALLOWED: "},
+    {27916, "BTS_HCI_CONN_REJECTED_DUE_TO_LIMITED_RESOURCES: "},
+    {27917, "BTS_HCI_CONN_REJECTED_DUE_TO_SECURITY_REASONS: "},
+    {27918, "BTS_HCI_HCI_CONN_REJECTED_DUE_TO_BD_ADDR: "},
+    {27919, "BTS_HCI_CONN_ACCEPT_TIMEOUT_EXCEEDED: "},
+    {27920, "BTS_HCI_UNSUPPORTED_FEATURE_ONPARM_VALUE: "},
+    {27921, "BTS_HCI_STATUS_CODE_INVALID_BTLE_COMMAND_PARAMETERS: "},
+    {27922, "BTS_HCI_REMOTE_USER_TERMINATED_CONNECTION: "},
+    {27923, "BTS_HCI_REMOTE_DEV_TERMINATION_DUE_TO_LOW_RESOURCES: "},
+    {27924, "BTS_HCI_REMOTE_DEV_TERMINATION_DUE_TO_POWER_OFF: "},
+    {27925, "BTS_HCI_LOCAL_HOST_TERMINATED_CONNECTION: "},
+    {27926, "BTS_HCI_REPEATED_ATTEMPTS: "},
+    {27927, "BTS_HCI_PAIRING_NOTALLOWED: "},
+    {27928, "BTS_HCI_LMP_PDU: "},
+    {27929, "BTS_HCI_UNSUPPORTED_REMOTE_FEATURE: The Bluetooth stack HCI controller has reported the remote feature is unsupported."},
+    {27930, "BTS_HCI_SCO_OFFSET_REJECTED: The Bluetooth stack HCI controller has rejected the SCO offset."},
+    {27931, "BTS_HCI_SCO_INTERVAL_REJECTED: The Bluetooth stack HCI controller has rejected the SCO interval."},
+    {27932, "BTS_HCI_SCO_AIR_MODE_REJECTED: The Bluetooth stack HCI controller has rejected the SCO air mode."},
+    {27933, "BTS_HCI_STATUS_CODE_INVALID_LMP_PARAMETERS: The Bluetooth stack HCI controller has reported invalid LMP parameters."},
+    {27934, "BTS_HCI_STATUS_CODE_UNSPECIFIED_ERROR: The Bluetooth stack HCI controller has reported an unknown error."},
+    {27935, "BTS_HCI_UNSUPPORTED_LMP_PARM_VALUE: The Bluetooth stack HCI controller has reported an unsupported LMP parameter value."},
+    {27936, "BTS_HCI_ROLE_CHANGE_NOT_ALLOWED: The Bluetooth stack HCI controller is not allow its role to be changed."},
+    {27937, "BTS_HCI_STATUS_CODE_LMP_RESPONSE_TIMEOUT: The Bluetooth stack HCI controller has reported a LMP response timeout."},
+    {27938, "BTS_HCI_LMP_ERROR_TRANSACTION_COLLISION: The Bluetooth stack HCI controller has reported a LMP transaction collision."},
+    {27939, "BTS_HCI_STATUS_CODE_LMP_PDU_NOT_ALLOWED: "},
+    {27940, "BTS_HCI_ENCRYPTION_MODE_NOT_ALLOWED: The Bluetooth stack HCI controller is not supporting encrypted mode at this time."},
+    {27941, "BTS_HCI_LINK_KEY_CAN_NOT_BE_CHANGED: The Bluetooth stack HCI controller does not support changing link keys."},
+    {27942, "BTS_HCI_REQUESTED_QOS_NOT_SUPPORTED: The Bluetooth stack HCI controller has reported that QOS is not supported."},
+    {27943, "BTS_HCI_INSTANT_PASSED: "},
+    {27944, "BTS_HCI_PAIRING_WITH_UNIT_KEY_UNSUPPORTED: The Bluetooth stack HCI controller has reported that trying to pair with a unit key is unsupported."},
+    {27945, "BTS_HCI_DIFFERENT_TRANSACTION_COLLISION: "},
+    {27946, "BTS_HCI_QOS_UNACCEPTABLE_PARAMETER: The Bluetooth stack HCI controller has reported an unacceptable QOS parameter."},
+    {27947, "BTS_HCI_QOS_REJECTED: The Bluetooth stack HCI controller has rejected the QOS."},
+    {27948, "BTS_HCI_CHANNEL_CLASSIFICATION_UNSUPPORTED: "},
+    {27949, "BTS_HCI_INSUFFICIENT_SECURITY: "},
+    {27950, "BTS_HCI_PARAMETER_OUT_OF_MANDATORY_RANGE: "},
+    {27951, "BTS_HCI_ROLE_SWITCH_PENDING: The Bluetooth stack HCI controller has reported that a role switch is currently pending."},
+    {27952, "BTS_HCI_RESERVED_SLOT_VIOLATION: "},
+    {27953, "BTS_HCI_ROLE_SWITCH_FAILED: The Bluetooth stack HCI controller has reported that a pending role switch has failed."},
+    {27954, "BTS_HCI_EXTENDED_INQUIRY_RESP_TOO_LARGE: The Bluetooth stack HCI controller has reported that an extended inquiry response is too large."},
+    {27955, "BTS_HCI_SSP_NOT_SUPPORTED_BY_HOST: The Bluetooth stack HCI controller has reported that SSP (Simple Secure Pairing) is not supported by the host device."},
+    {27956, "BTS_HCI_HOST_BUSY_PAIRING: The Bluetooth stack HCI controller is current busy processing a pair request."},
+    {27957, "BTS_HCI_CONN_REJ_DUETO_NO_SUITABLE_CHN_FOUND: The Bluetooth stack HCI controller has rejected a connection because no suitable channel was found."},
+    {27958, "BTS_HCI_CONTROLLER_BUSY: The Bluetooth stack HCI controller is currently busy with another operation."},
+    {27959, "BTS_HCI_CONN_INTERVAL_UNACCEPTABLE: The Bluetooth stack HCI connection interval is not valid."},
+    {27960, "BTS_HCI_DIRECTED_ADVERTISER_TIMEOUT: "},
+    {27961, "BTS_HCI_CONN_TERMINATED_DUE_TO_MIC_FAILURE: "},
+    {27962, "BTS_HCI_CONN_FAILED_TO_BE_ESTABLISHED: The Bluetooth stack HCI controller reported that a connection attempt failed."},
+    {27963, "BTS_HCI_MAC_CONNECTION_FAILED: "},
+    {28671, "BLE_HIGHEST_ERROR: "},
+    {28928, "STREAM_ALREADY_ESTABLISHED: There already is a stream established."},
+    {28929, "STREAM_NOT_ESTABLISHED: The provided stream bridge handle is not an established bridge."},
+    {28930, "STREAM_INVALID_HANDLE: The provided stream bridge handle is not valid."},
+    {28931, "STREAM_MAX_PORTS_REACHED: The maximum number of stream ports has been reached."},
+    {28932, "STREAM_INVALID_PORT: The provided port for a stream is not valid."},
+    {28933, "STREAM_INVALID_MODE: The provided mode for a stream is not valid."},
+    {28934, "STREAM_INVALID_BRIDGE: The stream bridge ID provided is not valid."},
+    {28935, "STREAM_MAX_BRIDGES_REACHED: The maximum number of stream bridges has been reached and no more can be created."},
+    {28936, "STREAM_INV_INDEX: The stream index provided is not valid."},
+    {29184, "HID_INVALID_HANDLE: The HID handle provided is not valid."},
+    {29185, "HID_MAX_REPORTS: "},
+    {29186, "HID_MALLOC_FAILED: Failed to alloc memory for HID, please try to reduce the number of variables used to free up additional space and try again."},
+    {29187, "HID_REPORT_LEN_EXCEEDED: "},
+    {29188, "HID_ELEMENT_LEN_EXCEEDED: "},
+    {29189, "HID_INVALID_REPORT_LEN: "},
+    {29190, "HID_INVALID_BIT_LEN: "},
+    {29191, "HID_INVALID_BIT_OFFSET: "},
+    {29440, "LORAMAC_HANDLE_NOT_AVAILABLE: "},
+    {29441, "LORAMAC_INVALID_FREQ_CHANNEL: "},
+    {29442, "LORAMAC_INVALID_FREQ: "},
+    {29443, "LORAMAC_INVALID_DATA_RATE: "},
+    {29444, "LORAMAC_WRITEREG_FAIL: "},
+    {29445, "LORAMAC_INVALID_SPREADING_FACTOR: "},
+    {29446, "LORAMAC_INVALID_BANDWIDTH: "},
+    {29447, "LORAMAC_INVALID_CODING_RATE: "},
+    {29448, "LORAMAC_INVALID_CRC: "},
+    {29449, "LORAMAC_INVALID_PARAMETER: "},
+    {29450, "LORAMAC_INVALID_POWER_BAND: "},
+    {29451, "LORAMAC_INVALID_POWER: "},
+    {29452, "LORAMAC_INVALID_PA_RAMP: "},
+    {29453, "LORAMAC_INVALID_MODE: "},
+    {29454, "LORAMAC_BUFFER_TOO_LARGE: "},
+    {29455, "LORAMAC_INVALID_DEVEUI: "},
+    {29456, "LORAMAC_INVALID_APPEUI: "},
+    {29457, "LORAMAC_INVALID_CONNECTTYPE: "},
+    {29458, "LORAMAC_INVALID_KEY: "},
+    {29459, "LORAMAC_INVALID_CONFIG_LEN: "},
+    {29460, "LORAMAC_TRANSMISSION_IN_PROGRESS: "},
+    {29461, "LORAMAC_DEVEUI_NOTSET: "},
+    {29462, "LORAMAC_APPEUI_NOTSET: "},
+    {29463, "LORAMAC_APPKEY_NOTSET: "},
+    {29464, "LORAMAC_NWKSKEY_NOTSET: "},
+    {29465, "LORAMAC_APPSKEY_NOTSET: "},
+    {29466, "LORAMAC_DEVADDR_NOTSET: "},
+    {29467, "LORAMAC_RX_BUFFER_EMPTY: "},
+    {29468, "LORAMAC_TIMER_NOT_RUNNING: "},
+    {29469, "LORAMAC_NO_SPACE: "},
+    {29470, "LORAMAC_VDD_OUT_OF_RANGE: "},
+    {29471, "LORAMAC_NOT_ALLOWED: "},
+    {29472, "LORAMAC_NO_NETWORK: "},
+    {29473, "LORAMAC_INVALID_TSCO: "},
+    {29474, "LORAMAC_INVALID_RTFE: "},
+    {29475, "LORAMAC_INVALID_DEV_ADDR: "},
+    {29476, "LORAMAC_UNEXPECTED_VALUE: "},
+    {29477, "LORAMAC_BUSY: "},
+    {29478, "LORAMAC_UNKNOWN_ERROR: "},
+    {29479, "LORAMAC_INVALID_DEBUG_SETTING: "},
+    {29480, "LORAMAC_DEBUG_ALREADY_ENABLED: "},
+    {29481, "LORAMAC_SAME_DEBUG_SIOS_SELECTED: "},
+    {29482, "LORAMAC_NOT_IN_TEST_MODE: "},
+    {29483, "LORAMAC_FREQUENCY_INVALID: "},
+    {29484, "LORAMAC_DATARATE_INVALID: "},
+    {29485, "LORAMAC_FREQUANDDR_INVALID: "},
+    {29486, "LORAMAC_REGION_NOT_SUPPORTED: "},
+    {57345, "PARM_OUT_OF_RANGE: A supplied parameter is not valid."},
+    {57346, "UNEXPECTED_PARM: A parameter was supplied when it was not expected."},
+    {57347, "NO_NETWORK_FOUND: "},
+    {57348, "NAMED_NETWORK_NOT_FOUND: "},
+    {57349, "SYNTAX_ERROR: "},
+    {57350, "ATTACH_FAILURE: "},
+    {57351, "UNKNOWN_COMMAND: The provided command does not exist."},
+    {57352, "NOTHING_TO_DETACH: "},
+    {57353, "INVALID_FILENAME: A filename provided is not valid."},
+    {57354, "GENERIC_ERROR: "},
+    {57355, "EMPTY_FILENAME: An empty filename was supplied, the device cannot create or open files that lack a filename."},
+    {57356, "FILENAME_TOO_LONG: The filename supplied is too long, the name will need to be shortened."},
+    {57357, "UNKNOWN_SUBCOMMAND: "},
+    {57358, "INCORRECT_MODE: The device is in the wrong mode. If a file download has failed, please reset the module using 'atz' and try the command again."},
+    {57359, "ALREADY_COMPILING: The target device is already busy compiling."},
+    {57360, "MEDIA_FULL: "},
+    {57361, "OPEN_FAIL: Opening a file handle failed, this could be because the file does not exist or because it's currently in use."},
+    {57362, "FILE_EXISTS: A file with that name already exists on the filesystem."},
+    {57363, "ERASE_FAIL: Erasing a file on the device failed, this may be because the file is currently in use and/or locked."},
+    {57364, "TOKENISE_FAIL: "},
+    {57365, "NOT_COMPILING: "},
+    {57366, "UNTERMINATED_ROUTINE: "},
+    {57367, "UNTERMINATED_BLOCK: "},
+    {57368, "FILE_MISSING: The specified file cannot be found on the filesystem and so cannot be opened."},
+    {57369, "OUT_OF_HEAPMEM: "},
+    {57370, "CORRUPT_FILE: The file you are attempting to access is corrupt and cannot be used. This may indicate a power failure whilst the file was being written."},
+    {57371, "NOT_DIRECT_ADDRESSABLE: "},
+    {57372, "FILE_READ_ERROR: There was an error trying to read the specified file."},
+    {57373, "NULL_POINTER: A provided parameter is null."},
+    {57374, "INTEGER_EXPECTED: An integer was expected but was not found."},
+    {57375, "DBKEY_UNKNOWN: "},
+    {57376, "DBKEY_TRUNCATED: "},
+    {57377, "CONST_TRUNCATION: The data supplied is too large to successfully fit in and has been truncated."},
+    {57378, "CONFIG_FAIL: There was an error whilst attempting to read a configuration key."},
+    {57379, "VAR_EXPECTED: A variable was expected but was not found, constant strings cannot be used here."},
+    {57380, "INDEX_MISSING: An array was addressed but no index was provided."},
+    {57381, "INDEX_INVALID: An array was addressed with an index that is not valid."},
+    {57382, "VALUE_EXPECTED: "},
+    {57383, "TYPE_MISMATCH: "},
+    {57384, "VALUE_OVERFLOW: "},
+    {57385, "CANNOT_RESUME: "},
+    {57386, "NO_FACTORY_DEF: There is no factory default value for this setting."},
+    {57387, "ABORTED_FILE: "},
+    {57388, "FAIL_OPENFILE: Opening a file handle failed, this could be because the file does not exist or because it's currently in use."},
+    {57389, "UNKNOWN_PARM: "},
+    {57390, "CMDBUF_OVERFLOW: "},
+    {57391, "STOPPED: "},
+    {57392, "RUNTIME_ERROR: "},
+    {57393, "DISK_FULL: The device filesystem is full and has no more free space left, writing to files will fail and data will be lost."},
+    {57394, "RTN_NAME_EXPECTED: "},
+    {57395, "MISSING_ARGS: An argument was expected but was not found."},
+    {57396, "ARG_ERROR: "},
+    {57397, "REF_EXPECTED: "},
+    {57398, "NO_SCRIPT_CONTEXT: No script is currently executing."},
+    {57399, "NO_FILE_TO_CLOSE: An error occured whilst trying to close a file because no file handle was open."},
+    {57400, "FILE_NOT_OPEN: Reading from or writing to a file was not successful because no file is open."},
+    {57401, "FILE_WRITE_ERROR: An error occured whilst writing to a file, this could indicate a fatal error with the device memory."},
+    {57402, "BREAKPOINTED: The device has encounted a breakpoint and is awaiting additional debug commands."},
+    {57403, "CANNOT_STEPOVER: Unable to stepover this part of the application in debug mode."},
+    {57404, "MEDIA_CORRUPT: The filesystem on the device is corrupt and unstable, this could indicate a fatal error with the device memory."},
+    {57405, "FILENAME_SAME: Cannot rename file: Both filenames provided are the same."},
+    {57406, "NOT_COMPILING_TABLE: "},
+    {57407, "SKEY_CONTEXT_MISSING: "},
+    {57408, "DISABLED_COMMAND: This function has been disabled and cannot be used."},
+    {57409, "RTC_INVALID_TIME: "},
+    {57410, "RTC_INVALID_TIME_STRING: "},
+    {57411, "RTC_INVALID_DATE: "},
+    {57412, "RTC_INVALID_DATE_STRING: "},
+    {57413, "COMMAND_FAILED: "}
+};
+
+constexpr qint32 ERROR_CODE_TABLE_SIZE = sizeof(ERROR_CODE_TABLE)/sizeof(ERROR_CODE_TABLE[0]);
+
+#endif // ERRORCODES_H
+
+/******************************************************************************/
+// END OF FILE
+/******************************************************************************/
@@ -26,14 +26,7 @@
 //=============================================================================
 ErrorLookup::ErrorLookup(QObject *parent) : QObject(parent)
 {
-    //Constructor
-    bIsOpen = false;
-    if (QFile::exists(":/Internal/codes.csv"))
-    {
-        //Internal error code file exists - open it
-        bIsOpen = true;
-        stgErrorMessages = new QSettings(QString(":/Internal/codes.csv"), QSettings::IniFormat);
-    }
+    //Constructor, the error codes are compiled in from codes.csv (see generate_errorcodes.py) so there is nothing to load
 }
 
 //=============================================================================
@@ -42,10 +35,6 @@ ErrorLookup::~ErrorLookup(
     )
 {
     //Destructor
-    if (bIsOpen == true)
-    {
-        delete stgErrorMessages;
-    }
 }
 
 //=============================================================================
@@ -55,12 +44,26 @@ ErrorLookup::LookupError(
     qint32 nErrorCode
     )
 {
-    //Returns the string of an error code
-    if (bIsOpen == false)
+    //Returns the string of an error code, found by a binary search of the table which is sorted by code
+    qint32 nLow = 0;
+    qint32 nHigh = ERROR_CODE_TABLE_SIZE - 1;
+    while (nLow <= nHigh)
     {
-        return "Undefined Error Code";
+        qint32 nMiddle = nLow + (nHigh - nLow)/2;
+        if (ERROR_CODE_TABLE[nMiddle].nCode == nErrorCode)
+        {
+            return QString::fromLatin1(ERROR_CODE_TABLE[nMiddle].strMessage);
+        }
+        else if (ERROR_CODE_TABLE[nMiddle].nCode < nErrorCode)
+        {
+            nLow = nMiddle + 1;
+        }
+        else
+        {
+            nHigh = nMiddle - 1;
+        }
     }
-    return stgErrorMessages->value(QString::number(nErrorCode), "Undefined Error Code").toString();
+    return "Undefined Error Code";
 }
 
 //=============================================================================
@@ -70,11 +73,7 @@ ErrorLookup::DatabaseVersion(
     )
 {
     //Returns the version of the error code database
-    if (bIsOpen == false)
-    {
-        return "(Not Loaded)";
-    }
-    return stgErrorMessages->value("Version", "0.00").toString();
+    return ERROR_CODE_DATABASE_VERSION;
 }
 
 /******************************************************************************/
@@ -27,8 +27,8 @@
 // Include Files
 /******************************************************************************/
 #include <QObject>
-#include <QSettings>
-#include <QFile>
+#include <QString>
+#include "errorcodes.h"
 #include "target.h"
 
 /******************************************************************************/
@@ -51,10 +51,6 @@ public:
     QString
     DatabaseVersion(
         );
-
-private:
-    QSettings *stgErrorMessages;
-    bool bIsOpen;
 };
 
 #endif // ERRORLOOKUP_H
@@ -0,0 +1,155 @@
+#!/usr/bin/env python3
+###############################################################################
+## Copyright (C) 2018 Laird
+##
+## Project: UwVSP-OTA
+##
+## Module: generate_errorcodes.py
+##
+## Notes: Generates errorcodes.h, a table of module error codes sorted by code,
+##        from codes.csv. codes.csv is the source of truth, regenerate the
+##        table whenever it changes. With --check nothing is written and the
+##        exit code is 1 if errorcodes.h does not match codes.csv.
+##
+## License: This program is free software: you can redistribute it and/or
+##          modify it under the terms of the GNU General Public License as
+##          published by the Free Software Foundation, version 3.
+##
+##          This program is distributed in the hope that it will be useful,
+##          but WITHOUT ANY WARRANTY; without even the implied warranty of
+##          MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+##          GNU General Public License for more details.
+##
+##          You should have received a copy of the GNU General Public License
+##          along with this program.  If not, see http://www.gnu.org/licenses/
+##
+###############################################################################
+import os
+import sys
+
+HEADER = """/******************************************************************************
+** Copyright (C) 2018 Laird
+**
+** Project: UwVSP-OTA
+**
+** Module: errorcodes.h
+**
+** Notes: Generated from codes.csv by generate_errorcodes.py, do not edit.
+**
+** License: This program is free software: you can redistribute it and/or
+**          modify it under the terms of the GNU General Public License as
+**          published by the Free Software Foundation, version 3.
+**
+**          This program is distributed in the hope that it will be useful,
+**          but WITHOUT ANY WARRANTY; without even the implied warranty of
+**          MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+**          GNU General Public License for more details.
+**
+**          You should have received a copy of the GNU General Public License
+**          along with this program.  If not, see http://www.gnu.org/licenses/
+**
+*******************************************************************************/
+#ifndef ERRORCODES_H
+#define ERRORCODES_H
+
+/******************************************************************************/
+// Include Files
+/******************************************************************************/
+#include <QtGlobal>
+
+/******************************************************************************/
+// Structures
+/******************************************************************************/
+struct ErrorCodeEntry
+{
+    qint32 nCode;
+    const char *strMessage;
+};
+
+/******************************************************************************/
+// Constants
+/******************************************************************************/
+//Version of codes.csv the table was generated from
+constexpr char ERROR_CODE_DATABASE_VERSION[] = "%(version)s";
+
+//Error codes and their messages, sorted by code
+constexpr ErrorCodeEntry ERROR_CODE_TABLE[] = {
+%(entries)s
+};
+
+constexpr qint32 ERROR_CODE_TABLE_SIZE = sizeof(ERROR_CODE_TABLE)/sizeof(ERROR_CODE_TABLE[0]);
+
+#endif // ERRORCODES_H
+
+/******************************************************************************/
+// END OF FILE
+/******************************************************************************/
+"""
+
+
+def unquote(value):
+    """Returns a value as QSettings reads it from an INI file"""
+    value = value.strip()
+    if len(value) < 2 or value[0] != '"' or value[-1] != '"':
+        return value
+    result = []
+    i = 1
+    while i < len(value) - 1:
+        if value[i] == '\\' and i + 1 < len(value) - 1:
+            i += 1
+            result.append({'n': '\n', 'r': '\r', 't': '\t'}.get(value[i], value[i]))
+        else:
+            result.append(value[i])
+        i += 1
+    return ''.join(result)
+
+
+def quote(text):
+    """Returns text as a C string literal"""
+    return '"' + text.replace('\\', '\\\\').replace('"', '\\"').replace('\n', '\\n').replace('\r', '\\r').replace('\t', '\\t') + '"'
+
+
+def generate(csv_path):
+    """Reads codes.csv and returns the contents of errorcodes.h, a code defined twice takes the later message as QSettings did"""
+    codes = {}
+    version = '0.00'
+    with open(csv_path, 'r', encoding='utf-8') as csv_file:
+        for line in csv_file:
+            line = line.strip()
+            if not line or line.startswith('[') or line.startswith(';') or '=' not in line:
+                continue
+            key, value = line.split('=', 1)
+            key = key.strip()
+            if key == 'Version':
+                version = unquote(value)
+            elif key.lstrip('-').isdigit():
+                codes[int(key)] = unquote(value)
+    entries = ',\n'.join('    {%d, %s}' % (code, quote(codes[code])) for code in sorted(codes))
+    return HEADER % {'version': version, 'entries': entries}
+
+
+def main():
+    directory = os.path.dirname(os.path.abspath(__file__))
+    arguments = [argument for argument in sys.argv[1:] if argument != '--check']
+    csv_path = arguments[0] if len(arguments) > 0 else os.path.join(directory, 'codes.csv')
+    header_path = arguments[1] if len(arguments) > 1 else os.path.join(directory, 'errorcodes.h')
+    header = generate(csv_path)
+
+    if '--check' in sys.argv[1:]:
+        try:
+            with open(header_path, 'r', encoding='utf-8', newline='') as header_file:
+                current = header_file.read()
+        except OSError:
+            current = None
+        if current != header:
+            sys.stderr.write('%s is out of date, run generate_errorcodes.py to regenerate it from %s\n' % (header_path, csv_path))
+            return 1
+        return 0
+
+    with open(header_path, 'w', encoding='utf-8', newline='\n') as header_file:
+        header_file.write(header)
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())
@@ -31,9 +31,11 @@ main(
     char *argv[]
     )
 {
-    //Start Qt application execution
+    //Start Qt application execution, timing start-up from here
+    QElapsedTimer tmrLaunch;
+    tmrLaunch.start();
     QApplication a(argc, argv);
-    MainWindow w;
+    MainWindow w(NULL, tmrLaunch);
     w.show();
     return a.exec();
 }
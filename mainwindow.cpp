@@ -28,8 +28,19 @@ QString gstrToastString;
 
 //=============================================================================
 //=============================================================================
-MainWindow::MainWindow(QWidget *parent) : QMainWindow(parent), ui(new Ui::MainWindow)
+MainWindow::MainWindow(QWidget *parent, QElapsedTimer tmrLaunch) : QMainWindow(parent), ui(new Ui::MainWindow)
 {
+    //Start-up timing is measured from application launch if the caller timed it, otherwise from here
+    tmrLaunchTimer = tmrLaunch;
+    if (!tmrLaunchTimer.isValid())
+    {
+        tmrLaunchTimer.start();
+    }
+    nFirstFrameTime = -1;
+    nScanReadyTime = -1;
+    bFirstFrameQueued = false;
+    bStartupLayoutDone = false;
+
     //Setup GUI
     ui->setupUi(this);
 
@@ -38,7 +49,8 @@ MainWindow::MainWindow(QWidget *parent) : QMainWindow(parent), ui(new Ui::MainWi
     QDesktopServices::setUrlHandler("file", this, "StartupFileLoad");
 #endif
 
-    //Load the images/animations
+    //Load the standby image, the busy animation is loaded when first needed
+    movieLoadingAnimation = NULL;
     LoadImages();
 
     //Add loading image to the status bar
@@ -67,17 +79,14 @@ MainWindow::MainWindow(QWidget *parent) : QMainWindow(parent), ui(new Ui::MainWi
     //Clear variables
     unWrittenBytes = 0;
     unRecDatSize = 0;
-    blesvcVSPService = NULL;
-    lecBLEController = NULL;
+    vtpTransport = NULL;
     unTotalSizeSent = 0;
     unTotalAppSize = 0;
     nSelectedFileType = 0;
-    strChecksumString = NULL;
-    chkChecksum = NULL;
-    bVSPBlocked = false;
+    nQueryMode = MAIN_MODE_QUERY;
+    unNegotiatedMTU = BLE_DEFAULT_MTU;
     bDisconnectActive = false;
     bIsConnected = false;
-    bHasModem = false;
 
     //Setup BLE discovery agent
     ddaDiscoveryAgent = new QBluetoothDeviceDiscoveryAgent();
@@ -86,28 +95,13 @@ MainWindow::MainWindow(QWidget *parent) : QMainWindow(parent), ui(new Ui::MainWi
     connect(ddaDiscoveryAgent, SIGNAL(finished()), this, SLOT(BTFinishedScan()));
     ddaDiscoveryAgent->setLowEnergyDiscoveryTimeout(TIMEOUT_BLE_SCAN);
 
-    //Setup device scan dialog
-    dlgScanDialog = new ScanSelection(this);
-    connect(dlgScanDialog, SIGNAL(DeviceSelected(QBluetoothDeviceInfo)), this, SLOT(ConnectToDevice(QBluetoothDeviceInfo)));
-    connect(dlgScanDialog, SIGNAL(WindowClosed()), this, SLOT(CancelScan()));
-    connect(dlgScanDialog, SIGNAL(ScanningFinished(quint8)), this, SLOT(SetLoadingStatus(quint8)));
-
-    //Setup file location selection dialog
-    dlgFileTypeDialog = new FileTypeSelection(this);
-    connect(dlgFileTypeDialog, SIGNAL(DisplayMessage(QString,bool)), this, SLOT(ExternalToastMessage(QString,bool)));
-    connect(dlgFileTypeDialog, SIGNAL(FileTypeChanged(qint8,QString)), this, SLOT(FileTypeChanged(qint8,QString)));
-
-    //Setup settings dialog
-    dlgSettingsView = new SettingsDialog(this);
-    connect(dlgSettingsView, SIGNAL(SaveSettings(QString,QString,QString,QString,QString,bool,
-#ifdef Q_OS_ANDROID
-        bool,
-#endif
-        quint8,bool,bool,quint8,bool,quint8,bool,bool,bool,bool)), this, SLOT(SettingsUpdated(QString,QString,QString,QString,QString,bool,
+    //Dialogs are created the first time they are shown
+    dlgScanDialog = NULL;
+    dlgFileTypeDialog = NULL;
+    dlgSettingsView = NULL;
 #ifdef Q_OS_ANDROID
-        bool,
+    afdFileDialog = NULL;
 #endif
-        quint8,bool,bool,quint8,bool,quint8,bool,bool,bool,bool)));
 
     //Setup disconnect clean up timer
     tmrDisconnectCleanUpTimer = new QTimer();
@@ -121,18 +115,12 @@ MainWindow::MainWindow(QWidget *parent) : QMainWindow(parent), ui(new Ui::MainWi
     tmrDisplayUpdateTimer->setInterval(80);
     connect(tmrDisplayUpdateTimer, SIGNAL(timeout()), this, SLOT(UpdateDisplay()));
 
-    //Setup response timeout timer
-    tmrResponseTimeoutTimer = new QTimer();
-    tmrResponseTimeoutTimer->setInterval(TIMEOUT_TIMER_INTERVAL);
-    tmrResponseTimeoutTimer->setSingleShot(true);
-    connect(tmrResponseTimeoutTimer, SIGNAL(timeout()), this, SLOT(TimeoutTimerElapsed()));
-
-    //Connect the downloader signals
+    //Connect the downloader signals, XCompile requests are made by the OTA session through the XCompile cache
     dwnDownloaderHandle = new Downloader();
-    connect(dwnDownloaderHandle, SIGNAL(XCompileComplete(bool,qint16,QByteArray)), this, SLOT(ProcessFileData(bool,qint16,QByteArray)));
-    connect(dwnDownloaderHandle, SIGNAL(FileDownloaded(bool,qint16,QByteArray)), this, SLOT(FileDownloaded(bool,qint16,QByteArray)));
-    connect(dwnDownloaderHandle, SIGNAL(FirmwareResponse(bool,qint16,QString)), this, SLOT(FirmwareVersionCheck(bool,qint16,QString)));
-    connect(dwnDownloaderHandle, SIGNAL(StatusChanged(quint8)), this, SLOT(DownloaderStatusChanged(quint8)));
+    unWebRequest = 0;
+    connect(dwnDownloaderHandle, SIGNAL(FileDownloaded(quint32,bool,qint16,QByteArray)), this, SLOT(FileDownloaded(quint32,bool,qint16,QByteArray)));
+    connect(dwnDownloaderHandle, SIGNAL(FirmwareResponse(quint32,bool,qint16,QString)), this, SLOT(FirmwareVersionCheck(quint32,bool,qint16,QString)));
+    connect(dwnDownloaderHandle, SIGNAL(StatusChanged(quint32,quint8)), this, SLOT(DownloaderStatusChanged(quint32,quint8)));
 
     //Load the settings
     stgSettingsHandle = new SettingsStorage(this);
@@ -146,7 +134,28 @@ MainWindow::MainWindow(QWidget *parent) : QMainWindow(parent), ui(new Ui::MainWi
     {
         //Settings opening failed
         QMessageBox::critical(this, "Configuration Write Failed", "Failed to write default configuration, please ensure you grant write access or errors and undesired operation may occur.", QMessageBox::Ok, QMessageBox::NoButton);
-    }
+        stgSettingsHandle->RefreshSnapshot();
+    }
+    pssSettings = stgSettingsHandle->GetSnapshot();
+    UpdateScrollbackSize();
+    xccXCompileCache.SetStorage(XCompileCache::DefaultDirectory(), (qint64)pssSettings->unXCompileCacheSize*1024*1024);
+    mscModuleCache.SetStorage(ModuleStateCache::DefaultFilename(), pssSettings->unModuleCacheTTL);
+    stlSessionLog.SetFilename(SessionTimingLog::DefaultFilename());
+    ptrPacketTracer.SetEnabled(pssSettings->bPacketTrace);
+
+    //Setup the OTA session, which queries the module and loads applications onto it
+    otsSession.SetXCompileCache(&xccXCompileCache);
+    otsSession.SetModuleStateCache(&mscModuleCache);
+    otsSession.SetTransferCheckpoint(&trcCheckpoint);
+    otsSession.SetPacketTracer(&ptrPacketTracer);
+    connect(&otsSession, SIGNAL(StageChanged(quint8)), this, SLOT(SessionStageChanged(quint8)));
+    connect(&otsSession, SIGNAL(Progress(qint32,qint32)), this, SLOT(SessionProgress(qint32,qint32)));
+    connect(&otsSession, SIGNAL(ModuleDetails(QString,QString)), this, SLOT(SessionModuleDetails(QString,QString)));
+    connect(&otsSession, SIGNAL(InsufficientSpace(qint32,qint32)), this, SLOT(SessionInsufficientSpace(qint32,qint32)));
+    connect(&otsSession, SIGNAL(PacketWritten(QByteArray)), this, SLOT(SessionPacketWritten(QByteArray)));
+    connect(&otsSession, SIGNAL(PipelineStalled()), this, SLOT(SessionPipelineStalled()));
+    connect(&otsSession, SIGNAL(Notice(QString)), this, SLOT(SessionNotice(QString)));
+    connect(&otsSession, SIGNAL(Finished(bool,QString)), this, SLOT(SessionFinished(bool,QString)));
 
     //Android: Check for bluetooth permissions
 #ifdef Q_OS_ANDROID
@@ -182,20 +191,6 @@ MainWindow::MainWindow(QWidget *parent) : QMainWindow(parent), ui(new Ui::MainWi
     ui->label_Notification->deleteLater();
 #endif
 
-    //Setup regular expression objects
-    rxpDevName.setPattern("\t0\t([a-zA-Z0-9\\-_]{3,20})\r");
-    rxpDevName.setPatternOptions(QRegularExpression::MultilineOption);
-    rxpXCompiler.setPattern("\t13\t([a-zA-Z0-9]{4}) ([a-zA-Z0-9]{4})");
-    rxpXCompiler.setPatternOptions(QRegularExpression::MultilineOption);
-    rxpFreeSpace.setPattern("\t6\t([0-9]+),([0-9]+),([0-9]+)\r");
-    rxpFreeSpace.setPatternOptions(QRegularExpression::MultilineOption);
-    rxpFirmware.setPattern("\t3\t([0-9a-zA-Z\\-\\_\\.]+)\r");
-    rxpFirmware.setPatternOptions(QRegularExpression::MultilineOption);
-    rxpErrorCode.setPattern("\n01\t([a-fA-f0-9]+)\r");
-    rxpErrorCode.setPatternOptions(QRegularExpression::MultilineOption);
-    rxpCRC.setPattern("\n10\t49452\t([0-9A-Fa-f]{4})\r\n");
-    rxpCRC.setPatternOptions(QRegularExpression::MultilineOption);
-
     //Calculate space required for loading image
     QFontMetrics fmFontMet(ui->statusBar->font());
     nStatusBarSpaces = ceilf(((float)LOADING_IMAGE_WIDTH / (float)fmFontMet.width(" ")));
@@ -243,28 +238,14 @@ MainWindow::~MainWindow(
     )
 {
     //Destructor
-    if (blesvcVSPService != NULL)
-    {
-        //Clean up VSP service
-        disconnect(this, SLOT(VSPServiceCharacteristicChanged(QLowEnergyCharacteristic,QByteArray)));
-        disconnect(this, SLOT(VSPServiceCharacteristicWritten(QLowEnergyCharacteristic,QByteArray)));
-        disconnect(this, SLOT(VSPServiceDescriptorWritten(QLowEnergyDescriptor,QByteArray)));
-        disconnect(this, SLOT(VSPServiceError(QLowEnergyService::ServiceError)));
-        disconnect(this, SLOT(VSPServiceStateChanged(QLowEnergyService::ServiceState)));
-        delete blesvcVSPService;
-        blesvcVSPService = NULL;
-    }
-
-    if (lecBLEController != NULL)
+    disconnect(&otsSession, 0, this, 0);
+    otsSession.Cancel();
+    if (vtpTransport != NULL)
     {
-        //Clean up BLE controller
-        disconnect(this, SLOT(BLEConnected()));
-        disconnect(this, SLOT(BLEDisconnected()));
-        disconnect(this, SLOT(BLEDiscoveryFinished()));
-        disconnect(this, SLOT(BLEError(QLowEnergyController::Error)));
-        disconnect(this, SLOT(BLEDiscovered(QBluetoothUuid)));
-        disconnect(this, SLOT(BLEStateChanged(QLowEnergyController::ControllerState)));
-        lecBLEController->deleteLater();
+        //Clean up the connection to the module, which disconnects from it
+        disconnect(vtpTransport, 0, this, 0);
+        delete vtpTransport;
+        vtpTransport = NULL;
     }
 
     if (stgSettingsHandle != NULL)
@@ -284,18 +265,15 @@ MainWindow::~MainWindow(
     //Clean up timers
     disconnect(this, SLOT(ClearVar()));
     disconnect(this, SLOT(UpdateDisplay()));
-    disconnect(this, SLOT(TimeoutTimerElapsed()));
     delete tmrDisconnectCleanUpTimer;
     delete tmrDisplayUpdateTimer;
-    delete tmrResponseTimeoutTimer;
 
     if (dwnDownloaderHandle != NULL)
     {
         //Clean up downloader object
-        disconnect(dwnDownloaderHandle, SIGNAL(XCompileComplete(bool,qint16,QByteArray)));
-        disconnect(dwnDownloaderHandle, SIGNAL(FileDownloaded(bool,qint16,QByteArray)));
-        disconnect(dwnDownloaderHandle, SIGNAL(FirmwareResponse(bool,qint16,QString)));
-        disconnect(dwnDownloaderHandle, SIGNAL(StatusChanged(quint8)));
+        disconnect(dwnDownloaderHandle, SIGNAL(FileDownloaded(quint32,bool,qint16,QByteArray)));
+        disconnect(dwnDownloaderHandle, SIGNAL(FirmwareResponse(quint32,bool,qint16,QString)));
+        disconnect(dwnDownloaderHandle, SIGNAL(StatusChanged(quint32,quint8)));
         delete dwnDownloaderHandle;
     }
 
@@ -304,21 +282,12 @@ MainWindow::~MainWindow(
     disconnect(this, SLOT(BTError(QBluetoothDeviceDiscoveryAgent::Error)));
     disconnect(this, SLOT(BTFinishedScan()));
     disconnect(this, SLOT(ConnectToDevice(QBluetoothDeviceInfo)));
-    delete dlgScanDialog;
-    delete ddaDiscoveryAgent;
-
-    //Clean up checksum variables if used
-    if (strChecksumString != NULL)
+    if (dlgScanDialog != NULL)
     {
-        delete strChecksumString;
-        strChecksumString = NULL;
-    }
-
-    if (chkChecksum != NULL)
-    {
-        delete chkChecksum;
-        chkChecksum = NULL;
+        //Clean up scan dialog
+        delete dlgScanDialog;
     }
+    delete ddaDiscoveryAgent;
 
 #ifdef Q_OS_ANDROID
     if (afdFileDialog != NULL)
@@ -337,7 +306,8 @@ MainWindow::~MainWindow(
 #ifdef Q_OS_ANDROID
             bool,
 #endif
-            quint8,bool,bool,quint8,bool,quint8,bool,bool,bool,bool)));
+            quint16,bool,bool,quint8,bool,quint32,bool,bool,bool,bool,bool,quint8,quint8,quint16,bool,quint32,bool,bool,bool)));
+        disconnect(this, SLOT(SavePacketTrace()));
         delete dlgSettingsView;
         dlgSettingsView = NULL;
     }
@@ -350,8 +320,12 @@ MainWindow::~MainWindow(
     //Remove added objects
     ui->statusBar->removeWidget(labelStatusBarLoader);
     delete labelStatusBarLoader;
-    movieLoadingAnimation->stop();
-    delete movieLoadingAnimation;
+    if (movieLoadingAnimation != NULL)
+    {
+        //Clean up busy animation
+        movieLoadingAnimation->stop();
+        delete movieLoadingAnimation;
+    }
     delete pixmapStandbyPicture;
 
     //Clean up the UI
@@ -414,7 +388,7 @@ MainWindow::BTFinishedScan(
     )
 {
     //Bluetooth scan finished
-    dlgScanDialog->SetStatus(STATUS_STANDBY);
+    ScanDialog()->SetStatus(STATUS_STANDBY);
     SetLoadingStatus(STATUS_STANDBY);
 #ifdef ENABLE_DEBUG
     qDebug() << "Finished";
@@ -431,7 +405,7 @@ MainWindow::FoundDevice(
     //Bluetooth device detected
     if (bdiDeviceInfo.coreConfigurations() & QBluetoothDeviceInfo::LowEnergyCoreConfiguration)
     {
-        if (stgSettingsHandle->GetBool(SETTINGS_KEY_RESTRICTUUID) == true)
+        if (pssSettings->bRestrictUUID == true)
         {
             //Service filtering, check if VSP service is present
 #ifdef ENABLE_DEBUG
@@ -449,7 +423,7 @@ MainWindow::FoundDevice(
                 if (Services.at(i).toString() == QString("{").append(stgSettingsHandle->GetString(SETTINGS_KEY_UUID)).append("}"))
                 {
                     //Found VSP service
-                    dlgScanDialog->ScanSelection::AddDevice(bdiDeviceInfo);
+                    ScanDialog()->AddDevice(bdiDeviceInfo);
                     break;
                 }
                ++i;
@@ -466,7 +440,7 @@ MainWindow::FoundDevice(
             qDebug() << bdiDeviceInfo.address() << bdiDeviceInfo.name() << bdiDeviceInfo.rssi();
 #endif
 #endif
-            dlgScanDialog->ScanSelection::AddDevice(bdiDeviceInfo);
+            ScanDialog()->AddDevice(bdiDeviceInfo);
         }
     }
 }
@@ -474,15 +448,15 @@ MainWindow::FoundDevice(
 //=============================================================================
 //=============================================================================
 void
-MainWindow::BLEConnected(
+MainWindow::TransportConnected(
     )
 {
-    //Connected to Bluetooth device
+    //Connected to Bluetooth device, the VSP service is being discovered
 #ifdef ENABLE_DEBUG
     qDebug() << "Connected";
 #endif
-    nCurrentMode = MAIN_MODE_DISCOVERING;
-    lecBLEController->discoverServices();
+    SetCurrentMode(MAIN_MODE_DISCOVERING);
+    stlSessionLog.SetDevice(strDeviceAddress);
     ui->btn_Scan->setVisible(false);
     ui->btn_Scan->setEnabled(false);
     ui->btn_Disconnect->setEnabled(true);
@@ -499,78 +473,50 @@ MainWindow::BLEConnected(
 //=============================================================================
 //=============================================================================
 void
-MainWindow::BLEDisconnected(
+MainWindow::TransportOpened(
+    )
+{
+    //VSP service is ready
+    sbfRecBuffer.Append("(Now ready to send/receive!)\n");
+    UpdateDisplay();
+
+    //Set status to idle
+    SetCurrentMode(MAIN_MODE_IDLE);
+    SetLoadingStatus(STATUS_STANDBY);
+
+    //Disable cancel button and enable download filename edit
+    ui->btn_Cancel->setEnabled(false);
+    ui->edit_DownloadName->setReadOnly(false);
+
+    //The module is now ready for an interrupted transfer to be resumed
+    OfferTransferResume();
+}
+
+//=============================================================================
+//=============================================================================
+void
+MainWindow::TransportClosed(
     )
 {
-    //Disconnected from Bluetooth device
+    //Disconnected from Bluetooth device, a session in progress keeps an interrupted transfer so it can be resumed
 #ifdef ENABLE_DEBUG
     qDebug() << "Disconnected";
 #endif
     if (nCurrentMode != MAIN_MODE_IDLE)
     {
-        //Cancel any current operations
-        baOutputBuffer.clear();
-        balOutputBufferList.clear();
-        baVersionResponse.clear();
-        baFileData.clear();
-        if (tmrResponseTimeoutTimer->isActive())
-        {
-            //Stop timeout timer
-            tmrResponseTimeoutTimer->stop();
-        }
-
-        if (nCurrentMode == MAIN_MODE_ONLINE_DOWNLOAD || nCurrentMode == MAIN_MODE_XCOMPILING)
-        {
-            //Pending web request, cancel it
-            dwnDownloaderHandle->CancelRequest();
-        }
+        //Cancel any pending web request
+        CancelWebRequest();
 
         //Disable cancel button
         ui->btn_Cancel->setEnabled(false);
 
         //Back to idle mode
-        nCurrentMode = MAIN_MODE_IDLE;
+        SetCurrentMode(MAIN_MODE_IDLE);
         ui->edit_DownloadName->setReadOnly(false);
     }
 
-    //Clean up
-    if (chkChecksum != NULL)
-    {
-        delete chkChecksum;
-        chkChecksum = NULL;
-    }
-
-    if (strChecksumString != NULL)
-    {
-        delete strChecksumString;
-        strChecksumString = NULL;
-    }
-
-    //Clean up BLE events
-    disconnect(this, SLOT(BLEConnected()));
-    disconnect(this, SLOT(BLEDisconnected()));
-    disconnect(this, SLOT(BLEDiscoveryFinished()));
-    disconnect(this, SLOT(BLEError(QLowEnergyController::Error)));
-    disconnect(this, SLOT(BLEDiscovered(QBluetoothUuid)));
-    disconnect(this, SLOT(BLEStateChanged(QLowEnergyController::ControllerState)));
-
-    if (blesvcVSPService != NULL)
-    {
-        //Clean up VSP service
-        disconnect(this, SLOT(VSPServiceCharacteristicChanged(QLowEnergyCharacteristic,QByteArray)));
-        disconnect(this, SLOT(VSPServiceCharacteristicWritten(QLowEnergyCharacteristic,QByteArray)));
-        disconnect(this, SLOT(VSPServiceDescriptorWritten(QLowEnergyDescriptor,QByteArray)));
-        disconnect(this, SLOT(VSPServiceError(QLowEnergyService::ServiceError)));
-        disconnect(this, SLOT(VSPServiceStateChanged(QLowEnergyService::ServiceState)));
-        delete blesvcVSPService;
-        blesvcVSPService = NULL;
-    }
-
-    if (lecBLEController != NULL)
-    {
-        //Start disconnect clean up timer
-        tmrDisconnectCleanUpTimer->start();
-    }
+    //Start disconnect clean up timer
+    tmrDisconnectCleanUpTimer->start();
 
     //Change button states to enable scan button
     ui->btn_Disconnect->setVisible(false);
@@ -597,1121 +543,394 @@ MainWindow::BLEDisconnected(
 //=============================================================================
 //=============================================================================
 void
-MainWindow::BLEDiscovered(
-    QBluetoothUuid
+MainWindow::TransportDataReceived(
+    QByteArray baData
+    )
+{
+    //VSP data received, the session acts on the responses
+#ifdef ENABLE_DEBUG
+    qDebug() << "Tx Changed";
+#endif
+    sbfRecBuffer.Append(baData.replace('\0', "+"));
+
+    unRecDatSize = unRecDatSize + baData.length();
+    if (!tmrDisplayUpdateTimer->isActive())
+    {
+        tmrDisplayUpdateTimer->start();
+    }
+    UpdateTxRx();
+}
+
+//=============================================================================
+//=============================================================================
+void
+MainWindow::TransportFlowChanged(
+    bool bBlocked
     )
 {
-    //This function is unused as the finished signal is used instead
+    //Module has stopped or restarted the flow of data using the modem out characteristic
+    if (bBlocked == true)
+    {
+        stlSessionLog.FlowStopped();
+    }
 }
 
 //=============================================================================
 //=============================================================================
 void
-MainWindow::BLEDiscoveryFinished(
+MainWindow::TransportMTUChanged(
+    int nMTU
     )
 {
-    //Bluetooth discovery complete
+    //ATT MTU for the connection has changed (-1 if it is not known)
+    unNegotiatedMTU = (nMTU > BLE_DEFAULT_MTU ? nMTU : BLE_DEFAULT_MTU);
 #ifdef ENABLE_DEBUG
-    qDebug() << "Discovery finished, " << QBluetoothUuid(stgSettingsHandle->GetString(SETTINGS_KEY_UUID));
+    qDebug() << "MTU: " << unNegotiatedMTU;
 #endif
-    blesvcVSPService = lecBLEController->createServiceObject(QBluetoothUuid(stgSettingsHandle->GetString(SETTINGS_KEY_UUID)));
+
+    //Update Tx/Rx counts
+    UpdateTxRx();
+}
+
+//=============================================================================
+//=============================================================================
+void
+MainWindow::TransportError(
+    QString strMessage
+    )
+{
+    //Bluetooth connection or VSP service error, the session fails on its own
 #ifdef ENABLE_DEBUG
-    qDebug() << "Is Null: " << (blesvcVSPService == NULL ? "yes" : "no");
-    qDebug() << lecBLEController->services();
-    qDebug() << "Is Null: " << blesvcVSPService;
-//    qDebug() << lecBLEController->children();
-////    qDebug() << blesvcVSPService->characteristics();
-//    qDebug() << blesvcVSPService->children();
+    qDebug() << "BLE Error: " << strMessage;
 #endif
+    gstrToastString = strMessage;
 
-    //Set status to idle
-    nCurrentMode = MAIN_MODE_IDLE;
+    //Set mode to idle
+    SetCurrentMode(MAIN_MODE_IDLE);
+    SetLoadingStatus(STATUS_STANDBY);
+    ui->btn_Disconnect->setVisible(false);
+    ui->btn_Disconnect->setEnabled(false);
+    ui->btn_Download->setVisible(false);
+    ui->btn_Download->setEnabled(false);
+    ui->btn_ModuleInfo->setVisible(false);
+    ui->btn_ModuleInfo->setEnabled(false);
+    ui->btn_Scan->setEnabled(true);
+    ui->btn_Scan->setVisible(true);
 
-    //Disable cancel button and enable download name edit
+    //Disable cancel button and enable download filename edit
     ui->btn_Cancel->setEnabled(false);
     ui->edit_DownloadName->setReadOnly(false);
 
-    if (!blesvcVSPService)
+    //Disconnect from the device (if connected) and clean up
+    if (vtpTransport != NULL && bDisconnectActive == false)
     {
-        //Service not found, disconnect
-        if (lecBLEController != NULL && bDisconnectActive == false)
-        {
-            bDisconnectActive = true;
-            lecBLEController->disconnectFromDevice();
-        }
-        ui->btn_Disconnect->setVisible(false);
-        ui->btn_Disconnect->setEnabled(false);
-        ui->btn_Download->setVisible(false);
-        ui->btn_Download->setEnabled(false);
-        ui->btn_ModuleInfo->setVisible(false);
-        ui->btn_ModuleInfo->setEnabled(false);
-        ui->btn_Scan->setEnabled(true);
-        ui->btn_Scan->setVisible(true);
-        SetLoadingStatus(STATUS_STANDBY);
-
-        //Set error
-        gstrToastString = "VSP service not found, disconnecting...";
-        ToastMessage(false);
-        ClearVar();
-
-        return;
+        bDisconnectActive = true;
+        vtpTransport->Close();
     }
+    tmrDisconnectCleanUpTimer->start();
 
-    //Connect VSP server signals
-    connect(blesvcVSPService, SIGNAL(characteristicChanged(QLowEnergyCharacteristic,QByteArray)), this, SLOT(VSPServiceCharacteristicChanged(QLowEnergyCharacteristic,QByteArray)));
-    connect(blesvcVSPService, SIGNAL(characteristicWritten(QLowEnergyCharacteristic,QByteArray)), this, SLOT(VSPServiceCharacteristicWritten(QLowEnergyCharacteristic,QByteArray)));
-    connect(blesvcVSPService, SIGNAL(descriptorWritten(QLowEnergyDescriptor,QByteArray)), this, SLOT(VSPServiceDescriptorWritten(QLowEnergyDescriptor,QByteArray)));
-    connect(blesvcVSPService, SIGNAL(error(QLowEnergyService::ServiceError)), this, SLOT(VSPServiceError(QLowEnergyService::ServiceError)));
-    connect(blesvcVSPService, SIGNAL(stateChanged(QLowEnergyService::ServiceState)), this, SLOT(VSPServiceStateChanged(QLowEnergyService::ServiceState)));
-
-    //Discover service details
-    blesvcVSPService->discoverDetails();
+    //Show message
+    ToastMessage(true);
 }
 
 //=============================================================================
 //=============================================================================
 void
-MainWindow::BLEError(
-    QLowEnergyController::Error nErrorCode
+MainWindow::SessionStageChanged(
+    quint8 unStage
     )
 {
-    //Bluetooth Low Energy error
-#ifdef ENABLE_DEBUG
-    qDebug() << "BLE Error: " << nErrorCode;
-#endif
-    if (nErrorCode != QLowEnergyController::NoError)
+    //The OTA session has moved to a new stage, which is shown as the current mode. The end of the session is handled by SessionFinished()
+    if (unStage == OTA_STAGE_QUERYING)
     {
-        if (nErrorCode == QLowEnergyController::UnknownError)
-        {
-            //Unknown error
-            if (lecBLEController != NULL && bDisconnectActive == false)
-            {
-                bDisconnectActive = true;
-                lecBLEController->disconnectFromDevice();
-            }
-            ui->btn_Disconnect->setVisible(false);
-            ui->btn_Disconnect->setEnabled(false);
-            ui->btn_Download->setVisible(false);
-            ui->btn_Download->setEnabled(false);
-            ui->btn_ModuleInfo->setVisible(false);
-            ui->btn_ModuleInfo->setEnabled(false);
-            ui->btn_Scan->setEnabled(true);
-            ui->btn_Scan->setVisible(true);
-            SetLoadingStatus(STATUS_STANDBY);
-
-            //Set error
-            gstrToastString = "Unknown Bluetooth Error.";
-            ClearVar();
-        }
-        else if (nErrorCode == QLowEnergyController::UnknownRemoteDeviceError)
-        {
-            //Remote device cannot be found
-            SetLoadingStatus(STATUS_STANDBY);
-
-            //Set error
-            gstrToastString = "Remote Bluetooth device was not found.";
-            ClearVar();
-        }
-        else if (nErrorCode == QLowEnergyController::NetworkError)
-        {
-            //Failed to read from/write to the remote device
-            if (lecBLEController != NULL && bDisconnectActive == false)
-            {
-                bDisconnectActive = true;
-                lecBLEController->disconnectFromDevice();
-            }
-            ui->btn_Disconnect->setVisible(false);
-            ui->btn_Disconnect->setEnabled(false);
-            ui->btn_Download->setVisible(false);
-            ui->btn_Download->setEnabled(false);
-            ui->btn_ModuleInfo->setVisible(false);
-            ui->btn_ModuleInfo->setEnabled(false);
-            ui->btn_Scan->setEnabled(true);
-            ui->btn_Scan->setVisible(true);
-            SetLoadingStatus(STATUS_STANDBY);
-
-            //Set error
-            gstrToastString = "Failed reading from/writing to remote device.";
-            ClearVar();
-        }
-        else if (nErrorCode == QLowEnergyController::InvalidBluetoothAdapterError)
-        {
-            //Issue with Bluetooth adapter
-            ui->btn_Disconnect->setVisible(false);
-            ui->btn_Disconnect->setEnabled(false);
-            ui->btn_Download->setVisible(false);
-            ui->btn_Download->setEnabled(false);
-            ui->btn_ModuleInfo->setVisible(false);
-            ui->btn_ModuleInfo->setEnabled(false);
-            ui->btn_Scan->setEnabled(true);
-            ui->btn_Scan->setVisible(true);
-            SetLoadingStatus(STATUS_STANDBY);
-
-            //Set error
-            gstrToastString = "Error with Bluetooth Adapter.";
-            ClearVar();
-        }
-        else if (nErrorCode == QLowEnergyController::ConnectionError)
+        SetCurrentMode(nQueryMode);
+    }
+    else if (unStage == OTA_STAGE_XCOMPILING)
+    {
+        //Waiting for the XCompile server
+        SetCurrentMode(MAIN_MODE_XCOMPILING);
+        gstrToastString = "XCompiling application...";
+        ToastMessage(false);
+    }
+    else if (unStage == OTA_STAGE_COMPARING)
+    {
+        //Reading the CRC and file listing
+        SetCurrentMode(MAIN_MODE_COMPARING);
+        gstrToastString = "Checking file on module...";
+        ToastMessage(false);
+    }
+    else if (unStage == OTA_STAGE_TRANSFERRING)
+    {
+        //Writing the application, the known free space of the module is not used again until the write completes
+        OtaSessionStatistics ossStatistics = otsSession.Statistics();
+        SetCurrentMode(MAIN_MODE_DOWNLOADING);
+        stlSessionLog.SetTransfer(ui->edit_DownloadName->text(), ossStatistics.nFileSize - ossStatistics.nFileOffset, ossStatistics.unPacketSize, (ossStatistics.nFileOffset > 0));
+        if (ossStatistics.nFileOffset > 0)
         {
-            //Failed to connect to device
-            ui->btn_Disconnect->setVisible(false);
-            ui->btn_Disconnect->setEnabled(false);
-            ui->btn_Download->setVisible(false);
-            ui->btn_Download->setEnabled(false);
-            ui->btn_ModuleInfo->setVisible(false);
-            ui->btn_ModuleInfo->setEnabled(false);
-            ui->btn_Scan->setEnabled(true);
-            ui->btn_Scan->setVisible(true);
-            SetLoadingStatus(STATUS_STANDBY);
-
-            //Set error
-            gstrToastString = "Failed to connect to Bluetooth device or connection interrupted during communication.";
-            ClearVar();
+            gstrToastString = QString("Resuming OTA transfer from byte ").append(QString::number(ossStatistics.nFileOffset)).append("...");
         }
-#if QT_VERSION >= 0x050A00
-        //Function was added in Qt 5.10
-        else if (nErrorCode == QLowEnergyController::RemoteHostClosedError)
+        else
         {
-            //Remote device closed the connection
-            SetLoadingStatus(STATUS_STANDBY);
-            ui->btn_Disconnect->setVisible(false);
-            ui->btn_Disconnect->setEnabled(false);
-            ui->btn_Download->setVisible(false);
-            ui->btn_Download->setEnabled(false);
-            ui->btn_ModuleInfo->setVisible(false);
-            ui->btn_ModuleInfo->setEnabled(false);
-            ui->btn_Scan->setEnabled(true);
-            ui->btn_Scan->setVisible(true);
-
-            //Set error
-            gstrToastString = "Remote Bluetooth device closed connection.";
-            ClearVar();
+            gstrToastString = "Transferring OTA data...";
         }
-#endif
+        ToastMessage(false);
+    }
+    else if (unStage == OTA_STAGE_VERIFYING)
+    {
+        //All file data has been written
+        SetCurrentMode(MAIN_MODE_VERIFYING);
+    }
+}
 
-        //Set mode to idle
-        nCurrentMode = MAIN_MODE_IDLE;
+//=============================================================================
+//=============================================================================
+void
+MainWindow::SessionProgress(
+    qint32 nSent,
+    qint32 nTotal
+    )
+{
+    //Progress of the transfer, the total is the size of the encoded data and not just the application
+    unTotalSizeSent = nSent;
+    unTotalAppSize = nTotal;
+    if (!tmrDisplayUpdateTimer->isActive())
+    {
+        //Start update display timer
+        tmrDisplayUpdateTimer->start();
+    }
+    UpdateTxRx();
+}
 
-        //Disable cancel button and enable download filename edit
-        ui->btn_Cancel->setEnabled(false);
-        ui->edit_DownloadName->setReadOnly(false);
+//=============================================================================
+//=============================================================================
+void
+MainWindow::SessionModuleDetails(
+    QString strDevice,
+    QString strFirmware
+    )
+{
+    //Module details have been read (or are known from an earlier connection), a load is cancelled here if the user does not want to continue
+    stlSessionLog.SetModule(strDevice, strFirmware);
+    if (nQueryMode == MAIN_MODE_QUERY)
+    {
+        return;
+    }
 
-        if (tmrResponseTimeoutTimer->isActive())
+    if (bIs2MPhySupported == true && strDevice == "BL652" && strFirmware == "28.7.3.0")
+    {
+        //BL652 firmware which may have issues with a 2M PHY phone
+        if (QMessageBox::question(this, "Continue VSP OTA operation", "Your phone has a BT v5 radio, there is a known issue which can cause a disconnect during a VSP operation on the BL652 of this firmware version - which is more likely to occur with larger applications, do you wish to continue?", QMessageBox::Yes, QMessageBox::No) == QMessageBox::No)
         {
-            //Stop timeout timer
-            tmrResponseTimeoutTimer->stop();
+            //User does not want to proceed, cancel.
+            otsSession.Cancel("VSP OTA operation cancelled.");
+            return;
         }
+    }
 
-        //Show message
-        ToastMessage(false);
+    if (nQueryMode == MAIN_MODE_VERSION)
+    {
+        //The application is XCompiled for this module
+        const ModuleInformation &mdiInfo = otsSession.Information();
+        sbfRecBuffer.Append(QString("Found device: ").append(mdiInfo.strDevice).append(", XCompiler hash: ").append(mdiInfo.strXCompilerA).append(" ").append(mdiInfo.strXCompilerB).append("\r\n").toUtf8());
+        UpdateDisplay();
     }
 }
 
 //=============================================================================
 //=============================================================================
 void
-MainWindow::BLEStateChanged(
-    QLowEnergyController::ControllerState lesNewState
+MainWindow::SessionInsufficientSpace(
+    qint32 nRequired,
+    qint32 nFree
     )
 {
-    //BLE status changed - unused
-#ifdef ENABLE_DEBUG
-    qDebug() << "State: " << lesNewState;
-#endif
+    //Insufficient space available on the module to download this application, check if the user is sure they want to download it
+    if (QMessageBox::question(this, "Insufficient module space", QString("There is insufficient storage space available on the module, ").append(QString::number(nRequired)).append(" bytes are required but only ").append(QString::number(nFree)).append(" bytes are free therefore the OTA will likely fail.\r\n\r\nAre you sure you want to continue with this operation?"), QMessageBox::Yes, QMessageBox::No) == QMessageBox::Yes)
+    {
+        otsSession.IgnoreInsufficientSpace();
+    }
+    else
+    {
+        //User does not want to continue, cancel operation
+        otsSession.Cancel("Insufficient module storage space, OTA cancelled!");
+    }
 }
 
 //=============================================================================
 //=============================================================================
 void
-MainWindow::VSPServiceCharacteristicChanged(
-    QLowEnergyCharacteristic lecCharacteristic,
+MainWindow::SessionPacketWritten(
     QByteArray baData
     )
 {
-    //VSP characteristic data received
-    if (lecCharacteristic == blechrTXChar)
+    //Updates the counters and display for a packet which has been written to the RX characteristic
+    unWrittenBytes = unWrittenBytes + baData.length();
+    stlSessionLog.PacketWritten(baData.length());
+    if (pssSettings->bSkipDownloadDisplay == false)
     {
+        //Append data to receive buffer display
+        sbfRecBuffer.Append(baData);
+    }
 #ifdef ENABLE_DEBUG
-        qDebug() << "Tx Changed";
+//    qDebug() << "Wrote: " << baData;
 #endif
-        baRecBuffer.append(baData.replace('\0', "+"));
-        TrucateRecBuffer();
 
-        unRecDatSize = unRecDatSize + baData.length();
-        if (!tmrDisplayUpdateTimer->isActive())
-        {
-            tmrDisplayUpdateTimer->start();
-        }
-        UpdateTxRx();
+    if (!tmrDisplayUpdateTimer->isActive())
+    {
+        //Start update display timer
+        tmrDisplayUpdateTimer->start();
+    }
+
+    //Update Tx/Rx counts
+    UpdateTxRx();
+}
+
+//=============================================================================
+//=============================================================================
+void
+MainWindow::SessionPipelineStalled(
+    )
+{
+    //Command window is full, sending resumes when the module acknowledges commands
+    stlSessionLog.PipelineStalled();
+}
+
+//=============================================================================
+//=============================================================================
+void
+MainWindow::SessionNotice(
+    QString strMessage
+    )
+{
+    //Information from the session which is shown with the module output
+    sbfRecBuffer.Append(strMessage.append("\r\n").toUtf8());
+    UpdateDisplay();
+}
 
-        if (tmrResponseTimeoutTimer->isActive())
+//=============================================================================
+//=============================================================================
+void
+MainWindow::SessionFinished(
+    bool bSuccess,
+    QString strMessage
+    )
+{
+    //The OTA session has ended, the connection to the module is kept unless it is to be disconnected
+    gstrToastString = strMessage;
+    if (!otsSession.CaptureFilename().isEmpty())
+    {
+        //Session was recorded, it can be replayed with vspota-bench --replay
+        SessionNotice(QString("Session recorded to ").append(otsSession.CaptureFilename()));
+    }
+    if (nQueryMode == MAIN_MODE_QUERY && bSuccess == true)
+    {
+        //Got the module query response
+        const ModuleInformation &mdiInfo = otsSession.Information();
+        if (pssSettings->bCheckFirmwareVersion == true)
         {
-            //Stop timeout timer
-            tmrResponseTimeoutTimer->stop();
+            //Check if device is on latest firmware
+            SetCurrentMode(MAIN_MODE_FIRMWAREVERSION);
+            unWebRequest = dwnDownloaderHandle->CheckLatestFirmware(mdiInfo.strDevice, mdiInfo.strFirmware);
+            gstrToastString = "Received module information, checking for latest firmware...";
+            ToastMessage(false);
         }
-
-        if (nCurrentMode == MAIN_MODE_VERSION)
+        else
         {
-            //Waiting for version response
-            baVersionResponse.append(baData);
-
-            //Search for errors
-            QRegularExpressionMatch rexpmM1Match = rxpErrorCode.match(baVersionResponse);
-            if (rexpmM1Match.hasMatch())
-            {
-                //Error detected
-                baOutputBuffer.clear();
-                balOutputBufferList.clear();
-                baVersionResponse.clear();
-                nCurrentMode = MAIN_MODE_IDLE;
-                SetLoadingStatus(STATUS_STANDBY);
-                QString ErrorMsg = elErrorLookupHandle.LookupError(rexpmM1Match.captured(1).toUInt(nullptr, 16));
-                gstrToastString = QString("Error retrieving module information (").append(rexpmM1Match.captured(1)).append(") ").append(ErrorMsg);
-                ToastMessage(false);
+            //Do not check for latest firmware
+            SetCurrentMode(MAIN_MODE_IDLE);
+            ShowModuleInformation(QString());
+        }
 
-                //Disable cancel button and enable download filename edit
-                ui->btn_Cancel->setEnabled(false);
-                ui->edit_DownloadName->setReadOnly(false);
-            }
-            else if (baOutputBuffer.length() == 0 && !balOutputBufferList.isEmpty() && baVersionResponse.indexOf("\n00\r") != -1)
-            {
-                //Command completed successfully
-                baVersionResponse.replace("\n00\r", "");
+        //Disable cancel button and enable download filename edit
+        ui->btn_Cancel->setEnabled(false);
+        ui->edit_DownloadName->setReadOnly(false);
+        return;
+    }
+    else if (bSuccess == true)
+    {
+        //Application has been loaded, or the module already had it
+        OtaSessionStatistics ossStatistics = otsSession.Statistics();
+        stlSessionLog.SetResult(ossStatistics.bSkipped == true ? "skipped" : "complete");
 
-                //Load next command
-                baOutputBuffer = balOutputBufferList.takeFirst();
-                if (bVSPBlocked == false)
-                {
-                    blesvcVSPService->writeCharacteristic(blechrRXChar, baOutputBuffer.left(stgSettingsHandle->GetUInt(SETTINGS_KEY_PACKETSIZE)));
-                    tmrResponseTimeoutTimer->start();
-                }
-            }
-            else if (balOutputBufferList.isEmpty() && baOutputBuffer.isEmpty() && baVersionResponse.indexOf("\t0\t") != -1 && baVersionResponse.indexOf("\t13\t") != -1 && baVersionResponse.indexOf("00", baVersionResponse.indexOf("\t13\t")) != -1)
+        //Check if the device should be disconnected or reset
+        if (pssSettings->unDownloadAction == DOWNLOAD_ACTION_DISCONNECT)
+        {
+            //Disconnect from device
+            if (vtpTransport != NULL && bDisconnectActive == false)
             {
-                //Got the version response - extract
-                QRegularExpressionMatch rexpmM1Match = rxpDevName.match(baVersionResponse);
-                QRegularExpressionMatch rexpmM2Match = rxpXCompiler.match(baVersionResponse);
-                QRegularExpressionMatch rexpmM3Match = rxpFreeSpace.match(baVersionResponse);
-
-                if (rexpmM1Match.hasMatch() && rexpmM2Match.hasMatch() && (stgSettingsHandle->GetBool(SETTINGS_KEY_CHECKFREESPACE) == false || rexpmM3Match.hasMatch()))
-                {
-                    if (bIs2MPhySupported == true && rexpmM1Match.captured(1) == "BL652")
-                    {
-                        //BL652 detected on phone with 2M PHY
-                        QRegularExpressionMatch rexpmM4Match = rxpFirmware.match(baVersionResponse);
-                        if (rexpmM4Match.captured(1) == "28.7.3.0" && QMessageBox::question(this, "Continue VSP OTA operation", "Your phone has a BT v5 radio, there is a known issue which can cause a disconnect during a VSP operation on the BL652 of this firmware version - which is more likely to occur with larger applications, do you wish to continue?", QMessageBox::Yes, QMessageBox::No) == QMessageBox::No)
-                        {
-                            //User does not want to proceed, cancel.
-                            baOutputBuffer.clear();
-                            nCurrentMode = MAIN_MODE_IDLE;
-                            SetLoadingStatus(STATUS_STANDBY);
-
-                            //Show message
-                            gstrToastString = "VSP OTA operation cancelled.";
-                            ToastMessage(false);
-
-                            //Disable cancel button and enable download filename edit
-                            ui->btn_Cancel->setEnabled(false);
-                            ui->edit_DownloadName->setReadOnly(false);
-                            return;
-                        }
-                    }
-
-                    //Send the XCompilation request
-                    baRecBuffer.append("Found device: ").append(rexpmM1Match.captured(1)).append(", XCompiler hash: ").append(rexpmM2Match.captured(1)).append(" ").append(rexpmM2Match.captured(2)).append("\r\n");
-                    nModuleFreeSpace = rexpmM3Match.captured(2).toUInt();
-                    UpdateDisplay();
-                    nCurrentMode = MAIN_MODE_XCOMPILING;
-                    dwnDownloaderHandle->XCompileFile(rexpmM1Match.captured(1), rexpmM2Match.captured(1), rexpmM2Match.captured(2), &baFileData);
-
-                    //Enable cancel button and disable download filename edit
-                    ui->btn_Cancel->setEnabled(true);
-                    ui->edit_DownloadName->setReadOnly(true);
-                }
-                else
-                {
-                    //Issue with received data
-                    baRecBuffer.append("An error has occured, please report this issue. ID: 1, rxpDevName: (").append((rexpmM1Match.hasMatch() == true ? "1" : "0")).append(") ").append(rexpmM1Match.captured(0)).append(", rxpXCompiler: (").append((rexpmM2Match.hasMatch() == true ? "1" : "0")).append(") ").append(rexpmM2Match.captured(0)).append(", rxpFreeSpace: (").append((rexpmM3Match.hasMatch() == true ? "1" : "0")).append(") ").append(rexpmM3Match.captured(0)).append(", CheckFreeSpace: ").append((stgSettingsHandle->GetBool(SETTINGS_KEY_CHECKFREESPACE) == true ? "1" : "0")).append("\r\n");
-                    UpdateDisplay();
-
-                    //Set status back to idle
-                    nCurrentMode = MAIN_MODE_IDLE;
-                    baVersionResponse.clear();
-
-                    //Disable cancel button and enable download filename edit
-                    ui->btn_Cancel->setEnabled(false);
-                    ui->edit_DownloadName->setReadOnly(false);
-                }
+                gstrToastString += " Disconnecting...";
+                bDisconnectActive = true;
+                vtpTransport->Close();
             }
         }
-        else if (nCurrentMode == MAIN_MODE_SPACECHECK)
+        else if (pssSettings->unDownloadAction == DOWNLOAD_ACTION_RESTART && ossStatistics.bSkipped == false)
         {
-            //Waiting for storage space response
-            baVersionResponse.append(baData);
+            //The module has been restarted by the session
+            gstrToastString += " Restarting...";
+        }
+        ToastMessage(false);
+    }
+    else if (nCurrentMode == MAIN_MODE_XCOMPILING)
+    {
+        //Error XCompiling application
+        QMessageBox::critical(this, "Error with XCompilation", strMessage, QMessageBox::Ok, QMessageBox::NoButton);
+    }
+    else
+    {
+        //Show the reason the session failed
+        ToastMessage(true);
+    }
 
-            //Search for errors
-            QRegularExpressionMatch rexpmM1Match = rxpErrorCode.match(baVersionResponse);
-            if (rexpmM1Match.hasMatch())
-            {
-                //Error detected
-                baOutputBuffer.clear();
-                balOutputBufferList.clear();
-                baVersionResponse.clear();
-                nCurrentMode = MAIN_MODE_IDLE;
-                SetLoadingStatus(STATUS_STANDBY);
-                QString strErrorMsg = elErrorLookupHandle.LookupError(rexpmM1Match.captured(1).toUInt(nullptr, 16));
-                gstrToastString = QString("Error retrieving storage space (").append(rexpmM1Match.captured(1)).append(") ").append(strErrorMsg);
-                ToastMessage(false);
+    //Set status back to idle
+    SetCurrentMode(MAIN_MODE_IDLE);
+    SetLoadingStatus(STATUS_STANDBY);
 
-                //Disable cancel button and enable download filename edit
-                ui->btn_Cancel->setEnabled(false);
-                ui->edit_DownloadName->setReadOnly(false);
-            }
-            else if (baOutputBuffer.length() == 0 && !balOutputBufferList.isEmpty() && baVersionResponse.indexOf("\n00\r") != -1)
-            {
-                //Command completed successfully
-                baVersionResponse.replace("\n00\r", "");
-
-                //Load next command
-                baOutputBuffer = balOutputBufferList.takeFirst();
-                if (bVSPBlocked == false)
-                {
-                    blesvcVSPService->writeCharacteristic(blechrRXChar, baOutputBuffer.left(stgSettingsHandle->GetUInt(SETTINGS_KEY_PACKETSIZE)));
-                    tmrResponseTimeoutTimer->start();
-                }
-            }
-            else if (bIs2MPhySupported == false && balOutputBufferList.isEmpty() && baOutputBuffer.isEmpty() && baVersionResponse.indexOf("\t6\t") != -1 && baVersionResponse.indexOf("00", baVersionResponse.indexOf("\t6\t")) != -1)
-            {
-                //Got the version response - extract (1M PHY)
-                QRegularExpressionMatch rexpmM1Match = rxpFreeSpace.match(baVersionResponse);
-
-                if (rexpmM1Match.hasMatch())
-                {
-                    //Get the free space on the module and pass to loading function
-                    nModuleFreeSpace = rexpmM1Match.captured(2).toUInt();
-
-                    //Process file data
-                    ProcessFileData(true, 0, baFileData);
-
-                    //Enable cancel button
-                    ui->btn_Cancel->setEnabled(true);
-                }
-                else
-                {
-                    ui->edit_Display->appendPlainText("No match");
-                }
-            }
-            else if (bIs2MPhySupported == true && balOutputBufferList.isEmpty() && baOutputBuffer.isEmpty() && baVersionResponse.indexOf("\t0\t") != -1 && baVersionResponse.indexOf("\t6\t") != -1 && baVersionResponse.indexOf("00", baVersionResponse.indexOf("\t6\t")) != -1)
-            {
-                //Got the version response - extract (2M PHY)
-                QRegularExpressionMatch rexpmM1Match = rxpDevName.match(baVersionResponse);
-                QRegularExpressionMatch rexpmM2Match = rxpFreeSpace.match(baVersionResponse);
-
-                if (rexpmM1Match.hasMatch() && rexpmM2Match.hasMatch())
-                {
-                    //2M PHY check - look for firmwares which may have issues
-                    if (rexpmM1Match.captured(1) == "BL652")
-                    {
-                        //BL652 detected on phone with 2M PHY
-                        QRegularExpressionMatch rexpmM3Match = rxpFirmware.match(baVersionResponse);
-                        if (rexpmM3Match.captured(1) == "28.7.3.0" && QMessageBox::question(this, "Continue VSP OTA operation", "Your phone has a BT v5 radio, there is a known issue which can cause a disconnect during a VSP operation on the BL652 of this firmware version - which is more likely to occur with larger applications, do you wish to continue?", QMessageBox::Yes, QMessageBox::No) == QMessageBox::No)
-                        {
-                            //User does not want to proceed, cancel.
-                            baOutputBuffer.clear();
-                            balOutputBufferList.clear();
-                            baVersionResponse.clear();
-                            nCurrentMode = MAIN_MODE_IDLE;
-                            SetLoadingStatus(STATUS_STANDBY);
-
-                            //Show message
-                            gstrToastString = "VSP OTA operation cancelled.";
-                            ToastMessage(false);
-
-                            //Disable cancel button and enable download filename edit
-                            ui->btn_Cancel->setEnabled(false);
-                            ui->edit_DownloadName->setReadOnly(false);
-                            return;
-                        }
-                    }
-
-                    //Get the free space on the module and pass to loading function
-                    nModuleFreeSpace = rexpmM2Match.captured(2).toUInt();
-
-                    //Process file data
-                    ProcessFileData(true, 0, baFileData);
-
-                    //Enable cancel button
-                    ui->btn_Cancel->setEnabled(true);
-                }
-                else
-                {
-                    //Issue with received data
-                    baRecBuffer.append("An error has occured, please report this issue. ID: 2, rxpDevName: (").append((rexpmM1Match.hasMatch() == true ? "1" : "0")).append(") ").append(rexpmM1Match.captured(0)).append(", rxpFreeSpace: (").append((rexpmM2Match.hasMatch() == true ? "1" : "0")).append(") ").append(rexpmM2Match.captured(0)).append("\r\n");
-                    UpdateDisplay();
-
-                    //Set status back to idle
-                    nCurrentMode = MAIN_MODE_IDLE;
-                    baVersionResponse.clear();
-
-                    //Disable cancel button and enable download filename edit
-                    ui->btn_Cancel->setEnabled(false);
-                    ui->edit_DownloadName->setReadOnly(false);
-                }
-            }
-        }
-        else if (nCurrentMode == MAIN_MODE_DOWNLOADING || nCurrentMode == MAIN_MODE_VERIFYING)
-        {
-            //Currently downloading or verifying downloaded application
-            baVersionResponse.append(baData);
-
-            //Check if we are near the near the end of the transmission
-            if (nCurrentMode == MAIN_MODE_DOWNLOADING && baOutputBuffer.length() > 25)
-            {
-                //Not near the end of the output so remove the success code from the buffer
-                baVersionResponse.replace("\n00\r", "");
-            }
-
-            //Check for errors
-            QRegularExpressionMatch rexpmM1Match = rxpErrorCode.match(baVersionResponse);
-
-            if (rexpmM1Match.hasMatch())
-            {
-                //An error has occured
-                nCurrentMode = MAIN_MODE_IDLE;
-                baOutputBuffer.clear();
-                balOutputBufferList.clear();
-                baVersionResponse.clear();
-                SetLoadingStatus(STATUS_STANDBY);
-
-                //Display message
-                QString ErrorMsg = elErrorLookupHandle.LookupError(rexpmM1Match.captured(1).toUInt(nullptr, 16));
-                gstrToastString = QString("Error during download (").append(rexpmM1Match.captured(1)).append(") ").append(ErrorMsg);
-                ToastMessage(true);
-
-                //Disable cancel button and enable download filename edit
-                ui->btn_Cancel->setEnabled(false);
-                ui->edit_DownloadName->setReadOnly(false);
-            }
-
-            if (nCurrentMode == MAIN_MODE_VERIFYING)
-            {
-#ifdef ENABLE_DEBUG
-                qDebug() << "Buf: " << baVersionResponse;
-#endif
-                if (stgSettingsHandle->GetBool(SETTINGS_KEY_VERIFYFILE) == true)
-                {
-                    //Check for file listing response
-                    if (baVersionResponse.indexOf("06\t") != -1 && baVersionResponse.indexOf("\n00\r", baVersionResponse.indexOf("06\t")) != -1)
-                    {
-                        //We have the directory listing response
-                        SetLoadingStatus(STATUS_STANDBY);
-
-                        //Check if module supports CRC verification
-                        QRegularExpressionMatch rexpmM2Match = rxpCRC.match(baVersionResponse);
-
-                        if (rexpmM2Match.hasMatch() && stgSettingsHandle->GetBool(SETTINGS_KEY_VERIFYFILE) == true && rexpmM2Match.captured(1) != strChecksumString)
-                        {
-                            //Module supports CRC checking and the verification test has failed
-                            gstrToastString = QString("OTA download failed - checksum failure, expected 0x").append(strChecksumString).append(" got 0x").append(rexpmM2Match.captured(1)).append(".");
-                        }
-                        else if (baVersionResponse.indexOf(QString("06\t").append(ui->edit_DownloadName->text()).append("\r")) == -1)
-                        {
-                            //File is missing...
-                            gstrToastString = "OTA download failed - file is missing.";
-                        }
-                        else
-                        {
-                            //File is present
-                            if (stgSettingsHandle->GetBool(SETTINGS_KEY_VERIFYFILE) == true && rexpmM2Match.hasMatch())
-                            {
-                                //Module supports CRC
-                                gstrToastString = "OTA download complete - file & CRC verified!";
-                            }
-                            else
-                            {
-                                //Module does not support CRC
-                                gstrToastString = "OTA download complete - file verified (CRC unsupported)!";
-                            }
-
-                            //Check if the device should be disonnected or reset
-                            if (stgSettingsHandle->GetUInt(SETTINGS_KEY_DOWNLOADACTION) == DOWNLOAD_ACTION_DISCONNECT)
-                            {
-                                //Disconnect from device
-                                if (lecBLEController != NULL && bDisconnectActive == false)
-                                {
-                                    gstrToastString += " Disconnecting...";
-                                    bDisconnectActive = true;
-                                    lecBLEController->disconnectFromDevice();
-                                }
-                            }
-                            else if (stgSettingsHandle->GetUInt(SETTINGS_KEY_DOWNLOADACTION) == DOWNLOAD_ACTION_RESTART)
-                            {
-                                //Restart device
-                                gstrToastString += " Restarting...";
-                                blesvcVSPService->writeCharacteristic(blechrRXChar, "atz\r");
-                            }
-                        }
-
-                        //Show the message
-                        ToastMessage(false);
-
-                        //Clean up
-                        delete strChecksumString;
-                        strChecksumString = NULL;
-                        baOutputBuffer.clear();
-                        balOutputBufferList.clear();
-                        nCurrentMode = MAIN_MODE_IDLE;
-                        SetLoadingStatus(STATUS_STANDBY);
-
-                        //Disable cancel button and enable download filename edit
-                        ui->btn_Cancel->setEnabled(false);
-                        ui->edit_DownloadName->setReadOnly(false);
-                    }
-                }
-                else
-                {
-                    //Check if data has finished transferring
-                    if (baVersionResponse.indexOf("\n10\t1\t") != -1)
-                    {
-                        //Response received - finished
-                        gstrToastString = "OTA download complete!";
-                        ToastMessage(false);
-
-                        //Check if the device should be disconnected or reset
-                        if (stgSettingsHandle->GetBool(SETTINGS_KEY_DOWNLOADACTION) == DOWNLOAD_ACTION_DISCONNECT)
-                        {
-                            //Disconnect from device
-                            if (lecBLEController != NULL && bDisconnectActive == false)
-                            {
-                                gstrToastString += " Disconnecting...";
-                                bDisconnectActive = true;
-                                lecBLEController->disconnectFromDevice();
-                            }
-                            else if (stgSettingsHandle->GetUInt(SETTINGS_KEY_DOWNLOADACTION) == DOWNLOAD_ACTION_RESTART)
-                            {
-                                //Restart device
-                                gstrToastString += " Restarting...";
-                                blesvcVSPService->writeCharacteristic(blechrRXChar, "atz\r");
-                            }
-                        }
-
-                        //Clean up
-                        baOutputBuffer.clear();
-                        balOutputBufferList.clear();
-                        nCurrentMode = MAIN_MODE_IDLE;
-                        SetLoadingStatus(STATUS_STANDBY);
-
-                        //Disable cancel button and enable download filename edit
-                        ui->btn_Cancel->setEnabled(false);
-                        ui->edit_DownloadName->setReadOnly(false);
-                    }
-                }
-            }
-        }
-        else if (nCurrentMode == MAIN_MODE_QUERY)
-        {
-            //Waiting for module information
-            baVersionResponse.append(baData);
-
-            //Search for errors
-            QRegularExpressionMatch rexpmM1Match = rxpErrorCode.match(baVersionResponse);
-            if (rexpmM1Match.hasMatch())
-            {
-                //Error detected
-                nCurrentMode = MAIN_MODE_IDLE;
-                baOutputBuffer.clear();
-                balOutputBufferList.clear();
-                baVersionResponse.clear();
-                SetLoadingStatus(STATUS_STANDBY);
-
-                //Display message
-                QString ErrorMsg = elErrorLookupHandle.LookupError(rexpmM1Match.captured(1).toUInt(nullptr, 16));
-                gstrToastString = QString("Error during module query (").append(rexpmM1Match.captured(1)).append(") ").append(ErrorMsg);
-                ToastMessage(true);
-
-                //Disable cancel button and enable download filename edit
-                ui->btn_Cancel->setEnabled(false);
-                ui->edit_DownloadName->setReadOnly(false);
-            }
-            else if (baOutputBuffer.length() == 0 && !balOutputBufferList.isEmpty() && baVersionResponse.indexOf("\n00\r") != -1)
-            {
-                //Command completed successfully
-                baVersionResponse.replace("\n00\r", "");
-
-                //Load next command
-                baOutputBuffer = balOutputBufferList.takeFirst();
-                if (bVSPBlocked == false)
-                {
-                    blesvcVSPService->writeCharacteristic(blechrRXChar, baOutputBuffer.left(stgSettingsHandle->GetUInt(SETTINGS_KEY_PACKETSIZE)));
-                    tmrResponseTimeoutTimer->start();
-                }
-            }
-
-            if (baVersionResponse.indexOf("\t0\t") != -1 && baVersionResponse.indexOf("\t6\t") != -1 && baVersionResponse.indexOf("00", baVersionResponse.indexOf("\t6\t")) != -1)
-            {
-                //Got the version response - extract
-                QRegularExpressionMatch rexpmM2Match = rxpDevName.match(baVersionResponse);
-                QRegularExpressionMatch rexpmM3Match = rxpFirmware.match(baVersionResponse);
-                QRegularExpressionMatch rexpmM4Match = rxpFreeSpace.match(baVersionResponse);
-
-                if (rexpmM2Match.hasMatch() && rexpmM3Match.hasMatch() && rexpmM4Match.hasMatch())
-                {
-                    //Version information received
-                    if (stgSettingsHandle->GetBool(SETTINGS_KEY_CHECKFWVERSION) == true)
-                    {
-                        //Check if device is on latest firmware
-                        nCurrentMode = MAIN_MODE_FIRMWAREVERSION;
-                        dwnDownloaderHandle->CheckLatestFirmware(rexpmM2Match.captured(1), rexpmM3Match.captured(1));
-                        gstrToastString = "Received module information, checking for latest firmware...";
-                        ToastMessage(false);
-                    }
-                    else
-                    {
-                        //Do not check for latest firmware
-                        nCurrentMode = MAIN_MODE_IDLE;
-                        QMessageBox::information(this, "Module Information", QString("The connected device is a ").append(rexpmM2Match.captured(1)).append(" module on firmware version ").append(rexpmM3Match.captured(1)).append(".\r\nFlash space available: ").append(rexpmM4Match.captured(2)).append("/").append(rexpmM4Match.captured(1)).append(" bytes (").append(QString::number(rexpmM4Match.captured(2).toUInt()*100/rexpmM4Match.captured(1).toUInt())).append("%).").append((rexpmM2Match.captured(1) == "BL652" && rexpmM3Match.captured(1) == "28.7.3.0" && bIs2MPhySupported == true ? "\r\n\r\nPlease note: VSP/OTA to this device is likely to fail due to your device having a Bluetooth v5 radio with support for 2M PHY." : "")));
-                        balOutputBufferList.clear();
-                        baOutputBuffer.clear();
-                        baVersionResponse.clear();
-                        UpdateDisplay();
-                    }
-                }
-                else
-                {
-                    //Error with received data
-                    baRecBuffer.append("An error has occured, please report this issue. ID: 3, rxpDevName: (").append((rexpmM2Match.hasMatch() == true ? "1" : "0")).append(") ").append(rexpmM2Match.captured(0)).append(", rxpFirmware: (").append((rexpmM3Match.hasMatch() == true ? "1" : "0")).append(") ").append(rexpmM3Match.captured(0)).append(", rxpFreeSpace: (").append((rexpmM4Match.hasMatch() == true ? "1" : "0")).append(") ").append(rexpmM4Match.captured(0)).append("\r\n");
-                    UpdateDisplay();
-
-                    //Set status back to idle
-                    nCurrentMode = MAIN_MODE_IDLE;
-                    baVersionResponse.clear();
-
-                    //Enable download filename edit
-                    ui->edit_DownloadName->setReadOnly(false);
-                }
-
-                //Disable cancel button
-                ui->btn_Cancel->setEnabled(false);
-            }
-        }
-    }
-    else
-    {
-        if (bHasModem == true)
-        {
-            if (lecCharacteristic == blechrMOChar)
-            {
-                //Modem characteristic update
-#ifdef ENABLE_DEBUG
-                qDebug() << baData.toHex();
-#endif
-                if (baData.at(0) == 0x01)
-                {
-                    //Go
-                    bVSPBlocked = false;
-                    if (!baOutputBuffer.isEmpty())
-                    {
-                        //We have data to send
-                        blesvcVSPService->writeCharacteristic(blechrRXChar, baOutputBuffer.left(stgSettingsHandle->GetUInt(SETTINGS_KEY_PACKETSIZE)));
-                    }
-                }
-                else if (baData.at(0) == 0x00)
-                {
-                    //Stop
-                    bVSPBlocked = true;
-                }
-            }
-        }
-//        else
-//        {
-//            //Other characteristic written
-//            bVSPBlocked = false;
-//            if (!baOutputBuffer.isEmpty())
-//            {
-//                //We have data to send
-//                blesvcVSPService->writeCharacteristic(blechrRXChar, baOutputBuffer.left(stgSettingsHandle->GetUInt(SETTINGS_KEY_PACKETSIZE)));
-//            }
-//        }
-    }
+    //Disable cancel button and enable download filename edit
+    ui->btn_Cancel->setEnabled(false);
+    ui->edit_DownloadName->setReadOnly(false);
 }
 
 //=============================================================================
 //=============================================================================
 void
-MainWindow::VSPServiceCharacteristicWritten(
-    QLowEnergyCharacteristic lecCharacteristic,
-    QByteArray baData
+MainWindow::SetCurrentMode(
+    qint8 nNewMode
     )
 {
-    //VSP characteristic written
-    if (lecCharacteristic == blechrRXChar)
+    //Changes the current mode, the time spent in each mode of a load is logged
+    if (nNewMode != nCurrentMode)
     {
-        unWrittenBytes = unWrittenBytes + baData.length();
-        if (stgSettingsHandle->GetBool(SETTINGS_KEY_SKIPDLDISPLAY) == false)
-        {
-            //Append data to receive buffer display
-            baRecBuffer.append(baData);
-            TrucateRecBuffer();
-        }
-#ifdef ENABLE_DEBUG
-//        qDebug() << "Wrote: " << baData;
-#endif
-
-        if (tmrResponseTimeoutTimer->isActive())
-        {
-            //Restart timeout timer
-            tmrResponseTimeoutTimer->stop();
-            tmrResponseTimeoutTimer->start();
-        }
-
-        //Send data chunk
-        if (nCurrentMode == MAIN_MODE_VERSION || nCurrentMode == MAIN_MODE_SPACECHECK)
-        {
-            baOutputBuffer = baOutputBuffer.mid(baData.length());
-            if (bVSPBlocked == false && baOutputBuffer.length() > 0)
-            {
-                //Write next part of data
-                blesvcVSPService->writeCharacteristic(blechrRXChar, baOutputBuffer.left(stgSettingsHandle->GetUInt(SETTINGS_KEY_PACKETSIZE)));
-            }
-        }
-        else if (nCurrentMode == MAIN_MODE_DOWNLOADING)
-        {
-            unTotalSizeSent += baData.length();
-            baOutputBuffer = baOutputBuffer.mid(baData.length());
-            if (bVSPBlocked == false && baOutputBuffer.length() > 0)
-            {
-                //Write next part of data
-                blesvcVSPService->writeCharacteristic(blechrRXChar, baOutputBuffer.left(stgSettingsHandle->GetUInt(SETTINGS_KEY_PACKETSIZE)));
-            }
-            else if (baOutputBuffer.length() == 0)
-            {
-                //Switch to verification mode
-                nCurrentMode = MAIN_MODE_VERIFYING;
-                if (balOutputBufferList.count() > 0)
-                {
-                    //Send next command
-                    baVersionResponse.clear();
-                    baOutputBuffer = balOutputBufferList.takeFirst();
-                    blesvcVSPService->writeCharacteristic(blechrRXChar, baOutputBuffer.left(stgSettingsHandle->GetUInt(SETTINGS_KEY_PACKETSIZE)));
-                }
-            }
-
-            if (!tmrDisplayUpdateTimer->isActive())
-            {
-                //Start update display timer
-                tmrDisplayUpdateTimer->start();
-            }
-        }
-        else if (nCurrentMode == MAIN_MODE_VERIFYING)
-        {
-            //Verifying download was successful
-            unTotalSizeSent += baData.length();
-            baOutputBuffer = baOutputBuffer.mid(baData.length());
-            if (bVSPBlocked == false && baOutputBuffer.length() > 0)
-            {
-                //Write next part of data
-                blesvcVSPService->writeCharacteristic(blechrRXChar, baOutputBuffer.left(stgSettingsHandle->GetUInt(SETTINGS_KEY_PACKETSIZE)));
-            }
-            else if (baOutputBuffer.length() == 0)
-            {
-                //Check for more commands
-                if (balOutputBufferList.count() > 0)
-                {
-                    //Send next command
-                    baVersionResponse.clear();
-                    baOutputBuffer = balOutputBufferList.takeFirst();
-                    blesvcVSPService->writeCharacteristic(blechrRXChar, baOutputBuffer.left(stgSettingsHandle->GetUInt(SETTINGS_KEY_PACKETSIZE)));
-                }
-            }
-        }
-        else if (nCurrentMode == MAIN_MODE_QUERY)
-        {
-            //Querying module
-            baOutputBuffer = baOutputBuffer.mid(baData.length());
-            if (bVSPBlocked == false && baOutputBuffer.length() > 0)
-            {
-                //Write next part of data
-                blesvcVSPService->writeCharacteristic(blechrRXChar, baOutputBuffer.left(stgSettingsHandle->GetUInt(SETTINGS_KEY_PACKETSIZE)));
-            }
-        }
-
-        //Update Tx/Rx counts
-        UpdateTxRx();
+        stlSessionLog.ModeChanged(nNewMode);
+        ptrPacketTracer.Record(TRACE_EVENT_MODE, nNewMode);
     }
+    nCurrentMode = nNewMode;
 }
 
 //=============================================================================
 //=============================================================================
 void
-MainWindow::VSPServiceDescriptorWritten(
-    QLowEnergyDescriptor ledDescriptor,
-    QByteArray baData
+MainWindow::OfferTransferResume(
     )
 {
-    //VSP descriptor written
-    if (bHasModem == true)
+    //Offers to resume an interrupted transfer if one was saved for the module which has just been connected to
+    if (nCurrentMode != MAIN_MODE_IDLE || vtpTransport == NULL || !trcCheckpoint.IsResumable(strDeviceAddress))
     {
-        if (ledDescriptor == blechrMOChar.descriptor(QBluetoothUuid::ClientCharacteristicConfiguration))
-        {
-            //Modem out enabled
-            baRecBuffer.append("(Now ready to send/receive!)\n");
-            UpdateDisplay();
-        }
+        return;
     }
-#ifdef ENABLE_DEBUG
-    qDebug() << "desc." << ledDescriptor.name() << baData;
-#endif
-}
 
-//=============================================================================
-//=============================================================================
-void
-MainWindow::VSPServiceError(
-    QLowEnergyService::ServiceError nErrorCode
-    )
-{
-    //VSP Service error
-#ifdef ENABLE_DEBUG
-    qDebug() << "BLE Service error: " << nErrorCode;
-#endif
-    if (nErrorCode != QLowEnergyService::NoError && nErrorCode != QLowEnergyService::OperationError)
+    if (QMessageBox::question(this, "Resume OTA transfer", QString("A previous transfer of ").append(trcCheckpoint.Filename()).append(" to this module was interrupted after ").append(QString::number(trcCheckpoint.FileOffset())).append(" of ").append(QString::number(trcCheckpoint.FileData().length())).append(" bytes.\r\n\r\nDo you wish to resume it?"), QMessageBox::Yes, QMessageBox::No) == QMessageBox::Yes)
     {
-        if (nErrorCode == QLowEnergyService::OperationError)
-        {
-            //Operation attempted whilst service was not ready
-            gstrToastString = "Operation error (invalid action), please report this issue to the developer.";
-        }
-        else if (nErrorCode == QLowEnergyService::CharacteristicReadError)
-        {
-            //Failed to read characteristic
-            gstrToastString = "Characteristic read failed - Ensure device is in hardware command VSP mode, try reconnecting again then disable/re-enable Bluetooth from settings to clear the cache.";
-        }
-        else if (nErrorCode == QLowEnergyService::CharacteristicWriteError)
-        {
-            //Failed to write characteristic
-            gstrToastString = "Characteristic write failed - Ensure device is in hardware command VSP mode, try reconnecting again then disable/re-enable Bluetooth from settings to clear the cache.";
-            if (stgSettingsHandle->GetUInt(SETTINGS_KEY_PACKETSIZE) > 20)
-            {
-                //Larger packet size set, add message about
-                gstrToastString += "\r\nA larger packet size is set, ensure you have correctly configured the module and that it supports this size packet.";
-            }
-        }
-        else if (nErrorCode == QLowEnergyService::DescriptorReadError)
-        {
-            //Failed to read descriptor
-            gstrToastString = "Descriptor read failed - Ensure device is in hardware command VSP mode, try reconnecting again then disable/re-enable Bluetooth from settings to clear the cache.";
-        }
-        else if (nErrorCode == QLowEnergyService::DescriptorWriteError)
-        {
-            //Failed to write descriptor
-            gstrToastString = "Descriptor write failed - Ensure device is in hardware command VSP mode, try reconnecting again then disable/re-enable Bluetooth from settings to clear the cache.";
-        }
-        else if (nErrorCode == QLowEnergyService::UnknownError)
-        {
-            //Unknown error
-            gstrToastString = "Unknown Bluetooth service error occured.";
-        }
-
-        //Disconnect from device
-        if (lecBLEController != NULL && bDisconnectActive == false)
-        {
-            bDisconnectActive = true;
-            lecBLEController->disconnectFromDevice();
-        }
-
-        //Clear buffers and set mode to idle
-        baVersionResponse.clear();
-        baOutputBuffer.clear();
-        balOutputBufferList.clear();
-        nCurrentMode = MAIN_MODE_IDLE;
-
-        if (tmrResponseTimeoutTimer->isActive())
-        {
-            //Stop timeout timer
-            tmrResponseTimeoutTimer->stop();
-        }
-
-        //Show message
-        ToastMessage(true);
-
-        //Disable cancel button and enable download filename edit
-        ui->btn_Cancel->setEnabled(false);
-        ui->edit_DownloadName->setReadOnly(false);
+        //Continue from where the transfer stopped, the CRC of the complete file is then verified
+        ui->edit_DownloadName->setText(trcCheckpoint.Filename());
+        SetLoadingStatus(STATUS_LOADING);
+        ui->btn_Cancel->setEnabled(true);
+        ui->edit_DownloadName->setReadOnly(true);
+        otsSession.Resume(SessionOptions(), vtpTransport, strDeviceAddress);
     }
-}
-
-//=============================================================================
-//=============================================================================
-void
-MainWindow::VSPServiceStateChanged(
-    QLowEnergyService::ServiceState nNewState
-    )
-{
-    //Service state changed
-#ifdef ENABLE_DEBUG
-    qDebug() << "State: " << nNewState;
-#endif
-    if (nNewState == QLowEnergyService::ServiceDiscovered)
+    else
     {
-        QLowEnergyService *svcBLEService = qobject_cast<QLowEnergyService *>(sender());
-#ifdef ENABLE_DEBUG
-        qDebug() << "Service: " << svcBLEService->serviceUuid() << ", looking for: " << QBluetoothUuid(stgSettingsHandle->GetString(SETTINGS_KEY_UUID));
-#endif
-        if (svcBLEService && svcBLEService->serviceUuid() == QBluetoothUuid(stgSettingsHandle->GetString(SETTINGS_KEY_UUID)))
-        {
-#ifdef ENABLE_DEBUG
-            qDebug() << "Tx: " << QString(stgSettingsHandle->GetString(SETTINGS_KEY_UUID).left(4)).append(stgSettingsHandle->GetString(SETTINGS_KEY_TX_OFFSET)).append(stgSettingsHandle->GetString(SETTINGS_KEY_UUID).right(28));
-            qDebug() << "Rx: " << QString(stgSettingsHandle->GetString(SETTINGS_KEY_UUID).left(4)).append(stgSettingsHandle->GetString(SETTINGS_KEY_RX_OFFSET)).append(stgSettingsHandle->GetString(SETTINGS_KEY_UUID).right(28));
-#endif
-            blechrTXChar = blesvcVSPService->characteristic(QBluetoothUuid(QString(stgSettingsHandle->GetString(SETTINGS_KEY_UUID).left(4)).append(stgSettingsHandle->GetString(SETTINGS_KEY_TX_OFFSET)).append(stgSettingsHandle->GetString(SETTINGS_KEY_UUID).right(28))));
-            blechrRXChar = blesvcVSPService->characteristic(QBluetoothUuid(QString(stgSettingsHandle->GetString(SETTINGS_KEY_UUID).left(4)).append(stgSettingsHandle->GetString(SETTINGS_KEY_RX_OFFSET)).append(stgSettingsHandle->GetString(SETTINGS_KEY_UUID).right(28))));
-#ifdef ENABLE_DEBUG
-            qint8 unTmp = 0;
-            while (unTmp < svcBLEService->characteristics().count())
-            {
-                qDebug() << "Char: " << unTmp;
-                qDebug() << svcBLEService->characteristics().at(unTmp).uuid();
-                qDebug() << svcBLEService->characteristics().at(unTmp).handle();
-                ++unTmp;
-            }
-            qDebug() << blechrRXChar.handle();
-            qDebug() << blechrRXChar.uuid();
-#endif
-
-            if (blesvcVSPService->characteristic(QBluetoothUuid(QString(stgSettingsHandle->GetString(SETTINGS_KEY_UUID).left(4)).append(stgSettingsHandle->GetString(SETTINGS_KEY_MO_OFFSET)).append(stgSettingsHandle->GetString(SETTINGS_KEY_UUID).right(28)))).isValid())
-            {
-                //Modem characteristics present
-#ifdef ENABLE_DEBUG
-                qDebug() << "-- MODEM -- ";
-#endif
-                bHasModem = true;
-                blechrMOChar = blesvcVSPService->characteristic(QBluetoothUuid(QString(stgSettingsHandle->GetString(SETTINGS_KEY_UUID).left(4)).append(stgSettingsHandle->GetString(SETTINGS_KEY_MO_OFFSET)).append(stgSettingsHandle->GetString(SETTINGS_KEY_UUID).right(28))));
-                blechrMIChar = blesvcVSPService->characteristic(QBluetoothUuid(QString(stgSettingsHandle->GetString(SETTINGS_KEY_UUID).left(4)).append(stgSettingsHandle->GetString(SETTINGS_KEY_MI_OFFSET)).append(stgSettingsHandle->GetString(SETTINGS_KEY_UUID).right(28))));
-            }
-            else
-            {
-                //Modem characteristics not present
-#ifdef ENABLE_DEBUG
-                qDebug() << "-- NO MODEM -- ";
-#endif
-                bHasModem = false;
-            }
-            if (!blechrTXChar.isValid())
-            {
-                //Missing Tx characteristic
-#ifdef ENABLE_DEBUG
-                qDebug() << "Tx char missing.";
-#endif
-                if (bDisconnectActive == false)
-                {
-                    bDisconnectActive = true;
-                    lecBLEController->disconnectFromDevice();
-                }
-            }
-
-            if (!blechrRXChar.isValid())
-            {
-                //Missing Rx characteristic
-#ifdef ENABLE_DEBUG
-                qDebug() << "Rx char missing.";
-#endif
-                if (bDisconnectActive == false)
-                {
-                    bDisconnectActive = true;
-                    lecBLEController->disconnectFromDevice();
-                }
-            }
-
-            if (bHasModem == true)
-            {
-                //VSP with modem in/out
-                if (!blechrMOChar.isValid())
-                {
-                    //Missing MO characteristic
-#ifdef ENABLE_DEBUG
-                    qDebug() << "MO char missing.";
-#endif
-                    if (bDisconnectActive == false)
-                    {
-                        bDisconnectActive = true;
-                        lecBLEController->disconnectFromDevice();
-                    }
-                }
-
-                if (!blechrMIChar.isValid())
-                {
-                    //Missing MI characteristic
-#ifdef ENABLE_DEBUG
-                    qDebug() << "MI char missing.";
-#endif
-                    if (bDisconnectActive == false)
-                    {
-                        bDisconnectActive = true;
-                        lecBLEController->disconnectFromDevice();
-                    }
-                }
-            }
-
-            //Tx notifications descriptor
-            const QLowEnergyDescriptor descTXDesc = blechrTXChar.descriptor(QBluetoothUuid::ClientCharacteristicConfiguration);
-
-            if (!descTXDesc.isValid())
-            {
-                //Tx descriptor missing
-#ifdef ENABLE_DEBUG
-                qDebug() << "Tx desc missing.";
-#endif
-                if (bDisconnectActive == false)
-                {
-                    bDisconnectActive = true;
-                    lecBLEController->disconnectFromDevice();
-                }
-            }
-
-            if (bHasModem == true)
-            {
-                const QLowEnergyDescriptor descMODesc = blechrMOChar.descriptor(QBluetoothUuid::ClientCharacteristicConfiguration);
-
-                if (!descMODesc.isValid())
-                {
-                    //MO descriptor missing
-#ifdef ENABLE_DEBUG
-                    qDebug() << "MO desc missing.";
-#endif
-                    if (bDisconnectActive == false)
-                    {
-                        bDisconnectActive = true;
-                        lecBLEController->disconnectFromDevice();
-                    }
-                }
-
-                //Enable notifications for MO
-                blesvcVSPService->writeDescriptor(descMODesc, QByteArray::fromHex("0100"));
-            }
-
-            //Enable Tx descriptor notifications
-            blesvcVSPService->writeDescriptor(descTXDesc, QByteArray::fromHex("0100"));
-
-            //Set status to idle
-            bVSPBlocked = false;
-            baVersionResponse.clear();
-            baOutputBuffer.clear();
-            balOutputBufferList.clear();
-            nCurrentMode = MAIN_MODE_IDLE;
-
-            //No longer busy
-            SetLoadingStatus(STATUS_STANDBY);
-
-            if (tmrResponseTimeoutTimer->isActive())
-            {
-                //Stop timeout timer
-                tmrResponseTimeoutTimer->stop();
-            }
-
-            //Disable cancel button and enable download filename edit
-            ui->btn_Cancel->setEnabled(false);
-            ui->edit_DownloadName->setReadOnly(false);
-        }
+        //Discard the interrupted transfer
+        trcCheckpoint.Clear();
     }
 }
 
@@ -1732,20 +951,40 @@ MainWindow::ConnectToDevice(
             ddaDiscoveryAgent->stop();
         }
 
-        //Setup the connection request
-        lecBLEController = new QLowEnergyController(bdiDeviceInfo);
-//        lecBLEController->setRemoteAddressType(QLowEnergyController::PublicAddress);
-        connect(lecBLEController, SIGNAL(connected()), this, SLOT(BLEConnected()));
-        connect(lecBLEController, SIGNAL(disconnected()), this, SLOT(BLEDisconnected()));
-        connect(lecBLEController, SIGNAL(discoveryFinished()), this, SLOT(BLEDiscoveryFinished()));
-        connect(lecBLEController, SIGNAL(error(QLowEnergyController::Error)), this, SLOT(BLEError(QLowEnergyController::Error)));
-        connect(lecBLEController, SIGNAL(serviceDiscovered(QBluetoothUuid)), this, SLOT(BLEDiscovered(QBluetoothUuid)));
-        connect(lecBLEController, SIGNAL(stateChanged(QLowEnergyController::ControllerState)), this, SLOT(BLEStateChanged(QLowEnergyController::ControllerState)));
-        lecBLEController->connectToDevice();
+        //Apple platforms do not expose the Bluetooth address so the device UUID identifies the module instead
+#ifdef Q_OS_DARWIN
+        strDeviceAddress = bdiDeviceInfo.deviceUuid().toString();
+#else
+        strDeviceAddress = bdiDeviceInfo.address().toString();
+#endif
+
+        //Setup the connection to the VSP service
+        BleVspTransport *bvtTransport = new BleVspTransport(bdiDeviceInfo);
+        bvtTransport->SetCharacteristics(stgSettingsHandle->GetString(SETTINGS_KEY_UUID), stgSettingsHandle->GetString(SETTINGS_KEY_TX_OFFSET), stgSettingsHandle->GetString(SETTINGS_KEY_RX_OFFSET), stgSettingsHandle->GetString(SETTINGS_KEY_MO_OFFSET), stgSettingsHandle->GetString(SETTINGS_KEY_MI_OFFSET));
+        if (pssSettings->bRecordSessions == true)
+        {
+            //Record the connection so loads over it can be replayed
+            vtpTransport = new RecordingVspTransport(bvtTransport);
+        }
+        else
+        {
+            vtpTransport = bvtTransport;
+        }
+        connect(vtpTransport, SIGNAL(Connected()), this, SLOT(TransportConnected()));
+        connect(vtpTransport, SIGNAL(Opened()), this, SLOT(TransportOpened()));
+        connect(vtpTransport, SIGNAL(Closed()), this, SLOT(TransportClosed()));
+        connect(vtpTransport, SIGNAL(DataReceived(QByteArray)), this, SLOT(TransportDataReceived(QByteArray)));
+        connect(vtpTransport, SIGNAL(FlowChanged(bool)), this, SLOT(TransportFlowChanged(bool)));
+        connect(vtpTransport, SIGNAL(MTUChanged(int)), this, SLOT(TransportMTUChanged(int)));
+        connect(vtpTransport, SIGNAL(Error(QString)), this, SLOT(TransportError(QString)));
+
+        //MTU is updated once it is known for this connection
+        TransportMTUChanged(BLE_DEFAULT_MTU);
+        vtpTransport->Open();
 
         //Set loading image to busy
         SetLoadingStatus(STATUS_LOADING);
-        nCurrentMode = MAIN_MODE_CONNECTING;
+        SetCurrentMode(MAIN_MODE_CONNECTING);
     }
 }
 
@@ -1756,10 +995,10 @@ MainWindow::on_btn_Disconnect_clicked(
     )
 {
     //Disconnect button clicked
-    if (lecBLEController != NULL && bDisconnectActive == false)
+    if (vtpTransport != NULL && bDisconnectActive == false)
     {
         bDisconnectActive = true;
-        lecBLEController->disconnectFromDevice();
+        vtpTransport->Close();
     }
     ui->btn_Disconnect->setEnabled(false);
     ui->btn_Download->setEnabled(false);
@@ -1773,18 +1012,19 @@ MainWindow::on_btn_Scan_clicked(
     )
 {
     //Scan for devices
-    if (lecBLEController == NULL)
+    if (vtpTransport == NULL)
     {
         if (nCurrentMode == MAIN_MODE_IDLE)
         {
-            dlgScanDialog->ClearDevices();
-            dlgScanDialog->SetStatus(STATUS_LOADING);
+            ScanSelection *dlgScan = ScanDialog();
+            dlgScan->ClearDevices();
+            dlgScan->SetStatus(STATUS_LOADING);
 #ifdef Q_OS_ANDROID
-            dlgScanDialog->UpdateWindowSize();
+            dlgScan->UpdateWindowSize();
 #endif
-            dlgScanDialog->show();
+            dlgScan->show();
 #ifdef Q_OS_ANDROID
-            if (stgSettingsHandle->GetBool(SETTINGS_KEY_COMPATIBLESCAN) == false)
+            if (pssSettings->bCompatibleScan == false)
             {
 #endif
                 //Normal scanning
@@ -1809,315 +1049,169 @@ MainWindow::on_btn_Scan_clicked(
     }
     else
     {
-        if (bDisconnectActive == false)
-        {
-            bDisconnectActive = true;
-            lecBLEController->disconnectFromDevice();
-        }
-    }
-}
-
-//=============================================================================
-//=============================================================================
-void
-MainWindow::ClearVar(
-    )
-{
-    //Clears up the BLE controller
-    disconnect(this, SLOT(BLEConnected()));
-    disconnect(this, SLOT(BLEDisconnected()));
-    disconnect(this, SLOT(BLEDiscoveryFinished()));
-    disconnect(this, SLOT(BLEError(QLowEnergyController::Error)));
-    disconnect(this, SLOT(BLEDiscovered(QBluetoothUuid)));
-    disconnect(this, SLOT(BLEStateChanged(QLowEnergyController::ControllerState)));
-    delete lecBLEController;
-    lecBLEController = NULL;
-}
-
-//=============================================================================
-//=============================================================================
-void
-MainWindow::UpdateDisplay(
-    )
-{
-    //Updates the display
-    ui->edit_Display->setPlainText(baRecBuffer);
-    ui->edit_Display->verticalScrollBar()->setSliderPosition(ui->edit_Display->verticalScrollBar()->maximum());
-}
-
-//=============================================================================
-//=============================================================================
-void
-MainWindow::UpdateTxRx(
-    )
-{
-    //Updates the Tx/Rx count message
-    ui->statusBar->showMessage(QString(" ").repeated(nStatusBarSpaces).append("Tx: ").append(QString::number(unWrittenBytes)).append(", Rx: ").append(QString::number(unRecDatSize)).append(", Remaining: ").append(QString::number(unTotalAppSize - unTotalSizeSent)).append(", ").append(QString::number((unTotalAppSize == 0 ? 0 : (unTotalSizeSent * 100 / unTotalAppSize)))).append("% complete."));
-}
-
-//=============================================================================
-//=============================================================================
-void
-MainWindow::on_btn_Clear_clicked(
-    )
-{
-    //Clears the display
-    unWrittenBytes = 0;
-    unRecDatSize = 0;
-    baRecBuffer.clear();
-    UpdateDisplay();
-    UpdateTxRx();
-}
-
-//=============================================================================
-//=============================================================================
-void
-MainWindow::ProcessFileData(
-    bool bSuccess,
-    qint16 nErrorCode,
-    QByteArray baFileData
-    )
-{
-    //Callback for processing file data
-    if (lecBLEController != NULL && bDisconnectActive == false)
-    {
-        if (bSuccess == false)
-        {
-            //Failed to select file
-            if (nErrorCode == DOWNLOAD_FILESIZE_ERROR)
-            {
-                //Filesize not valid
-                gstrToastString = QString("Invalid filesize, must be between ").append(QString::number(FILESIZE_MIN)).append(" - ").append(QString::number(FILESIZE_MAX)).append(" bytes.");
-                ToastMessage(false);
-            }
-            else if (nErrorCode == DOWNLOAD_JSON_ERROR)
-            {
-                //JSON data not valid
-                gstrToastString = "Error parsing HTTP response: JSON data not valid.";
-                ToastMessage(false);
-            }
-            else if (nErrorCode == DOWNLOAD_SERVER_ERROR)
-            {
-                //Server error
-                gstrToastString = QString("Server error: ").append(baFileData);
-                ToastMessage(true);
-            }
-            else if (nErrorCode == DOWNLOAD_XCOMPILE_ERROR)
-            {
-                //Error XCompiling application
-                QMessageBox::critical(this, "Error with XCompilation", baFileData, QMessageBox::Ok, QMessageBox::NoButton);
-            }
-            else if (nErrorCode == DOWNLOAD_GENERAL_ERROR)
-            {
-                //General error
-                gstrToastString = QString("HTTP Download error: ").append(baFileData);
-                ToastMessage(false);
-            }
-            else if (nErrorCode == DOWNLOAD_UNSUPPORTED_ERROR)
-            {
-                //Unsupported device error
-                gstrToastString = QString("XCompile error: ").append(baFileData);
-                ToastMessage(true);
-            }
-            else if (nErrorCode == DOWNLOAD_UNKNOWN_ERROR)
-            {
-                //Unsupported device error
-                gstrToastString = QString("Unknown error - is your ISP altering your network traffic?");
-                ToastMessage(true);
-            }
-            else
-            {
-                //HTTP failure response code
-                gstrToastString = QString("HTTP error code: ").append(QString::number(nErrorCode));
-                ToastMessage(false);
-            }
-            baOutputBuffer.clear();
-            balOutputBufferList.clear();
-            nCurrentMode = MAIN_MODE_IDLE;
-            SetLoadingStatus(STATUS_STANDBY);
-
-            if (tmrResponseTimeoutTimer->isActive())
-            {
-                //Stop timeout timer
-                tmrResponseTimeoutTimer->stop();
-            }
-
-            //Disable cancel button and enable download filename edit
-            ui->btn_Cancel->setEnabled(false);
-            ui->edit_DownloadName->setReadOnly(false);
-            return;
-        }
-        else if (baFileData.isNull() || baFileData.isEmpty())
-        {
-            //No file selected
-            gstrToastString = "File selection cancelled: returned data is null.";
-            ToastMessage(false);
-            baOutputBuffer.clear();
-            balOutputBufferList.clear();
-            nCurrentMode = MAIN_MODE_IDLE;
-            SetLoadingStatus(STATUS_STANDBY);
-
-            if (tmrResponseTimeoutTimer->isActive())
-            {
-                //Stop timeout timer
-                tmrResponseTimeoutTimer->stop();
-            }
-
-            //Disable cancel button and enable download filename edit
-            ui->btn_Cancel->setEnabled(false);
-            ui->edit_DownloadName->setReadOnly(false);
-            return;
-        }
-
-#ifdef ENABLE_DEBUG
-        qDebug() << "Got: " << baFileData;
-#endif
-
-        //Check available module space, if enabled
-        if (stgSettingsHandle->GetBool(SETTINGS_KEY_CHECKFREESPACE) == true && baFileData.length() > nModuleFreeSpace)
-        {
-            //Insufficient space available on the module to download this application, check if the user is sure they want to download it
-            if (QMessageBox::question(this, "Insufficient module space", QString("There is insufficient storage space available on the module, ").append(QString::number(baFileData.length())).append(" bytes are required but only ").append(QString::number(nModuleFreeSpace)).append(" bytes are free therefore the OTA will likely fail.\r\n\r\nAre you sure you want to continue with this operation?"), QMessageBox::Yes, QMessageBox::No) == QMessageBox::No)
-            {
-                //User does not want to continue, cancel operation
-                gstrToastString = "Insufficient module storage space, OTA cancelled!";
-
-                //Show message
-                ToastMessage(false);
-
-                //Set status back to being idle
-                baOutputBuffer.clear();
-                balOutputBufferList.clear();
-                nCurrentMode = MAIN_MODE_IDLE;
-                SetLoadingStatus(STATUS_STANDBY);
-
-                if (tmrResponseTimeoutTimer->isActive())
-                {
-                    //Stop timeout timer
-                    tmrResponseTimeoutTimer->stop();
-                }
-
-                //Disable cancel button and enable download filename edit
-                ui->btn_Cancel->setEnabled(false);
-                ui->edit_DownloadName->setReadOnly(false);
-                return;
-            }
-        }
-
-        //Check if the checksum is being calculated
-        if (stgSettingsHandle->GetBool(SETTINGS_KEY_VERIFYFILE) == true)
-        {
-            chkChecksum = new ChecksumCalculator();
-        }
-
-        //One byte at a time, convert the data to hex
-        QString gstrHexData = "";
-        int i = 0;
-
-        while (i < baFileData.length())
-        {
-            quint8 ThisByte = baFileData[i];
-            if (stgSettingsHandle->GetBool(SETTINGS_KEY_VERIFYFILE) == true)
-            {
-                //Add to checksum
-                chkChecksum->AddByte(ThisByte);
-            }
-
-            QString strThisHex;
-            strThisHex.setNum(ThisByte, 16);
-            if (strThisHex.length() == 1)
-            {
-                //Expand to 2 characters
-                strThisHex.prepend("0");
-            }
-
-            //Add the hex character to the string
-#ifdef ENABLE_DEBUG
-//            qDebug() << "Add: " << strThisHex;
-#endif
-            gstrHexData.append(strThisHex.toUpper());
-            ++i;
-        }
-
-        //Clean up
-        if (stgSettingsHandle->GetBool(SETTINGS_KEY_VERIFYFILE) == true)
-        {
-            strChecksumString = new QString(chkChecksum->GetChecksumHexString());
-            delete chkChecksum;
-            chkChecksum = NULL;
-        }
-
-        //Clear output buffers
-        baOutputBuffer.clear();
-        balOutputBufferList.clear();
-
-        if (stgSettingsHandle->GetBool(SETTINGS_KEY_DELFILE) == true)
+        if (bDisconnectActive == false)
         {
-            //Add delete file command
-            baOutputBuffer.append(QString("AT+del \"").append(ui->edit_DownloadName->text()).append("\"\r"));
+            bDisconnectActive = true;
+            vtpTransport->Close();
         }
+    }
+}
 
-        //Create the file writing data
-        baOutputBuffer.append(QString("AT+fow \"").append(ui->edit_DownloadName->text()).append("\"\r"));
-        while (gstrHexData.length() > 0)
-        {
-            baOutputBuffer.append(QString("AT+fwrh \"").append(gstrHexData.length() > MODULE_MAX_COMMAND_LENGTH ? gstrHexData.left(MODULE_MAX_COMMAND_LENGTH) : gstrHexData).append("\"\r"));
-            if (gstrHexData.length() > MODULE_MAX_COMMAND_LENGTH)
-            {
-                gstrHexData = gstrHexData.right(gstrHexData.length() - MODULE_MAX_COMMAND_LENGTH);
-            }
-            else
-            {
-                gstrHexData = "";
-            }
-        }
+//=============================================================================
+//=============================================================================
+void
+MainWindow::ClearVar(
+    )
+{
+    //Clears up the connection to the module
+    if (sender() == tmrDisconnectCleanUpTimer)
+    {
+        ptrPacketTracer.Record(TRACE_EVENT_TIMER, TRACE_TIMER_DISCONNECT);
+    }
+    if (vtpTransport == NULL)
+    {
+        return;
+    }
+    disconnect(vtpTransport, 0, this, 0);
+    vtpTransport->deleteLater();
+    vtpTransport = NULL;
+}
 
-        //Closing the file
-        balOutputBufferList.append("at+fcl\r");
+//=============================================================================
+//=============================================================================
+void
+MainWindow::UpdateDisplay(
+    )
+{
+    //Updates the display with only the text added since the last update, the display drops old lines itself as its block count is limited to the scrollback size
+    if (sender() == tmrDisplayUpdateTimer)
+    {
+        ptrPacketTracer.Record(TRACE_EVENT_TIMER, TRACE_TIMER_DISPLAY);
+    }
+    bool bReplace;
+    QByteArray baNewText = sbfRecBuffer.TakeUnshown(&bReplace);
+    if (bReplace == true)
+    {
+        //Text which was never shown has been dropped, show everything which is kept
+        ui->edit_Display->setPlainText(baNewText);
+    }
+    else if (!baNewText.isEmpty())
+    {
+        //Insert at the end without re-laying out the rest of the document
+        QTextCursor tcCursor(ui->edit_Display->document());
+        tcCursor.movePosition(QTextCursor::End);
+        tcCursor.insertText(baNewText);
+    }
+    else
+    {
+        //Nothing new
+        return;
+    }
+    ui->edit_Display->verticalScrollBar()->setSliderPosition(ui->edit_Display->verticalScrollBar()->maximum());
+}
 
-        if (stgSettingsHandle->GetBool(SETTINGS_KEY_VERIFYFILE) == true)
-        {
-            //Add commands for verifying file exists and was transferred successfully
-            balOutputBufferList.append("at i 0xc12c\r");
-            balOutputBufferList.append("at+dir\r");
-        }
-        else
-        {
-            //Send dummy command
-            balOutputBufferList.append("at i 1\r");
-        }
+//=============================================================================
+//=============================================================================
+void
+MainWindow::UpdateTxRx(
+    )
+{
+    //Updates the Tx/Rx count message
+    ui->statusBar->showMessage(QString(" ").repeated(nStatusBarSpaces).append("Tx: ").append(QString::number(unWrittenBytes)).append(", Rx: ").append(QString::number(unRecDatSize)).append(", MTU: ").append(QString::number(unNegotiatedMTU)).append(", Remaining: ").append(QString::number(unTotalAppSize - unTotalSizeSent)).append(", ").append(QString::number((unTotalAppSize == 0 ? 0 : (unTotalSizeSent * 100 / unTotalAppSize)))).append("% complete."));
+}
 
-        //Set variables for progress tracking and clear any received responses - note that the total app size is the size of the encoded buffer data, not just purely the application size
-        unTotalSizeSent = 0;
-        unTotalAppSize = baOutputBuffer.length();
-        baVersionResponse.clear();
+//=============================================================================
+//=============================================================================
+void
+MainWindow::UpdateScrollbackSize(
+    )
+{
+    //Limits the kept text and the display to the scrollback size, the display has one more block than there are line feeds (0 is unlimited for both)
+    sbfRecBuffer.SetCapacity(pssSettings->unScrollbackSize);
+    ui->edit_Display->setMaximumBlockCount(pssSettings->unScrollbackSize == 0 ? 0 : (int)pssSettings->unScrollbackSize + 1);
+    UpdateDisplay();
+}
 
-        //Add in the length of all extra commands
-        i = 0;
-        while (i < balOutputBufferList.length())
-        {
-            unTotalAppSize += balOutputBufferList[i].length();
-            ++i;
-        }
+//=============================================================================
+//=============================================================================
+void
+MainWindow::on_btn_Clear_clicked(
+    )
+{
+    //Clears the display
+    unWrittenBytes = 0;
+    unRecDatSize = 0;
+    sbfRecBuffer.Clear();
+    UpdateDisplay();
+    UpdateTxRx();
+}
 
-        //Set mode to downloading application
-        nCurrentMode = MAIN_MODE_DOWNLOADING;
+//=============================================================================
+//=============================================================================
+void
+MainWindow::CancelWebRequest(
+    )
+{
+    //Cancels the web request the current mode is waiting for, XCompile requests belong to the OTA session
+    if (unWebRequest != 0)
+    {
+        dwnDownloaderHandle->CancelRequest(unWebRequest);
+        unWebRequest = 0;
+    }
+}
 
-#ifdef ENABLE_DEBUG
-        qDebug() << "nCurrentMode is now: " << nCurrentMode << ", Data: " << baOutputBuffer.left(stgSettingsHandle->GetUInt(SETTINGS_KEY_PACKETSIZE));
-#endif
+//=============================================================================
+//=============================================================================
+void
+MainWindow::LoadFile(
+    const QByteArray &baApplicationData,
+    bool bXCompile
+    )
+{
+    //Loads an application (or smartBASIC source which is XCompiled for the module) onto the connected module using the OTA session
+    OtaSessionOptions osoOptions = SessionOptions();
+    osoOptions.baFileData = baApplicationData;
+    osoOptions.bXCompile = bXCompile;
+    nQueryMode = (bXCompile == true ? MAIN_MODE_VERSION : MAIN_MODE_SPACECHECK);
 
-        //Start writing the data
-        blesvcVSPService->writeCharacteristic(blechrRXChar, baOutputBuffer.left(stgSettingsHandle->GetUInt(SETTINGS_KEY_PACKETSIZE)));
+    //Enable cancel button and disable download filename edit
+    SetLoadingStatus(STATUS_LOADING);
+    ui->btn_Cancel->setEnabled(true);
+    ui->edit_DownloadName->setReadOnly(true);
 
-        //Enable cancel button and disable download filename edit
-        ui->btn_Cancel->setEnabled(true);
-        ui->edit_DownloadName->setReadOnly(true);
+    //Show message
+    gstrToastString = (bXCompile == true ? "Fetching details for XCompilation from module..." : "Checking module storage space...");
+    ToastMessage(false);
 
-        //Output message
-        gstrToastString = "Transferring OTA data...";
-        ToastMessage(false);
-    }
+    otsSession.Load(osoOptions, vtpTransport, strDeviceAddress);
+}
+
+//=============================================================================
+//=============================================================================
+OtaSessionOptions
+MainWindow::SessionOptions(
+    )
+{
+    //Returns the options for an OTA session from the settings
+    OtaSessionOptions osoOptions;
+    osoOptions.strAddress = strDeviceAddress;
+    osoOptions.strTargetName = ui->edit_DownloadName->text();
+    osoOptions.bPrefetchXCompile = pssSettings->bPrefetchXCompile;
+    osoOptions.bSSL = pssSettings->bSSL;
+    osoOptions.bDeleteFile = pssSettings->bDeleteFile;
+    osoOptions.bVerifyFile = pssSettings->bVerifyFile;
+    osoOptions.bSkipIdentical = pssSettings->bSkipIdentical;
+    osoOptions.bCheckFreeSpace = pssSettings->bCheckFreeSpace;
+    osoOptions.bRestart = (pssSettings->unDownloadAction == DOWNLOAD_ACTION_RESTART);
+    osoOptions.unPacketSize = pssSettings->unPacketSize;
+    osoOptions.bStreamWrites = pssSettings->bStreamWrites;
+    osoOptions.unStreamWindow = pssSettings->unStreamWindow;
+    osoOptions.unCommandWindow = pssSettings->unCommandWindow;
+    if (pssSettings->bRecordSessions == true)
+    {
+        osoOptions.strCaptureDirectory = SessionCapture::DefaultDirectory();
+    }
+    return osoOptions;
 }
 
 //=============================================================================
@@ -2127,7 +1221,7 @@ MainWindow::on_btn_Download_clicked(
     )
 {
     //Download button clicked
-    if (lecBLEController != NULL && nCurrentMode == MAIN_MODE_IDLE)
+    if (vtpTransport != NULL && nCurrentMode == MAIN_MODE_IDLE)
     {
         if (nSelectedFileType == FILE_TYPE_LOCALFILE)
         {
@@ -2176,7 +1270,7 @@ MainWindow::on_btn_Download_clicked(
 #endif
 
                 //Is this a source file or compiled application
-                if (stgSettingsHandle->GetBool(SETTINGS_KEY_ONLINEXCOMP) == true && (strLocalFilename.right(3).toLower() == ".sb" || strLocalFilename.right(4).toLower() == ".txt"))
+                if (pssSettings->bOnlineXCompile == true && (strLocalFilename.right(3).toLower() == ".sb" || strLocalFilename.right(4).toLower() == ".txt"))
                 {
                     //Source file and XCompilation enabled, load file data into byte array
                     SetLoadingStatus(STATUS_LOADING);
@@ -2185,35 +1279,8 @@ MainWindow::on_btn_Download_clicked(
                     qDebug() << "Read file data (" << baFileData.length() << ").";
 #endif
 
-                    //Fetch details from module
-                    nCurrentMode = MAIN_MODE_VERSION;
-                    baVersionResponse.clear();
-                    balOutputBufferList.clear();
-                    balOutputBufferList.append("at i 0\r\n");
-                    if (bIs2MPhySupported == true)
-                    {
-                        //Check module firmware for 2M PHY devices
-                        balOutputBufferList.append("at i 3\r\n");
-                    }
-                    if (stgSettingsHandle->GetBool(SETTINGS_KEY_CHECKFREESPACE) == true)
-                    {
-                        //Check if there is sufficient free space
-                        balOutputBufferList.append("at i 6\r\n");
-                    }
-                    balOutputBufferList.append("at i 13\r\n");
-                    baOutputBuffer = balOutputBufferList.takeFirst();
-                    blesvcVSPService->writeCharacteristic(blechrRXChar, baOutputBuffer.left(stgSettingsHandle->GetUInt(SETTINGS_KEY_PACKETSIZE)));
-
-                    //Show message
-                    gstrToastString = "Fetching details for XCompilation from module...";
-                    ToastMessage(false);
-
-                    //Start response timeout timer
-                    tmrResponseTimeoutTimer->start();
-
-                    //Enable cancel button and disable download filename edit
-                    ui->btn_Cancel->setEnabled(true);
-                    ui->edit_DownloadName->setReadOnly(true);
+                    //Fetch details for XCompilation from module
+                    LoadFile(baFileData, true);
                 }
                 else
                 {
@@ -2221,51 +1288,15 @@ MainWindow::on_btn_Download_clicked(
                     SetLoadingStatus(STATUS_LOADING);
 
                     //Fetch details from module
-                    nCurrentMode = MAIN_MODE_SPACECHECK;
-                    baVersionResponse.clear();
-                    balOutputBufferList.clear();
-                    if (bIs2MPhySupported == true)
-                    {
-                        //Check module information for 2M PHY devices
-                        balOutputBufferList.append("at i 0\r\n");
-                        balOutputBufferList.append("at i 3\r\n");
-                    }
-                    if (stgSettingsHandle->GetBool(SETTINGS_KEY_CHECKFREESPACE) == true)
-                    {
-                        //Check if there is sufficient free space
-                        balOutputBufferList.append("at i 6\r\n");
-                    }
-
-                    if (!balOutputBufferList.isEmpty())
-                    {
-                        //Commands to send
-                        baOutputBuffer = balOutputBufferList.takeFirst();
-                        blesvcVSPService->writeCharacteristic(blechrRXChar, baOutputBuffer.left(stgSettingsHandle->GetUInt(SETTINGS_KEY_PACKETSIZE)));
-
-                        //Show message
-                        gstrToastString = "Checking module storage space...";
-                        ToastMessage(false);
-                    }
-                    else
-                    {
-                        //Load the file directly to the module
-                        ProcessFileData(true, 0, baFileData);
-                    }
-
-                    //Start response timeout timer
-                    tmrResponseTimeoutTimer->start();
-
-                    //Enable cancel button and disable download filename edit
-                    ui->btn_Cancel->setEnabled(true);
-                    ui->edit_DownloadName->setReadOnly(true);
+                    LoadFile(baFileData, false);
                 }
             }
         }
         else if (nSelectedFileType == FILE_TYPE_REMOTEURL)
         {
             //Remote file
-            nCurrentMode = MAIN_MODE_ONLINE_DOWNLOAD;
-            dwnDownloaderHandle->DownloadFile(strLocalFilename);
+            SetCurrentMode(MAIN_MODE_ONLINE_DOWNLOAD);
+            unWebRequest = dwnDownloaderHandle->DownloadFile(strLocalFilename);
 
             //Enable cancel button and disable download filename edit
             ui->btn_Cancel->setEnabled(true);
@@ -2285,7 +1316,7 @@ MainWindow::on_btn_Download_clicked(
             ToastMessage(false);
         }
     }
-    else if (lecBLEController == NULL)
+    else if (vtpTransport == NULL)
     {
         //Not connected to a device
         gstrToastString = "Not connected to a VSP BLE device, please click the 'Scan' button to list available devices.";
@@ -2324,15 +1355,16 @@ MainWindow::on_btn_Settings_clicked(
     if (nCurrentMode == MAIN_MODE_IDLE)
     {
         //Not busy - show application settings
-        dlgSettingsView->SetValues(stgSettingsHandle->GetString(SETTINGS_KEY_UUID), stgSettingsHandle->GetString(SETTINGS_KEY_TX_OFFSET), stgSettingsHandle->GetString(SETTINGS_KEY_RX_OFFSET), stgSettingsHandle->GetString(SETTINGS_KEY_MO_OFFSET), stgSettingsHandle->GetString(SETTINGS_KEY_MI_OFFSET), stgSettingsHandle->GetBool(SETTINGS_KEY_RESTRICTUUID),
+        SettingsDialog *dlgSettings = SettingsView();
+        dlgSettings->SetValues(stgSettingsHandle->GetString(SETTINGS_KEY_UUID), stgSettingsHandle->GetString(SETTINGS_KEY_TX_OFFSET), stgSettingsHandle->GetString(SETTINGS_KEY_RX_OFFSET), stgSettingsHandle->GetString(SETTINGS_KEY_MO_OFFSET), stgSettingsHandle->GetString(SETTINGS_KEY_MI_OFFSET), stgSettingsHandle->GetBool(SETTINGS_KEY_RESTRICTUUID),
 #ifdef Q_OS_ANDROID
             stgSettingsHandle->GetBool(SETTINGS_KEY_COMPATIBLESCAN),
 #endif
-            stgSettingsHandle->GetUInt(SETTINGS_KEY_PACKETSIZE), stgSettingsHandle->GetBool(SETTINGS_KEY_DELFILE), stgSettingsHandle->GetBool(SETTINGS_KEY_VERIFYFILE), stgSettingsHandle->GetUInt(SETTINGS_KEY_DOWNLOADACTION), stgSettingsHandle->GetBool(SETTINGS_KEY_SKIPDLDISPLAY), stgSettingsHandle->GetUInt(SETTINGS_KEY_SCROLLBACKSIZE), stgSettingsHandle->GetBool(SETTINGS_KEY_ONLINEXCOMP), stgSettingsHandle->GetBool(SETTINGS_KEY_SSL), stgSettingsHandle->GetBool(SETTINGS_KEY_CHECKFWVERSION), stgSettingsHandle->GetBool(SETTINGS_KEY_CHECKFREESPACE), elErrorLookupHandle.DatabaseVersion());
+            stgSettingsHandle->GetUInt(SETTINGS_KEY_PACKETSIZE), stgSettingsHandle->GetBool(SETTINGS_KEY_DELFILE), stgSettingsHandle->GetBool(SETTINGS_KEY_VERIFYFILE), stgSettingsHandle->GetUInt(SETTINGS_KEY_DOWNLOADACTION), stgSettingsHandle->GetBool(SETTINGS_KEY_SKIPDLDISPLAY), stgSettingsHandle->GetUInt(SETTINGS_KEY_SCROLLBACKSIZE), stgSettingsHandle->GetBool(SETTINGS_KEY_ONLINEXCOMP), stgSettingsHandle->GetBool(SETTINGS_KEY_SSL), stgSettingsHandle->GetBool(SETTINGS_KEY_CHECKFWVERSION), stgSettingsHandle->GetBool(SETTINGS_KEY_CHECKFREESPACE), pssSettings->bStreamWrites, pssSettings->unStreamWindow, pssSettings->unCommandWindow, pssSettings->unXCompileCacheSize, pssSettings->bPrefetchXCompile, pssSettings->unModuleCacheTTL, pssSettings->bSkipIdentical, pssSettings->bPacketTrace, pssSettings->bRecordSessions, elErrorLookupHandle.DatabaseVersion());
 #ifdef Q_OS_ANDROID
-        dlgSettingsView->UpdateWindowSize();
+        dlgSettings->UpdateWindowSize();
 #endif
-        dlgSettingsView->show();
+        dlgSettings->show();
     }
 }
 
@@ -2407,16 +1439,25 @@ MainWindow::SettingsUpdated(
 #ifdef Q_OS_ANDROID
     bool bCompatibleScanning,
 #endif
-    quint8 unPacketSize,
+    quint16 unPacketSize,
     bool bDelFile,
     bool bVerifyFile,
     quint8 unDownloadAction,
     bool bSkipDownloadDisplay,
-    quint8 unScrollbackSize,
+    quint32 unScrollbackSize,
     bool bXCompile,
     bool bSSL,
     bool bCheckFirmware,
-    bool bFreeSpaceCheck
+    bool bFreeSpaceCheck,
+    bool bStreamWrites,
+    quint8 unStreamWindow,
+    quint8 unCommandWindow,
+    quint16 unXCompileCacheSize,
+    bool bPrefetchXCompile,
+    quint32 unModuleCacheTTL,
+    bool bSkipIdentical,
+    bool bPacketTrace,
+    bool bRecordSessions
     )
 {
     //Callback for settings being updated
@@ -2442,12 +1483,45 @@ MainWindow::SettingsUpdated(
         stgSettingsHandle->SetBool(SETTINGS_KEY_SSL, bSSL);
         stgSettingsHandle->SetBool(SETTINGS_KEY_CHECKFWVERSION, bCheckFirmware);
         stgSettingsHandle->SetBool(SETTINGS_KEY_CHECKFREESPACE, bFreeSpaceCheck);
+        stgSettingsHandle->SetBool(SETTINGS_KEY_STREAMWRITES, bStreamWrites);
+        stgSettingsHandle->SetUInt(SETTINGS_KEY_STREAMWINDOW, unStreamWindow);
+        stgSettingsHandle->SetUInt(SETTINGS_KEY_COMMANDWINDOW, unCommandWindow);
+        stgSettingsHandle->SetUInt(SETTINGS_KEY_XCOMPILECACHE, unXCompileCacheSize);
+        stgSettingsHandle->SetBool(SETTINGS_KEY_PREFETCHXCOMP, bPrefetchXCompile);
+        stgSettingsHandle->SetUInt(SETTINGS_KEY_MODULECACHETTL, unModuleCacheTTL);
+        stgSettingsHandle->SetBool(SETTINGS_KEY_SKIPIDENTICAL, bSkipIdentical);
+        stgSettingsHandle->SetBool(SETTINGS_KEY_PACKETTRACE, bPacketTrace);
+        stgSettingsHandle->SetBool(SETTINGS_KEY_RECORDSESSIONS, bRecordSessions);
+        stgSettingsHandle->RefreshSnapshot();
+        UpdateScrollbackSize();
+        xccXCompileCache.SetStorage(XCompileCache::DefaultDirectory(), (qint64)pssSettings->unXCompileCacheSize*1024*1024);
+        mscModuleCache.SetStorage(ModuleStateCache::DefaultFilename(), pssSettings->unModuleCacheTTL);
+        ptrPacketTracer.SetEnabled(pssSettings->bPacketTrace);
 
         //Change SSL option
         dwnDownloaderHandle->SetSSLSupport(bSSL);
     }
 }
 
+//=============================================================================
+//=============================================================================
+void
+MainWindow::SavePacketTrace(
+    )
+{
+    //Saves the packet trace recorded so far for viewing in chrome://tracing or Perfetto
+    QString strFilename = PacketTracer::DefaultFilename();
+    if (ptrPacketTracer.Save(strFilename) == true)
+    {
+        gstrToastString = QString("Packet trace saved to ").append(strFilename);
+    }
+    else
+    {
+        gstrToastString = "No packet trace to save, enable recording and repeat the operation to trace.";
+    }
+    ToastMessage(true);
+}
+
 //=============================================================================
 //=============================================================================
 void
@@ -2455,11 +1529,12 @@ MainWindow::on_btn_SelectFile_clicked(
     )
 {
     //File selection button clicked
-    dlgFileTypeDialog->open();
+    FileTypeSelection *dlgFileType = FileTypeDialog();
+    dlgFileType->open();
 
 #ifdef Q_OS_ANDROID
     //Fix for some faulty and badly designed file selection systems on some android devices i.e. onedrive
-    dlgFileTypeDialog->move((QApplication::desktop()->availableGeometry().width()/2 - dlgFileTypeDialog->width()/2), (QApplication::desktop()->availableGeometry().height()/2 - dlgFileTypeDialog->height()/2));
+    dlgFileType->move((QApplication::desktop()->availableGeometry().width()/2 - dlgFileType->width()/2), (QApplication::desktop()->availableGeometry().height()/2 - dlgFileType->height()/2));
 
     //Fix for some bug in Qt which decies to cut the top and bottom of word-wrapped text off
     tmrStartupTimer = new QTimer();
@@ -2498,10 +1573,6 @@ void
 MainWindow::LoadImages(
     )
 {
-    //Load the busy animation
-    movieLoadingAnimation = new QMovie(":/Internal/loader.gif");
-    movieLoadingAnimation->setScaledSize(QSize(LOADING_IMAGE_WIDTH, LOADING_IMAGE_HEIGHT));
-
     //Load the stanby picture
     QPixmap pixmapTmp = QPixmap(":/Internal/standby.png");
     pixmapStandbyPicture = new QPixmap(pixmapTmp.scaled(LOADING_IMAGE_WIDTH, LOADING_IMAGE_HEIGHT));
@@ -2525,11 +1596,20 @@ MainWindow::SetLoadingStatus(
     {
         //Standby
         labelStatusBarLoader->setPixmap(*pixmapStandbyPicture);
-        movieLoadingAnimation->stop();
+        if (movieLoadingAnimation != NULL)
+        {
+            movieLoadingAnimation->stop();
+        }
     }
     else if (unStatus == STATUS_LOADING)
     {
         //Loading
+        if (movieLoadingAnimation == NULL)
+        {
+            //First time the busy animation is shown, load it
+            movieLoadingAnimation = new QMovie(":/Internal/loader.gif");
+            movieLoadingAnimation->setScaledSize(QSize(LOADING_IMAGE_WIDTH, LOADING_IMAGE_HEIGHT));
+        }
         movieLoadingAnimation->start();
         labelStatusBarLoader->setMovie(movieLoadingAnimation);
     }
@@ -2543,21 +1623,14 @@ MainWindow::on_btn_ModuleInfo_clicked(
     )
 {
     //Fetch information about module
-    if (nCurrentMode == MAIN_MODE_IDLE)
+    if (vtpTransport != NULL && nCurrentMode == MAIN_MODE_IDLE)
     {
-        nCurrentMode = MAIN_MODE_QUERY;
-        baVersionResponse.clear();
-        balOutputBufferList.append("at i 0\r\n");
-        balOutputBufferList.append("at i 3\r\n");
-        balOutputBufferList.append("at i 6\r\n");
-        baOutputBuffer = balOutputBufferList.takeFirst();
-        blesvcVSPService->writeCharacteristic(blechrRXChar, baOutputBuffer.left(stgSettingsHandle->GetUInt(SETTINGS_KEY_PACKETSIZE)));
-
-        //Start response timeout timer
-        tmrResponseTimeoutTimer->start();
+        //The details are always read from the module
+        nQueryMode = MAIN_MODE_QUERY;
 
         //Enable cancel button
         ui->btn_Cancel->setEnabled(true);
+        otsSession.Query(vtpTransport, strDeviceAddress);
     }
 }
 
@@ -2592,8 +1665,9 @@ MainWindow::FileTypeChanged(
         if (!afdFileDialog->provideExistingFileName())
         {
             //File open dialogue failed
-            connect(afdFileDialog, SIGNAL(existingFileNameReady(QString,QByteArray)), this, SLOT(AndroidOpen(QString,QByteArray)));
+            disconnect(afdFileDialog, SIGNAL(existingFileNameReady(QString,QByteArray)), this, SLOT(AndroidOpen(QString,QByteArray)));
             delete afdFileDialog;
+            afdFileDialog = NULL;
             QMessageBox::critical(this, "Error opening file selector", "An error occured whilst attempting to open the Android File Selector dialogue, please report this issue including details of which device you are using it on and what the firmware version is.", QMessageBox::Ok, QMessageBox::NoButton);
         }
 #elif defined(Q_OS_IOS)
@@ -2680,178 +1754,29 @@ MainWindow::FileTypeChanged(
 //=============================================================================
 void
 MainWindow::FileDownloaded(
+    quint32 unRequestID,
     bool bSuccess,
     qint16 nErrorCode,
     QByteArray baDownloadedFileData
     )
 {
     //Callback for file download notification
-    if (lecBLEController != NULL && bDisconnectActive == false)
+    if (unRequestID != unWebRequest)
+    {
+        //Response to a request which is no longer wanted
+        return;
+    }
+    unWebRequest = 0;
+    if (vtpTransport != NULL && bDisconnectActive == false)
     {
         if (bSuccess == true)
         {
             //Successfully downloaded file
             ui->label_Filesize->setText(QString::number(baDownloadedFileData.length()));
+            baFileData = baDownloadedFileData;
 
-            //Is this a source file or compiled application?
-            if (stgSettingsHandle->GetBool(SETTINGS_KEY_ONLINEXCOMP) == true && (strLocalFilename.right(3).toLower() == ".sb" || strLocalFilename.right(4).toLower() == ".txt"))
-            {
-                //Source file and XCompilation enabled, load file data into byte array
-                baFileData.clear();
-                baFileData = baDownloadedFileData;
-
-                //Fetch details from module
-                nCurrentMode = MAIN_MODE_VERSION;
-                baVersionResponse.clear();
-                balOutputBufferList.clear();
-                balOutputBufferList.append("at i 0\r\n");
-                balOutputBufferList.append("at i 3\r\n");
-                balOutputBufferList.append("at i 13\r\n");
-                if (stgSettingsHandle->GetBool(SETTINGS_KEY_CHECKFREESPACE) == true)
-                {
-                    //Check if there is sufficient free space
-                    balOutputBufferList.append("at i 6\r\n");
-                }
-                baOutputBuffer = balOutputBufferList.takeFirst();
-                blesvcVSPService->writeCharacteristic(blechrRXChar, baOutputBuffer.left(stgSettingsHandle->GetUInt(SETTINGS_KEY_PACKETSIZE)));
-
-                //Enable cancel button and disable download filename edit
-                ui->btn_Cancel->setEnabled(true);
-                ui->edit_DownloadName->setReadOnly(true);
-            }
-            else
-            {
-                //Application file or XCompilation disabled, load directly to module
-                if (baDownloadedFileData.length() > nModuleFreeSpace)
-                {
-                    //Insufficient space available on the module to download this application, check if the user is sure they want to download it
-                    if (QMessageBox::question(this, "Insufficient module space", QString("There is insufficient storage space available on the module, ").append(QString::number(baDownloadedFileData.length())).append(" bytes are required but only ").append(QString::number(nModuleFreeSpace)).append(" bytes are free therefore the OTA will likely fail.\r\n\r\nAre you sure you want to continue with this operation?"), QMessageBox::Yes, QMessageBox::No) == QMessageBox::No)
-                    {
-                        //User does not want to continue, cancel operation
-                        gstrToastString = "Insufficient module storage space, OTA cancelled!";
-
-                        //Show message
-                        ToastMessage(false);
-
-                        //Set status back to being idle
-                        baOutputBuffer.clear();
-                        balOutputBufferList.clear();
-                        nCurrentMode = MAIN_MODE_IDLE;
-                        SetLoadingStatus(STATUS_STANDBY);
-
-                        if (tmrResponseTimeoutTimer->isActive())
-                        {
-                            //Stop timeout timer
-                            tmrResponseTimeoutTimer->stop();
-                        }
-
-                        //Disable cancel button and enable download filename edit
-                        ui->btn_Cancel->setEnabled(false);
-                        ui->edit_DownloadName->setReadOnly(false);
-                        return;
-                    }
-                }
-
-                if (stgSettingsHandle->GetBool(SETTINGS_KEY_VERIFYFILE) == true)
-                {
-                    //Checksum is being calculated, create object
-                    chkChecksum = new ChecksumCalculator();
-                }
-
-                //One byte at a time, convert the data to hex
-                QString gstrHexData = "";
-                int i = 0;
-
-                while (i < baDownloadedFileData.length())
-                {
-                    quint8 unThisByte = baDownloadedFileData[i];
-                    if (stgSettingsHandle->GetBool(SETTINGS_KEY_VERIFYFILE) == true)
-                    {
-                        //Add to checksum
-                        chkChecksum->AddByte(unThisByte);
-                    }
-
-                    QString strThisHex;
-                    strThisHex.setNum(unThisByte, 16);
-                    if (strThisHex.length() == 1)
-                    {
-                        //Expand to 2 characters
-                        strThisHex.prepend("0");
-                    }
-
-                    //Add the hex character to the string
-#ifdef ENABLE_DEBUG
-//                    qDebug() << "Add: " << strThisHex;
-#endif
-                    gstrHexData.append(strThisHex.toUpper());
-                    ++i;
-                }
-
-                //Clean up
-                if (stgSettingsHandle->GetBool(SETTINGS_KEY_VERIFYFILE) == true)
-                {
-                    strChecksumString = new QString(chkChecksum->GetChecksumHexString());
-                    delete chkChecksum;
-                    chkChecksum = NULL;
-                }
-
-                //Clear output buffer
-                baOutputBuffer.clear();
-
-                if (stgSettingsHandle->GetBool(SETTINGS_KEY_DELFILE) == true)
-                {
-                    //Add delete file command
-                    baOutputBuffer.append(QString("AT+del \"").append(ui->edit_DownloadName->text()).append("\"\r"));
-                }
-
-                //Create the file writing data
-                baOutputBuffer.append(QString("AT+fow \"").append(ui->edit_DownloadName->text()).append("\"\r"));
-                while (gstrHexData.length() > 0)
-                {
-                    baOutputBuffer.append(QString("AT+fwrh \"").append(gstrHexData.length() > MODULE_MAX_COMMAND_LENGTH ? gstrHexData.left(MODULE_MAX_COMMAND_LENGTH) : gstrHexData).append("\"\r"));
-                    if (gstrHexData.length() > MODULE_MAX_COMMAND_LENGTH)
-                    {
-                        gstrHexData = gstrHexData.right(gstrHexData.length() - MODULE_MAX_COMMAND_LENGTH);
-                    }
-                    else
-                    {
-                        gstrHexData = "";
-                    }
-                }
-
-                //Closing the file
-                baOutputBuffer.append(QString("at+fcl\r"));
-
-                if (stgSettingsHandle->GetBool(SETTINGS_KEY_VERIFYFILE) == true)
-                {
-                    //Add commands for verifying file exists and was transferred successfully
-                    baOutputBuffer.append(QString("at i 0xc12c\rat+dir\r"));
-                }
-                else
-                {
-                    //Send dummy command
-                    baOutputBuffer.append(QString("at i 1\r"));
-                }
-
-                //Set variables for progress tracking and clear any received responses - note that the total app size is the size of the encoded buffer data, not just purely the application size
-                unTotalSizeSent = 0;
-                unTotalAppSize = baOutputBuffer.length();
-                baVersionResponse.clear();
-
-                //Set mode to downloading application
-                nCurrentMode = MAIN_MODE_DOWNLOADING;
-
-#ifdef ENABLE_DEBUG
-                qDebug() << "nCurrentMode is now: " << nCurrentMode << ", Data: " << baOutputBuffer.left(stgSettingsHandle->GetUInt(SETTINGS_KEY_PACKETSIZE));
-#endif
-
-                //Start writing the data
-                blesvcVSPService->writeCharacteristic(blechrRXChar, baOutputBuffer.left(stgSettingsHandle->GetUInt(SETTINGS_KEY_PACKETSIZE)));
-
-                //Enable cancel button and disable download filename edit
-                ui->btn_Cancel->setEnabled(true);
-                ui->edit_DownloadName->setReadOnly(true);
-            }
+            //Is this a source file or compiled application? Source files are XCompiled if XCompilation is enabled
+            LoadFile(baFileData, (pssSettings->bOnlineXCompile == true && (strLocalFilename.right(3).toLower() == ".sb" || strLocalFilename.right(4).toLower() == ".txt")));
         }
         else
         {
@@ -2888,17 +1813,9 @@ MainWindow::FileDownloaded(
             ToastMessage(false);
 
             //Set status back to being idle
-            baOutputBuffer.clear();
-            balOutputBufferList.clear();
-            nCurrentMode = MAIN_MODE_IDLE;
+            SetCurrentMode(MAIN_MODE_IDLE);
             SetLoadingStatus(STATUS_STANDBY);
 
-            if (tmrResponseTimeoutTimer->isActive())
-            {
-                //Stop timeout timer
-                tmrResponseTimeoutTimer->stop();
-            }
-
             //Disable cancel button and enable download filename edit
             ui->btn_Cancel->setEnabled(false);
             ui->edit_DownloadName->setReadOnly(false);
@@ -2914,10 +1831,12 @@ MainWindow::FileDownloaded(
 //=============================================================================
 void
 MainWindow::DownloaderStatusChanged(
+    quint32 unRequestID,
     quint8 unStatus
     )
 {
-    //Download object status has changed
+    //Download object status has changed, the status of a request is shown as soon as it is made so the request ID is not checked
+    Q_UNUSED(unRequestID);
     if (unStatus == DOWNLOAD_MODE_IDLE)
     {
         //Inactive
@@ -2959,66 +1878,125 @@ MainWindow::StartupTimerElapsed(
     disconnect(tmrStartupTimer, SIGNAL(timeout()), this, SLOT(StartupTimerElapsed()));
     delete tmrStartupTimer;
     tmrStartupTimer = NULL;
+
+    //Window layout is final
+    bStartupLayoutDone = true;
+    StartupScanReady();
 }
 
 //=============================================================================
 //=============================================================================
-void
-MainWindow::TimeoutTimerElapsed(
+bool
+MainWindow::event(
+    QEvent *evtEvent
     )
 {
-    //Timeout whilst awaiting response from module
-    if (nCurrentMode == MAIN_MODE_VERSION)
+    //Watches for the first paint of the window to time start-up
+    bool bHandled = QMainWindow::event(evtEvent);
+    if (bFirstFrameQueued == false && evtEvent->type() == QEvent::Paint)
     {
-        //Timeout whilst attempting to retrieve module firmware details
-        gstrToastString = "Response timeout awaiting module firmware details - please ensure module is in hardware command mode VSP and retry.";
+        //Painting has started, the frame is complete once the event loop returns to idle
+        bFirstFrameQueued = true;
+        QTimer::singleShot(0, this, SLOT(StartupFirstFrame()));
     }
-    else if (nCurrentMode == MAIN_MODE_SPACECHECK)
+    return bHandled;
+}
+
+//=============================================================================
+//=============================================================================
+void
+MainWindow::StartupFirstFrame(
+    )
+{
+    //First frame of the window has been drawn
+    nFirstFrameTime = tmrLaunchTimer.elapsed();
+#ifdef ENABLE_DEBUG
+    qDebug() << "Start-up: first frame after" << nFirstFrameTime << "ms";
+#endif
+    StartupScanReady();
+}
+
+//=============================================================================
+//=============================================================================
+void
+MainWindow::StartupScanReady(
+    )
+{
+    //Records when the window is drawn, laid out and can be used to start a scan
+    if (nScanReadyTime != -1 || nFirstFrameTime == -1 || bStartupLayoutDone == false)
     {
-        //Timeout whilst attempting to retrieve module storage space
-        gstrToastString = "Response timeout awaiting module storage space - please ensure module is in hardware command mode VSP and retry.";
+        //Already recorded or start-up not yet complete
+        return;
     }
-    else if (nCurrentMode == MAIN_MODE_DOWNLOADING)
+
+    nScanReadyTime = tmrLaunchTimer.elapsed();
+#ifdef ENABLE_DEBUG
+    if (ui->btn_Scan->isEnabled())
     {
-        //Timeout whilst downloading application
-        gstrToastString = "Response timeout whilst downloading application to module - please try again.";
+        qDebug() << "Start-up: ready to scan after" << nScanReadyTime << "ms (first frame after" << nFirstFrameTime << "ms)";
     }
-    else if (nCurrentMode == MAIN_MODE_VERIFYING)
+    else
     {
-        //Timeout whilst attempting to verify application
-        gstrToastString = "Response timeout whilst attempting to verify application - please try again.";
+        qDebug() << "Start-up: complete after" << nScanReadyTime << "ms but scanning is unavailable (first frame after" << nFirstFrameTime << "ms)";
     }
-    else if (nCurrentMode == MAIN_MODE_QUERY)
+#endif
+}
+
+//=============================================================================
+//=============================================================================
+ScanSelection *
+MainWindow::ScanDialog(
+    )
+{
+    //Returns the device scan dialog, creating it on first use
+    if (dlgScanDialog == NULL)
     {
-        //Timeout whilst awaiting module response to query
-        gstrToastString = "Response timeout awaiting module query details - please ensure module is in hardware command mode VSP and retry.";
+        dlgScanDialog = new ScanSelection(this);
+        connect(dlgScanDialog, SIGNAL(DeviceSelected(QBluetoothDeviceInfo)), this, SLOT(ConnectToDevice(QBluetoothDeviceInfo)));
+        connect(dlgScanDialog, SIGNAL(WindowClosed()), this, SLOT(CancelScan()));
+        connect(dlgScanDialog, SIGNAL(ScanningFinished(quint8)), this, SLOT(SetLoadingStatus(quint8)));
     }
-    else
+    return dlgScanDialog;
+}
+
+//=============================================================================
+//=============================================================================
+SettingsDialog *
+MainWindow::SettingsView(
+    )
+{
+    //Returns the settings dialog, creating it on first use
+    if (dlgSettingsView == NULL)
     {
-        //Unhandled timeout
-        return;
+        dlgSettingsView = new SettingsDialog(this);
+        connect(dlgSettingsView, SIGNAL(SaveSettings(QString,QString,QString,QString,QString,bool,
+#ifdef Q_OS_ANDROID
+            bool,
+#endif
+            quint16,bool,bool,quint8,bool,quint32,bool,bool,bool,bool,bool,quint8,quint8,quint16,bool,quint32,bool,bool,bool)), this, SLOT(SettingsUpdated(QString,QString,QString,QString,QString,bool,
+#ifdef Q_OS_ANDROID
+            bool,
+#endif
+            quint16,bool,bool,quint8,bool,quint32,bool,bool,bool,bool,bool,quint8,quint8,quint16,bool,quint32,bool,bool,bool)));
+        connect(dlgSettingsView, SIGNAL(SavePacketTrace()), this, SLOT(SavePacketTrace()));
     }
+    return dlgSettingsView;
+}
 
-    //Show message
-    ToastMessage(true);
-
-    //Clear variables and set mode back to being idle
-    nCurrentMode = MAIN_MODE_IDLE;
-    balOutputBufferList.clear();
-    baFileData.clear();
-    baOutputBuffer.clear();
-    baVersionResponse.clear();
-    SetLoadingStatus(STATUS_STANDBY);
-
-    if (tmrResponseTimeoutTimer->isActive())
+//=============================================================================
+//=============================================================================
+FileTypeSelection *
+MainWindow::FileTypeDialog(
+    )
+{
+    //Returns the file location selection dialog, creating it on first use
+    if (dlgFileTypeDialog == NULL)
     {
-        //Stop timeout timer
-        tmrResponseTimeoutTimer->stop();
+        dlgFileTypeDialog = new FileTypeSelection(this);
+        connect(dlgFileTypeDialog, SIGNAL(DisplayMessage(QString,bool)), this, SLOT(ExternalToastMessage(QString,bool)));
+        connect(dlgFileTypeDialog, SIGNAL(FileTypeChanged(qint8,QString)), this, SLOT(FileTypeChanged(qint8,QString)));
     }
-
-    //Disable cancel button and enable download filename edit
-    ui->btn_Cancel->setEnabled(false);
-    ui->edit_DownloadName->setReadOnly(false);
+    return dlgFileTypeDialog;
 }
 
 //=============================================================================
@@ -3030,7 +2008,7 @@ MainWindow::FileTypeSelectionFixBrokenQtTextHeightTimerElapsed(
 {
     //Fix for some bug in Qt which decies to cut the top and bottom of word-wrapped text off QTBUG-58503
     disconnect(this, SLOT(FileTypeSelectionFixBrokenQtTextHeightTimerElapsed()));
-    dlgFileTypeDialog->FixBrokenQtTextHeight();
+    FileTypeDialog()->FixBrokenQtTextHeight();
     delete tmrStartupTimer;
     tmrStartupTimer = NULL;
 }
@@ -3045,33 +2023,24 @@ MainWindow::on_btn_Cancel_clicked(
     //Cancel current action (if there is an active activity)
     if (nCurrentMode != MAIN_MODE_IDLE)
     {
-        if (nCurrentMode == MAIN_MODE_ONLINE_DOWNLOAD || nCurrentMode == MAIN_MODE_XCOMPILING)
+        stlSessionLog.SetResult("cancelled");
+        if (otsSession.Stage() != OTA_STAGE_IDLE && otsSession.Stage() != OTA_STAGE_COMPLETE && otsSession.Stage() != OTA_STAGE_FAILED)
         {
-            //Pending web request, cancel it
-            dwnDownloaderHandle->CancelRequest();
+            //The OTA session is sending data to/from the module, it reports the cancellation once finished
+            otsSession.Cancel("Operation cancelled.");
         }
-        else if (nCurrentMode == MAIN_MODE_QUERY || nCurrentMode == MAIN_MODE_VERIFYING || nCurrentMode == MAIN_MODE_DOWNLOADING || nCurrentMode == MAIN_MODE_VERSION || nCurrentMode == MAIN_MODE_SPACECHECK)
+        else if (nCurrentMode == MAIN_MODE_ONLINE_DOWNLOAD || nCurrentMode == MAIN_MODE_FIRMWAREVERSION)
         {
-            //Pending sending data to/from module
-            baOutputBuffer.clear();
-            balOutputBufferList.clear();
-            baFileData.clear();
-            baVersionResponse.clear();
-            nCurrentMode = MAIN_MODE_IDLE;
+            //Cancel the pending web request, no response is received for a cancelled request
+            CancelWebRequest();
+            SetCurrentMode(MAIN_MODE_IDLE);
             SetLoadingStatus(STATUS_STANDBY);
 
-            if (tmrResponseTimeoutTimer->isActive())
-            {
-                //Stop timeout timer
-                tmrResponseTimeoutTimer->stop();
-            }
-
             //Show message
             gstrToastString = "Operation cancelled.";
             ToastMessage(false);
 
-            //Disable cancel button and enable download filename edit
-            ui->btn_Cancel->setEnabled(false);
+            //Enable download filename edit
             ui->edit_DownloadName->setReadOnly(false);
         }
     }
@@ -3084,16 +2053,20 @@ MainWindow::on_btn_Cancel_clicked(
 //=============================================================================
 void
 MainWindow::FirmwareVersionCheck(
+    quint32 unRequestID,
     bool bSuccess,
     qint16 nErrorCode,
     QString strData
     )
 {
     //Response to latest firmware check
-    QRegularExpressionMatch rexpmM2Match = rxpDevName.match(baVersionResponse);
-    QRegularExpressionMatch rexpmM3Match = rxpFirmware.match(baVersionResponse);
-    QRegularExpressionMatch rexpmM4Match = rxpFreeSpace.match(baVersionResponse);
-    nCurrentMode = MAIN_MODE_IDLE;
+    if (unRequestID != unWebRequest)
+    {
+        //Response to a request which is no longer wanted
+        return;
+    }
+    unWebRequest = 0;
+    SetCurrentMode(MAIN_MODE_IDLE);
     QString strExtraInfo = "";
 
     if (bSuccess == false)
@@ -3129,40 +2102,22 @@ MainWindow::FirmwareVersionCheck(
     }
 
     //Show information
-    QMessageBox::information(this, "Module Information", QString("The connected device is a ").append(rexpmM2Match.captured(1)).append(" module on firmware version ").append(rexpmM3Match.captured(1)).append(strExtraInfo).append(".\r\nFlash space available: ").append(rexpmM4Match.captured(2)).append("/").append(rexpmM4Match.captured(1)).append(" bytes (").append(QString::number(rexpmM4Match.captured(2).toUInt()*100/rexpmM4Match.captured(1).toUInt())).append("%).").append((rexpmM2Match.captured(1) == "BL652" && rexpmM3Match.captured(1) == "28.7.3.0" && bIs2MPhySupported == true ? "\r\n\r\nPlease note: VSP/OTA to this device is likely to fail due to your device having a Bluetooth v5 radio with support for 2M PHY." : "")));
-
-    //Clean up
-    balOutputBufferList.clear();
-    baOutputBuffer.clear();
-    baVersionResponse.clear();
-    UpdateDisplay();
+    ShowModuleInformation(strExtraInfo);
 }
 
 //=============================================================================
 //=============================================================================
 void
-MainWindow::TrucateRecBuffer(
+MainWindow::ShowModuleInformation(
+    const QString &strExtraInfo
     )
 {
-    //Trucates the receive buffer to a smaller size if desired
-    if (stgSettingsHandle->GetInt(SETTINGS_KEY_SCROLLBACKSIZE) > 0)
-    {
-        //Trucation is enabled
-        if (baRecBuffer.count("\n") > stgSettingsHandle->GetInt(SETTINGS_KEY_SCROLLBACKSIZE))
-        {
-            //Remove lines
-            qint8 nLineCount = baRecBuffer.count("\n") - stgSettingsHandle->GetInt(SETTINGS_KEY_SCROLLBACKSIZE);
-            quint16 unCutoffPosition = 0;
-            while (nLineCount > 0)
-            {
-                unCutoffPosition = baRecBuffer.indexOf("\n", unCutoffPosition+1);
-                --nLineCount;
-            }
+    //Shows the details of the module which were gathered by the last module query
+    const ModuleInformation &mdiInfo = otsSession.Information();
+    QMessageBox::information(this, "Module Information", QString("The connected device is a ").append(mdiInfo.strDevice).append(" module on firmware version ").append(mdiInfo.strFirmware).append(strExtraInfo).append(".\r\nFlash space available: ").append(mdiInfo.strStorageFree).append("/").append(mdiInfo.strStorageTotal).append(" bytes (").append(QString::number(mdiInfo.strStorageTotal.toUInt() == 0 ? 0 : mdiInfo.strStorageFree.toUInt()*100/mdiInfo.strStorageTotal.toUInt())).append("%).").append((mdiInfo.strDevice == "BL652" && mdiInfo.strFirmware == "28.7.3.0" && bIs2MPhySupported == true ? "\r\n\r\nPlease note: VSP/OTA to this device is likely to fail due to your device having a Bluetooth v5 radio with support for 2M PHY." : "")));
 
-            //Perform the truncation
-            baRecBuffer = baRecBuffer.right(baRecBuffer.length()-unCutoffPosition);
-        }
-    }
+    //Clean up
+    UpdateDisplay();
 }
 
 //=============================================================================
@@ -31,25 +31,33 @@
 #include <QBluetoothDeviceInfo>
 #include <QBluetoothUuid>
 #include <QBluetoothLocalDevice>
-#include <QLowEnergyController>
 #include <QMovie>
 #include <QElapsedTimer>
+#include <QEvent>
 #include <QTimer>
 #include <QFile>
 #include <QDateTime>
-#include <QRegularExpression>
 #include <QScrollBar>
+#include <QTextCursor>
 #if !defined(Q_OS_ANDROID) && !defined(Q_OS_IOS)
 #include <QFileDialog>
 #endif
 #include <math.h>
 #include "downloader.h"
+#include "xcompilecache.h"
+#include "modulestatecache.h"
+#include "sessiontiminglog.h"
+#include "packettracer.h"
 #include "scanselection.h"
 #include "settingsdialog.h"
 #include "settingsstorage.h"
 #include "errorlookup.h"
 #include "filetypeselection.h"
-#include "checksumcalculator.h"
+#include "otasession.h"
+#include "blevsptransport.h"
+#include "recordingvsptransport.h"
+#include "transfercheckpoint.h"
+#include "scrollbackbuffer.h"
 #include "target.h"
 
 #ifdef Q_OS_ANDROID
@@ -82,11 +90,18 @@ class MainWindow : public QMainWindow
 public:
     explicit
     MainWindow(
-        QWidget *parent = 0
+        QWidget *parent = 0,
+        QElapsedTimer tmrLaunch = QElapsedTimer()
         );
     ~MainWindow(
         );
 
+protected:
+    bool
+    event(
+        QEvent *evtEvent
+        );
+
 private slots:
     void
     FoundDevice(
@@ -100,48 +115,64 @@ private slots:
     BTFinishedScan(
         );
     void
-    BLEConnected(
+    TransportConnected(
         );
     void
-    BLEDisconnected(
+    TransportOpened(
         );
     void
-    BLEDiscoveryFinished(
+    TransportClosed(
         );
     void
-    BLEDiscovered(
-        QBluetoothUuid
+    TransportDataReceived(
+        QByteArray baData
         );
     void
-    BLEError(
-        QLowEnergyController::Error nErrorCode
+    TransportFlowChanged(
+        bool bBlocked
         );
     void
-    BLEStateChanged(
-        QLowEnergyController::ControllerState lesNewState
+    TransportMTUChanged(
+        int nMTU
         );
     void
-    VSPServiceCharacteristicChanged(
-        QLowEnergyCharacteristic lecCharacteristic,
-        QByteArray baData
+    TransportError(
+        QString strMessage
         );
     void
-    VSPServiceCharacteristicWritten(
-        QLowEnergyCharacteristic lecCharacteristic,
-        QByteArray baData
+    SessionStageChanged(
+        quint8 unStage
+        );
+    void
+    SessionProgress(
+        qint32 nSent,
+        qint32 nTotal
+        );
+    void
+    SessionModuleDetails(
+        QString strDevice,
+        QString strFirmware
+        );
+    void
+    SessionInsufficientSpace(
+        qint32 nRequired,
+        qint32 nFree
         );
     void
-    VSPServiceDescriptorWritten(
-        QLowEnergyDescriptor ledDescriptor,
+    SessionPacketWritten(
         QByteArray baData
         );
     void
-    VSPServiceError(
-        QLowEnergyService::ServiceError nErrorCode
+    SessionPipelineStalled(
         );
     void
-    VSPServiceStateChanged(
-        QLowEnergyService::ServiceState nNewState
+    SessionNotice(
+        QString strMessage
+        );
+    void
+    SessionFinished(
+        bool bSuccess,
+        QString strMessage
         );
     void
     ConnectToDevice(
@@ -163,12 +194,6 @@ private slots:
     UpdateDisplay(
         );
     void
-    ProcessFileData(
-        bool bSuccess,
-        qint16 nErrorCode,
-        QByteArray FileData
-        );
-    void
     on_btn_Download_clicked(
         );
     void
@@ -188,16 +213,28 @@ private slots:
 #ifdef Q_OS_ANDROID
         bool bCompatibleScanning,
 #endif
-        quint8 unPacketSize,
+        quint16 unPacketSize,
         bool bDelFile,
         bool bVerifyFile,
         quint8 unDownloadAction,
         bool bSkipDownloadDisplay,
-        quint8 unScrollbackSize,
+        quint32 unScrollbackSize,
         bool bXCompile,
         bool bSSL,
         bool bCheckFirmware,
-        bool bFreeSpaceCheck
+        bool bFreeSpaceCheck,
+        bool bStreamWrites,
+        quint8 unStreamWindow,
+        quint8 unCommandWindow,
+        quint16 unXCompileCacheSize,
+        bool bPrefetchXCompile,
+        quint32 unModuleCacheTTL,
+        bool bSkipIdentical,
+        bool bPacketTrace,
+        bool bRecordSessions
+        );
+    void
+    SavePacketTrace(
         );
 #ifdef Q_OS_ANDROID
     void
@@ -235,19 +272,21 @@ private slots:
         );
     void
     FileDownloaded(
+        quint32 unRequestID,
         bool bSuccess,
         qint16 nErrorCode,
         QByteArray baDownloadedFileData
         );
     void
     DownloaderStatusChanged(
+        quint32 unRequestID,
         quint8 unStatus
         );
     void
     StartupTimerElapsed(
         );
     void
-    TimeoutTimerElapsed(
+    StartupFirstFrame(
         );
 #ifdef Q_OS_ANDROID
     void
@@ -259,13 +298,11 @@ private slots:
         );
     void
     FirmwareVersionCheck(
+        quint32 unRequestID,
         bool bSuccess,
         qint16 nErrorCode,
         QString strData
         );
-    void
-    TrucateRecBuffer(
-        );
 #ifdef Q_OS_IOS
     void
     StartupFileLoad(
@@ -274,65 +311,102 @@ private slots:
 #endif
 
 private:
+    ScanSelection *
+    ScanDialog(
+        );
+    SettingsDialog *
+    SettingsView(
+        );
+    FileTypeSelection *
+    FileTypeDialog(
+        );
+    void
+    StartupScanReady(
+        );
+    void
+    LoadFile(
+        const QByteArray &baApplicationData,
+        bool bXCompile
+        );
+    OtaSessionOptions
+    SessionOptions(
+        );
+    void
+    SetCurrentMode(
+        qint8 nNewMode
+        );
+    void
+    CancelWebRequest(
+        );
     void
     UpdateTxRx(
         );
+    void
+    UpdateScrollbackSize(
+        );
+    void
+    OfferTransferResume(
+        );
+    void
+    ShowModuleInformation(
+        const QString &strExtraInfo
+        );
 
     Ui::MainWindow *ui;
 
     //Bools
-    bool bVSPBlocked; //True if VSP host has notified saying to stop sending data
-    bool bHasModem;
     bool bIs2MPhySupported;
     bool bDisconnectActive;
     bool bIsConnected;
+    bool bFirstFrameQueued; //True once the first paint of the window has been seen
+    bool bStartupLayoutDone; //True once the start-up timer has adjusted the window layout
 
     //Integers
     qint8 nSelectedFileType;
     qint8 nCurrentMode;
+    qint8 nQueryMode;         //Mode shown whilst the session reads the module details, MAIN_MODE_QUERY if only the details are wanted
     qint8 nStatusBarSpaces;
     quint8 unOldStatus;
-    qint32 nModuleFreeSpace;
     quint32 unRecDatSize;     //Amount of data received
     quint32 unWrittenBytes;   //Number of bytes written
     quint32 unTotalAppSize;   //Total size of application to load
     quint32 unTotalSizeSent;  //Total size of application which has been sent
+    quint16 unNegotiatedMTU;  //ATT MTU negotiated with the module
 
     //Strings
     QString strLocalFilename;
-    QString *strChecksumString;
+    QString strDeviceAddress; //Address (or device UUID on Apple platforms) of the connected module
 
     //Byte arrays
-    QByteArray baRecBuffer;
-    QByteArray baVersionResponse;
     QByteArray baFileData;
-    QByteArray baOutputBuffer;
 
-    //Byte array lists
-    QByteArrayList balOutputBufferList;
+    //Output data
+    TransferCheckpoint trcCheckpoint; //Interrupted transfer which can be resumed on reconnection
+    ScrollbackBuffer sbfRecBuffer; //Text shown in the display, limited to the scrollback size
 
     //Timers
     QTimer *tmrDisconnectCleanUpTimer;
     QTimer *tmrDisplayUpdateTimer;
     QTimer *tmrStartupTimer;
-    QTimer *tmrResponseTimeoutTimer;
 
-    //Regular expressions
-    QRegularExpression rxpDevName;
-    QRegularExpression rxpXCompiler;
-    QRegularExpression rxpFreeSpace;
-    QRegularExpression rxpFirmware;
-    QRegularExpression rxpErrorCode;
-    QRegularExpression rxpFileListing;
-    QRegularExpression rxpCRC;
+    //Start-up timing, in ms from application launch (-1 until reached)
+    QElapsedTimer tmrLaunchTimer;
+    qint64 nFirstFrameTime;
+    qint64 nScanReadyTime;
 
     //Objects
     Downloader *dwnDownloaderHandle;
+    quint32 unWebRequest; //ID of the downloader request the current mode is waiting for, 0 if none
+    XCompileCache xccXCompileCache; //Applications XCompiled by this and previous runs
+    ModuleStateCache mscModuleCache; //Module details from earlier connections, so the query can be skipped
+    SessionTimingLog stlSessionLog; //Time spent in each mode of each load
+    PacketTracer ptrPacketTracer; //Writes, notifications, flow control and timers with their timing, for finding throughput stalls
+    OtaSession otsSession; //Queries the module and loads applications onto it over vtpTransport
     SettingsStorage *stgSettingsHandle;
-    ChecksumCalculator *chkChecksum;
+    const SettingsSnapshot *pssSettings; //Settings snapshot owned by stgSettingsHandle
     ErrorLookup elErrorLookupHandle;
 
-    //Dialogs
+    //Dialogs, created on first use
     ScanSelection *dlgScanDialog;
     SettingsDialog *dlgSettingsView;
     FileTypeSelection *dlgFileTypeDialog;
@@ -341,16 +415,11 @@ private:
 #endif
 
     //Bluetooth-related
-    QLowEnergyService *blesvcVSPService; //VSP service
-    QLowEnergyCharacteristic blechrRXChar; //RX characteristic
-    QLowEnergyCharacteristic blechrTXChar; //TX characteristic
-    QLowEnergyCharacteristic blechrMIChar; //Modem in characteristic
-    QLowEnergyCharacteristic blechrMOChar; //Modem out characteristic
     QBluetoothDeviceDiscoveryAgent *ddaDiscoveryAgent; //Bluetooth device discovery agent
-    QLowEnergyController *lecBLEController; //Bluetooth Low Energy controller
+    VspTransport *vtpTransport; //Connection to the VSP service of the module, NULL if not connected
 
     //Status bar objects
-    QMovie *movieLoadingAnimation;
+    QMovie *movieLoadingAnimation; //Created the first time the busy animation is shown
     QPixmap *pixmapStandbyPicture;
     QLabel *labelStatusBarLoader;
 };
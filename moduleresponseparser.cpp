@@ -0,0 +1,264 @@
+/******************************************************************************
+** Copyright (C) 2018 Laird
+**
+** Project: UwVSP-OTA
+**
+** Module: moduleresponseparser.cpp
+**
+** Notes:
+**
+** License: This program is free software: you can redistribute it and/or
+**          modify it under the terms of the GNU General Public License as
+**          published by the Free Software Foundation, version 3.
+**
+**          This program is distributed in the hope that it will be useful,
+**          but WITHOUT ANY WARRANTY; without even the implied warranty of
+**          MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+**          GNU General Public License for more details.
+**
+**          You should have received a copy of the GNU General Public License
+**          along with this program.  If not, see http://www.gnu.org/licenses/
+**
+*******************************************************************************/
+#include "moduleresponseparser.h"
+
+//=============================================================================
+//=============================================================================
+ModuleResponseParser::ModuleResponseParser(QObject *parent) : QObject(parent)
+{
+    //Constructor
+    bOverlongLine = false;
+}
+
+//=============================================================================
+//=============================================================================
+ModuleResponseParser::~ModuleResponseParser(
+    )
+{
+    //Destructor
+}
+
+//=============================================================================
+//=============================================================================
+void
+ModuleResponseParser::Reset(
+    )
+{
+    //Discards any partially received line and the module details gathered so far
+    baPartialLine.clear();
+    bOverlongLine = false;
+    mdiInfo = ModuleInformation();
+}
+
+//=============================================================================
+//=============================================================================
+QVector<ModuleResponse>
+ModuleResponseParser::Parse(
+    const QByteArray &baData
+    )
+{
+    //Parses newly received data, only complete lines are returned as responses and the rest is kept until the end of the line arrives
+    QVector<ModuleResponse> vecResponses;
+    const char *pData = baData.constData();
+    const qint32 nLength = baData.length();
+    qint32 nStart = 0;
+    for (qint32 i = 0; i < nLength; ++i)
+    {
+        if (pData[i] != '\r')
+        {
+            continue;
+        }
+
+        //End of a line
+        ModuleResponse mrResponse;
+        bool bValid;
+        if (bOverlongLine == true)
+        {
+            //Skip the end of a line which was too long
+            bValid = false;
+            bOverlongLine = false;
+        }
+        else if (baPartialLine.isEmpty())
+        {
+            //Whole line is in this data so parse it in place
+            bValid = ParseLine(pData + nStart, i - nStart, &mrResponse);
+        }
+        else
+        {
+            //Line started in earlier data
+            baPartialLine.append(pData + nStart, i - nStart);
+            bValid = ParseLine(baPartialLine.constData(), baPartialLine.length(), &mrResponse);
+            baPartialLine.clear();
+        }
+
+        if (bValid == true)
+        {
+            UpdateInformation(mrResponse);
+            vecResponses.append(mrResponse);
+        }
+        nStart = i + 1;
+    }
+
+    if (nStart < nLength && bOverlongLine == false)
+    {
+        //Keep the start of the next line
+        baPartialLine.append(pData + nStart, nLength - nStart);
+        if (baPartialLine.length() > RESPONSE_MAX_LINE_LENGTH)
+        {
+            //Not a module response, ignore it up to the end of the line
+            baPartialLine.clear();
+            bOverlongLine = true;
+        }
+    }
+
+    return vecResponses;
+}
+
+//=============================================================================
+//=============================================================================
+const ModuleInformation &
+ModuleResponseParser::Information(
+    )
+{
+    //Returns the module details gathered since the parser was last reset
+    return mdiInfo;
+}
+
+//=============================================================================
+//=============================================================================
+void
+ModuleResponseParser::SetInformation(
+    const ModuleInformation &mdiNewInfo
+    )
+{
+    //Replaces the gathered module details with ones known from an earlier connection
+    mdiInfo = mdiNewInfo;
+}
+
+//=============================================================================
+//=============================================================================
+bool
+ModuleResponseParser::ParseLine(
+    const char *pLine,
+    qint32 nLength,
+    ModuleResponse *pmrResponse
+    )
+{
+    //Decodes a single line (without the trailing carriage return), returns false if it is not a module response
+    while (nLength > 0 && *pLine == '\n')
+    {
+        //Skip the line feed which starts each response
+        ++pLine;
+        --nLength;
+    }
+
+    if (nLength < 2 || pLine[0] < '0' || pLine[0] > '9' || pLine[1] < '0' || pLine[1] > '9')
+    {
+        //Responses start with a two digit code
+        return false;
+    }
+
+    if (nLength == 2 && pLine[0] == '0' && pLine[1] == '0')
+    {
+        //Success
+        pmrResponse->unType = RESPONSE_TYPE_OK;
+        pmrResponse->unCode = 0;
+        return true;
+    }
+
+    if (nLength < 4 || pLine[2] != '\t')
+    {
+        //Every other response has a value after a tab
+        return false;
+    }
+
+    const QByteArray baValue(pLine + 3, nLength - 3);
+    bool bConverted = false;
+    if (pLine[0] == '0' && pLine[1] == '1')
+    {
+        //Error, code is in hex
+        pmrResponse->unType = RESPONSE_TYPE_ERROR;
+        pmrResponse->unCode = baValue.toUInt(&bConverted, 16);
+        pmrResponse->baValue = baValue;
+        return bConverted;
+    }
+    else if (pLine[0] == '1' && pLine[1] == '0')
+    {
+        //Information, tag is in decimal followed by a tab and the value
+        qint32 nTab = baValue.indexOf('\t');
+        if (nTab <= 0)
+        {
+            return false;
+        }
+        pmrResponse->unType = RESPONSE_TYPE_INFO;
+        pmrResponse->unCode = baValue.left(nTab).toUInt(&bConverted, 10);
+        pmrResponse->baValue = baValue.mid(nTab + 1);
+        return bConverted;
+    }
+    else if (pLine[0] == '0' && pLine[1] == '6')
+    {
+        //Directory entry
+        pmrResponse->unType = RESPONSE_TYPE_DIRECTORY;
+        pmrResponse->unCode = 0;
+        pmrResponse->baValue = baValue;
+        return true;
+    }
+
+    //Unknown response
+    return false;
+}
+
+//=============================================================================
+//=============================================================================
+void
+ModuleResponseParser::UpdateInformation(
+    const ModuleResponse &mrResponse
+    )
+{
+    //Records module details from information and directory responses
+    if (mrResponse.unType == RESPONSE_TYPE_DIRECTORY)
+    {
+        mdiInfo.balFiles.append(mrResponse.baValue);
+    }
+    else if (mrResponse.unType == RESPONSE_TYPE_INFO)
+    {
+        if (mrResponse.unCode == RESPONSE_INFO_DEVICE)
+        {
+            //Module type
+            mdiInfo.strDevice = QString(mrResponse.baValue);
+        }
+        else if (mrResponse.unCode == RESPONSE_INFO_FIRMWARE)
+        {
+            //Firmware version
+            mdiInfo.strFirmware = QString(mrResponse.baValue);
+        }
+        else if (mrResponse.unCode == RESPONSE_INFO_STORAGE)
+        {
+            //Total, free and deleted space as "total,free,deleted"
+            QList<QByteArray> lstParts = mrResponse.baValue.split(',');
+            if (lstParts.count() == 3)
+            {
+                mdiInfo.strStorageTotal = QString(lstParts.at(0));
+                mdiInfo.strStorageFree = QString(lstParts.at(1));
+            }
+        }
+        else if (mrResponse.unCode == RESPONSE_INFO_XCOMPILER)
+        {
+            //XCompiler hash as "XXXX YYYY"
+            if (mrResponse.baValue.length() == 9 && mrResponse.baValue.at(4) == ' ')
+            {
+                mdiInfo.strXCompilerA = QString(mrResponse.baValue.left(4));
+                mdiInfo.strXCompilerB = QString(mrResponse.baValue.mid(5));
+            }
+        }
+        else if (mrResponse.unCode == RESPONSE_INFO_CRC)
+        {
+            //CRC of the last closed file
+            mdiInfo.strCRC = QString(mrResponse.baValue);
+        }
+    }
+}
+
+/******************************************************************************/
+// END OF FILE
+/******************************************************************************/
@@ -0,0 +1,129 @@
+/******************************************************************************
+** Copyright (C) 2018 Laird
+**
+** Project: UwVSP-OTA
+**
+** Module: moduleresponseparser.h
+**
+** Notes:
+**
+** License: This program is free software: you can redistribute it and/or
+**          modify it under the terms of the GNU General Public License as
+**          published by the Free Software Foundation, version 3.
+**
+**          This program is distributed in the hope that it will be useful,
+**          but WITHOUT ANY WARRANTY; without even the implied warranty of
+**          MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+**          GNU General Public License for more details.
+**
+**          You should have received a copy of the GNU General Public License
+**          along with this program.  If not, see http://www.gnu.org/licenses/
+**
+*******************************************************************************/
+#ifndef MODULERESPONSEPARSER_H
+#define MODULERESPONSEPARSER_H
+
+/******************************************************************************/
+// Include Files
+/******************************************************************************/
+#include <QObject>
+#include <QString>
+#include <QByteArray>
+#include <QByteArrayList>
+#include <QVector>
+#include "target.h"
+
+/******************************************************************************/
+// Constants
+/******************************************************************************/
+//Types of module response
+const quint8 RESPONSE_TYPE_OK            = 0; //Command completed successfully (00)
+const quint8 RESPONSE_TYPE_ERROR         = 1; //Command failed (01), code is the error number
+const quint8 RESPONSE_TYPE_INFO          = 2; //AT I response (10), code is the information tag
+const quint8 RESPONSE_TYPE_DIRECTORY     = 3; //AT+DIR file entry (06), value is the filename
+
+//AT I information tags
+const quint32 RESPONSE_INFO_DEVICE       = 0;
+const quint32 RESPONSE_INFO_DUMMY        = 1;
+const quint32 RESPONSE_INFO_FIRMWARE     = 3;
+const quint32 RESPONSE_INFO_STORAGE      = 6;
+const quint32 RESPONSE_INFO_XCOMPILER    = 13;
+const quint32 RESPONSE_INFO_CRC          = 0xc12c;
+
+//Longest line which is buffered whilst waiting for the end of it, anything longer is not a module response
+const qint32 RESPONSE_MAX_LINE_LENGTH    = 256;
+
+/******************************************************************************/
+// Structures
+/******************************************************************************/
+//A single response line from the module
+struct ModuleResponse
+{
+    quint8 unType;      //One of the RESPONSE_TYPE_ values
+    quint32 unCode;     //Error number or information tag
+    QByteArray baValue; //Error number text, information value or filename
+};
+
+//Module details gathered from the responses since the parser was last reset
+struct ModuleInformation
+{
+    QString strDevice;       //Module type (AT I 0)
+    QString strFirmware;     //Firmware version (AT I 3)
+    QString strXCompilerA;   //First half of the XCompiler hash (AT I 13)
+    QString strXCompilerB;   //Second half of the XCompiler hash (AT I 13)
+    QString strStorageTotal; //Total file system space (AT I 6)
+    QString strStorageFree;  //Free file system space (AT I 6)
+    QString strCRC;          //CRC of the last closed file (AT I 0xC12C)
+    QByteArrayList balFiles; //Files listed by AT+DIR
+};
+
+/******************************************************************************/
+// Class definitions
+/******************************************************************************/
+class ModuleResponseParser : public QObject
+{
+    Q_OBJECT
+public:
+    explicit
+    ModuleResponseParser(
+        QObject *parent = nullptr
+        );
+    ~ModuleResponseParser(
+        );
+    void
+    Reset(
+        );
+    QVector<ModuleResponse>
+    Parse(
+        const QByteArray &baData
+        );
+    const ModuleInformation &
+    Information(
+        );
+    void
+    SetInformation(
+        const ModuleInformation &mdiNewInfo
+        );
+
+private:
+    bool
+    ParseLine(
+        const char *pLine,
+        qint32 nLength,
+        ModuleResponse *pmrResponse
+        );
+    void
+    UpdateInformation(
+        const ModuleResponse &mrResponse
+        );
+
+    QByteArray baPartialLine;  //Data received after the last complete line
+    bool bOverlongLine;        //True if the current line is too long to be a response and is being skipped
+    ModuleInformation mdiInfo; //Details gathered from the responses
+};
+
+#endif // MODULERESPONSEPARSER_H
+
+/******************************************************************************/
+// END OF FILE
+/******************************************************************************/
@@ -0,0 +1,258 @@
+/******************************************************************************
+** Copyright (C) 2018 Laird
+**
+** Project: UwVSP-OTA
+**
+** Module: modulestatecache.cpp
+**
+** Notes:
+**
+** License: This program is free software: you can redistribute it and/or
+**          modify it under the terms of the GNU General Public License as
+**          published by the Free Software Foundation, version 3.
+**
+**          This program is distributed in the hope that it will be useful,
+**          but WITHOUT ANY WARRANTY; without even the implied warranty of
+**          MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+**          GNU General Public License for more details.
+**
+**          You should have received a copy of the GNU General Public License
+**          along with this program.  If not, see http://www.gnu.org/licenses/
+**
+*******************************************************************************/
+#include "modulestatecache.h"
+
+//=============================================================================
+//=============================================================================
+ModuleStateCache::ModuleStateCache(QObject *parent) : QObject(parent)
+{
+    //Constructor, details are not kept until storage is set
+    unTTL = 0;
+}
+
+//=============================================================================
+//=============================================================================
+ModuleStateCache::~ModuleStateCache(
+    )
+{
+    //Destructor
+}
+
+//=============================================================================
+//=============================================================================
+void
+ModuleStateCache::SetStorage(
+    const QString &strNewFilename,
+    quint32 unNewTTL
+    )
+{
+    //Sets the file module details are kept in and how long (in seconds) they can be used for, an empty filename or a time of 0 disables the cache
+    strFilename = strNewFilename;
+    unTTL = unNewTTL;
+}
+
+//=============================================================================
+//=============================================================================
+QString
+ModuleStateCache::DefaultFilename(
+    )
+{
+    //Returns the file shared by the GUI and command line applications
+    return QStandardPaths::writableLocation(QStandardPaths::GenericCacheLocation).append('/').append(MODULE_CACHE_FILENAME);
+}
+
+//=============================================================================
+//=============================================================================
+bool
+ModuleStateCache::Lookup(
+    const QString &strAddress,
+    ModuleInformation &mdiInfo
+    )
+{
+    //Returns true with the details of a module if they were read within the time to live and no file write to it is unaccounted for
+    if (strFilename.isEmpty() || unTTL == 0 || strAddress.isEmpty())
+    {
+        return false;
+    }
+
+    QSettings stgCache(strFilename, QSettings::IniFormat);
+    stgCache.beginGroup(Group(strAddress));
+    if (!stgCache.contains("Device") || stgCache.value("Writing", false).toBool() == true)
+    {
+        //Not known, or a write was interrupted so the free space is unknown
+        return false;
+    }
+
+    qint64 nAge = QDateTime::currentMSecsSinceEpoch() - stgCache.value("ReadTime", 0).toLongLong();
+    if (nAge < 0 || nAge > (qint64)unTTL*1000)
+    {
+        //Expired, or the clock has changed
+        return false;
+    }
+
+    mdiInfo = ModuleInformation();
+    mdiInfo.strDevice = stgCache.value("Device").toString();
+    mdiInfo.strFirmware = stgCache.value("Firmware").toString();
+    mdiInfo.strXCompilerA = stgCache.value("XCompilerA").toString();
+    mdiInfo.strXCompilerB = stgCache.value("XCompilerB").toString();
+    mdiInfo.strStorageTotal = stgCache.value("StorageTotal").toString();
+    mdiInfo.strStorageFree = stgCache.value("StorageFree").toString();
+    return (!mdiInfo.strDevice.isEmpty() && !mdiInfo.strFirmware.isEmpty() && !mdiInfo.strStorageFree.isEmpty());
+}
+
+//=============================================================================
+//=============================================================================
+void
+ModuleStateCache::Store(
+    const QString &strAddress,
+    const ModuleInformation &mdiInfo
+    )
+{
+    //Records details which have just been read from a module, only complete details are kept. XCompiler hashes are kept from before if they were not read and the firmware is unchanged
+    if (strFilename.isEmpty() || unTTL == 0 || strAddress.isEmpty() || mdiInfo.strDevice.isEmpty() || mdiInfo.strFirmware.isEmpty() || mdiInfo.strStorageFree.isEmpty())
+    {
+        return;
+    }
+
+    QSettings stgCache(strFilename, QSettings::IniFormat);
+    stgCache.beginGroup(Group(strAddress));
+    QString strXCompilerA = mdiInfo.strXCompilerA;
+    QString strXCompilerB = mdiInfo.strXCompilerB;
+    if (strXCompilerA.isEmpty() && stgCache.value("Device").toString() == mdiInfo.strDevice && stgCache.value("Firmware").toString() == mdiInfo.strFirmware)
+    {
+        strXCompilerA = stgCache.value("XCompilerA").toString();
+        strXCompilerB = stgCache.value("XCompilerB").toString();
+    }
+    stgCache.setValue("Device", mdiInfo.strDevice);
+    stgCache.setValue("Firmware", mdiInfo.strFirmware);
+    stgCache.setValue("XCompilerA", strXCompilerA);
+    stgCache.setValue("XCompilerB", strXCompilerB);
+    stgCache.setValue("StorageTotal", mdiInfo.strStorageTotal);
+    stgCache.setValue("StorageFree", mdiInfo.strStorageFree);
+    stgCache.setValue("ReadTime", QDateTime::currentMSecsSinceEpoch());
+    stgCache.setValue("Writing", false);
+}
+
+//=============================================================================
+//=============================================================================
+void
+ModuleStateCache::WriteStarted(
+    const QString &strAddress
+    )
+{
+    //Marks a module as having a file written to it, its details are not used again until the write completes or they are read again. The last file closed is no longer known
+    if (strFilename.isEmpty() || strAddress.isEmpty())
+    {
+        return;
+    }
+
+    QSettings stgCache(strFilename, QSettings::IniFormat);
+    stgCache.beginGroup(Group(strAddress));
+    if (stgCache.contains("Device"))
+    {
+        stgCache.setValue("Writing", true);
+    }
+    stgCache.remove("ClosedFile");
+    stgCache.remove("ClosedCRC");
+    stgCache.remove("ClosedSize");
+}
+
+//=============================================================================
+//=============================================================================
+void
+ModuleStateCache::WriteComplete(
+    const QString &strAddress,
+    qint32 nFileSize
+    )
+{
+    //Reduces the free space of a module by the size of a file written to it, space used by a replaced file is not freed until the file system is cleaned
+    if (strFilename.isEmpty() || strAddress.isEmpty())
+    {
+        return;
+    }
+
+    QSettings stgCache(strFilename, QSettings::IniFormat);
+    stgCache.beginGroup(Group(strAddress));
+    if (stgCache.contains("Device"))
+    {
+        qint64 nStorageFree = stgCache.value("StorageFree").toLongLong() - nFileSize;
+        stgCache.setValue("StorageFree", QString::number(nStorageFree < 0 ? 0 : nStorageFree));
+        stgCache.setValue("Writing", false);
+    }
+}
+
+//=============================================================================
+//=============================================================================
+void
+ModuleStateCache::FileVerified(
+    const QString &strAddress,
+    const QString &strTarget,
+    const QString &strCRC,
+    qint32 nFileSize
+    )
+{
+    //Records the file which was just closed on a module and read back with a matching CRC, it is the file the CRC of the last closed file belongs to
+    if (strFilename.isEmpty() || strAddress.isEmpty() || strTarget.isEmpty() || strCRC.isEmpty())
+    {
+        return;
+    }
+
+    QSettings stgCache(strFilename, QSettings::IniFormat);
+    stgCache.beginGroup(Group(strAddress));
+    stgCache.setValue("ClosedFile", strTarget);
+    stgCache.setValue("ClosedCRC", strCRC.toUpper());
+    stgCache.setValue("ClosedSize", nFileSize);
+}
+
+//=============================================================================
+//=============================================================================
+bool
+ModuleStateCache::IsLastClosed(
+    const QString &strAddress,
+    const QString &strTarget,
+    const QString &strCRC,
+    qint32 nFileSize
+    )
+{
+    //Returns true if the last file verified on a module was the target file with this CRC and size, so a matching CRC from the module is that of the target file
+    if (strFilename.isEmpty() || strAddress.isEmpty() || strTarget.isEmpty() || strCRC.isEmpty())
+    {
+        return false;
+    }
+
+    QSettings stgCache(strFilename, QSettings::IniFormat);
+    stgCache.beginGroup(Group(strAddress));
+    return (stgCache.value("ClosedFile").toString() == strTarget && stgCache.value("ClosedCRC").toString() == strCRC.toUpper() && stgCache.value("ClosedSize", -1).toInt() == nFileSize);
+}
+
+//=============================================================================
+//=============================================================================
+void
+ModuleStateCache::Invalidate(
+    const QString &strAddress
+    )
+{
+    //Discards the details of a module so they are read again on the next connection
+    if (strFilename.isEmpty() || strAddress.isEmpty())
+    {
+        return;
+    }
+
+    QSettings stgCache(strFilename, QSettings::IniFormat);
+    stgCache.remove(Group(strAddress));
+}
+
+//=============================================================================
+//=============================================================================
+QString
+ModuleStateCache::Group(
+    const QString &strAddress
+    )
+{
+    //Returns the settings group of a module, the same for addresses written with or without braces and in either case
+    return QString(strAddress).remove('{').remove('}').toUpper();
+}
+
+/******************************************************************************/
+// END OF FILE
+/******************************************************************************/
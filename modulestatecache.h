@@ -0,0 +1,113 @@
+/******************************************************************************
+** Copyright (C) 2018 Laird
+**
+** Project: UwVSP-OTA
+**
+** Module: modulestatecache.h
+**
+** Notes:
+**
+** License: This program is free software: you can redistribute it and/or
+**          modify it under the terms of the GNU General Public License as
+**          published by the Free Software Foundation, version 3.
+**
+**          This program is distributed in the hope that it will be useful,
+**          but WITHOUT ANY WARRANTY; without even the implied warranty of
+**          MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+**          GNU General Public License for more details.
+**
+**          You should have received a copy of the GNU General Public License
+**          along with this program.  If not, see http://www.gnu.org/licenses/
+**
+*******************************************************************************/
+#ifndef MODULESTATECACHE_H
+#define MODULESTATECACHE_H
+
+/******************************************************************************/
+// Include Files
+/******************************************************************************/
+#include <QObject>
+#include <QString>
+#include <QSettings>
+#include <QDateTime>
+#include <QStandardPaths>
+#include "moduleresponseparser.h"
+#include "target.h"
+
+/******************************************************************************/
+// Class definitions
+/******************************************************************************/
+//Module details (type, firmware, XCompiler hashes and storage space) from earlier connections, by Bluetooth address (or device UUID on Apple platforms).
+//Details expire after a time to live, and are discarded when the module is restarted or reports an error. Free space is reduced by the size of each file written.
+//The name, CRC and size of the last file closed and verified on a module are also kept, so the CRC the module reports for its last closed file can be tied to a file
+class ModuleStateCache : public QObject
+{
+    Q_OBJECT
+public:
+    explicit
+    ModuleStateCache(
+        QObject *parent = nullptr
+        );
+    ~ModuleStateCache(
+        );
+    void
+    SetStorage(
+        const QString &strNewFilename,
+        quint32 unNewTTL
+        );
+    static QString
+    DefaultFilename(
+        );
+    bool
+    Lookup(
+        const QString &strAddress,
+        ModuleInformation &mdiInfo
+        );
+    void
+    Store(
+        const QString &strAddress,
+        const ModuleInformation &mdiInfo
+        );
+    void
+    WriteStarted(
+        const QString &strAddress
+        );
+    void
+    WriteComplete(
+        const QString &strAddress,
+        qint32 nFileSize
+        );
+    void
+    FileVerified(
+        const QString &strAddress,
+        const QString &strTarget,
+        const QString &strCRC,
+        qint32 nFileSize
+        );
+    bool
+    IsLastClosed(
+        const QString &strAddress,
+        const QString &strTarget,
+        const QString &strCRC,
+        qint32 nFileSize
+        );
+    void
+    Invalidate(
+        const QString &strAddress
+        );
+
+private:
+    static QString
+    Group(
+        const QString &strAddress
+        );
+
+    QString strFilename; //File the details are kept in, shared with other instances and runs, empty if disabled
+    quint32 unTTL;       //Time in seconds the details are used for after they were read from the module, 0 if disabled
+};
+
+#endif // MODULESTATECACHE_H
+
+/******************************************************************************/
+// END OF FILE
+/******************************************************************************/
@@ -0,0 +1,421 @@
+/******************************************************************************
+** Copyright (C) 2018 Laird
+**
+** Project: UwVSP-OTA
+**
+** Module: otabenchmark.cpp
+**
+** Notes:
+**
+** License: This program is free software: you can redistribute it and/or
+**          modify it under the terms of the GNU General Public License as
+**          published by the Free Software Foundation, version 3.
+**
+**          This program is distributed in the hope that it will be useful,
+**          but WITHOUT ANY WARRANTY; without even the implied warranty of
+**          MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+**          GNU General Public License for more details.
+**
+**          You should have received a copy of the GNU General Public License
+**          along with this program.  If not, see http://www.gnu.org/licenses/
+**
+*******************************************************************************/
+#include "otabenchmark.h"
+#include <QJsonDocument>
+#include <QTextStream>
+#include <QTimer>
+#include <stdio.h>
+
+//=============================================================================
+//=============================================================================
+OtaBenchmark::OtaBenchmark(QObject *parent) : QObject(parent)
+{
+    //Constructor
+    svtTransport = NULL;
+    rvtTransport = NULL;
+    nSize = 0;
+    nFailed = 0;
+    bReplay = false;
+    bRecordedSpeed = false;
+    unReplayRuns = 0;
+    unReplayRun = 0;
+    clkCpuStart = 0;
+    connect(&otsSession, SIGNAL(Finished(bool,QString)), this, SLOT(Finished(bool,QString)));
+}
+
+//=============================================================================
+//=============================================================================
+OtaBenchmark::~OtaBenchmark(
+    )
+{
+    //Destructor
+}
+
+//=============================================================================
+//=============================================================================
+int
+OtaBenchmark::Run(
+    QCoreApplication &appApplication
+    )
+{
+    //Parses the command line, loads an application of each size onto a simulated module and returns the process exit code
+    QCommandLineParser clpParser;
+    clpParser.setApplicationDescription("Measures OTA transfer throughput against a simulated VSP module, or replays a session recorded by vspota-cli --record to measure the processor time taken by the session. Results are deterministic for a given set of options and are output as one JSON object per line.");
+    clpParser.addHelpOption();
+    clpParser.addVersionOption();
+    QCommandLineOption cloSizes("sizes", "Comma-separated application sizes to load.", "bytes", OTABENCH_DEFAULT_SIZES);
+    QCommandLineOption cloMTU("mtu", "Negotiated ATT MTU.", "bytes", QString::number(svsSettings.nMTU));
+    QCommandLineOption cloInterval("interval", "Connection interval.", "us", QString::number(svsSettings.unConnectionInterval));
+    QCommandLineOption cloLoss("loss", "Packets lost per 1000.", "packets", QString::number(svsSettings.unPacketLoss));
+    QCommandLineOption cloBuffer("rx-buffer", "Size of the module receive buffer.", "bytes", QString::number(svsSettings.nRxBufferSize));
+    QCommandLineOption cloNoModem("no-modem", "Simulate a module without modem out flow control.");
+    QCommandLineOption cloSeed("seed", "Seed for packet loss and application data.", "seed", QString::number(svsSettings.unSeed));
+    QCommandLineOption cloNoVerify("no-verify", "Do not verify the file or its CRC after loading.");
+    QCommandLineOption cloPacketSize("packet-size", "Size of packets written to the module, 0 to size them from the MTU.", "bytes", QString::number(SETTINGS_VALUE_PACKETSIZE));
+    QCommandLineOption cloWindow("command-window", "Number of file write commands which can be outstanding, 0 for no limit.", "commands", QString::number(SETTINGS_VALUE_COMMANDWINDOW));
+    QCommandLineOption cloStream("stream", "Write the file data without response, the module stops the flow with modem out when its buffer fills.");
+    QCommandLineOption cloStreamWindow("stream-window", "Number of packets which can be streamed ahead of the commands the module has acknowledged.", "packets", QString::number(SETTINGS_VALUE_STREAMWINDOW));
+    QCommandLineOption cloCheckpoint("checkpoint", "Keep a transfer checkpoint so an interrupted load could be resumed, as the application does.");
+    QCommandLineOption cloPacketsPerEvent("packets-per-event", "Packets written without response which can be sent in one connection event.", "packets", QString::number(svsSettings.unPacketsPerEvent));
+    QCommandLineOption cloReplay("replay", "Replay a recorded session instead of simulating a module, the simulation options are ignored.", "capture");
+    QCommandLineOption cloRecordedSpeed("recorded-speed", "Replay at the speed the session was recorded instead of as fast as possible.");
+    QCommandLineOption cloRepeat("repeat", "Number of times to replay the session.", "runs", "1");
+    clpParser.addOptions(QList<QCommandLineOption>() << cloSizes << cloMTU << cloInterval << cloLoss << cloBuffer << cloNoModem << cloSeed << cloNoVerify << cloPacketSize << cloWindow << cloStream << cloStreamWindow << cloCheckpoint << cloPacketsPerEvent << cloReplay << cloRecordedSpeed << cloRepeat);
+    clpParser.process(appApplication);
+
+    if (clpParser.isSet(cloReplay))
+    {
+        //Replay a recorded session
+        bool bRepeatOk;
+        unReplayRuns = clpParser.value(cloRepeat).toUInt(&bRepeatOk);
+        if (bRepeatOk == false || unReplayRuns == 0)
+        {
+            Emit("error", QJsonObject{{"message", "Repeat must be a positive number."}});
+            return OTABENCH_EXIT_USAGE;
+        }
+        if (!LoadReplay(clpParser.value(cloReplay)))
+        {
+            Emit("error", QJsonObject{{"message", QString("Unable to read capture: ").append(clpParser.value(cloReplay))}});
+            return OTABENCH_EXIT_USAGE;
+        }
+        bReplay = true;
+        bRecordedSpeed = clpParser.isSet(cloRecordedSpeed);
+        QJsonObject joHeader = scpReplayCapture.Header();
+        Emit("start", QJsonObject{{"version", APP_VERSION}, {"replay", clpParser.value(cloReplay)}, {"recorded_version", joHeader.value("version")}, {"recorded_time", joHeader.value("time")}, {"address", joHeader.value("address")},
+                                  {"records", scpReplayCapture.Count()}, {"recorded_speed", bRecordedSpeed}, {"runs", (qint64)unReplayRuns}});
+        QTimer::singleShot(0, this, SLOT(RunNext()));
+        return appApplication.exec();
+    }
+
+    bool bMTUOk;
+    bool bIntervalOk;
+    bool bLossOk;
+    bool bBufferOk;
+    bool bSeedOk;
+    bool bPacketSizeOk;
+    bool bWindowOk;
+    bool bStreamWindowOk;
+    bool bPacketsPerEventOk;
+    svsSettings.nMTU = clpParser.value(cloMTU).toInt(&bMTUOk);
+    svsSettings.unConnectionInterval = clpParser.value(cloInterval).toUInt(&bIntervalOk);
+    svsSettings.unPacketLoss = clpParser.value(cloLoss).toUInt(&bLossOk);
+    svsSettings.nRxBufferSize = clpParser.value(cloBuffer).toInt(&bBufferOk);
+    svsSettings.unSeed = clpParser.value(cloSeed).toUInt(&bSeedOk);
+    svsSettings.bModem = !clpParser.isSet(cloNoModem);
+    uint unPacketSize = clpParser.value(cloPacketSize).toUInt(&bPacketSizeOk);
+    uint unWindow = clpParser.value(cloWindow).toUInt(&bWindowOk);
+    uint unStreamWindow = clpParser.value(cloStreamWindow).toUInt(&bStreamWindowOk);
+    svsSettings.unPacketsPerEvent = clpParser.value(cloPacketsPerEvent).toUInt(&bPacketsPerEventOk);
+
+    QString strError;
+    QStringList lstSizeValues = clpParser.value(cloSizes).split(',', QString::SkipEmptyParts);
+    for (qint32 i = 0; i < lstSizeValues.count() && strError.isEmpty(); ++i)
+    {
+        bool bSizeOk;
+        qint32 nThisSize = lstSizeValues.at(i).trimmed().toInt(&bSizeOk);
+        if (bSizeOk == false || nThisSize <= FILESIZE_MIN || nThisSize > FILESIZE_MAX)
+        {
+            strError = QString("Sizes must be between %1 and %2 bytes.").arg(FILESIZE_MIN + 1).arg(FILESIZE_MAX);
+        }
+        lstSizes.append(nThisSize);
+    }
+
+    if (!strError.isEmpty())
+    {
+        //Error already set
+    }
+    else if (lstSizes.isEmpty())
+    {
+        strError = "At least one size must be given.";
+    }
+    else if (bMTUOk == false || svsSettings.nMTU < BLE_DEFAULT_MTU || svsSettings.nMTU > BLE_MAX_PACKET_SIZE + BLE_ATT_HEADER_SIZE)
+    {
+        strError = QString("MTU must be between %1 and %2.").arg(BLE_DEFAULT_MTU).arg(BLE_MAX_PACKET_SIZE + BLE_ATT_HEADER_SIZE);
+    }
+    else if (bIntervalOk == false || svsSettings.unConnectionInterval == 0)
+    {
+        strError = "Connection interval must be a positive number of microseconds.";
+    }
+    else if (bLossOk == false || svsSettings.unPacketLoss >= 1000)
+    {
+        strError = "Packet loss must be between 0 and 999.";
+    }
+    else if (bBufferOk == false || svsSettings.nRxBufferSize < 4 * svsSettings.nMTU)
+    {
+        strError = "Receive buffer must hold at least four packets.";
+    }
+    else if (bSeedOk == false)
+    {
+        strError = "Seed must be a positive number.";
+    }
+    else if (bPacketSizeOk == false || unPacketSize > (uint)(svsSettings.nMTU - BLE_ATT_HEADER_SIZE))
+    {
+        strError = QString("Packet size must be between 0 and %1.").arg(svsSettings.nMTU - BLE_ATT_HEADER_SIZE);
+    }
+    else if (bWindowOk == false || unWindow > 255)
+    {
+        strError = "Command window must be between 0 and 255.";
+    }
+    else if (bStreamWindowOk == false || unStreamWindow == 0 || unStreamWindow > 255)
+    {
+        strError = "Stream window must be between 1 and 255.";
+    }
+    else if (bPacketsPerEventOk == false || svsSettings.unPacketsPerEvent == 0)
+    {
+        strError = "Packets per event must be a positive number.";
+    }
+
+    if (!strError.isEmpty())
+    {
+        //Invalid arguments
+        Emit("error", QJsonObject{{"message", strError}});
+        return OTABENCH_EXIT_USAGE;
+    }
+
+    osoOptions.strTargetName = OTABENCH_TARGET_NAME;
+    osoOptions.bVerifyFile = !clpParser.isSet(cloNoVerify);
+    osoOptions.bSkipIdentical = false;
+    osoOptions.unPacketSize = unPacketSize;
+    osoOptions.unCommandWindow = unWindow;
+    osoOptions.bStreamWrites = clpParser.isSet(cloStream);
+    osoOptions.unStreamWindow = unStreamWindow;
+    if (clpParser.isSet(cloCheckpoint))
+    {
+        //Run the session as the application's loads are
+        otsSession.SetTransferCheckpoint(&trcCheckpoint);
+    }
+
+    //Runs are made one after another from the event loop
+    Emit("start", QJsonObject{{"version", APP_VERSION}, {"mtu", svsSettings.nMTU}, {"interval_us", (qint64)svsSettings.unConnectionInterval}, {"loss", (qint64)svsSettings.unPacketLoss}, {"modem", svsSettings.bModem},
+                              {"stream", osoOptions.bStreamWrites}, {"stream_window", osoOptions.unStreamWindow}, {"command_window", osoOptions.unCommandWindow},
+                              {"checkpoint", clpParser.isSet(cloCheckpoint)}, {"packets_per_event", (qint64)svsSettings.unPacketsPerEvent}, {"seed", (qint64)svsSettings.unSeed}});
+    QTimer::singleShot(0, this, SLOT(RunNext()));
+    return appApplication.exec();
+}
+
+//=============================================================================
+//=============================================================================
+void
+OtaBenchmark::RunNext(
+    )
+{
+    //Loads the next application onto a new simulated module, or exits once all sizes have been run
+    if (bReplay == true)
+    {
+        //Replay the capture again, each run starts a new session against a new replay of it
+        if (unReplayRuns == 0)
+        {
+            QCoreApplication::exit(nFailed == 0 ? OTABENCH_EXIT_SUCCESS : OTABENCH_EXIT_FAILED);
+            return;
+        }
+        --unReplayRuns;
+        ++unReplayRun;
+
+        //The module cache starts as it was when the session was recorded, holding the file the module already had if the load was skipped
+        QJsonObject joHeader = scpReplayCapture.Header();
+        mscReplayCache.Invalidate(osoOptions.strAddress);
+        if (joHeader.value("skipped").toBool() == true)
+        {
+            mscReplayCache.FileVerified(osoOptions.strAddress, osoOptions.strTargetName, joHeader.value("checksum").toString(), joHeader.value("file_size").toInt());
+        }
+        rvtTransport = new ReplayVspTransport(&scpReplayCapture, bRecordedSpeed);
+        tmrWall.start();
+        clkCpuStart = clock();
+        otsSession.Start(osoOptions, false);
+        otsSession.Open(rvtTransport);
+        return;
+    }
+
+    if (lstSizes.isEmpty())
+    {
+        QCoreApplication::exit(nFailed == 0 ? OTABENCH_EXIT_SUCCESS : OTABENCH_EXIT_FAILED);
+        return;
+    }
+
+    nSize = lstSizes.takeFirst();
+    osoOptions.baFileData = Application(nSize);
+    svtTransport = new SimulatedVspTransport(svsSettings);
+    tmrWall.start();
+    otsSession.Start(osoOptions, false);
+    otsSession.Open(svtTransport);
+}
+
+//=============================================================================
+//=============================================================================
+void
+OtaBenchmark::Finished(
+    bool bSuccess,
+    QString strMessage
+    )
+{
+    //Run complete, the throughput is of the application data over the simulated time from the start of the connection to the end of verification
+    if (bReplay == true)
+    {
+        ReplayFinished(bSuccess, strMessage);
+        QTimer::singleShot(0, this, SLOT(RunNext()));
+        return;
+    }
+
+    qint64 nWall = tmrWall.elapsed();
+    qint64 nSimulated = svtTransport->Elapsed();
+    bool bIdentical = (svtTransport->File(OTABENCH_TARGET_NAME) == osoOptions.baFileData);
+    if (bSuccess == false || bIdentical == false)
+    {
+        ++nFailed;
+    }
+
+    Emit("result", QJsonObject{
+             {"size", nSize},
+             {"success", bSuccess},
+             {"identical", bIdentical},
+             {"message", strMessage},
+             {"simulated_ms", nSimulated / 1000.0},
+             {"bytes_per_second", (nSimulated > 0 ? (qint64)((double)nSize * 1000000.0 / nSimulated) : 0)},
+             {"wall_ms", nWall},
+             {"packets", svtTransport->PacketsWritten()},
+             {"streamed", svtTransport->PacketsStreamed()},
+             {"retransmissions", svtTransport->PacketsRetransmitted()},
+             {"modem_out_stops", svtTransport->FlowStops()}});
+    QTimer::singleShot(0, this, SLOT(RunNext()));
+}
+
+//=============================================================================
+//=============================================================================
+QByteArray
+OtaBenchmark::Application(
+    qint32 nSize
+    )
+{
+    //Returns pseudo-random application data, which is the same for a given seed and size
+    QByteArray baData;
+    baData.resize(nSize);
+    quint32 unRandom = svsSettings.unSeed ^ (quint32)nSize;
+    for (qint32 i = 0; i < nSize; ++i)
+    {
+        unRandom = unRandom * 1103515245 + 12345;
+        baData[i] = (char)(unRandom >> 16);
+    }
+    return baData;
+}
+
+//=============================================================================
+//=============================================================================
+bool
+OtaBenchmark::LoadReplay(
+    const QString &strFilename
+    )
+{
+    //Reads a capture and sets up the session as it was recorded. The application is loaded as it was, an XCompiled application comes from the capture instead of the XCompile server
+    if (!scpReplayCapture.Load(strFilename))
+    {
+        return false;
+    }
+
+    QJsonObject joHeader = scpReplayCapture.Header();
+    osoOptions = OtaSessionOptions();
+    osoOptions.baFileData = scpReplayCapture.SourceData();
+    osoOptions.strTargetName = joHeader.value("target").toString();
+    osoOptions.bXCompile = joHeader.value("xcompile").toBool();
+    osoOptions.bPrefetchXCompile = joHeader.value("prefetch_xcompile").toBool();
+    osoOptions.bDeleteFile = joHeader.value("delete").toBool();
+    osoOptions.bVerifyFile = joHeader.value("verify").toBool();
+    osoOptions.bSkipIdentical = joHeader.value("skip_identical").toBool();
+    osoOptions.bRestart = joHeader.value("restart").toBool();
+    osoOptions.unPacketSize = joHeader.value("packet_size").toInt();
+    osoOptions.bStreamWrites = joHeader.value("stream_writes").toBool(false);
+    osoOptions.unStreamWindow = joHeader.value("stream_window").toInt(SETTINGS_VALUE_STREAMWINDOW);
+    osoOptions.unCommandWindow = joHeader.value("command_window").toInt();
+    osoOptions.bCheckFreeSpace = joHeader.value("check_free_space").toBool(true);
+    osoOptions.strAddress = joHeader.value("address").toString();
+    if (osoOptions.bXCompile == true && !scpReplayCapture.CompiledData().isEmpty())
+    {
+        xccReplayCache.Store(joHeader.value("xcompile_key").toString(), scpReplayCapture.CompiledData());
+    }
+    otsSession.SetXCompileCache(&xccReplayCache);
+
+    //Module details are always read from the module whilst recording, so only the file verified by an earlier load is kept (time to live of 0)
+    mscReplayCache.SetStorage(tmdReplayCacheDirectory.filePath("modules.ini"), 0);
+    otsSession.SetModuleStateCache(&mscReplayCache);
+    return true;
+}
+
+//=============================================================================
+//=============================================================================
+void
+OtaBenchmark::ReplayFinished(
+    bool bSuccess,
+    const QString &strMessage
+    )
+{
+    //Replay complete, the run fails if the session wrote anything differently to the recording or finished with a different result. Processor time is given per KB written to the module
+    qint64 nWall = tmrWall.elapsed();
+    qint64 nCpu = (qint64)(clock() - clkCpuStart) * 1000000 / CLOCKS_PER_SEC;
+    OtaSessionStatistics ossStatistics = otsSession.Statistics();
+    bool bRecordedSuccess = scpReplayCapture.Header().value("success").toBool();
+    if (rvtTransport->WritesMismatched() > 0 || rvtTransport->WritesMissing() > 0 || bSuccess != bRecordedSuccess)
+    {
+        ++nFailed;
+    }
+
+    QJsonObject joResult{
+             {"run", (qint64)unReplayRun},
+             {"success", bSuccess},
+             {"recorded_success", bRecordedSuccess},
+             {"message", strMessage},
+             {"writes_matched", rvtTransport->WritesMatched()},
+             {"writes_mismatched", rvtTransport->WritesMismatched()},
+             {"writes_missing", rvtTransport->WritesMissing()},
+             {"recorded_ms", (scpReplayCapture.Count() > 0 ? scpReplayCapture.Record(scpReplayCapture.Count() - 1).nTime / 1000.0 : 0.0)},
+             {"wall_ms", nWall},
+             {"cpu_ms", nCpu / 1000.0},
+             {"payload_bytes", ossStatistics.nFileSize},
+             {"wire_bytes", ossStatistics.nWireSize}};
+    if (rvtTransport->FirstMismatch() != -1)
+    {
+        joResult.insert("first_mismatch", rvtTransport->FirstMismatch());
+    }
+    if (ossStatistics.nWireSize > 0)
+    {
+        joResult.insert("cpu_us_per_kb", (double)nCpu * 1024.0 / ossStatistics.nWireSize);
+    }
+    Emit("replay", joResult);
+}
+
+//=============================================================================
+//=============================================================================
+void
+OtaBenchmark::Emit(
+    const QString &strEvent,
+    QJsonObject joFields
+    )
+{
+    //Writes an event as a single line of JSON
+    joFields.insert("event", strEvent);
+    QTextStream tsOutput(stdout);
+    tsOutput << QJsonDocument(joFields).toJson(QJsonDocument::Compact) << "\n";
+    tsOutput.flush();
+}
+
+/******************************************************************************/
+// END OF FILE
+/******************************************************************************/
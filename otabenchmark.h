@@ -0,0 +1,134 @@
+/******************************************************************************
+** Copyright (C) 2018 Laird
+**
+** Project: UwVSP-OTA
+**
+** Module: otabenchmark.h
+**
+** Notes:
+**
+** License: This program is free software: you can redistribute it and/or
+**          modify it under the terms of the GNU General Public License as
+**          published by the Free Software Foundation, version 3.
+**
+**          This program is distributed in the hope that it will be useful,
+**          but WITHOUT ANY WARRANTY; without even the implied warranty of
+**          MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+**          GNU General Public License for more details.
+**
+**          You should have received a copy of the GNU General Public License
+**          along with this program.  If not, see http://www.gnu.org/licenses/
+**
+*******************************************************************************/
+#ifndef OTABENCHMARK_H
+#define OTABENCHMARK_H
+
+/******************************************************************************/
+// Include Files
+/******************************************************************************/
+#include <QObject>
+#include <QCoreApplication>
+#include <QCommandLineParser>
+#include <QElapsedTimer>
+#include <QJsonObject>
+#include <QList>
+#include <QTemporaryDir>
+#include <time.h>
+#include "otasession.h"
+#include "simulatedvsptransport.h"
+#include "replayvsptransport.h"
+#include "sessioncapture.h"
+#include "xcompilecache.h"
+#include "modulestatecache.h"
+#include "transfercheckpoint.h"
+
+/******************************************************************************/
+// Constants
+/******************************************************************************/
+//Process exit codes
+const int OTABENCH_EXIT_SUCCESS          = 0;
+const int OTABENCH_EXIT_FAILED           = 1;
+const int OTABENCH_EXIT_USAGE            = 2;
+
+//Application sizes loaded when none are given
+const char OTABENCH_DEFAULT_SIZES[]      = "1024,4096,16384,65536,262144,393216";
+
+//Name of the file loaded onto the simulated module
+const char OTABENCH_TARGET_NAME[]        = "bench";
+
+/******************************************************************************/
+// Class definitions
+/******************************************************************************/
+class OtaBenchmark : public QObject
+{
+    Q_OBJECT
+public:
+    explicit
+    OtaBenchmark(
+        QObject *parent = nullptr
+        );
+    ~OtaBenchmark(
+        );
+    int
+    Run(
+        QCoreApplication &appApplication
+        );
+
+private slots:
+    void
+    RunNext(
+        );
+    void
+    Finished(
+        bool bSuccess,
+        QString strMessage
+        );
+
+private:
+    QByteArray
+    Application(
+        qint32 nSize
+        );
+    bool
+    LoadReplay(
+        const QString &strFilename
+        );
+    void
+    ReplayFinished(
+        bool bSuccess,
+        const QString &strMessage
+        );
+    void
+    Emit(
+        const QString &strEvent,
+        QJsonObject joFields
+        );
+
+    OtaSession otsSession;
+    OtaSessionOptions osoOptions;
+    SimulatedVspSettings svsSettings;
+    TransferCheckpoint trcCheckpoint;   //Kept for each run if --checkpoint is given, as the application does
+    SimulatedVspTransport *svtTransport; //Transport of the current run, owned by the session
+    QList<qint32> lstSizes;             //Application sizes still to be loaded
+    qint32 nSize;                       //Size of the current run
+    QElapsedTimer tmrWall;              //Real time taken by the current run
+    qint32 nFailed;
+
+    //Replaying a recorded session instead of simulating a module
+    bool bReplay;                       //True if a capture is being replayed
+    bool bRecordedSpeed;                //True to replay at the recorded speed instead of as fast as possible
+    quint32 unReplayRuns;               //Number of times the capture is still to be replayed
+    quint32 unReplayRun;                //Number of the current replay
+    SessionCapture scpReplayCapture;
+    XCompileCache xccReplayCache;       //Holds the XCompiled application from the capture
+    QTemporaryDir tmdReplayCacheDirectory; //Holds mscReplayCache, removed on exit
+    ModuleStateCache mscReplayCache;    //Holds the file the module had already loaded if the recorded session skipped the load
+    ReplayVspTransport *rvtTransport;   //Transport of the current replay, owned by the session
+    clock_t clkCpuStart;                //Processor time used when the current run started
+};
+
+#endif // OTABENCHMARK_H
+
+/******************************************************************************/
+// END OF FILE
+/******************************************************************************/
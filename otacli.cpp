@@ -0,0 +1,319 @@
+/******************************************************************************
+** Copyright (C) 2018 Laird
+**
+** Project: UwVSP-OTA
+**
+** Module: otacli.cpp
+**
+** Notes:
+**
+** License: This program is free software: you can redistribute it and/or
+**          modify it under the terms of the GNU General Public License as
+**          published by the Free Software Foundation, version 3.
+**
+**          This program is distributed in the hope that it will be useful,
+**          but WITHOUT ANY WARRANTY; without even the implied warranty of
+**          MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+**          GNU General Public License for more details.
+**
+**          You should have received a copy of the GNU General Public License
+**          along with this program.  If not, see http://www.gnu.org/licenses/
+**
+*******************************************************************************/
+#include "otacli.h"
+#include <QFileInfo>
+#include <QJsonDocument>
+#include <QTextStream>
+#include <stdio.h>
+
+//=============================================================================
+//=============================================================================
+OtaCli::OtaCli(QObject *parent) : QObject(parent)
+{
+    //Constructor
+    nExitCode = -1;
+    connect(&osmSessions, SIGNAL(StageChanged(qint32,quint8)), this, SLOT(StageChanged(qint32,quint8)));
+    connect(&osmSessions, SIGNAL(Progress(qint32,qint32,qint32)), this, SLOT(Progress(qint32,qint32,qint32)));
+    connect(&osmSessions, SIGNAL(ModuleDetails(qint32,QString,QString)), this, SLOT(ModuleDetails(qint32,QString,QString)));
+    connect(&osmSessions, SIGNAL(Finished(qint32,bool,QString)), this, SLOT(Finished(qint32,bool,QString)));
+    connect(&osmSessions, SIGNAL(AllFinished(qint32,qint32)), this, SLOT(AllFinished(qint32,qint32)));
+}
+
+//=============================================================================
+//=============================================================================
+OtaCli::~OtaCli(
+    )
+{
+    //Destructor
+}
+
+//=============================================================================
+//=============================================================================
+int
+OtaCli::Run(
+    QCoreApplication &appApplication
+    )
+{
+    //Parses the command line, runs the sessions and returns the process exit code
+    QCommandLineParser clpParser;
+    clpParser.setApplicationDescription("Loads a smartBASIC application onto one or more modules over VSP without a user interface. Modules are loaded in parallel and progress is output as one JSON object per line.");
+    clpParser.addHelpOption();
+    clpParser.addVersionOption();
+    clpParser.addPositionalArgument("file", "Compiled application (.uwc) or smartBASIC source to XCompile.");
+    QCommandLineOption cloAddress(QStringList() << "a" << "address", "Bluetooth address (or device UUID on Apple platforms) of a module, can be given more than once.", "address");
+    QCommandLineOption cloName(QStringList() << "n" << "name", "Regular expression matched against advertised names, used if no address is given.", "pattern");
+    QCommandLineOption cloCount(QStringList() << "c" << "count", "Number of modules matching the name pattern to load.", "modules", "1");
+    QCommandLineOption cloTarget(QStringList() << "t" << "target", "Name of the file on the module, defaults to the file name without its extension.", "filename");
+    QCommandLineOption cloXCompile(QStringList() << "x" << "xcompile", "XCompile the file online for the module before loading it.");
+    QCommandLineOption cloNoSSL("no-ssl", "Use HTTP instead of HTTPS for XCompilation.");
+    QCommandLineOption cloNoPrefetch("no-prefetch", "Wait for the module query to complete before starting the XCompile.");
+    QCommandLineOption cloNoDelete("no-delete", "Do not delete the existing file before loading.");
+    QCommandLineOption cloNoVerify("no-verify", "Do not verify the file or its CRC after loading.");
+    QCommandLineOption cloAlwaysLoad("always-load", "Load the file even if the module already has it with the same CRC.");
+    QCommandLineOption cloRestart(QStringList() << "r" << "restart", "Restart the module once loaded instead of disconnecting.");
+    QCommandLineOption cloPacketSize("packet-size", "Size of packets written to the module, 0 to size them from the negotiated MTU.", "bytes", QString::number(SETTINGS_VALUE_PACKETSIZE));
+    QCommandLineOption cloWindow("command-window", "Number of file write commands which can be outstanding, 0 for no limit.", "commands", QString::number(SETTINGS_VALUE_COMMANDWINDOW));
+    QCommandLineOption cloScanTimeout("scan-timeout", "Time to scan for the module.", "ms", QString::number(TIMEOUT_BLE_SCAN));
+    QCommandLineOption cloCacheSize("xcompile-cache", "Size of the cache of XCompiled applications kept between runs, 0 to disable it.", "MB", QString::number(SETTINGS_VALUE_XCOMPILECACHE));
+    QCommandLineOption cloModuleCacheTTL("module-cache-ttl", "Time module details read on an earlier connection are reused for instead of querying the module, 0 to always query it.", "seconds", QString::number(SETTINGS_VALUE_MODULECACHETTL));
+    QCommandLineOption cloRecord("record", "Record the connection to each module to a file in this directory, for replaying with vspota-bench. Module details are then always read from the module.", "directory");
+    clpParser.addOptions(QList<QCommandLineOption>() << cloAddress << cloName << cloCount << cloTarget << cloXCompile << cloNoSSL << cloNoPrefetch << cloNoDelete << cloNoVerify << cloAlwaysLoad << cloRestart << cloPacketSize << cloWindow << cloScanTimeout << cloCacheSize << cloModuleCacheTTL << cloRecord);
+    clpParser.process(appApplication);
+
+    OtaSessionOptions osoOptions;
+    osoOptions.strNamePattern = clpParser.value(cloName);
+    osoOptions.bXCompile = clpParser.isSet(cloXCompile);
+    osoOptions.bSSL = (clpParser.isSet(cloNoSSL) ? false : SETTINGS_VALUE_SSL);
+    osoOptions.bPrefetchXCompile = (clpParser.isSet(cloNoPrefetch) ? false : SETTINGS_VALUE_PREFETCHXCOMP);
+    osoOptions.bDeleteFile = (clpParser.isSet(cloNoDelete) ? false : SETTINGS_VALUE_DELFILE);
+    osoOptions.bVerifyFile = (clpParser.isSet(cloNoVerify) ? false : SETTINGS_VALUE_VERIFYFILE);
+    osoOptions.bSkipIdentical = (clpParser.isSet(cloAlwaysLoad) ? false : SETTINGS_VALUE_SKIPIDENTICAL);
+    osoOptions.bRestart = clpParser.isSet(cloRestart);
+    osoOptions.strCaptureDirectory = clpParser.value(cloRecord);
+
+    bool bPacketSizeOk;
+    bool bWindowOk;
+    bool bScanTimeoutOk;
+    bool bCountOk;
+    bool bCacheSizeOk;
+    bool bModuleCacheTTLOk;
+    QStringList lstAddresses = clpParser.values(cloAddress);
+    uint unCount = clpParser.value(cloCount).toUInt(&bCountOk);
+    uint unPacketSize = clpParser.value(cloPacketSize).toUInt(&bPacketSizeOk);
+    uint unWindow = clpParser.value(cloWindow).toUInt(&bWindowOk);
+    osoOptions.unScanTimeout = clpParser.value(cloScanTimeout).toUInt(&bScanTimeoutOk);
+    uint unCacheSize = clpParser.value(cloCacheSize).toUInt(&bCacheSizeOk);
+    uint unModuleCacheTTL = clpParser.value(cloModuleCacheTTL).toUInt(&bModuleCacheTTLOk);
+
+    QString strError;
+    if (clpParser.positionalArguments().count() != 1)
+    {
+        strError = "Exactly one file must be given.";
+    }
+    else if (lstAddresses.isEmpty() && osoOptions.strNamePattern.isEmpty())
+    {
+        strError = "A module address or name pattern must be given.";
+    }
+    else if (bCountOk == false || unCount == 0 || (!lstAddresses.isEmpty() && clpParser.isSet(cloCount)))
+    {
+        strError = "Count must be a positive number and can only be used with a name pattern.";
+    }
+    else if (bPacketSizeOk == false || unPacketSize > BLE_MAX_PACKET_SIZE)
+    {
+        strError = QString("Packet size must be between 0 and %1.").arg(BLE_MAX_PACKET_SIZE);
+    }
+    else if (bWindowOk == false || unWindow > 255)
+    {
+        strError = "Command window must be between 0 and 255.";
+    }
+    else if (bScanTimeoutOk == false || osoOptions.unScanTimeout == 0)
+    {
+        strError = "Scan timeout must be a positive number of milliseconds.";
+    }
+    else if (bCacheSizeOk == false)
+    {
+        strError = "XCompile cache size must be a number of megabytes.";
+    }
+    else if (bModuleCacheTTLOk == false)
+    {
+        strError = "Module cache time to live must be a number of seconds.";
+    }
+
+    if (!strError.isEmpty())
+    {
+        //Invalid arguments
+        Emit("error", QJsonObject{{"message", strError}});
+        return OTACLI_EXIT_USAGE;
+    }
+    osoOptions.unPacketSize = unPacketSize;
+    osoOptions.unCommandWindow = unWindow;
+
+    //Read the file, which must be within the limits accepted by the module and XCompile server
+    QString strFilename = clpParser.positionalArguments().at(0);
+    QFile fileApplication(strFilename);
+    if (!fileApplication.open(QIODevice::ReadOnly))
+    {
+        Emit("error", QJsonObject{{"message", QString("Unable to open file: ").append(fileApplication.errorString())}});
+        return OTACLI_EXIT_USAGE;
+    }
+    osoOptions.baFileData = fileApplication.readAll();
+    fileApplication.close();
+    if (osoOptions.baFileData.length() <= FILESIZE_MIN || osoOptions.baFileData.length() > FILESIZE_MAX)
+    {
+        Emit("error", QJsonObject{{"message", QString("Invalid filesize, must be between ").append(QString::number(FILESIZE_MIN)).append(" - ").append(QString::number(FILESIZE_MAX)).append(" bytes.")}});
+        return OTACLI_EXIT_USAGE;
+    }
+
+    //The target defaults to the file name without its extension, as in the application
+    osoOptions.strTargetName = (clpParser.isSet(cloTarget) ? clpParser.value(cloTarget) : QFileInfo(strFilename).baseName());
+    if (osoOptions.strTargetName.isEmpty())
+    {
+        Emit("error", QJsonObject{{"message", "Target filename must not be empty."}});
+        return OTACLI_EXIT_USAGE;
+    }
+
+    //One session per module, either one for each address or the requested number matching the name
+    QList<OtaSessionOptions> lstOptions;
+    if (lstAddresses.isEmpty())
+    {
+        for (uint i = 0; i < unCount; ++i)
+        {
+            lstOptions.append(osoOptions);
+        }
+    }
+    else
+    {
+        for (qint32 i = 0; i < lstAddresses.count(); ++i)
+        {
+            osoOptions.strAddress = lstAddresses.at(i);
+            lstOptions.append(osoOptions);
+        }
+    }
+
+    //Run the sessions, the event loop exits once all have finished
+    Emit("start", QJsonObject{{"version", APP_VERSION}, {"file", strFilename}, {"target", osoOptions.strTargetName}, {"size", osoOptions.baFileData.length()}, {"sessions", lstOptions.count()}});
+    vecTiming.fill(OtaCliSessionTiming(), lstOptions.count());
+    tmrElapsed.start();
+    osmSessions.SetXCompileStorage(XCompileCache::DefaultDirectory(), (qint64)unCacheSize*1024*1024);
+    osmSessions.SetModuleStateStorage(ModuleStateCache::DefaultFilename(), unModuleCacheTTL);
+    osmSessions.Start(lstOptions, osoOptions.unScanTimeout);
+    if (nExitCode != -1)
+    {
+        //All sessions failed before anything was started
+        return nExitCode;
+    }
+    return appApplication.exec();
+}
+
+//=============================================================================
+//=============================================================================
+void
+OtaCli::StageChanged(
+    qint32 nSession,
+    quint8 unStage
+    )
+{
+    //Records the time a session spent in its previous stage
+    OtaCliSessionTiming &octTiming = vecTiming[nSession];
+    qint64 nNow = tmrElapsed.elapsed();
+    if (octTiming.unLastStage != OTA_STAGE_IDLE)
+    {
+        octTiming.joStageTimes.insert(OtaSession::StageName(octTiming.unLastStage), nNow - octTiming.nStageStart);
+    }
+    octTiming.unLastStage = unStage;
+    octTiming.nStageStart = nNow;
+    octTiming.nLastPercent = -1;
+    Emit("stage", QJsonObject{{"session", nSession}, {"stage", OtaSession::StageName(unStage)}});
+}
+
+//=============================================================================
+//=============================================================================
+void
+OtaCli::Progress(
+    qint32 nSession,
+    qint32 nSent,
+    qint32 nTotal
+    )
+{
+    //Outputs progress each time the percentage of a session changes, to keep the output small
+    qint32 nPercent = (nTotal > 0 ? (qint32)((qint64)nSent * 100 / nTotal) : 0);
+    if (nPercent == vecTiming.at(nSession).nLastPercent)
+    {
+        return;
+    }
+    vecTiming[nSession].nLastPercent = nPercent;
+    Emit("progress", QJsonObject{{"session", nSession}, {"sent", nSent}, {"total", nTotal}, {"percent", nPercent}});
+}
+
+//=============================================================================
+//=============================================================================
+void
+OtaCli::ModuleDetails(
+    qint32 nSession,
+    QString strDevice,
+    QString strFirmware
+    )
+{
+    //Module has been queried
+    Emit("module", QJsonObject{{"session", nSession}, {"device", strDevice}, {"firmware", strFirmware}});
+}
+
+//=============================================================================
+//=============================================================================
+void
+OtaCli::Finished(
+    qint32 nSession,
+    bool bSuccess,
+    QString strMessage
+    )
+{
+    //Session has ended, output the result, its stage timings and what was written. Payload throughput is over the transfer stage, the verification time is in the stage timings
+    const QJsonObject &joStageTimes = vecTiming.at(nSession).joStageTimes;
+    OtaSessionStatistics ossStatistics = osmSessions.Session(nSession)->Statistics();
+    QJsonObject joResult{{"session", nSession}, {"success", bSuccess}, {"message", strMessage}, {"stages", joStageTimes},
+                         {"payload_bytes", ossStatistics.nFileSize}, {"wire_bytes", ossStatistics.nWireSize}, {"packet_size", ossStatistics.unPacketSize}, {"modem_out_stops", (qint64)ossStatistics.unFlowStops}};
+    qint64 nTransferTime = (qint64)joStageTimes.value(OtaSession::StageName(OTA_STAGE_TRANSFERRING)).toDouble();
+    if (nTransferTime > 0 && ossStatistics.nWireSize > 0)
+    {
+        joResult.insert("throughput", (qint64)ossStatistics.nFileSize * 1000 / nTransferTime);
+    }
+    if (!osmSessions.Session(nSession)->CaptureFilename().isEmpty())
+    {
+        joResult.insert("capture", osmSessions.Session(nSession)->CaptureFilename());
+    }
+    Emit("result", joResult);
+}
+
+//=============================================================================
+//=============================================================================
+void
+OtaCli::AllFinished(
+    qint32 nSucceeded,
+    qint32 nFailed
+    )
+{
+    //All sessions have ended, the process fails if any module was not loaded
+    Emit("summary", QJsonObject{{"succeeded", nSucceeded}, {"failed", nFailed}});
+    nExitCode = (nFailed == 0 ? OTACLI_EXIT_SUCCESS : OTACLI_EXIT_FAILED);
+    QCoreApplication::exit(nExitCode);
+}
+
+//=============================================================================
+//=============================================================================
+void
+OtaCli::Emit(
+    const QString &strEvent,
+    QJsonObject joFields
+    )
+{
+    //Writes an event as a single line of JSON, flushed so that it can be read as it happens
+    joFields.insert("event", strEvent);
+    joFields.insert("ms", (tmrElapsed.isValid() ? tmrElapsed.elapsed() : 0));
+    QTextStream tsOutput(stdout);
+    tsOutput << QJsonDocument(joFields).toJson(QJsonDocument::Compact) << "\n";
+    tsOutput.flush();
+}
+
+/******************************************************************************/
+// END OF FILE
+/******************************************************************************/
@@ -0,0 +1,123 @@
+/******************************************************************************
+** Copyright (C) 2018 Laird
+**
+** Project: UwVSP-OTA
+**
+** Module: otacli.h
+**
+** Notes:
+**
+** License: This program is free software: you can redistribute it and/or
+**          modify it under the terms of the GNU General Public License as
+**          published by the Free Software Foundation, version 3.
+**
+**          This program is distributed in the hope that it will be useful,
+**          but WITHOUT ANY WARRANTY; without even the implied warranty of
+**          MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+**          GNU General Public License for more details.
+**
+**          You should have received a copy of the GNU General Public License
+**          along with this program.  If not, see http://www.gnu.org/licenses/
+**
+*******************************************************************************/
+#ifndef OTACLI_H
+#define OTACLI_H
+
+/******************************************************************************/
+// Include Files
+/******************************************************************************/
+#include <QObject>
+#include <QCoreApplication>
+#include <QCommandLineParser>
+#include <QElapsedTimer>
+#include <QJsonObject>
+#include <QFile>
+#include <QVector>
+#include "otasessionmanager.h"
+
+/******************************************************************************/
+// Constants
+/******************************************************************************/
+//Process exit codes
+const int OTACLI_EXIT_SUCCESS            = 0;
+const int OTACLI_EXIT_FAILED             = 1;
+const int OTACLI_EXIT_USAGE              = 2;
+
+/******************************************************************************/
+// Structures
+/******************************************************************************/
+//Timing of a session, used for the output
+struct OtaCliSessionTiming
+{
+    qint64 nStageStart = 0;                //Elapsed time at which the current stage started
+    quint8 unLastStage = OTA_STAGE_IDLE;
+    qint32 nLastPercent = -1;              //Last progress percentage output, progress is only output when this changes
+    QJsonObject joStageTimes;              //Duration of each completed stage in ms
+};
+
+/******************************************************************************/
+// Class definitions
+/******************************************************************************/
+class OtaCli : public QObject
+{
+    Q_OBJECT
+public:
+    explicit
+    OtaCli(
+        QObject *parent = nullptr
+        );
+    ~OtaCli(
+        );
+    int
+    Run(
+        QCoreApplication &appApplication
+        );
+
+private slots:
+    void
+    StageChanged(
+        qint32 nSession,
+        quint8 unStage
+        );
+    void
+    Progress(
+        qint32 nSession,
+        qint32 nSent,
+        qint32 nTotal
+        );
+    void
+    ModuleDetails(
+        qint32 nSession,
+        QString strDevice,
+        QString strFirmware
+        );
+    void
+    Finished(
+        qint32 nSession,
+        bool bSuccess,
+        QString strMessage
+        );
+    void
+    AllFinished(
+        qint32 nSucceeded,
+        qint32 nFailed
+        );
+
+private:
+    void
+    Emit(
+        const QString &strEvent,
+        QJsonObject joFields
+        );
+
+    OtaSessionManager osmSessions;
+    QElapsedTimer tmrElapsed;              //Time since the sessions started
+    QVector<OtaCliSessionTiming> vecTiming;
+    qint32 nExitCode;                      //Set once all sessions have finished, -1 until then
+};
+
+#endif // OTACLI_H
+
+/******************************************************************************/
+// END OF FILE
+/******************************************************************************/
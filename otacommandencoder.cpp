@@ -0,0 +1,318 @@
+/******************************************************************************
+** Copyright (C) 2018 Laird
+**
+** Project: UwVSP-OTA
+**
+** Module: otacommandencoder.cpp
+**
+** Notes:
+**
+** License: This program is free software: you can redistribute it and/or
+**          modify it under the terms of the GNU General Public License as
+**          published by the Free Software Foundation, version 3.
+**
+**          This program is distributed in the hope that it will be useful,
+**          but WITHOUT ANY WARRANTY; without even the implied warranty of
+**          MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+**          GNU General Public License for more details.
+**
+**          You should have received a copy of the GNU General Public License
+**          along with this program.  If not, see http://www.gnu.org/licenses/
+**
+*******************************************************************************/
+#include "otacommandencoder.h"
+
+/******************************************************************************/
+// Local Functions or Private Members
+/******************************************************************************/
+static const char acHexDigits[] = "0123456789ABCDEF";
+
+//=============================================================================
+//=============================================================================
+static inline char *
+EncoderCopy(
+    char *pOut,
+    const char *pData,
+    qint32 nLength
+    )
+{
+    //Copies data to the output and returns the new output position
+    memcpy(pOut, pData, nLength);
+    return pOut + nLength;
+}
+
+//=============================================================================
+//=============================================================================
+static inline qint32
+EscapedByteLength(
+    unsigned char ucByte
+    )
+{
+    //Returns the number of characters a byte takes up in an AT+FWR string
+    return ((ucByte < 0x20 || ucByte > 0x7E || ucByte == '"' || ucByte == '\\') ? 3 : 1);
+}
+
+//=============================================================================
+//=============================================================================
+static qint32
+EscapedChunkSize(
+    const unsigned char *pucData,
+    qint32 nRemaining,
+    qint32 *pnEncodedLength
+    )
+{
+    //Returns how many bytes fit in one AT+FWR command without splitting an escape sequence, and the number of characters they encode to
+    qint32 nBytes = 0;
+    qint32 nCharacters = 0;
+    while (nBytes < nRemaining)
+    {
+        qint32 nByteLength = EscapedByteLength(pucData[nBytes]);
+        if (nCharacters + nByteLength > MODULE_MAX_COMMAND_LENGTH)
+        {
+            break;
+        }
+        nCharacters += nByteLength;
+        ++nBytes;
+    }
+    *pnEncodedLength = nCharacters;
+    return nBytes;
+}
+
+//=============================================================================
+//=============================================================================
+OtaCommandEncoder::OtaCommandEncoder(QObject *parent) : QObject(parent)
+{
+    //Constructor
+}
+
+//=============================================================================
+//=============================================================================
+OtaCommandEncoder::~OtaCommandEncoder(
+    )
+{
+    //Destructor
+}
+
+//=============================================================================
+//=============================================================================
+QByteArray
+OtaCommandEncoder::EncodeFile(
+    const QString &strFilename,
+    const QByteArray &baFileData,
+    bool bDeleteFile,
+    bool bCalculateChecksum,
+    quint8 unFormat,
+    qint32 nStartOffset
+    )
+{
+    //Encodes file data into the module commands to (optionally) delete, open and write the file, the checksum is calculated in the same pass. A non-zero start
+    //offset writes only the rest of the data, to a file which has already been opened in append mode
+    const QByteArray baFilename = strFilename.toUtf8();
+    const bool bAppend = (nStartOffset > 0);
+    const qint32 nDeleteLength = sizeof(ENCODER_COMMAND_DELETE) - 1;
+    const qint32 nOpenLength = sizeof(ENCODER_COMMAND_OPEN) - 1;
+    const qint32 nWriteHexLength = sizeof(ENCODER_COMMAND_WRITEHEX) - 1;
+    const qint32 nWriteLength = sizeof(ENCODER_COMMAND_WRITE) - 1;
+    const qint32 nEndLength = sizeof(ENCODER_COMMAND_END) - 1;
+    const qint32 nChunkSize = MODULE_MAX_COMMAND_LENGTH / 2;
+    const qint32 nFileLength = baFileData.length();
+    const QByteArray baWriteData = QByteArray::fromRawData(baFileData.constData() + nStartOffset, nFileLength - nStartOffset);
+
+    //Work out the exact size of the output so it is only allocated once
+    qint32 nOutputLength = EncodedDataLength(baWriteData, unFormat);
+    if (bAppend == false)
+    {
+        nOutputLength += nOpenLength + baFilename.length() + nEndLength;
+    }
+    if (bDeleteFile == true && bAppend == false)
+    {
+        nOutputLength += nDeleteLength + baFilename.length() + nEndLength;
+    }
+
+    QByteArray baOutput;
+    baOutput.resize(nOutputLength);
+    char *pOut = baOutput.data();
+    vecCommands.clear();
+    vecCommands.reserve(baWriteData.length() / nChunkSize + 3);
+
+    if (bDeleteFile == true && bAppend == false)
+    {
+        //Delete file command
+        pOut = EncoderCopy(pOut, ENCODER_COMMAND_DELETE, nDeleteLength);
+        pOut = EncoderCopy(pOut, baFilename.constData(), baFilename.length());
+        pOut = EncoderCopy(pOut, ENCODER_COMMAND_END, nEndLength);
+        AddCommand(pOut - baOutput.constData(), -1);
+    }
+
+    if (bAppend == false)
+    {
+        //Open file command
+        pOut = EncoderCopy(pOut, ENCODER_COMMAND_OPEN, nOpenLength);
+        pOut = EncoderCopy(pOut, baFilename.constData(), baFilename.length());
+        pOut = EncoderCopy(pOut, ENCODER_COMMAND_END, nEndLength);
+        AddCommand(pOut - baOutput.constData(), -1);
+    }
+
+    //File write commands
+    chkChecksum.ResetChecksum();
+    const unsigned char *pucData = (const unsigned char *)baWriteData.constData();
+    qint32 nRemaining = baWriteData.length();
+    while (nRemaining > 0)
+    {
+        qint32 nThisChunk;
+        qint32 nEncodedLength;
+        if (unFormat == ENCODER_FORMAT_ESCAPED)
+        {
+            //As many bytes as fit in the command once escaped
+            nThisChunk = EscapedChunkSize(pucData, nRemaining, &nEncodedLength);
+        }
+        else
+        {
+            //Fixed number of bytes per command
+            nThisChunk = (nRemaining > nChunkSize ? nChunkSize : nRemaining);
+        }
+
+        if (bCalculateChecksum == true)
+        {
+            //Add to checksum
+            chkChecksum.AddBlock((const char *)pucData, nThisChunk);
+        }
+
+        const unsigned char *pucChunkEnd = pucData + nThisChunk;
+        if (unFormat == ENCODER_FORMAT_ESCAPED)
+        {
+            //Printable bytes are written as-is, others as a \HH escape sequence
+            pOut = EncoderCopy(pOut, ENCODER_COMMAND_WRITE, nWriteLength);
+            while (pucData < pucChunkEnd)
+            {
+                if (EscapedByteLength(*pucData) == 1)
+                {
+                    *pOut++ = (char)*pucData;
+                }
+                else
+                {
+                    *pOut++ = '\\';
+                    *pOut++ = acHexDigits[*pucData >> 4];
+                    *pOut++ = acHexDigits[*pucData & 0x0F];
+                }
+                ++pucData;
+            }
+        }
+        else
+        {
+            //Every byte is written as two hex digits
+            pOut = EncoderCopy(pOut, ENCODER_COMMAND_WRITEHEX, nWriteHexLength);
+            while (pucData < pucChunkEnd)
+            {
+                *pOut++ = acHexDigits[*pucData >> 4];
+                *pOut++ = acHexDigits[*pucData & 0x0F];
+                ++pucData;
+            }
+        }
+        pOut = EncoderCopy(pOut, ENCODER_COMMAND_END, nEndLength);
+        AddCommand(pOut - baOutput.constData(), nFileLength - nRemaining);
+        nRemaining -= nThisChunk;
+    }
+
+    return baOutput;
+}
+
+//=============================================================================
+//=============================================================================
+qint32
+OtaCommandEncoder::EncodedDataLength(
+    const QByteArray &baFileData,
+    quint8 unFormat
+    )
+{
+    //Returns the length of the file write commands for the data in the given format
+    const qint32 nEndLength = sizeof(ENCODER_COMMAND_END) - 1;
+    const qint32 nFileLength = baFileData.length();
+    if (unFormat == ENCODER_FORMAT_ESCAPED)
+    {
+        //Escaped commands vary in size so walk through the data
+        const qint32 nWriteLength = sizeof(ENCODER_COMMAND_WRITE) - 1;
+        const unsigned char *pucData = (const unsigned char *)baFileData.constData();
+        qint32 nRemaining = nFileLength;
+        qint32 nLength = 0;
+        while (nRemaining > 0)
+        {
+            qint32 nEncodedLength;
+            qint32 nThisChunk = EscapedChunkSize(pucData, nRemaining, &nEncodedLength);
+            nLength += nWriteLength + nEncodedLength + nEndLength;
+            pucData += nThisChunk;
+            nRemaining -= nThisChunk;
+        }
+        return nLength;
+    }
+
+    //Hex commands are all the same size
+    const qint32 nWriteHexLength = sizeof(ENCODER_COMMAND_WRITEHEX) - 1;
+    const qint32 nChunkSize = MODULE_MAX_COMMAND_LENGTH / 2;
+    const qint32 nChunks = (nFileLength + nChunkSize - 1) / nChunkSize;
+    return nChunks * (nWriteHexLength + nEndLength) + nFileLength * 2;
+}
+
+//=============================================================================
+//=============================================================================
+quint8
+OtaCommandEncoder::SelectFormat(
+    const QByteArray &baFileData
+    )
+{
+    //Returns the format which sends the least data, AT+FWR with \HH escapes is accepted by smartBASIC modules alongside AT+FWRH
+    if (EncodedDataLength(baFileData, ENCODER_FORMAT_ESCAPED) < EncodedDataLength(baFileData, ENCODER_FORMAT_HEX))
+    {
+        return ENCODER_FORMAT_ESCAPED;
+    }
+    return ENCODER_FORMAT_HEX;
+}
+
+//=============================================================================
+//=============================================================================
+quint16
+OtaCommandEncoder::GetChecksum(
+    )
+{
+    //Returns the checksum of the last encoded file
+    return chkChecksum.GetChecksum();
+}
+
+//=============================================================================
+//=============================================================================
+QString
+OtaCommandEncoder::GetChecksumHexString(
+    )
+{
+    //Returns the checksum of the last encoded file as a hex-encoded string
+    return chkChecksum.GetChecksumHexString();
+}
+
+//=============================================================================
+//=============================================================================
+const QVector<EncodedCommand> &
+OtaCommandEncoder::GetCommands(
+    )
+{
+    //Returns the position of each command in the last encoded output
+    return vecCommands;
+}
+
+//=============================================================================
+//=============================================================================
+void
+OtaCommandEncoder::AddCommand(
+    qint32 nEnd,
+    qint32 nFileOffset
+    )
+{
+    //Records the position of an encoded command
+    EncodedCommand ecCommand;
+    ecCommand.nEnd = nEnd;
+    ecCommand.nFileOffset = nFileOffset;
+    vecCommands.append(ecCommand);
+}
+
+/******************************************************************************/
+// END OF FILE
+/******************************************************************************/
@@ -0,0 +1,116 @@
+/******************************************************************************
+** Copyright (C) 2018 Laird
+**
+** Project: UwVSP-OTA
+**
+** Module: otacommandencoder.h
+**
+** Notes:
+**
+** License: This program is free software: you can redistribute it and/or
+**          modify it under the terms of the GNU General Public License as
+**          published by the Free Software Foundation, version 3.
+**
+**          This program is distributed in the hope that it will be useful,
+**          but WITHOUT ANY WARRANTY; without even the implied warranty of
+**          MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+**          GNU General Public License for more details.
+**
+**          You should have received a copy of the GNU General Public License
+**          along with this program.  If not, see http://www.gnu.org/licenses/
+**
+*******************************************************************************/
+#ifndef OTACOMMANDENCODER_H
+#define OTACOMMANDENCODER_H
+
+/******************************************************************************/
+// Include Files
+/******************************************************************************/
+#include <QObject>
+#include <QByteArray>
+#include <QVector>
+#include "checksumcalculator.h"
+#include "target.h"
+
+/******************************************************************************/
+// Constants
+/******************************************************************************/
+//Module file commands
+const char ENCODER_COMMAND_DELETE[]      = "AT+del \"";
+const char ENCODER_COMMAND_OPEN[]        = "AT+fow \"";
+const char ENCODER_COMMAND_APPEND[]      = "AT+foa \""; //Requires firmware with append mode file open support, a resume checks the module accepts it
+const char ENCODER_COMMAND_WRITEHEX[]    = "AT+fwrh \"";
+const char ENCODER_COMMAND_WRITE[]       = "AT+fwr \"";
+const char ENCODER_COMMAND_END[]         = "\"\r";
+
+//Formats which file data can be written in
+const quint8 ENCODER_FORMAT_HEX          = 0; //AT+FWRH with every byte hex-encoded
+const quint8 ENCODER_FORMAT_ESCAPED      = 1; //AT+FWR with printable bytes sent as-is and others escaped as \HH
+
+/******************************************************************************/
+// Structures
+/******************************************************************************/
+//Position of an encoded command in the output and the file data it writes
+struct EncodedCommand
+{
+    qint32 nEnd;        //Offset in the encoded output just after the command
+    qint32 nFileOffset; //Offset in the file of the first byte written by the command, -1 if the command does not write data
+};
+
+/******************************************************************************/
+// Class definitions
+/******************************************************************************/
+class OtaCommandEncoder : public QObject
+{
+    Q_OBJECT
+public:
+    explicit
+    OtaCommandEncoder(
+        QObject *parent = nullptr
+        );
+    ~OtaCommandEncoder(
+        );
+    QByteArray
+    EncodeFile(
+        const QString &strFilename,
+        const QByteArray &baFileData,
+        bool bDeleteFile,
+        bool bCalculateChecksum,
+        quint8 unFormat = ENCODER_FORMAT_HEX,
+        qint32 nStartOffset = 0
+        );
+    qint32
+    EncodedDataLength(
+        const QByteArray &baFileData,
+        quint8 unFormat
+        );
+    quint8
+    SelectFormat(
+        const QByteArray &baFileData
+        );
+    quint16
+    GetChecksum(
+        );
+    QString
+    GetChecksumHexString(
+        );
+    const QVector<EncodedCommand> &
+    GetCommands(
+        );
+
+private:
+    void
+    AddCommand(
+        qint32 nEnd,
+        qint32 nFileOffset
+        );
+
+    ChecksumCalculator chkChecksum;
+    QVector<EncodedCommand> vecCommands; //Commands in the last encoded output
+};
+
+#endif // OTACOMMANDENCODER_H
+
+/******************************************************************************/
+// END OF FILE
+/******************************************************************************/
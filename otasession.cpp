@@ -0,0 +1,1685 @@
+/******************************************************************************
+** Copyright (C) 2018 Laird
+**
+** Project: UwVSP-OTA
+**
+** Module: otasession.cpp
+**
+** Notes:
+**
+** License: This program is free software: you can redistribute it and/or
+**          modify it under the terms of the GNU General Public License as
+**          published by the Free Software Foundation, version 3.
+**
+**          This program is distributed in the hope that it will be useful,
+**          but WITHOUT ANY WARRANTY; without even the implied warranty of
+**          MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+**          GNU General Public License for more details.
+**
+**          You should have received a copy of the GNU General Public License
+**          along with this program.  If not, see http://www.gnu.org/licenses/
+**
+*******************************************************************************/
+#include "otasession.h"
+
+//=============================================================================
+//=============================================================================
+OtaSession::OtaSession(QObject *parent) : QObject(parent)
+{
+    //Constructor
+    unStage = OTA_STAGE_IDLE;
+    bOwnsTransport = false;
+    bQueryOnly = false;
+    bVSPBlocked = false;
+    bWriteActive = false;
+    bStreamingActive = false;
+    bPipelineStalled = false;
+    bRestartActive = false;
+    bIgnoreInsufficientSpace = false;
+    bSkipped = false;
+    bResuming = false;
+    unResumeStep = OTA_RESUME_CLOSING;
+    unActivePacketSize = BLE_DEFAULT_MTU - BLE_ATT_HEADER_SIZE;
+    nTotalSize = 0;
+    nSentSize = 0;
+    nFileSize = 0;
+    nFileOffset = 0;
+    unFlowStops = 0;
+    bModuleDetailsCached = false;
+    vtpTransport = NULL;
+    rvtRecorder = NULL;
+    trcCheckpoint = NULL;
+    ptrPacketTracer = NULL;
+
+    //Setup the scanner, the scan timeout is set for each session
+    ddaDiscoveryAgent = new QBluetoothDeviceDiscoveryAgent(this);
+    connect(ddaDiscoveryAgent, SIGNAL(deviceDiscovered(QBluetoothDeviceInfo)), this, SLOT(DeviceDiscovered(QBluetoothDeviceInfo)));
+    connect(ddaDiscoveryAgent, SIGNAL(error(QBluetoothDeviceDiscoveryAgent::Error)), this, SLOT(ScanError(QBluetoothDeviceDiscoveryAgent::Error)));
+    connect(ddaDiscoveryAgent, SIGNAL(finished()), this, SLOT(ScanFinished()));
+
+    //Setup the module response timeout timer
+    tmrResponseTimeoutTimer.setSingleShot(true);
+    tmrResponseTimeoutTimer.setInterval(TIMEOUT_TIMER_INTERVAL);
+    connect(&tmrResponseTimeoutTimer, SIGNAL(timeout()), this, SLOT(ResponseTimeout()));
+
+    //Setup the XCompile cache, which is replaced if it is shared between sessions
+    xccXCompileCache = NULL;
+    SetXCompileCache(new XCompileCache(this));
+
+    //Module details are not kept unless a cache with storage is set
+    mscModuleCache = new ModuleStateCache(this);
+}
+
+//=============================================================================
+//=============================================================================
+OtaSession::~OtaSession(
+    )
+{
+    //Destructor
+    tmrResponseTimeoutTimer.stop();
+    if (vtpTransport != NULL)
+    {
+        disconnect(vtpTransport, 0, this, 0);
+        if (bOwnsTransport == true)
+        {
+            vtpTransport->Close();
+        }
+    }
+}
+
+//=============================================================================
+//=============================================================================
+void
+OtaSession::Start(
+    const OtaSessionOptions &osoNewOptions,
+    bool bScan
+    )
+{
+    //Starts loading a file onto a module, beginning with a scan for it. If bScan is false the scan is done elsewhere and the module is passed to Connect()
+    if (Prepare(osoNewOptions) == false)
+    {
+        //A session is already in progress
+        return;
+    }
+
+    if (osoOptions.strAddress.isEmpty())
+    {
+        //Module is matched by name
+        rxpNamePattern.setPattern(osoOptions.strNamePattern);
+        if (osoOptions.strNamePattern.isEmpty() || !rxpNamePattern.isValid())
+        {
+            SetStage(OTA_STAGE_SCANNING);
+            Finish(false, QString("Invalid module name pattern: ").append(osoOptions.strNamePattern));
+            return;
+        }
+    }
+
+    //Scan for the module
+    SetStage(OTA_STAGE_SCANNING);
+    if (bScan == false)
+    {
+        return;
+    }
+    ddaDiscoveryAgent->setLowEnergyDiscoveryTimeout(osoOptions.unScanTimeout);
+    ddaDiscoveryAgent->start(QBluetoothDeviceDiscoveryAgent::LowEnergyMethod);
+}
+
+//=============================================================================
+//=============================================================================
+void
+OtaSession::Load(
+    const OtaSessionOptions &osoNewOptions,
+    VspTransport *vtpOpenTransport,
+    const QString &strAddress
+    )
+{
+    //Loads a file onto a module over a transport which the caller has already opened and keeps once the session finishes
+    if (Prepare(osoNewOptions) == false)
+    {
+        return;
+    }
+    strModuleAddress = strAddress;
+    Attach(vtpOpenTransport, false);
+    if (!osoOptions.strCaptureDirectory.isEmpty())
+    {
+        //Record the session if the caller's transport is a recording one, the capture starts afresh so it replays as if the session had connected
+        rvtRecorder = qobject_cast<RecordingVspTransport *>(vtpOpenTransport);
+        if (rvtRecorder != NULL)
+        {
+            rvtRecorder->Restart();
+        }
+    }
+    StartQuery();
+}
+
+//=============================================================================
+//=============================================================================
+void
+OtaSession::Query(
+    VspTransport *vtpOpenTransport,
+    const QString &strAddress
+    )
+{
+    //Reads the module details over a transport which the caller has already opened, they are always read from the module and Information() holds them once finished
+    if (Prepare(OtaSessionOptions()) == false)
+    {
+        return;
+    }
+    bQueryOnly = true;
+    strModuleAddress = strAddress;
+    Attach(vtpOpenTransport, false);
+    StartQuery();
+}
+
+//=============================================================================
+//=============================================================================
+void
+OtaSession::Resume(
+    const OtaSessionOptions &osoNewOptions,
+    VspTransport *vtpOpenTransport,
+    const QString &strAddress
+    )
+{
+    //Continues the interrupted transfer held in the transfer checkpoint over a transport which the caller has already opened
+    if (trcCheckpoint == NULL || !trcCheckpoint->IsResumable(strAddress) || Prepare(osoNewOptions) == false)
+    {
+        return;
+    }
+    strModuleAddress = strAddress;
+    Attach(vtpOpenTransport, false);
+    StartResume();
+}
+
+//=============================================================================
+//=============================================================================
+bool
+OtaSession::Prepare(
+    const OtaSessionOptions &osoNewOptions
+    )
+{
+    //Clears the state of the previous session, returns false if a session is in progress
+    if (unStage != OTA_STAGE_IDLE && unStage != OTA_STAGE_COMPLETE && unStage != OTA_STAGE_FAILED)
+    {
+        return false;
+    }
+
+    if (vtpTransport != NULL)
+    {
+        //Release the connection from the previous session
+        disconnect(vtpTransport, 0, this, 0);
+        if (bOwnsTransport == true)
+        {
+            vtpTransport->deleteLater();
+        }
+        vtpTransport = NULL;
+        rvtRecorder = NULL;
+    }
+
+    osoOptions = osoNewOptions;
+    strCaptureFilename.clear();
+    bOwnsTransport = false;
+    bQueryOnly = false;
+    bVSPBlocked = false;
+    bWriteActive = false;
+    bStreamingActive = false;
+    bPipelineStalled = false;
+    bRestartActive = false;
+    bSkipped = false;
+    bResuming = false;
+    nTotalSize = 0;
+    nSentSize = 0;
+    nFileSize = 0;
+    nFileOffset = 0;
+    unFlowStops = 0;
+    baWritePacket.clear();
+    strChecksum.clear();
+    strAppendChecksum.clear();
+    strResult.clear();
+    strXCompileKey.clear();
+    strModuleAddress.clear();
+    bModuleDetailsCached = false;
+    bXCompileReady = false;
+    baXCompiledData.clear();
+    baCompareData.clear();
+    oqOutputQueue.Clear();
+    cplCommandPipeline.Clear();
+    mrpResponseParser.Reset();
+    return true;
+}
+
+//=============================================================================
+//=============================================================================
+void
+OtaSession::Attach(
+    VspTransport *vtpNewTransport,
+    bool bOwned
+    )
+{
+    //Uses a transport for the session, one which is owned is closed once the session finishes and deleted when the next one starts
+    vtpTransport = vtpNewTransport;
+    bOwnsTransport = bOwned;
+    if (bOwnsTransport == true)
+    {
+        vtpTransport->setParent(this);
+    }
+    connect(vtpTransport, SIGNAL(Connected()), this, SLOT(TransportConnected()));
+    connect(vtpTransport, SIGNAL(Opened()), this, SLOT(TransportOpened()));
+    connect(vtpTransport, SIGNAL(Closed()), this, SLOT(TransportClosed()));
+    connect(vtpTransport, SIGNAL(DataReceived(QByteArray)), this, SLOT(TransportDataReceived(QByteArray)));
+    connect(vtpTransport, SIGNAL(DataWritten(qint32)), this, SLOT(TransportDataWritten(qint32)));
+    connect(vtpTransport, SIGNAL(FlowChanged(bool)), this, SLOT(TransportFlowChanged(bool)));
+    connect(vtpTransport, SIGNAL(MTUChanged(int)), this, SLOT(TransportMTUChanged(int)));
+    connect(vtpTransport, SIGNAL(Error(QString)), this, SLOT(TransportError(QString)));
+
+    //Packet size follows the MTU of the connection, which is updated if it changes
+    TransportMTUChanged(vtpTransport->MTU());
+}
+
+//=============================================================================
+//=============================================================================
+void
+OtaSession::Cancel(
+    const QString &strReason
+    )
+{
+    //Abandons the session, the module is left with a partially written file which is not resumed. An outstanding XCompile request still completes and is cached
+    if (unStage == OTA_STAGE_IDLE || unStage == OTA_STAGE_COMPLETE || unStage == OTA_STAGE_FAILED)
+    {
+        return;
+    }
+    if (trcCheckpoint != NULL && (unStage == OTA_STAGE_TRANSFERRING || unStage == OTA_STAGE_VERIFYING || bResuming == true))
+    {
+        trcCheckpoint->Clear();
+    }
+    Finish(false, strReason);
+}
+
+//=============================================================================
+//=============================================================================
+void
+OtaSession::IgnoreInsufficientSpace(
+    )
+{
+    //Called from a slot connected to InsufficientSpace() to load the file anyway, otherwise the session fails
+    bIgnoreInsufficientSpace = true;
+}
+
+//=============================================================================
+//=============================================================================
+void
+OtaSession::SetXCompileCache(
+    XCompileCache *xccNewCache
+    )
+{
+    //Sets the cache used for XCompiling, so that sessions loading the same application onto the same module type only compile it once
+    if (xccXCompileCache != NULL)
+    {
+        disconnect(xccXCompileCache, 0, this, 0);
+    }
+    xccXCompileCache = xccNewCache;
+    connect(xccXCompileCache, SIGNAL(XCompileComplete(QString,bool,qint16,QByteArray)), this, SLOT(XCompileComplete(QString,bool,qint16,QByteArray)));
+}
+
+//=============================================================================
+//=============================================================================
+void
+OtaSession::SetModuleStateCache(
+    ModuleStateCache *mscNewCache
+    )
+{
+    //Sets the cache of module details, so a module loaded again within its time to live is not queried
+    mscModuleCache = mscNewCache;
+}
+
+//=============================================================================
+//=============================================================================
+void
+OtaSession::SetTransferCheckpoint(
+    TransferCheckpoint *trcNewCheckpoint
+    )
+{
+    //Sets where an interrupted transfer is kept so Resume() can continue it after reconnecting
+    trcCheckpoint = trcNewCheckpoint;
+}
+
+//=============================================================================
+//=============================================================================
+void
+OtaSession::SetPacketTracer(
+    PacketTracer *ptrNewTracer
+    )
+{
+    //Sets the tracer which records the traffic of the session, which only records whilst it is enabled
+    ptrPacketTracer = ptrNewTracer;
+}
+
+//=============================================================================
+//=============================================================================
+quint8
+OtaSession::Stage(
+    )
+{
+    //Returns the current stage
+    return unStage;
+}
+
+//=============================================================================
+//=============================================================================
+const ModuleInformation &
+OtaSession::Information(
+    )
+{
+    //Returns the module details read by the last query
+    return mrpResponseParser.Information();
+}
+
+//=============================================================================
+//=============================================================================
+OtaSessionStatistics
+OtaSession::Statistics(
+    )
+{
+    //Returns what has been written to the module
+    OtaSessionStatistics ossStatistics;
+    ossStatistics.nFileSize = nFileSize;
+    ossStatistics.nFileOffset = nFileOffset;
+    ossStatistics.nWireSize = nSentSize;
+    ossStatistics.unPacketSize = unActivePacketSize;
+    ossStatistics.unFlowStops = unFlowStops;
+    ossStatistics.bSkipped = bSkipped;
+    return ossStatistics;
+}
+
+//=============================================================================
+//=============================================================================
+QString
+OtaSession::CaptureFilename(
+    )
+{
+    //Returns the file the recorded connection was saved to, empty if it was not recorded
+    return strCaptureFilename;
+}
+
+//=============================================================================
+//=============================================================================
+QString
+OtaSession::StageName(
+    quint8 unStage
+    )
+{
+    //Returns a short machine-readable name for a stage
+    switch (unStage)
+    {
+        case OTA_STAGE_IDLE:
+            return "idle";
+        case OTA_STAGE_SCANNING:
+            return "scanning";
+        case OTA_STAGE_CONNECTING:
+            return "connecting";
+        case OTA_STAGE_DISCOVERING:
+            return "discovering";
+        case OTA_STAGE_QUERYING:
+            return "querying";
+        case OTA_STAGE_XCOMPILING:
+            return "xcompiling";
+        case OTA_STAGE_COMPARING:
+            return "comparing";
+        case OTA_STAGE_TRANSFERRING:
+            return "transferring";
+        case OTA_STAGE_VERIFYING:
+            return "verifying";
+        case OTA_STAGE_COMPLETE:
+            return "complete";
+        default:
+            return "failed";
+    }
+}
+
+//=============================================================================
+//=============================================================================
+bool
+OtaSession::Matches(
+    const QBluetoothDeviceInfo &bdiDeviceInfo
+    )
+{
+    //Returns true if a device is the requested module
+    if (unStage != OTA_STAGE_SCANNING || !(bdiDeviceInfo.coreConfigurations() & QBluetoothDeviceInfo::LowEnergyCoreConfiguration))
+    {
+        return false;
+    }
+
+    if (!osoOptions.strAddress.isEmpty())
+    {
+        //Match by address, Apple platforms only expose a device UUID
+#ifdef Q_OS_MAC
+        QString strDeviceAddress = bdiDeviceInfo.deviceUuid().toString().remove('{').remove('}');
+#else
+        QString strDeviceAddress = bdiDeviceInfo.address().toString();
+#endif
+        return (strDeviceAddress.compare(QString(osoOptions.strAddress).remove('{').remove('}'), Qt::CaseInsensitive) == 0);
+    }
+    return rxpNamePattern.match(bdiDeviceInfo.name()).hasMatch();
+}
+
+//=============================================================================
+//=============================================================================
+void
+OtaSession::Connect(
+    const QBluetoothDeviceInfo &bdiDeviceInfo
+    )
+{
+    //Connects to the module once it has been found
+    if (unStage != OTA_STAGE_SCANNING)
+    {
+        return;
+    }
+
+    if (ddaDiscoveryAgent->isActive())
+    {
+        ddaDiscoveryAgent->stop();
+    }
+#ifdef Q_OS_MAC
+    strModuleAddress = bdiDeviceInfo.deviceUuid().toString();
+#else
+    strModuleAddress = bdiDeviceInfo.address().toString();
+#endif
+    VspTransport *vtpNewTransport = new BleVspTransport(bdiDeviceInfo);
+    if (!osoOptions.strCaptureDirectory.isEmpty())
+    {
+        //Record the connection so the session can be replayed
+        rvtRecorder = new RecordingVspTransport(vtpNewTransport);
+        vtpNewTransport = rvtRecorder;
+    }
+    Open(vtpNewTransport);
+}
+
+//=============================================================================
+//=============================================================================
+void
+OtaSession::Open(
+    VspTransport *vtpNewTransport
+    )
+{
+    //Continues the session over a transport to the module, which the session takes ownership of
+    if (unStage != OTA_STAGE_SCANNING || vtpTransport != NULL)
+    {
+        delete vtpNewTransport;
+        return;
+    }
+
+    if (strModuleAddress.isEmpty())
+    {
+        //Not connected by Connect(), the address given in the options (if any) identifies the module in the caches
+        strModuleAddress = osoOptions.strAddress;
+    }
+    SetStage(OTA_STAGE_CONNECTING);
+    Attach(vtpNewTransport, true);
+    vtpTransport->Open();
+}
+
+//=============================================================================
+//=============================================================================
+void
+OtaSession::DeviceDiscovered(
+    const QBluetoothDeviceInfo &bdiDeviceInfo
+    )
+{
+    //Bluetooth device detected, connect to it if it is the requested module
+    if (Matches(bdiDeviceInfo))
+    {
+        Connect(bdiDeviceInfo);
+    }
+}
+
+//=============================================================================
+//=============================================================================
+void
+OtaSession::ScanFinished(
+    )
+{
+    //Bluetooth scan finished, this is only reached if the module was not seen
+    if (unStage == OTA_STAGE_SCANNING)
+    {
+        Finish(false, "Module not found.");
+    }
+}
+
+//=============================================================================
+//=============================================================================
+void
+OtaSession::ScanError(
+    QBluetoothDeviceDiscoveryAgent::Error nErrorCode
+    )
+{
+    //Bluetooth scan error
+    if (unStage == OTA_STAGE_SCANNING && nErrorCode != QBluetoothDeviceDiscoveryAgent::NoError)
+    {
+        Finish(false, QString("Bluetooth scan error: ").append(ddaDiscoveryAgent->errorString()));
+    }
+}
+
+//=============================================================================
+//=============================================================================
+void
+OtaSession::TransportConnected(
+    )
+{
+    //Connected to the module, the VSP service is being discovered
+    if (unStage == OTA_STAGE_CONNECTING)
+    {
+        SetStage(OTA_STAGE_DISCOVERING);
+    }
+}
+
+//=============================================================================
+//=============================================================================
+void
+OtaSession::TransportOpened(
+    )
+{
+    //VSP service is ready
+    if (unStage == OTA_STAGE_DISCOVERING)
+    {
+        StartQuery();
+    }
+}
+
+//=============================================================================
+//=============================================================================
+void
+OtaSession::TransportClosed(
+    )
+{
+    //Module disconnected, which is only expected once the session has ended. An interrupted transfer is kept so it can be resumed
+    if (unStage != OTA_STAGE_IDLE && unStage != OTA_STAGE_COMPLETE && unStage != OTA_STAGE_FAILED)
+    {
+        SaveCheckpoint();
+        Finish(false, QString("Module disconnected whilst ").append(StageName(unStage)).append("."));
+    }
+}
+
+//=============================================================================
+//=============================================================================
+void
+OtaSession::TransportDataReceived(
+    QByteArray baData
+    )
+{
+    //Module output, each complete response advances the session
+    if (ptrPacketTracer != NULL)
+    {
+        ptrPacketTracer->Record(TRACE_EVENT_NOTIFY, baData.length());
+    }
+    if (tmrResponseTimeoutTimer.isActive())
+    {
+        //Restart timeout timer
+        tmrResponseTimeoutTimer.start();
+    }
+
+    QVector<ModuleResponse> vecResponses = mrpResponseParser.Parse(baData);
+    for (qint32 i = 0; i < vecResponses.count() && (unStage == OTA_STAGE_QUERYING || unStage == OTA_STAGE_COMPARING || unStage == OTA_STAGE_TRANSFERRING || unStage == OTA_STAGE_VERIFYING); ++i)
+    {
+        ModuleResponseReceived(vecResponses.at(i));
+    }
+}
+
+//=============================================================================
+//=============================================================================
+void
+OtaSession::TransportDataWritten(
+    qint32 nLength
+    )
+{
+    //Packet written to the module, packets streamed without response are accounted for when they are written
+    if (bWriteActive == false)
+    {
+        return;
+    }
+    bWriteActive = false;
+    if (ptrPacketTracer != NULL)
+    {
+        ptrPacketTracer->Record(TRACE_EVENT_WRITTEN, nLength);
+    }
+    if (bRestartActive == true)
+    {
+        //Restart command has been written, the session is complete
+        Finish(true, strResult);
+        return;
+    }
+    else if (bStreamingActive == true)
+    {
+        //Late response to the command written before streaming started, streamed packets are accounted for when they are written so nothing is consumed
+        baWritePacket.clear();
+        WriteNext();
+        return;
+    }
+
+    emit PacketWritten(baWritePacket);
+    baWritePacket.clear();
+    oqOutputQueue.Consume(nLength);
+    if (unStage == OTA_STAGE_TRANSFERRING || unStage == OTA_STAGE_VERIFYING)
+    {
+        //Update progress
+        nSentSize += nLength;
+        emit Progress(nSentSize, nTotalSize);
+
+        if (oqOutputQueue.Remaining() == 0)
+        {
+            //File data has been sent, the closing and verification commands are sent without waiting for responses
+            if (unStage == OTA_STAGE_TRANSFERRING)
+            {
+                SetStage(OTA_STAGE_VERIFYING);
+            }
+            if (oqOutputQueue.HasPendingCommands())
+            {
+                oqOutputQueue.LoadNextCommand();
+            }
+        }
+    }
+
+    if (tmrResponseTimeoutTimer.isActive())
+    {
+        //Restart timeout timer
+        tmrResponseTimeoutTimer.start();
+    }
+
+    //Write next part of data, if any is available
+    WriteNext();
+}
+
+//=============================================================================
+//=============================================================================
+void
+OtaSession::TransportFlowChanged(
+    bool bBlocked
+    )
+{
+    //Module has stopped or restarted the flow of data using the modem out characteristic
+    if (ptrPacketTracer != NULL)
+    {
+        ptrPacketTracer->Record(TRACE_EVENT_FLOW, (bBlocked == true ? 1 : 0));
+    }
+    bVSPBlocked = bBlocked;
+    if (bVSPBlocked == false)
+    {
+        WriteNext();
+    }
+    else
+    {
+        ++unFlowStops;
+    }
+}
+
+//=============================================================================
+//=============================================================================
+void
+OtaSession::TransportMTUChanged(
+    int nMTU
+    )
+{
+    //ATT MTU for the connection has changed (-1 if it is not known), the packet size follows it unless a fixed size was requested
+    if (osoOptions.unPacketSize == 0)
+    {
+        //Automatic: use the whole ATT payload, limited to what fits in a single data length extension packet
+        unActivePacketSize = (nMTU > BLE_DEFAULT_MTU ? nMTU : BLE_DEFAULT_MTU) - BLE_ATT_HEADER_SIZE;
+        if (unActivePacketSize > BLE_MAX_PACKET_SIZE)
+        {
+            unActivePacketSize = BLE_MAX_PACKET_SIZE;
+        }
+    }
+    else
+    {
+        //Fixed size
+        unActivePacketSize = osoOptions.unPacketSize;
+    }
+}
+
+//=============================================================================
+//=============================================================================
+void
+OtaSession::TransportError(
+    QString strMessage
+    )
+{
+    //Connection or VSP service error, an interrupted transfer is kept so it can be resumed
+    if (unStage != OTA_STAGE_IDLE && unStage != OTA_STAGE_COMPLETE && unStage != OTA_STAGE_FAILED)
+    {
+        SaveCheckpoint();
+        Finish(false, strMessage);
+    }
+}
+
+//=============================================================================
+//=============================================================================
+void
+OtaSession::XCompileComplete(
+    QString strKey,
+    bool bSuccess,
+    qint16 nErrorCode,
+    QByteArray baCompiledData
+    )
+{
+    //XCompile server response received, the cache reports completions for every session sharing it
+    if (strKey != strXCompileKey)
+    {
+        return;
+    }
+    if (unStage == OTA_STAGE_QUERYING)
+    {
+        //Completed before the module query, the result is used once the query completes
+        bXCompileReady = true;
+        bXCompileSuccess = bSuccess;
+        nXCompileErrorCode = nErrorCode;
+        baXCompiledData = baCompiledData;
+        return;
+    }
+    if (unStage == OTA_STAGE_XCOMPILING)
+    {
+        XCompileResult(bSuccess, nErrorCode, baCompiledData);
+    }
+}
+
+//=============================================================================
+//=============================================================================
+void
+OtaSession::XCompileResult(
+    bool bSuccess,
+    qint16 nErrorCode,
+    const QByteArray &baCompiledData
+    )
+{
+    //Loads the XCompiled application, or fails the session with the reason the XCompile failed
+    if (bSuccess == false)
+    {
+        //XCompilation failed
+        if (nErrorCode == DOWNLOAD_FILESIZE_ERROR)
+        {
+            Finish(false, QString("Invalid filesize, must be between ").append(QString::number(FILESIZE_MIN)).append(" - ").append(QString::number(FILESIZE_MAX)).append(" bytes."));
+        }
+        else if (nErrorCode == DOWNLOAD_JSON_ERROR)
+        {
+            Finish(false, "Error parsing HTTP response: JSON data not valid.");
+        }
+        else if (nErrorCode == DOWNLOAD_SERVER_ERROR)
+        {
+            Finish(false, QString("Server error: ").append(baCompiledData));
+        }
+        else if (nErrorCode == DOWNLOAD_XCOMPILE_ERROR)
+        {
+            Finish(false, QString("XCompilation error: ").append(baCompiledData));
+        }
+        else if (nErrorCode == DOWNLOAD_GENERAL_ERROR)
+        {
+            Finish(false, QString("HTTP Download error: ").append(baCompiledData));
+        }
+        else if (nErrorCode == DOWNLOAD_UNSUPPORTED_ERROR)
+        {
+            Finish(false, QString("XCompile error: ").append(baCompiledData));
+        }
+        else if (nErrorCode == DOWNLOAD_UNKNOWN_ERROR)
+        {
+            Finish(false, "Unknown error - is your ISP altering your network traffic?");
+        }
+        else
+        {
+            Finish(false, QString("HTTP error code: ").append(QString::number(nErrorCode)));
+        }
+        return;
+    }
+    else if (baCompiledData.isEmpty())
+    {
+        //Nothing was returned
+        Finish(false, "XCompilation returned no data.");
+        return;
+    }
+
+    StartCompare(baCompiledData);
+}
+
+//=============================================================================
+//=============================================================================
+void
+OtaSession::ResponseTimeout(
+    )
+{
+    //Timeout whilst awaiting the module, a stalled transfer is kept so it can be resumed after reconnecting
+    if (ptrPacketTracer != NULL)
+    {
+        ptrPacketTracer->Record(TRACE_EVENT_TIMER, TRACE_TIMER_RESPONSE);
+    }
+    SaveCheckpoint();
+    if (unStage == OTA_STAGE_QUERYING)
+    {
+        Finish(false, (bQueryOnly == true ? "Response timeout awaiting module query details - please ensure module is in hardware command mode VSP and retry." : "Response timeout awaiting module firmware details - please ensure module is in hardware command mode VSP and retry."));
+    }
+    else if (unStage == OTA_STAGE_COMPARING)
+    {
+        Finish(false, "Response timeout awaiting module file details - please ensure module is in hardware command mode VSP and retry.");
+    }
+    else if (unStage == OTA_STAGE_TRANSFERRING)
+    {
+        Finish(false, "Response timeout whilst downloading application to module - please try again.");
+    }
+    else if (unStage == OTA_STAGE_VERIFYING)
+    {
+        Finish(false, "Response timeout whilst attempting to verify application - please try again.");
+    }
+    else
+    {
+        Finish(false, QString("Response timeout whilst ").append(StageName(unStage)).append(" - ensure the module is in hardware command mode VSP and retry."));
+    }
+}
+
+//=============================================================================
+//=============================================================================
+void
+OtaSession::SetStage(
+    quint8 unNewStage
+    )
+{
+    //Moves to a new stage
+    unStage = unNewStage;
+    emit StageChanged(unStage);
+}
+
+//=============================================================================
+//=============================================================================
+void
+OtaSession::Finish(
+    bool bSuccess,
+    const QString &strMessage
+    )
+{
+    //Ends the session and disconnects from the module, unless the transport belongs to the caller
+    if (unStage == OTA_STAGE_COMPLETE || unStage == OTA_STAGE_FAILED)
+    {
+        return;
+    }
+
+    tmrResponseTimeoutTimer.stop();
+    bStreamingActive = false;
+    bWriteActive = false;
+    if (ddaDiscoveryAgent->isActive())
+    {
+        ddaDiscoveryAgent->stop();
+    }
+    oqOutputQueue.Clear();
+    cplCommandPipeline.Clear();
+    bRestartActive = false;
+    SetStage(bSuccess == true ? OTA_STAGE_COMPLETE : OTA_STAGE_FAILED);
+
+    if (rvtRecorder != NULL)
+    {
+        //Save the recording with the options needed to run the session against it again
+        rvtRecorder->Capture()->SetHeader(QJsonObject{{"version", APP_VERSION}, {"time", QDateTime::currentDateTime().toString(Qt::ISODate)}, {"address", strModuleAddress}, {"target", osoOptions.strTargetName},
+                                                       {"xcompile", osoOptions.bXCompile}, {"xcompile_key", strXCompileKey}, {"prefetch_xcompile", osoOptions.bPrefetchXCompile}, {"delete", osoOptions.bDeleteFile},
+                                                       {"verify", osoOptions.bVerifyFile}, {"skip_identical", osoOptions.bSkipIdentical}, {"restart", osoOptions.bRestart}, {"packet_size", osoOptions.unPacketSize},
+                                                       {"stream_writes", osoOptions.bStreamWrites}, {"stream_window", osoOptions.unStreamWindow}, {"command_window", osoOptions.unCommandWindow}, {"check_free_space", osoOptions.bCheckFreeSpace},
+                                                       {"skipped", bSkipped}, {"checksum", strChecksum}, {"file_size", nFileSize}, {"success", bSuccess}, {"message", strMessage}});
+        strCaptureFilename = QString(osoOptions.strCaptureDirectory).append('/').append(QString(strModuleAddress).remove(QRegularExpression("[^0-9A-Za-z]"))).append('-').append(QDateTime::currentDateTime().toString("yyyyMMdd-hhmmss")).append(CAPTURE_FILE_EXTENSION);
+        if (!rvtRecorder->Capture()->Save(strCaptureFilename))
+        {
+            strCaptureFilename.clear();
+        }
+    }
+
+    if (vtpTransport != NULL && bOwnsTransport == true)
+    {
+        //Disconnect from module
+        vtpTransport->Close();
+    }
+    else if (vtpTransport != NULL)
+    {
+        //The connection is left open for the caller
+        disconnect(vtpTransport, 0, this, 0);
+        vtpTransport = NULL;
+        rvtRecorder = NULL;
+    }
+    emit Finished(bSuccess, strMessage);
+}
+
+//=============================================================================
+//=============================================================================
+void
+OtaSession::StartQuery(
+    )
+{
+    //Reads the module details, unless they were read within the cache time to live. The query commands are sent one at a time
+    SetStage(OTA_STAGE_QUERYING);
+    mrpResponseParser.Reset();
+    oqOutputQueue.Clear();
+    strXCompileKey.clear();
+    bXCompileReady = false;
+    baXCompiledData.clear();
+
+    if (osoOptions.bXCompile == true)
+    {
+        //Open the connection to the XCompile server whilst the module is queried
+        xccXCompileCache->ConnectToServer(osoOptions.bSSL);
+    }
+
+    ModuleInformation mdiCached;
+    bModuleDetailsCached = (rvtRecorder == NULL && bQueryOnly == false && mscModuleCache->Lookup(strModuleAddress, mdiCached) && (osoOptions.bXCompile == false || !mdiCached.strXCompilerA.isEmpty())); //A recorded connection always reads the details, so it can be replayed without the cache
+    if (bModuleDetailsCached == true)
+    {
+        //Details are already known
+        mrpResponseParser.SetInformation(mdiCached);
+        emit Notice("Using module details from an earlier connection.");
+        QueryComplete();
+        return;
+    }
+
+    oqOutputQueue.AppendCommand("at i 0\r");
+    if (osoOptions.bXCompile == true)
+    {
+        //Language hashes are read early so the XCompile can start whilst the query continues
+        oqOutputQueue.AppendCommand("at i 13\r");
+    }
+    oqOutputQueue.AppendCommand("at i 3\r");
+    if (osoOptions.bCheckFreeSpace == true || bQueryOnly == true)
+    {
+        //Free space is only needed to check the application fits, or to show the module details
+        oqOutputQueue.AppendCommand("at i 6\r");
+    }
+    oqOutputQueue.LoadNextCommand();
+    tmrResponseTimeoutTimer.start();
+    WriteNext();
+}
+
+//=============================================================================
+//=============================================================================
+void
+OtaSession::QueryComplete(
+    )
+{
+    //Module details received, XCompile the application if needed and then load it. A slot connected to ModuleDetails() may cancel the session
+    const ModuleInformation &mdiInfo = mrpResponseParser.Information();
+    tmrResponseTimeoutTimer.stop();
+    if (bModuleDetailsCached == false)
+    {
+        mscModuleCache->Store(strModuleAddress, mdiInfo);
+    }
+    emit ModuleDetails(mdiInfo.strDevice, mdiInfo.strFirmware);
+    if (unStage != OTA_STAGE_QUERYING)
+    {
+        return;
+    }
+
+    if (bQueryOnly == true)
+    {
+        //Only the details were wanted
+        if (mdiInfo.strDevice.isEmpty() || mdiInfo.strFirmware.isEmpty() || mdiInfo.strStorageFree.isEmpty())
+        {
+            Finish(false, QString("Incomplete module information, Device: ").append(mdiInfo.strDevice).append(", Firmware: ").append(mdiInfo.strFirmware).append(", FreeSpace: ").append(mdiInfo.strStorageFree));
+            return;
+        }
+        Finish(true, "Received module information.");
+        return;
+    }
+
+    if (mdiInfo.strDevice.isEmpty() || (osoOptions.bCheckFreeSpace == true && mdiInfo.strStorageFree.isEmpty()) || (osoOptions.bXCompile == true && mdiInfo.strXCompilerA.isEmpty()))
+    {
+        //Issue with received data
+        Finish(false, QString("Incomplete module information, Device: ").append(mdiInfo.strDevice).append(", XCompiler: ").append(mdiInfo.strXCompilerA).append(" ").append(mdiInfo.strXCompilerB).append(", FreeSpace: ").append(mdiInfo.strStorageFree));
+        return;
+    }
+
+    if (osoOptions.bXCompile == true)
+    {
+        //Send the XCompilation request if it was not started whilst querying, the module is idle until it completes
+        if (strXCompileKey.isEmpty())
+        {
+            StartXCompile();
+        }
+        if (bXCompileReady == true)
+        {
+            //Already compiled whilst querying or by another session
+            bXCompileReady = false;
+            QByteArray baCompiledData = baXCompiledData;
+            baXCompiledData.clear();
+            XCompileResult(bXCompileSuccess, nXCompileErrorCode, baCompiledData);
+            return;
+        }
+        SetStage(OTA_STAGE_XCOMPILING);
+    }
+    else
+    {
+        //File is already compiled
+        StartCompare(osoOptions.baFileData);
+    }
+}
+
+//=============================================================================
+//=============================================================================
+void
+OtaSession::StartXCompile(
+    )
+{
+    //Requests the application compiled for the queried module, it is ready immediately if another session has already compiled it
+    const ModuleInformation &mdiInfo = mrpResponseParser.Information();
+    strXCompileKey = XCompileCache::Key(mdiInfo.strDevice, mdiInfo.strXCompilerA, mdiInfo.strXCompilerB, osoOptions.baFileData);
+    if (xccXCompileCache->Lookup(strXCompileKey, baXCompiledData))
+    {
+        //Already XCompiled for this module type and firmware, the XCompile server is not needed
+        emit Notice("Using cached XCompile result.");
+        bXCompileReady = true;
+        bXCompileSuccess = true;
+        nXCompileErrorCode = 0;
+        return;
+    }
+    xccXCompileCache->Request(strXCompileKey, mdiInfo.strDevice, mdiInfo.strXCompilerA, mdiInfo.strXCompilerB, osoOptions.baFileData, osoOptions.bSSL);
+}
+
+//=============================================================================
+//=============================================================================
+void
+OtaSession::StartCompare(
+    const QByteArray &baApplicationData
+    )
+{
+    //Reads the CRC of the last closed file and the file listing, if the module already has this application nothing needs to be written
+    if (rvtRecorder != NULL)
+    {
+        //Replaying needs the application which was loaded
+        rvtRecorder->Capture()->SetApplication(osoOptions.baFileData, (osoOptions.bXCompile == true ? baApplicationData : QByteArray()));
+    }
+
+    if (osoOptions.bSkipIdentical == false)
+    {
+        StartTransfer(baApplicationData);
+        return;
+    }
+
+    ChecksumCalculator chkChecksum;
+    chkChecksum.AddBlock(baApplicationData.constData(), baApplicationData.length());
+    strChecksum = chkChecksum.GetChecksumHexString();
+    baCompareData = baApplicationData;
+
+    //The module details are kept, only the CRC and listing are added to them
+    SetStage(OTA_STAGE_COMPARING);
+    oqOutputQueue.Clear();
+    oqOutputQueue.AppendCommand("at i 0xc12c\r");
+    oqOutputQueue.AppendCommand("at+dir\r");
+    oqOutputQueue.LoadNextCommand();
+    tmrResponseTimeoutTimer.start();
+    WriteNext();
+}
+
+//=============================================================================
+//=============================================================================
+void
+OtaSession::CompareComplete(
+    )
+{
+    //Finishes without writing anything if the target file exists, the last file closed has the CRC of the application and the module cache shows the last file closed
+    //was the target file with the size of the application. The CRC only belongs to the last file closed, which may have been another file with the same contents
+    const ModuleInformation &mdiInfo = mrpResponseParser.Information();
+    QByteArray baApplicationData = baCompareData;
+    baCompareData.clear();
+    if (!mdiInfo.strCRC.isEmpty() && mdiInfo.strCRC == strChecksum && mdiInfo.balFiles.contains(osoOptions.strTargetName.toUtf8()) && mscModuleCache->IsLastClosed(strModuleAddress, osoOptions.strTargetName, strChecksum, baApplicationData.length()))
+    {
+        //Already up to date
+        nFileSize = baApplicationData.length();
+        bSkipped = true;
+        emit Progress(nFileSize, nFileSize);
+        Finish(true, "OTA download skipped - file is already up to date (file & CRC match).");
+        return;
+    }
+    StartTransfer(baApplicationData);
+}
+
+//=============================================================================
+//=============================================================================
+void
+OtaSession::StartTransfer(
+    const QByteArray &baApplicationData
+    )
+{
+    //Encodes the application and starts writing it to the module
+    const ModuleInformation &mdiInfo = mrpResponseParser.Information();
+    if (osoOptions.bCheckFreeSpace == true && baApplicationData.length() > mdiInfo.strStorageFree.toInt() && bModuleDetailsCached == true)
+    {
+        //Free space from an earlier connection is an estimate, read it from the module (an XCompiled application is then ready from the XCompile cache)
+        mscModuleCache->Invalidate(strModuleAddress);
+        StartQuery();
+        return;
+    }
+    else if (osoOptions.bCheckFreeSpace == true && baApplicationData.length() > mdiInfo.strStorageFree.toInt())
+    {
+        //The file would not fit, a slot connected to InsufficientSpace() can choose to continue (or cancel), otherwise fail now
+        quint8 unCheckedStage = unStage;
+        tmrResponseTimeoutTimer.stop();
+        bIgnoreInsufficientSpace = false;
+        emit InsufficientSpace(baApplicationData.length(), mdiInfo.strStorageFree.toInt());
+        if (unStage != unCheckedStage)
+        {
+            return;
+        }
+        else if (bIgnoreInsufficientSpace == false)
+        {
+            Finish(false, QString("Insufficient module storage space, ").append(QString::number(baApplicationData.length())).append(" bytes are required but only ").append(mdiInfo.strStorageFree).append(" bytes are free."));
+            return;
+        }
+    }
+
+    //Create the file delete, open and writing data, calculating the checksum if it is being verified
+    OtaCommandEncoder ocEncoder;
+    quint8 unEncoderFormat = ocEncoder.SelectFormat(baApplicationData);
+    nFileSize = baApplicationData.length();
+    nFileOffset = 0;
+    SetStage(OTA_STAGE_TRANSFERRING);
+    mrpResponseParser.Reset();
+    oqOutputQueue.Clear();
+    oqOutputQueue.SetData(ocEncoder.EncodeFile(osoOptions.strTargetName, baApplicationData, osoOptions.bDeleteFile, osoOptions.bVerifyFile, unEncoderFormat));
+    cplCommandPipeline.SetCommands(ocEncoder.GetCommands(), osoOptions.unCommandWindow);
+    oqOutputQueue.SetLimit(cplCommandPipeline.SendLimit());
+    strChecksum = (osoOptions.bVerifyFile == true ? ocEncoder.GetChecksumHexString() : QString());
+    mscModuleCache->WriteStarted(strModuleAddress);
+    if (trcCheckpoint != NULL)
+    {
+        //Keep what is needed to resume the transfer if it is interrupted
+        trcCheckpoint->Start(osoOptions.strTargetName, baApplicationData, strChecksum, unEncoderFormat);
+    }
+    StartWriting();
+}
+
+//=============================================================================
+//=============================================================================
+void
+OtaSession::StartResume(
+    )
+{
+    //Closes the partially written file and reads its CRC, which shows how much of it the module wrote. Responses to the last commands sent before the link dropped
+    //may have been lost, so the module can have written more than it acknowledged
+    osoOptions.strTargetName = trcCheckpoint->Filename();
+    nFileSize = trcCheckpoint->FileData().length();
+    strChecksum = trcCheckpoint->Checksum();
+    bResuming = true;
+    unResumeStep = OTA_RESUME_CLOSING;
+    SetStage(OTA_STAGE_COMPARING);
+    mrpResponseParser.Reset();
+    oqOutputQueue.Clear();
+    oqOutputQueue.AppendCommand("at+fcl\r");
+    oqOutputQueue.AppendCommand("at i 0xc12c\r");
+    oqOutputQueue.LoadNextCommand();
+    tmrResponseTimeoutTimer.start();
+    WriteNext();
+}
+
+//=============================================================================
+//=============================================================================
+void
+OtaSession::ResumeResponseReceived(
+    const ModuleResponse &mrResponse
+    )
+{
+    //Advances the resume on a response line from the module. If the module does not report a CRC matching the data sent, or cannot open the file in append
+    //mode, the file is loaded again in full
+    if (mrResponse.unType == RESPONSE_TYPE_ERROR && unResumeStep == OTA_RESUME_READING)
+    {
+        //CRC is not supported, what the module wrote is unknown
+        ReloadFile("Module cannot report the CRC of the interrupted transfer");
+        return;
+    }
+    else if (mrResponse.unType == RESPONSE_TYPE_ERROR && unResumeStep == OTA_RESUME_OPENING)
+    {
+        //Firmware without append mode file open support
+        ReloadFile(QString("Module cannot append to the file (").append(mrResponse.baValue).append(") ").append(elErrorLookup.LookupError(mrResponse.unCode)));
+        return;
+    }
+    else if (mrResponse.unType != RESPONSE_TYPE_OK && mrResponse.unType != RESPONSE_TYPE_ERROR)
+    {
+        //Gathered by the parser
+        return;
+    }
+
+    if (unResumeStep == OTA_RESUME_CLOSING)
+    {
+        //File closed, read its CRC
+        unResumeStep = OTA_RESUME_READING;
+        oqOutputQueue.LoadNextCommand();
+        WriteNext();
+    }
+    else if (unResumeStep == OTA_RESUME_READING)
+    {
+        //Open the file in append mode after the data the module wrote
+        nFileOffset = ResumeOffset();
+        if (nFileOffset < 0)
+        {
+            ReloadFile("File on the module does not match the data sent");
+            return;
+        }
+        unResumeStep = OTA_RESUME_OPENING;
+        oqOutputQueue.AppendCommand(QByteArray(ENCODER_COMMAND_APPEND).append(trcCheckpoint->Filename().toUtf8()).append(ENCODER_COMMAND_END));
+        oqOutputQueue.LoadNextCommand();
+        WriteNext();
+    }
+    else
+    {
+        //File open, write the rest of the data
+        ContinueTransfer();
+    }
+}
+
+//=============================================================================
+//=============================================================================
+qint32
+OtaSession::ResumeOffset(
+    )
+{
+    //Returns the offset, out of those the interrupted transfer may have reached, whose CRC matches the one the module reported for the file, or -1 if none match.
+    //Once a transfer has been resumed the module may only include the data written since the file was opened in append mode, so that CRC is also checked
+    const QString &strModuleCRC = mrpResponseParser.Information().strCRC;
+    const QByteArray &baFileData = trcCheckpoint->FileData();
+    const QVector<qint32> &vecOffsets = trcCheckpoint->FileOffsets();
+    const qint32 nOpenOffset = trcCheckpoint->OpenOffset();
+    ChecksumCalculator chkFile;
+    ChecksumCalculator chkOpened;
+    qint32 nPosition = 0;
+    if (strModuleCRC.isEmpty())
+    {
+        return -1;
+    }
+
+    for (qint32 i = 0; i < vecOffsets.count(); ++i)
+    {
+        //Offsets are in order, each CRC continues from the previous one
+        qint32 nOffset = vecOffsets.at(i);
+        if (nOffset < nPosition || nOffset > baFileData.length())
+        {
+            break;
+        }
+        chkFile.AddBlock(baFileData.constData() + nPosition, nOffset - nPosition);
+        if (nOffset > nOpenOffset)
+        {
+            qint32 nOpenedStart = (nPosition > nOpenOffset ? nPosition : nOpenOffset);
+            chkOpened.AddBlock(baFileData.constData() + nOpenedStart, nOffset - nOpenedStart);
+        }
+        nPosition = nOffset;
+        if (strModuleCRC == chkFile.GetChecksumHexString() || (nOpenOffset > 0 && nOffset >= nOpenOffset && strModuleCRC == chkOpened.GetChecksumHexString()))
+        {
+            return nOffset;
+        }
+    }
+    return -1;
+}
+
+//=============================================================================
+//=============================================================================
+void
+OtaSession::ContinueTransfer(
+    )
+{
+    //Writes the rest of the data to the file the module has opened in append mode, the CRC is then verified
+    OtaCommandEncoder ocEncoder;
+    bResuming = false;
+    SetStage(OTA_STAGE_TRANSFERRING);
+    mrpResponseParser.Reset();
+    oqOutputQueue.Clear();
+    oqOutputQueue.SetData(ocEncoder.EncodeFile(trcCheckpoint->Filename(), trcCheckpoint->FileData(), false, true, trcCheckpoint->Format(), nFileOffset));
+    cplCommandPipeline.SetCommands(ocEncoder.GetCommands(), osoOptions.unCommandWindow);
+    oqOutputQueue.SetLimit(cplCommandPipeline.SendLimit());
+    strAppendChecksum = ocEncoder.GetChecksumHexString();
+    trcCheckpoint->Reopen(nFileOffset);
+    mscModuleCache->WriteStarted(strModuleAddress);
+    StartWriting();
+}
+
+//=============================================================================
+//=============================================================================
+void
+OtaSession::ReloadFile(
+    const QString &strReason
+    )
+{
+    //The interrupted transfer cannot be resumed, so the file is deleted and written again from the start. Free space is not checked as it was not read and the
+    //partly written file is deleted first
+    QByteArray baApplicationData = trcCheckpoint->FileData();
+    emit Notice(QString(strReason).append(", loading it again in full."));
+    bResuming = false;
+    osoOptions.bDeleteFile = true;
+    osoOptions.bVerifyFile = true;
+    osoOptions.bCheckFreeSpace = false;
+    StartTransfer(baApplicationData);
+}
+
+//=============================================================================
+//=============================================================================
+void
+OtaSession::StartWriting(
+    )
+{
+    //Adds the closing and verification commands to the encoded file data and starts writing it, streaming the data without response if enabled and the module has flow control
+    oqOutputQueue.AppendCommand("at+fcl\r");
+
+    if (!strChecksum.isEmpty())
+    {
+        //Add commands for verifying file exists and was transferred successfully
+        oqOutputQueue.AppendCommand("at i 0xc12c\r");
+        oqOutputQueue.AppendCommand("at+dir\r");
+    }
+    else
+    {
+        //Send dummy command
+        oqOutputQueue.AppendCommand("at i 1\r");
+    }
+
+    //The total size is that of the encoded data, not just the application
+    nSentSize = 0;
+    nTotalSize = oqOutputQueue.Remaining() + oqOutputQueue.PendingCommandsLength();
+    emit Progress(nSentSize, nTotalSize);
+
+    //Start writing the data
+    bPipelineStalled = false;
+    bStreamingActive = (osoOptions.bStreamWrites == true && vtpTransport->CanStream());
+    tmrResponseTimeoutTimer.start();
+    if (oqOutputQueue.Remaining() == 0)
+    {
+        //A resumed transfer where the module already has all of the file data, only the closing and verification commands are sent
+        bStreamingActive = false;
+        SetStage(OTA_STAGE_VERIFYING);
+        oqOutputQueue.LoadNextCommand();
+    }
+    WriteNext();
+}
+
+//=============================================================================
+//=============================================================================
+void
+OtaSession::WriteNext(
+    )
+{
+    //Writes the next packet unless one is in flight, the module has stopped the flow or the command window is full
+    if (bStreamingActive == true)
+    {
+        StreamNext();
+        return;
+    }
+    if (bWriteActive == true || bVSPBlocked == true || vtpTransport == NULL)
+    {
+        return;
+    }
+    if (oqOutputQueue.Available() <= 0)
+    {
+        if (unStage == OTA_STAGE_TRANSFERRING && oqOutputQueue.Remaining() > 0 && bPipelineStalled == false)
+        {
+            //Command window is full, sending resumes when the module acknowledges commands
+            bPipelineStalled = true;
+            emit PipelineStalled();
+        }
+        return;
+    }
+
+    bWriteActive = true;
+    bPipelineStalled = false;
+    baWritePacket = oqOutputQueue.NextPacket(unActivePacketSize);
+    if (ptrPacketTracer != NULL)
+    {
+        ptrPacketTracer->Record(TRACE_EVENT_WRITE, baWritePacket.length());
+    }
+    vtpTransport->Write(baWritePacket);
+}
+
+//=============================================================================
+//=============================================================================
+void
+OtaSession::StreamNext(
+    )
+{
+    //Writes packets without response whilst they are within the stream window of the commands the module has acknowledged, until the module stops the flow or all
+    //file data has been sent. Each acknowledgement from the module, and the module restarting the flow, opens the window again
+    if (vtpTransport == NULL)
+    {
+        return;
+    }
+
+    qint32 nStreamLimit = cplCommandPipeline.StreamLimit((qint32)osoOptions.unStreamWindow * unActivePacketSize);
+    while (unStage == OTA_STAGE_TRANSFERRING && bVSPBlocked == false && (nStreamLimit < 0 || nSentSize < nStreamLimit) && oqOutputQueue.Available() > 0)
+    {
+        QByteArray baPacket = oqOutputQueue.NextPacket(unActivePacketSize);
+        if (ptrPacketTracer != NULL)
+        {
+            ptrPacketTracer->Record(TRACE_EVENT_WRITE_STREAM, baPacket.length());
+        }
+        vtpTransport->Stream(baPacket);
+        oqOutputQueue.Consume(baPacket.length());
+        nSentSize += baPacket.length();
+        bPipelineStalled = false;
+        emit PacketWritten(baPacket);
+    }
+    if (unStage != OTA_STAGE_TRANSFERRING)
+    {
+        return;
+    }
+    emit Progress(nSentSize, nTotalSize);
+
+    if (tmrResponseTimeoutTimer.isActive())
+    {
+        //Restart timeout timer
+        tmrResponseTimeoutTimer.start();
+    }
+
+    if (oqOutputQueue.Remaining() == 0)
+    {
+        //All file data has been streamed, the closing and verification commands use acknowledged writes
+        bStreamingActive = false;
+        SetStage(OTA_STAGE_VERIFYING);
+        if (oqOutputQueue.HasPendingCommands())
+        {
+            oqOutputQueue.LoadNextCommand();
+        }
+        WriteNext();
+    }
+    else if (oqOutputQueue.Available() == 0 && bPipelineStalled == false)
+    {
+        //Command window is full, sending resumes when the module acknowledges commands
+        bPipelineStalled = true;
+        emit PipelineStalled();
+    }
+}
+
+//=============================================================================
+//=============================================================================
+void
+OtaSession::SaveCheckpoint(
+    )
+{
+    //Saves how much of the file the module may have written, including a packet whose write had not completed, so an interrupted transfer can be resumed on reconnection
+    if (trcCheckpoint != NULL && (unStage == OTA_STAGE_TRANSFERRING || unStage == OTA_STAGE_VERIFYING))
+    {
+        trcCheckpoint->Save(strModuleAddress, cplCommandPipeline.WrittenFileOffsets(nSentSize + baWritePacket.length(), trcCheckpoint->FileData().length()));
+    }
+}
+
+//=============================================================================
+//=============================================================================
+void
+OtaSession::ModuleResponseReceived(
+    const ModuleResponse &mrResponse
+    )
+{
+    //Advances the session on a response line from the module
+    if (unStage == OTA_STAGE_QUERYING)
+    {
+        //Waiting for module details
+        if (mrResponse.unType == RESPONSE_TYPE_ERROR)
+        {
+            //Error detected
+            mscModuleCache->Invalidate(strModuleAddress);
+            Finish(false, QString("Error during module query (").append(mrResponse.baValue).append(") ").append(elErrorLookup.LookupError(mrResponse.unCode)));
+            return;
+        }
+        else if (mrResponse.unType != RESPONSE_TYPE_OK)
+        {
+            //Information is gathered by the parser, nothing to do until the command completes
+            return;
+        }
+
+        const ModuleInformation &mdiInfo = mrpResponseParser.Information();
+        if (osoOptions.bXCompile == true && osoOptions.bPrefetchXCompile == true && strXCompileKey.isEmpty() && !mdiInfo.strDevice.isEmpty() && !mdiInfo.strXCompilerA.isEmpty())
+        {
+            //Language hashes received, XCompile whilst the remaining details are read from the module
+            StartXCompile();
+        }
+
+        if (oqOutputQueue.Remaining() == 0 && oqOutputQueue.HasPendingCommands())
+        {
+            //Command completed successfully, send next command
+            oqOutputQueue.LoadNextCommand();
+            WriteNext();
+        }
+        else if (oqOutputQueue.IsEmpty() && !oqOutputQueue.HasPendingCommands())
+        {
+            //All details received
+            QueryComplete();
+        }
+        return;
+    }
+    else if (unStage == OTA_STAGE_COMPARING && bResuming == true)
+    {
+        //Checking how much of an interrupted transfer the module wrote
+        ResumeResponseReceived(mrResponse);
+        return;
+    }
+    else if (unStage == OTA_STAGE_COMPARING)
+    {
+        //Waiting for the CRC and file listing, an error (older firmware without CRC support) only means the file is loaded
+        if (mrResponse.unType == RESPONSE_TYPE_ERROR)
+        {
+            QByteArray baApplicationData = baCompareData;
+            baCompareData.clear();
+            StartTransfer(baApplicationData);
+            return;
+        }
+        else if (mrResponse.unType != RESPONSE_TYPE_OK)
+        {
+            //Gathered by the parser
+            return;
+        }
+
+        if (oqOutputQueue.Remaining() == 0 && oqOutputQueue.HasPendingCommands())
+        {
+            //Command completed successfully, send next command
+            oqOutputQueue.LoadNextCommand();
+            WriteNext();
+        }
+        else if (oqOutputQueue.IsEmpty() && !oqOutputQueue.HasPendingCommands())
+        {
+            //CRC and listing received
+            CompareComplete();
+        }
+        return;
+    }
+
+    //Transferring or verifying
+    if (mrResponse.unType == RESPONSE_TYPE_ERROR)
+    {
+        //An error has occured, the first unacknowledged command is the one which failed
+        qint32 nFailedOffset = cplCommandPipeline.FailedFileOffset();
+        mscModuleCache->Invalidate(strModuleAddress);
+        if (trcCheckpoint != NULL)
+        {
+            trcCheckpoint->Clear();
+        }
+        QString strMessage = QString("Error during download (").append(mrResponse.baValue).append(") ").append(elErrorLookup.LookupError(mrResponse.unCode));
+        if (nFailedOffset >= 0)
+        {
+            //Error was in a file write command
+            strMessage.append(QString(" at byte offset %1 of %2.").arg(nFailedOffset).arg(nFileSize));
+        }
+        Finish(false, strMessage);
+        return;
+    }
+
+    if (mrResponse.unType == RESPONSE_TYPE_OK && cplCommandPipeline.Acknowledge() == true)
+    {
+        //File command acknowledged, more can be sent
+        oqOutputQueue.SetLimit(cplCommandPipeline.SendLimit());
+        WriteNext();
+        return;
+    }
+
+    if (unStage != OTA_STAGE_VERIFYING)
+    {
+        return;
+    }
+
+    if (!strChecksum.isEmpty())
+    {
+        //The success response to at+dir (after those for at+fcl and at i 0xc12c) completes the verification
+        if (mrResponse.unType == RESPONSE_TYPE_OK && cplCommandPipeline.TrailingAcknowledged() == VERIFY_TRAILING_RESPONSES)
+        {
+            VerifyComplete();
+        }
+    }
+    else if (mrResponse.unType == RESPONSE_TYPE_INFO && mrResponse.unCode == RESPONSE_INFO_DUMMY)
+    {
+        //The at i 1 response shows the data has finished transferring
+        VerifyComplete();
+    }
+}
+
+//=============================================================================
+//=============================================================================
+void
+OtaSession::VerifyComplete(
+    )
+{
+    //All commands have completed, check the file and then restart or disconnect from the module
+    const ModuleInformation &mdiInfo = mrpResponseParser.Information();
+    if (!strChecksum.isEmpty())
+    {
+        if (!mdiInfo.strCRC.isEmpty() && mdiInfo.strCRC != strChecksum && (strAppendChecksum.isEmpty() || mdiInfo.strCRC != strAppendChecksum))
+        {
+            //Module supports CRC checking and the verification test has failed
+            mscModuleCache->Invalidate(strModuleAddress);
+            Finish(false, QString("OTA download failed - checksum failure, expected 0x").append(strChecksum).append(" got 0x").append(mdiInfo.strCRC).append("."));
+            return;
+        }
+        else if (!mdiInfo.balFiles.contains(osoOptions.strTargetName.toUtf8()))
+        {
+            //File is missing
+            mscModuleCache->Invalidate(strModuleAddress);
+            Finish(false, "OTA download failed - file is missing.");
+            return;
+        }
+        strResult = (mdiInfo.strCRC.isEmpty() ? "OTA download complete - file verified (CRC unsupported)!" : "OTA download complete - file & CRC verified!");
+        if (mdiInfo.strCRC == strChecksum)
+        {
+            //The CRC of the last closed file is now that of the target file, a later load of the same application can be skipped
+            mscModuleCache->FileVerified(strModuleAddress, osoOptions.strTargetName, strChecksum, nFileSize);
+        }
+    }
+    else
+    {
+        //Not verified
+        strResult = "OTA download complete!";
+    }
+    mscModuleCache->WriteComplete(strModuleAddress, nFileSize);
+    if (trcCheckpoint != NULL)
+    {
+        trcCheckpoint->Clear();
+    }
+
+    if (osoOptions.bRestart == true)
+    {
+        //Restart the module, the session completes once the command has been written. Its details are read again after a restart
+        mscModuleCache->Invalidate(strModuleAddress);
+        tmrResponseTimeoutTimer.start();
+        bRestartActive = true;
+        bWriteActive = true;
+        if (ptrPacketTracer != NULL)
+        {
+            ptrPacketTracer->Record(TRACE_EVENT_WRITE, 4);
+        }
+        vtpTransport->Write("atz\r");
+    }
+    else
+    {
+        Finish(true, strResult);
+    }
+}
+
+/******************************************************************************/
+// END OF FILE
+/******************************************************************************/
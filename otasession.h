@@ -0,0 +1,419 @@
+/******************************************************************************
+** Copyright (C) 2018 Laird
+**
+** Project: UwVSP-OTA
+**
+** Module: otasession.h
+**
+** Notes:
+**
+** License: This program is free software: you can redistribute it and/or
+**          modify it under the terms of the GNU General Public License as
+**          published by the Free Software Foundation, version 3.
+**
+**          This program is distributed in the hope that it will be useful,
+**          but WITHOUT ANY WARRANTY; without even the implied warranty of
+**          MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+**          GNU General Public License for more details.
+**
+**          You should have received a copy of the GNU General Public License
+**          along with this program.  If not, see http://www.gnu.org/licenses/
+**
+*******************************************************************************/
+#ifndef OTASESSION_H
+#define OTASESSION_H
+
+/******************************************************************************/
+// Include Files
+/******************************************************************************/
+#include <QObject>
+#include <QTimer>
+#include <QRegularExpression>
+#include <QDateTime>
+#include <QJsonObject>
+#include <QBluetoothDeviceDiscoveryAgent>
+#include <QBluetoothDeviceInfo>
+#include "vsptransport.h"
+#include "blevsptransport.h"
+#include "recordingvsptransport.h"
+#include "xcompilecache.h"
+#include "modulestatecache.h"
+#include "otacommandencoder.h"
+#include "outputqueue.h"
+#include "commandpipeline.h"
+#include "moduleresponseparser.h"
+#include "errorlookup.h"
+#include "packettracer.h"
+#include "transfercheckpoint.h"
+#include "target.h"
+
+/******************************************************************************/
+// Constants
+/******************************************************************************/
+//Stages of an OTA session
+const quint8 OTA_STAGE_IDLE              = 0;
+const quint8 OTA_STAGE_SCANNING          = 1;
+const quint8 OTA_STAGE_CONNECTING        = 2;
+const quint8 OTA_STAGE_DISCOVERING       = 3;
+const quint8 OTA_STAGE_QUERYING          = 4;
+const quint8 OTA_STAGE_XCOMPILING        = 5;
+const quint8 OTA_STAGE_COMPARING         = 6;
+const quint8 OTA_STAGE_TRANSFERRING      = 7;
+const quint8 OTA_STAGE_VERIFYING         = 8;
+const quint8 OTA_STAGE_COMPLETE          = 9;
+const quint8 OTA_STAGE_FAILED            = 10;
+
+//Steps of checking how much of an interrupted transfer the module wrote, which happens in the comparing stage
+const quint8 OTA_RESUME_CLOSING          = 0; //at+fcl, an error is ignored as the file may already be closed
+const quint8 OTA_RESUME_READING          = 1; //at i 0xc12c
+const quint8 OTA_RESUME_OPENING          = 2; //AT+foa, which not every firmware supports
+
+/******************************************************************************/
+// Structures
+/******************************************************************************/
+//What to load and where, the defaults match those of the application settings
+struct OtaSessionOptions
+{
+    QString strAddress;         //Bluetooth address (or device UUID on Apple platforms) of the module, empty to match by name
+    QString strNamePattern;     //Regular expression matched against advertised names if no address is given
+    QByteArray baFileData;      //Compiled application, or smartBASIC source if it is to be XCompiled
+    QString strTargetName;      //Name of the file on the module
+    bool bXCompile = false;     //True to XCompile the file data online for the module
+    bool bPrefetchXCompile = SETTINGS_VALUE_PREFETCHXCOMP; //True to start the XCompile as soon as the language hashes are read, whilst the query continues
+    bool bSSL = SETTINGS_VALUE_SSL;
+    bool bDeleteFile = SETTINGS_VALUE_DELFILE;
+    bool bVerifyFile = SETTINGS_VALUE_VERIFYFILE;
+    bool bSkipIdentical = SETTINGS_VALUE_SKIPIDENTICAL; //True to leave the file alone if the module cache shows it was the last file verified on the module, with the same CRC and size
+    bool bCheckFreeSpace = SETTINGS_VALUE_CHECKFREESPACE; //True to read the free space of the module and check the application fits
+    bool bRestart = false;      //True to restart the module once loaded instead of disconnecting
+    quint16 unPacketSize = SETTINGS_VALUE_PACKETSIZE;
+    bool bStreamWrites = SETTINGS_VALUE_STREAMWRITES; //True to write the file data without response if the module has flow control
+    quint8 unStreamWindow = SETTINGS_VALUE_STREAMWINDOW; //Number of packets which can be streamed ahead of the commands the module has acknowledged
+    quint8 unCommandWindow = SETTINGS_VALUE_COMMANDWINDOW;
+    quint32 unScanTimeout = TIMEOUT_BLE_SCAN;
+    QString strCaptureDirectory; //Directory the connection to the module is recorded to so the session can be replayed, empty to not record it
+};
+
+//What was written to the module by a session
+struct OtaSessionStatistics
+{
+    qint32 nFileSize;     //Size of the application, 0 if the session did not reach the transfer
+    qint32 nFileOffset;   //Offset in the application the transfer resumed from, 0 if it was not resumed
+    qint32 nWireSize;     //Encoded data and commands written during the transfer
+    quint16 unPacketSize; //Size of packets written to the RX characteristic
+    quint32 unFlowStops;  //Number of times the module stopped the flow using the modem out characteristic
+    bool bSkipped;        //True if nothing was written as the module already had the application
+};
+
+/******************************************************************************/
+// Class definitions
+/******************************************************************************/
+class OtaSession : public QObject
+{
+    Q_OBJECT
+public:
+    explicit
+    OtaSession(
+        QObject *parent = nullptr
+        );
+    ~OtaSession(
+        );
+    void
+    Start(
+        const OtaSessionOptions &osoNewOptions,
+        bool bScan = true
+        );
+    bool
+    Matches(
+        const QBluetoothDeviceInfo &bdiDeviceInfo
+        );
+    void
+    Connect(
+        const QBluetoothDeviceInfo &bdiDeviceInfo
+        );
+    void
+    Open(
+        VspTransport *vtpNewTransport
+        );
+    void
+    Load(
+        const OtaSessionOptions &osoNewOptions,
+        VspTransport *vtpOpenTransport,
+        const QString &strAddress
+        );
+    void
+    Query(
+        VspTransport *vtpOpenTransport,
+        const QString &strAddress
+        );
+    void
+    Resume(
+        const OtaSessionOptions &osoNewOptions,
+        VspTransport *vtpOpenTransport,
+        const QString &strAddress
+        );
+    void
+    Cancel(
+        const QString &strReason = "Cancelled."
+        );
+    void
+    IgnoreInsufficientSpace(
+        );
+    void
+    SetXCompileCache(
+        XCompileCache *xccNewCache
+        );
+    void
+    SetModuleStateCache(
+        ModuleStateCache *mscNewCache
+        );
+    void
+    SetTransferCheckpoint(
+        TransferCheckpoint *trcNewCheckpoint
+        );
+    void
+    SetPacketTracer(
+        PacketTracer *ptrNewTracer
+        );
+    quint8
+    Stage(
+        );
+    const ModuleInformation &
+    Information(
+        );
+    OtaSessionStatistics
+    Statistics(
+        );
+    QString
+    CaptureFilename(
+        );
+    static QString
+    StageName(
+        quint8 unStage
+        );
+
+signals:
+    void
+    StageChanged(
+        quint8 unStage
+        );
+    void
+    Progress(
+        qint32 nSent,
+        qint32 nTotal
+        );
+    void
+    ModuleDetails(
+        QString strDevice,
+        QString strFirmware
+        );
+    void
+    InsufficientSpace(
+        qint32 nRequired,
+        qint32 nFree
+        );
+    void
+    PacketWritten(
+        QByteArray baData
+        );
+    void
+    PipelineStalled(
+        );
+    void
+    Notice(
+        QString strMessage
+        );
+    void
+    Finished(
+        bool bSuccess,
+        QString strMessage
+        );
+
+private slots:
+    void
+    DeviceDiscovered(
+        const QBluetoothDeviceInfo &bdiDeviceInfo
+        );
+    void
+    ScanFinished(
+        );
+    void
+    ScanError(
+        QBluetoothDeviceDiscoveryAgent::Error nErrorCode
+        );
+    void
+    TransportConnected(
+        );
+    void
+    TransportOpened(
+        );
+    void
+    TransportClosed(
+        );
+    void
+    TransportDataReceived(
+        QByteArray baData
+        );
+    void
+    TransportDataWritten(
+        qint32 nLength
+        );
+    void
+    TransportFlowChanged(
+        bool bBlocked
+        );
+    void
+    TransportMTUChanged(
+        int nMTU
+        );
+    void
+    TransportError(
+        QString strMessage
+        );
+    void
+    XCompileComplete(
+        QString strKey,
+        bool bSuccess,
+        qint16 nErrorCode,
+        QByteArray baCompiledData
+        );
+    void
+    ResponseTimeout(
+        );
+
+private:
+    bool
+    Prepare(
+        const OtaSessionOptions &osoNewOptions
+        );
+    void
+    Attach(
+        VspTransport *vtpNewTransport,
+        bool bOwned
+        );
+    void
+    SetStage(
+        quint8 unNewStage
+        );
+    void
+    Finish(
+        bool bSuccess,
+        const QString &strMessage
+        );
+    void
+    StartQuery(
+        );
+    void
+    QueryComplete(
+        );
+    void
+    StartXCompile(
+        );
+    void
+    XCompileResult(
+        bool bSuccess,
+        qint16 nErrorCode,
+        const QByteArray &baCompiledData
+        );
+    void
+    StartCompare(
+        const QByteArray &baApplicationData
+        );
+    void
+    CompareComplete(
+        );
+    void
+    StartTransfer(
+        const QByteArray &baApplicationData
+        );
+    void
+    StartResume(
+        );
+    void
+    ResumeResponseReceived(
+        const ModuleResponse &mrResponse
+        );
+    qint32
+    ResumeOffset(
+        );
+    void
+    ContinueTransfer(
+        );
+    void
+    ReloadFile(
+        const QString &strReason
+        );
+    void
+    StartWriting(
+        );
+    void
+    WriteNext(
+        );
+    void
+    StreamNext(
+        );
+    void
+    SaveCheckpoint(
+        );
+    void
+    ModuleResponseReceived(
+        const ModuleResponse &mrResponse
+        );
+    void
+    VerifyComplete(
+        );
+
+    OtaSessionOptions osoOptions;
+    quint8 unStage;
+    bool bOwnsTransport;   //True if the session opened vtpTransport and closes it when finished, false if it belongs to the caller
+    bool bQueryOnly;       //True if the module details are being read without loading a file
+    bool bVSPBlocked;      //True if the module has stopped the flow of data using the modem out characteristic
+    bool bWriteActive;     //True if a write is waiting for the Bluetooth stack to complete it
+    bool bStreamingActive; //True if the file data is being written without response
+    bool bPipelineStalled; //True if sending has paused until the module acknowledges outstanding commands
+    bool bRestartActive;   //True if the module is being restarted after a successful load
+    bool bIgnoreInsufficientSpace; //Set by IgnoreInsufficientSpace() from a slot connected to InsufficientSpace()
+    bool bSkipped;         //True if the module already had the application
+    bool bResuming;        //True whilst the module is checked for how much of an interrupted transfer it wrote
+    quint8 unResumeStep;   //Command being run whilst resuming (OTA_RESUME_*)
+    quint16 unActivePacketSize; //Size of packets written to the RX characteristic
+    qint32 nTotalSize;     //Size of the encoded transfer
+    qint32 nSentSize;      //Amount of the encoded transfer which has been written
+    qint32 nFileSize;      //Size of the application being loaded
+    qint32 nFileOffset;    //Offset in the application the transfer resumed from
+    quint32 unFlowStops;   //Number of times the module has stopped the flow of data
+    QByteArray baWritePacket; //Packet waiting for the Bluetooth stack to complete its write
+    QString strChecksum;   //Expected CRC of the application, empty if it is not being verified
+    QString strAppendChecksum; //Expected CRC of the data written since a resumed transfer re-opened the file, empty if it was not resumed
+    QString strResult;     //Message reported once the module has restarted
+    QString strXCompileKey; //Key of the application being XCompiled
+    QString strModuleAddress; //Address (or device UUID) of the module, empty if it is not connected over Bluetooth
+    bool bModuleDetailsCached; //True if the module details came from mscModuleCache instead of the module
+    bool bXCompileReady;   //True if the XCompile completed before the query, the result is held below until the query completes
+    bool bXCompileSuccess;
+    qint16 nXCompileErrorCode;
+    QByteArray baXCompiledData;
+    QByteArray baCompareData; //Application held whilst the file on the module is compared with it
+
+    QBluetoothDeviceDiscoveryAgent *ddaDiscoveryAgent;
+    VspTransport *vtpTransport;
+    RecordingVspTransport *rvtRecorder; //vtpTransport if the connection is being recorded, otherwise NULL
+    QString strCaptureFilename; //File the recorded connection was saved to, empty if none
+    QRegularExpression rxpNamePattern;
+    QTimer tmrResponseTimeoutTimer;
+
+    XCompileCache *xccXCompileCache; //Compiled applications, which can be shared with other sessions
+    ModuleStateCache *mscModuleCache; //Module details from earlier connections, which can be shared with other sessions
+    TransferCheckpoint *trcCheckpoint; //Where an interrupted transfer is kept so it can be resumed, NULL if transfers are not resumed
+    PacketTracer *ptrPacketTracer; //Records writes, notifications, flow control and timers, NULL if not traced
+    OutputQueue oqOutputQueue;
+    CommandPipeline cplCommandPipeline;
+    ModuleResponseParser mrpResponseParser;
+    ErrorLookup elErrorLookup;
+};
+
+#endif // OTASESSION_H
+
+/******************************************************************************/
+// END OF FILE
+/******************************************************************************/
@@ -0,0 +1,335 @@
+/******************************************************************************
+** Copyright (C) 2018 Laird
+**
+** Project: UwVSP-OTA
+**
+** Module: otasessionmanager.cpp
+**
+** Notes:
+**
+** License: This program is free software: you can redistribute it and/or
+**          modify it under the terms of the GNU General Public License as
+**          published by the Free Software Foundation, version 3.
+**
+**          This program is distributed in the hope that it will be useful,
+**          but WITHOUT ANY WARRANTY; without even the implied warranty of
+**          MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+**          GNU General Public License for more details.
+**
+**          You should have received a copy of the GNU General Public License
+**          along with this program.  If not, see http://www.gnu.org/licenses/
+**
+*******************************************************************************/
+#include "otasessionmanager.h"
+
+//=============================================================================
+//=============================================================================
+OtaSessionManager::OtaSessionManager(QObject *parent) : QObject(parent)
+{
+    //Constructor
+    nSucceeded = 0;
+    nFailed = 0;
+
+    //A single scan finds the modules for all sessions, as most adapters only allow one scan at a time
+    ddaDiscoveryAgent = new QBluetoothDeviceDiscoveryAgent(this);
+    connect(ddaDiscoveryAgent, SIGNAL(deviceDiscovered(QBluetoothDeviceInfo)), this, SLOT(DeviceDiscovered(QBluetoothDeviceInfo)));
+    connect(ddaDiscoveryAgent, SIGNAL(error(QBluetoothDeviceDiscoveryAgent::Error)), this, SLOT(ScanError(QBluetoothDeviceDiscoveryAgent::Error)));
+    connect(ddaDiscoveryAgent, SIGNAL(finished()), this, SLOT(ScanFinished()));
+}
+
+//=============================================================================
+//=============================================================================
+OtaSessionManager::~OtaSessionManager(
+    )
+{
+    //Destructor
+    if (ddaDiscoveryAgent->isActive())
+    {
+        ddaDiscoveryAgent->stop();
+    }
+    qDeleteAll(lstSessions);
+    lstSessions.clear();
+}
+
+//=============================================================================
+//=============================================================================
+void
+OtaSessionManager::Start(
+    const QList<OtaSessionOptions> &lstOptions,
+    quint32 unScanTimeout
+    )
+{
+    //Starts a session for each set of options, sessions run in parallel once their module has been found
+    if (ddaDiscoveryAgent->isActive())
+    {
+        return;
+    }
+    for (qint32 i = 0; i < lstSessions.count(); ++i)
+    {
+        quint8 unStage = lstSessions.at(i)->Stage();
+        if (unStage != OTA_STAGE_IDLE && unStage != OTA_STAGE_COMPLETE && unStage != OTA_STAGE_FAILED)
+        {
+            //Sessions are still in progress
+            return;
+        }
+    }
+
+    qDeleteAll(lstSessions);
+    lstSessions.clear();
+    setClaimedDevices.clear();
+    nSucceeded = 0;
+    nFailed = 0;
+    for (qint32 i = 0; i < lstOptions.count(); ++i)
+    {
+        OtaSession *otsSession = new OtaSession();
+        otsSession->SetXCompileCache(&xccXCompileCache);
+        otsSession->SetModuleStateCache(&mscModuleCache);
+        connect(otsSession, SIGNAL(StageChanged(quint8)), this, SLOT(SessionStageChanged(quint8)));
+        connect(otsSession, SIGNAL(Progress(qint32,qint32)), this, SLOT(SessionProgress(qint32,qint32)));
+        connect(otsSession, SIGNAL(ModuleDetails(QString,QString)), this, SLOT(SessionModuleDetails(QString,QString)));
+        connect(otsSession, SIGNAL(Finished(bool,QString)), this, SLOT(SessionFinished(bool,QString)));
+        lstSessions.append(otsSession);
+    }
+
+    //Sessions with invalid options fail immediately, the rest wait for the scan
+    for (qint32 i = 0; i < lstSessions.count(); ++i)
+    {
+        lstSessions.at(i)->Start(lstOptions.at(i), false);
+    }
+    if (nSucceeded + nFailed < lstSessions.count())
+    {
+        ddaDiscoveryAgent->setLowEnergyDiscoveryTimeout(unScanTimeout);
+        ddaDiscoveryAgent->start(QBluetoothDeviceDiscoveryAgent::LowEnergyMethod);
+    }
+}
+
+//=============================================================================
+//=============================================================================
+void
+OtaSessionManager::Cancel(
+    )
+{
+    //Abandons all sessions
+    if (ddaDiscoveryAgent->isActive())
+    {
+        ddaDiscoveryAgent->stop();
+    }
+    for (qint32 i = 0; i < lstSessions.count(); ++i)
+    {
+        lstSessions.at(i)->Cancel();
+    }
+}
+
+//=============================================================================
+//=============================================================================
+qint32
+OtaSessionManager::Count(
+    )
+{
+    //Returns the number of sessions
+    return lstSessions.count();
+}
+
+//=============================================================================
+//=============================================================================
+OtaSession *
+OtaSessionManager::Session(
+    qint32 nSession
+    )
+{
+    //Returns a session
+    return lstSessions.value(nSession, NULL);
+}
+
+//=============================================================================
+//=============================================================================
+void
+OtaSessionManager::SetXCompileStorage(
+    const QString &strDirectory,
+    qint64 nMaxSize
+    )
+{
+    //Keeps XCompiled applications between runs, see XCompileCache::SetStorage()
+    xccXCompileCache.SetStorage(strDirectory, nMaxSize);
+}
+
+//=============================================================================
+//=============================================================================
+void
+OtaSessionManager::SetModuleStateStorage(
+    const QString &strFilename,
+    quint32 unTTL
+    )
+{
+    //Keeps module details between runs, see ModuleStateCache::SetStorage()
+    mscModuleCache.SetStorage(strFilename, unTTL);
+}
+
+//=============================================================================
+//=============================================================================
+void
+OtaSessionManager::DeviceDiscovered(
+    const QBluetoothDeviceInfo &bdiDeviceInfo
+    )
+{
+    //Bluetooth device detected, give it to the first waiting session it matches. A module is only given to one session
+#ifdef Q_OS_MAC
+    QString strDeviceAddress = bdiDeviceInfo.deviceUuid().toString();
+#else
+    QString strDeviceAddress = bdiDeviceInfo.address().toString();
+#endif
+    if (setClaimedDevices.contains(strDeviceAddress))
+    {
+        return;
+    }
+
+    bool bClaimed = false;
+    bool bWaiting = false;
+    for (qint32 i = 0; i < lstSessions.count(); ++i)
+    {
+        OtaSession *otsSession = lstSessions.at(i);
+        if (bClaimed == false && otsSession->Matches(bdiDeviceInfo))
+        {
+            bClaimed = true;
+            setClaimedDevices.insert(strDeviceAddress);
+            otsSession->Connect(bdiDeviceInfo);
+        }
+        else if (otsSession->Stage() == OTA_STAGE_SCANNING)
+        {
+            bWaiting = true;
+        }
+    }
+
+    if (bWaiting == false && ddaDiscoveryAgent->isActive())
+    {
+        //All modules have been found
+        ddaDiscoveryAgent->stop();
+    }
+}
+
+//=============================================================================
+//=============================================================================
+void
+OtaSessionManager::ScanFinished(
+    )
+{
+    //Bluetooth scan finished, any session still waiting did not see its module
+    FailWaiting("Module not found.");
+}
+
+//=============================================================================
+//=============================================================================
+void
+OtaSessionManager::ScanError(
+    QBluetoothDeviceDiscoveryAgent::Error nErrorCode
+    )
+{
+    //Bluetooth scan error
+    if (nErrorCode != QBluetoothDeviceDiscoveryAgent::NoError)
+    {
+        FailWaiting(QString("Bluetooth scan error: ").append(ddaDiscoveryAgent->errorString()));
+    }
+}
+
+//=============================================================================
+//=============================================================================
+void
+OtaSessionManager::SessionStageChanged(
+    quint8 unStage
+    )
+{
+    //Forwards the stage change of a session
+    qint32 nSession = lstSessions.indexOf(qobject_cast<OtaSession *>(sender()));
+    if (nSession >= 0)
+    {
+        emit StageChanged(nSession, unStage);
+    }
+}
+
+//=============================================================================
+//=============================================================================
+void
+OtaSessionManager::SessionProgress(
+    qint32 nSent,
+    qint32 nTotal
+    )
+{
+    //Forwards the progress of a session
+    qint32 nSession = lstSessions.indexOf(qobject_cast<OtaSession *>(sender()));
+    if (nSession >= 0)
+    {
+        emit Progress(nSession, nSent, nTotal);
+    }
+}
+
+//=============================================================================
+//=============================================================================
+void
+OtaSessionManager::SessionModuleDetails(
+    QString strDevice,
+    QString strFirmware
+    )
+{
+    //Forwards the module details of a session
+    qint32 nSession = lstSessions.indexOf(qobject_cast<OtaSession *>(sender()));
+    if (nSession >= 0)
+    {
+        emit ModuleDetails(nSession, strDevice, strFirmware);
+    }
+}
+
+//=============================================================================
+//=============================================================================
+void
+OtaSessionManager::SessionFinished(
+    bool bSuccess,
+    QString strMessage
+    )
+{
+    //Forwards the result of a session, once all have finished the overall result is given
+    qint32 nSession = lstSessions.indexOf(qobject_cast<OtaSession *>(sender()));
+    if (nSession < 0)
+    {
+        return;
+    }
+
+    if (bSuccess == true)
+    {
+        ++nSucceeded;
+    }
+    else
+    {
+        ++nFailed;
+    }
+    emit Finished(nSession, bSuccess, strMessage);
+
+    if (nSucceeded + nFailed == lstSessions.count())
+    {
+        if (ddaDiscoveryAgent->isActive())
+        {
+            ddaDiscoveryAgent->stop();
+        }
+        emit AllFinished(nSucceeded, nFailed);
+    }
+}
+
+//=============================================================================
+//=============================================================================
+void
+OtaSessionManager::FailWaiting(
+    const QString &strReason
+    )
+{
+    //Fails every session which is still waiting for its module
+    for (qint32 i = 0; i < lstSessions.count(); ++i)
+    {
+        if (lstSessions.at(i)->Stage() == OTA_STAGE_SCANNING)
+        {
+            lstSessions.at(i)->Cancel(strReason);
+        }
+    }
+}
+
+/******************************************************************************/
+// END OF FILE
+/******************************************************************************/
@@ -0,0 +1,158 @@
+/******************************************************************************
+** Copyright (C) 2018 Laird
+**
+** Project: UwVSP-OTA
+**
+** Module: otasessionmanager.h
+**
+** Notes:
+**
+** License: This program is free software: you can redistribute it and/or
+**          modify it under the terms of the GNU General Public License as
+**          published by the Free Software Foundation, version 3.
+**
+**          This program is distributed in the hope that it will be useful,
+**          but WITHOUT ANY WARRANTY; without even the implied warranty of
+**          MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+**          GNU General Public License for more details.
+**
+**          You should have received a copy of the GNU General Public License
+**          along with this program.  If not, see http://www.gnu.org/licenses/
+**
+*******************************************************************************/
+#ifndef OTASESSIONMANAGER_H
+#define OTASESSIONMANAGER_H
+
+/******************************************************************************/
+// Include Files
+/******************************************************************************/
+#include <QObject>
+#include <QList>
+#include <QSet>
+#include <QBluetoothDeviceDiscoveryAgent>
+#include <QBluetoothDeviceInfo>
+#include "otasession.h"
+#include "xcompilecache.h"
+#include "target.h"
+
+/******************************************************************************/
+// Class definitions
+/******************************************************************************/
+class OtaSessionManager : public QObject
+{
+    Q_OBJECT
+public:
+    explicit
+    OtaSessionManager(
+        QObject *parent = nullptr
+        );
+    ~OtaSessionManager(
+        );
+    void
+    Start(
+        const QList<OtaSessionOptions> &lstOptions,
+        quint32 unScanTimeout
+        );
+    void
+    Cancel(
+        );
+    qint32
+    Count(
+        );
+    OtaSession *
+    Session(
+        qint32 nSession
+        );
+    void
+    SetXCompileStorage(
+        const QString &strDirectory,
+        qint64 nMaxSize
+        );
+    void
+    SetModuleStateStorage(
+        const QString &strFilename,
+        quint32 unTTL
+        );
+
+signals:
+    void
+    StageChanged(
+        qint32 nSession,
+        quint8 unStage
+        );
+    void
+    Progress(
+        qint32 nSession,
+        qint32 nSent,
+        qint32 nTotal
+        );
+    void
+    ModuleDetails(
+        qint32 nSession,
+        QString strDevice,
+        QString strFirmware
+        );
+    void
+    Finished(
+        qint32 nSession,
+        bool bSuccess,
+        QString strMessage
+        );
+    void
+    AllFinished(
+        qint32 nSucceeded,
+        qint32 nFailed
+        );
+
+private slots:
+    void
+    DeviceDiscovered(
+        const QBluetoothDeviceInfo &bdiDeviceInfo
+        );
+    void
+    ScanFinished(
+        );
+    void
+    ScanError(
+        QBluetoothDeviceDiscoveryAgent::Error nErrorCode
+        );
+    void
+    SessionStageChanged(
+        quint8 unStage
+        );
+    void
+    SessionProgress(
+        qint32 nSent,
+        qint32 nTotal
+        );
+    void
+    SessionModuleDetails(
+        QString strDevice,
+        QString strFirmware
+        );
+    void
+    SessionFinished(
+        bool bSuccess,
+        QString strMessage
+        );
+
+private:
+    void
+    FailWaiting(
+        const QString &strReason
+        );
+
+    QList<OtaSession *> lstSessions;
+    QSet<QString> setClaimedDevices; //Addresses of modules which have been given to a session
+    qint32 nSucceeded;
+    qint32 nFailed;
+    QBluetoothDeviceDiscoveryAgent *ddaDiscoveryAgent;
+    XCompileCache xccXCompileCache;  //Shared by all sessions
+    ModuleStateCache mscModuleCache; //Shared by all sessions
+};
+
+#endif // OTASESSIONMANAGER_H
+
+/******************************************************************************/
+// END OF FILE
+/******************************************************************************/
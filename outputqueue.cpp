@@ -0,0 +1,194 @@
+/******************************************************************************
+** Copyright (C) 2018 Laird
+**
+** Project: UwVSP-OTA
+**
+** Module: outputqueue.cpp
+**
+** Notes:
+**
+** License: This program is free software: you can redistribute it and/or
+**          modify it under the terms of the GNU General Public License as
+**          published by the Free Software Foundation, version 3.
+**
+**          This program is distributed in the hope that it will be useful,
+**          but WITHOUT ANY WARRANTY; without even the implied warranty of
+**          MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+**          GNU General Public License for more details.
+**
+**          You should have received a copy of the GNU General Public License
+**          along with this program.  If not, see http://www.gnu.org/licenses/
+**
+*******************************************************************************/
+#include "outputqueue.h"
+
+//=============================================================================
+//=============================================================================
+OutputQueue::OutputQueue(QObject *parent) : QObject(parent)
+{
+    //Constructor
+    nOffset = 0;
+    nLimit = -1;
+}
+
+//=============================================================================
+//=============================================================================
+OutputQueue::~OutputQueue(
+    )
+{
+    //Destructor
+}
+
+//=============================================================================
+//=============================================================================
+void
+OutputQueue::Clear(
+    )
+{
+    //Discards all unsent data and commands
+    nOffset = baData.length();
+    nLimit = -1;
+    balCommands.clear();
+}
+
+//=============================================================================
+//=============================================================================
+void
+OutputQueue::SetData(
+    const QByteArray &baNewData
+    )
+{
+    //Sets the data to send
+    baData = baNewData;
+    nOffset = 0;
+    nLimit = -1;
+}
+
+//=============================================================================
+//=============================================================================
+void
+OutputQueue::AppendCommand(
+    const QByteArray &baCommand
+    )
+{
+    //Adds a command to send after the current data
+    balCommands.append(baCommand);
+}
+
+//=============================================================================
+//=============================================================================
+bool
+OutputQueue::HasPendingCommands(
+    )
+{
+    //Returns true if there are commands waiting to be sent
+    return !balCommands.isEmpty();
+}
+
+//=============================================================================
+//=============================================================================
+qint32
+OutputQueue::PendingCommandsLength(
+    )
+{
+    //Returns the total length of the commands waiting to be sent
+    qint32 nLength = 0;
+    int i = 0;
+    while (i < balCommands.length())
+    {
+        nLength += balCommands.at(i).length();
+        ++i;
+    }
+    return nLength;
+}
+
+//=============================================================================
+//=============================================================================
+void
+OutputQueue::LoadNextCommand(
+    )
+{
+    //Makes the next waiting command the data to send
+    SetData(balCommands.takeFirst());
+}
+
+//=============================================================================
+//=============================================================================
+qint32
+OutputQueue::Remaining(
+    )
+{
+    //Returns the number of bytes left to send of the current data
+    return baData.length() - nOffset;
+}
+
+//=============================================================================
+//=============================================================================
+void
+OutputQueue::SetLimit(
+    qint32 nNewLimit
+    )
+{
+    //Sets the offset in the current data which can be sent up to, -1 removes the limit
+    nLimit = nNewLimit;
+}
+
+//=============================================================================
+//=============================================================================
+qint32
+OutputQueue::Available(
+    )
+{
+    //Returns the number of bytes of the current data which can be sent now
+    qint32 nEnd = baData.length();
+    if (nLimit >= 0 && nLimit < nEnd)
+    {
+        nEnd = nLimit;
+    }
+    return (nEnd > nOffset ? nEnd - nOffset : 0);
+}
+
+//=============================================================================
+//=============================================================================
+bool
+OutputQueue::IsEmpty(
+    )
+{
+    //Returns true if all of the current data has been sent
+    return (nOffset >= baData.length());
+}
+
+//=============================================================================
+//=============================================================================
+QByteArray
+OutputQueue::NextPacket(
+    qint32 nPacketSize
+    )
+{
+    //Returns a copy of the next packet of data which can be sent, only the packet is copied. It owns its data so it stays valid once the queue is cleared or given new data
+    qint32 nLength = Available();
+    if (nLength > nPacketSize)
+    {
+        nLength = nPacketSize;
+    }
+    return baData.mid(nOffset, nLength);
+}
+
+//=============================================================================
+//=============================================================================
+void
+OutputQueue::Consume(
+    qint32 nLength
+    )
+{
+    //Marks data as having been sent
+    nOffset += nLength;
+    if (nOffset > baData.length())
+    {
+        nOffset = baData.length();
+    }
+}
+
+/******************************************************************************/
+// END OF FILE
+/******************************************************************************/
@@ -0,0 +1,100 @@
+/******************************************************************************
+** Copyright (C) 2018 Laird
+**
+** Project: UwVSP-OTA
+**
+** Module: outputqueue.h
+**
+** Notes:
+**
+** License: This program is free software: you can redistribute it and/or
+**          modify it under the terms of the GNU General Public License as
+**          published by the Free Software Foundation, version 3.
+**
+**          This program is distributed in the hope that it will be useful,
+**          but WITHOUT ANY WARRANTY; without even the implied warranty of
+**          MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+**          GNU General Public License for more details.
+**
+**          You should have received a copy of the GNU General Public License
+**          along with this program.  If not, see http://www.gnu.org/licenses/
+**
+*******************************************************************************/
+#ifndef OUTPUTQUEUE_H
+#define OUTPUTQUEUE_H
+
+/******************************************************************************/
+// Include Files
+/******************************************************************************/
+#include <QObject>
+#include <QByteArray>
+#include <QByteArrayList>
+#include "target.h"
+
+/******************************************************************************/
+// Class definitions
+/******************************************************************************/
+class OutputQueue : public QObject
+{
+    Q_OBJECT
+public:
+    explicit
+    OutputQueue(
+        QObject *parent = nullptr
+        );
+    ~OutputQueue(
+        );
+    void
+    Clear(
+        );
+    void
+    SetData(
+        const QByteArray &baNewData
+        );
+    void
+    AppendCommand(
+        const QByteArray &baCommand
+        );
+    bool
+    HasPendingCommands(
+        );
+    qint32
+    PendingCommandsLength(
+        );
+    void
+    LoadNextCommand(
+        );
+    qint32
+    Remaining(
+        );
+    void
+    SetLimit(
+        qint32 nNewLimit
+        );
+    qint32
+    Available(
+        );
+    bool
+    IsEmpty(
+        );
+    QByteArray
+    NextPacket(
+        qint32 nPacketSize
+        );
+    void
+    Consume(
+        qint32 nLength
+        );
+
+private:
+    QByteArray baData;          //Data currently being sent, shared with the caller's copy. NextPacket() returns copies, so it can be replaced at any time
+    qint32 nOffset;             //Offset of the first unacknowledged byte in baData
+    qint32 nLimit;              //Offset in baData which data can be sent up to, -1 for no limit
+    QByteArrayList balCommands; //Commands to send once baData has been sent
+};
+
+#endif // OUTPUTQUEUE_H
+
+/******************************************************************************/
+// END OF FILE
+/******************************************************************************/
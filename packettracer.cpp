@@ -0,0 +1,273 @@
+/******************************************************************************
+** Copyright (C) 2018 Laird
+**
+** Project: UwVSP-OTA
+**
+** Module: packettracer.cpp
+**
+** Notes:
+**
+** License: This program is free software: you can redistribute it and/or
+**          modify it under the terms of the GNU General Public License as
+**          published by the Free Software Foundation, version 3.
+**
+**          This program is distributed in the hope that it will be useful,
+**          but WITHOUT ANY WARRANTY; without even the implied warranty of
+**          MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+**          GNU General Public License for more details.
+**
+**          You should have received a copy of the GNU General Public License
+**          along with this program.  If not, see http://www.gnu.org/licenses/
+**
+*******************************************************************************/
+#include "packettracer.h"
+
+/******************************************************************************/
+// Local Functions or Private Members
+/******************************************************************************/
+//Tracks the events are shown on
+const qint32 TRACE_TRACK_MODE     = 0;
+const qint32 TRACE_TRACK_WRITES   = 1;
+const qint32 TRACE_TRACK_NOTIFY   = 2;
+const qint32 TRACE_TRACK_FLOW     = 3;
+const qint32 TRACE_TRACK_TIMERS   = 4;
+static const char *const TRACE_TRACK_NAMES[] = {"Mode", "RX writes", "TX notifications", "Modem out", "Timers"};
+
+//=============================================================================
+//=============================================================================
+static QJsonObject
+TraceEvent(
+    const QString &strName,
+    const QString &strPhase,
+    qint64 nTime,
+    qint32 nTrack
+    )
+{
+    //Returns a Chrome trace event, all events are in a single process
+    return QJsonObject{{"name", strName}, {"ph", strPhase}, {"ts", nTime}, {"pid", 1}, {"tid", nTrack}};
+}
+
+//=============================================================================
+//=============================================================================
+static QString
+TimerName(
+    quint32 unTimer
+    )
+{
+    //Returns the name of a traced timer
+    switch (unTimer)
+    {
+        case TRACE_TIMER_RESPONSE:
+            return "response timeout";
+        case TRACE_TIMER_DISPLAY:
+            return "display update";
+        case TRACE_TIMER_DISCONNECT:
+            return "disconnect clean up";
+        default:
+            return "timer";
+    }
+}
+
+//=============================================================================
+//=============================================================================
+PacketTracer::PacketTracer(QObject *parent) : QObject(parent)
+{
+    //Constructor, nothing is recorded until tracing is enabled
+    bEnabled = false;
+    unRecorded = 0;
+}
+
+//=============================================================================
+//=============================================================================
+PacketTracer::~PacketTracer(
+    )
+{
+    //Destructor
+}
+
+//=============================================================================
+//=============================================================================
+void
+PacketTracer::SetEnabled(
+    bool bNewEnabled
+    )
+{
+    //Starts or stops recording, starting discards the previous trace. Events recorded before tracing was stopped can still be saved
+    if (bNewEnabled == true && bEnabled == false)
+    {
+        vecEvents.resize(PACKET_TRACE_CAPACITY);
+        unRecorded = 0;
+        dtStarted = QDateTime::currentDateTime();
+        tmrTraceTimer.start();
+    }
+    bEnabled = bNewEnabled;
+}
+
+//=============================================================================
+//=============================================================================
+bool
+PacketTracer::IsEnabled(
+    )
+{
+    //Returns true if events are being recorded
+    return bEnabled;
+}
+
+//=============================================================================
+//=============================================================================
+QString
+PacketTracer::DefaultFilename(
+    )
+{
+    //Returns a new file in the user data directory, named by the current time
+    return QStandardPaths::writableLocation(QStandardPaths::GenericDataLocation).append('/').append(PACKET_TRACE_DIRECTORY).append("/trace-").append(QDateTime::currentDateTime().toString("yyyyMMdd-hhmmss")).append(".json");
+}
+
+//=============================================================================
+//=============================================================================
+void
+PacketTracer::Record(
+    quint8 unType,
+    quint32 unValue
+    )
+{
+    //Adds an event, overwriting the oldest once the ring is full
+    if (bEnabled == true)
+    {
+        PacketTraceEvent &pteEvent = vecEvents[(qint32)(unRecorded & (PACKET_TRACE_CAPACITY - 1))];
+        pteEvent.nTime = tmrTraceTimer.nsecsElapsed() / 1000;
+        pteEvent.unValue = unValue;
+        pteEvent.unType = unType;
+        ++unRecorded;
+    }
+}
+
+//=============================================================================
+//=============================================================================
+bool
+PacketTracer::Save(
+    const QString &strFilename
+    )
+{
+    //Writes the events in the Chrome trace event format. Each acknowledged write is a slice from being issued until it was acknowledged so the gap before the
+    //next write is visible, writes without response are instants as they are never acknowledged, modes are slices on their own track and the modem out state
+    //is also shown as a counter. Returns false if there is nothing to save
+    if (unRecorded == 0)
+    {
+        return false;
+    }
+
+    QJsonArray jaEvents;
+    for (qint32 i = TRACE_TRACK_MODE; i <= TRACE_TRACK_TIMERS; ++i)
+    {
+        QJsonObject joTrack = TraceEvent("thread_name", "M", 0, i);
+        joTrack.insert("args", QJsonObject{{"name", TRACE_TRACK_NAMES[i]}});
+        jaEvents.append(joTrack);
+    }
+
+    QVector<PacketTraceEvent> vecPendingWrites; //Writes with response issued and not yet acknowledged, acknowledgements are in the order the writes were issued
+    qint32 nPendingWrite = 0;
+    bool bModeStarted = false;
+    PacketTraceEvent pteMode = PacketTraceEvent();
+    quint64 unFirst = (unRecorded > PACKET_TRACE_CAPACITY ? unRecorded - PACKET_TRACE_CAPACITY : 0);
+    qint64 nLastTime = 0;
+    for (quint64 i = unFirst; i < unRecorded; ++i)
+    {
+        const PacketTraceEvent &pteEvent = vecEvents.at((qint32)(i & (PACKET_TRACE_CAPACITY - 1)));
+        QJsonObject joEvent;
+        nLastTime = pteEvent.nTime;
+        if (pteEvent.unType == TRACE_EVENT_WRITE)
+        {
+            //Shown once acknowledged
+            vecPendingWrites.append(pteEvent);
+            continue;
+        }
+        else if (pteEvent.unType == TRACE_EVENT_WRITTEN && nPendingWrite < vecPendingWrites.count() && vecPendingWrites.at(nPendingWrite).unValue == pteEvent.unValue)
+        {
+            const PacketTraceEvent &pteWrite = vecPendingWrites.at(nPendingWrite++);
+            joEvent = TraceEvent("write", "X", pteWrite.nTime, TRACE_TRACK_WRITES);
+            joEvent.insert("dur", pteEvent.nTime - pteWrite.nTime);
+            joEvent.insert("args", QJsonObject{{"length", (qint64)pteWrite.unValue}});
+        }
+        else if (pteEvent.unType == TRACE_EVENT_WRITTEN)
+        {
+            //Write was issued before the oldest event kept, or the acknowledgement does not belong to the oldest pending write
+            joEvent = TraceEvent("write acknowledged", "i", pteEvent.nTime, TRACE_TRACK_WRITES);
+            joEvent.insert("args", QJsonObject{{"length", (qint64)pteEvent.unValue}});
+        }
+        else if (pteEvent.unType == TRACE_EVENT_WRITE_STREAM)
+        {
+            joEvent = TraceEvent("write without response", "i", pteEvent.nTime, TRACE_TRACK_WRITES);
+            joEvent.insert("args", QJsonObject{{"length", (qint64)pteEvent.unValue}});
+        }
+        else if (pteEvent.unType == TRACE_EVENT_NOTIFY)
+        {
+            joEvent = TraceEvent("notification", "i", pteEvent.nTime, TRACE_TRACK_NOTIFY);
+            joEvent.insert("args", QJsonObject{{"length", (qint64)pteEvent.unValue}});
+        }
+        else if (pteEvent.unType == TRACE_EVENT_FLOW)
+        {
+            QJsonObject joCounter = TraceEvent("modem out stopped", "C", pteEvent.nTime, TRACE_TRACK_FLOW);
+            joCounter.insert("args", QJsonObject{{"stopped", (qint64)pteEvent.unValue}});
+            jaEvents.append(joCounter);
+            joEvent = TraceEvent((pteEvent.unValue != 0 ? "stop" : "go"), "i", pteEvent.nTime, TRACE_TRACK_FLOW);
+        }
+        else if (pteEvent.unType == TRACE_EVENT_TIMER)
+        {
+            joEvent = TraceEvent(TimerName(pteEvent.unValue), "i", pteEvent.nTime, TRACE_TRACK_TIMERS);
+        }
+        else if (pteEvent.unType == TRACE_EVENT_MODE)
+        {
+            //The previous mode ends
+            if (bModeStarted == true && pteMode.unValue != MAIN_MODE_IDLE)
+            {
+                joEvent = TraceEvent(SessionTimingLog::ModeName(pteMode.unValue), "X", pteMode.nTime, TRACE_TRACK_MODE);
+                joEvent.insert("dur", pteEvent.nTime - pteMode.nTime);
+            }
+            pteMode = pteEvent;
+            bModeStarted = true;
+        }
+
+        if (!joEvent.isEmpty())
+        {
+            //Instant events are scoped to their track
+            if (joEvent.value("ph").toString() == "i")
+            {
+                joEvent.insert("s", "t");
+            }
+            jaEvents.append(joEvent);
+        }
+    }
+
+    while (nPendingWrite < vecPendingWrites.count())
+    {
+        //Never acknowledged
+        const PacketTraceEvent &pteWrite = vecPendingWrites.at(nPendingWrite++);
+        QJsonObject joEvent = TraceEvent("write (unacknowledged)", "i", pteWrite.nTime, TRACE_TRACK_WRITES);
+        joEvent.insert("s", "t");
+        joEvent.insert("args", QJsonObject{{"length", (qint64)pteWrite.unValue}});
+        jaEvents.append(joEvent);
+    }
+    if (bModeStarted == true && pteMode.unValue != MAIN_MODE_IDLE)
+    {
+        //Mode in progress when the trace was saved
+        QJsonObject joEvent = TraceEvent(SessionTimingLog::ModeName(pteMode.unValue), "X", pteMode.nTime, TRACE_TRACK_MODE);
+        joEvent.insert("dur", nLastTime - pteMode.nTime);
+        jaEvents.append(joEvent);
+    }
+
+    QDir().mkpath(QFileInfo(strFilename).absolutePath());
+    QFile fileTrace(strFilename);
+    if (!fileTrace.open(QIODevice::WriteOnly | QIODevice::Truncate))
+    {
+        return false;
+    }
+    QJsonObject joTrace{{"traceEvents", jaEvents}, {"displayTimeUnit", "ms"}, {"otherData", QJsonObject{{"started", dtStarted.toString(Qt::ISODate)}, {"events", (qint64)unRecorded}, {"version", APP_VERSION}}}};
+    bool bWritten = (fileTrace.write(QJsonDocument(joTrace).toJson(QJsonDocument::Compact)) > 0);
+    fileTrace.close();
+    return bWritten;
+}
+
+/******************************************************************************/
+// END OF FILE
+/******************************************************************************/
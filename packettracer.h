@@ -0,0 +1,120 @@
+/******************************************************************************
+** Copyright (C) 2018 Laird
+**
+** Project: UwVSP-OTA
+**
+** Module: packettracer.h
+**
+** Notes:
+**
+** License: This program is free software: you can redistribute it and/or
+**          modify it under the terms of the GNU General Public License as
+**          published by the Free Software Foundation, version 3.
+**
+**          This program is distributed in the hope that it will be useful,
+**          but WITHOUT ANY WARRANTY; without even the implied warranty of
+**          MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+**          GNU General Public License for more details.
+**
+**          You should have received a copy of the GNU General Public License
+**          along with this program.  If not, see http://www.gnu.org/licenses/
+**
+*******************************************************************************/
+#ifndef PACKETTRACER_H
+#define PACKETTRACER_H
+
+/******************************************************************************/
+// Include Files
+/******************************************************************************/
+#include <QObject>
+#include <QString>
+#include <QVector>
+#include <QElapsedTimer>
+#include <QDateTime>
+#include <QStandardPaths>
+#include <QJsonObject>
+#include <QJsonArray>
+#include <QJsonDocument>
+#include <QFile>
+#include <QFileInfo>
+#include <QDir>
+#include "sessiontiminglog.h"
+#include "target.h"
+
+/******************************************************************************/
+// Constants
+/******************************************************************************/
+//Traced events, the value recorded with each is given
+const quint8 TRACE_EVENT_WRITE           = 0; //Write to the RX characteristic issued, length
+const quint8 TRACE_EVENT_WRITE_STREAM    = 1; //Write without response to the RX characteristic issued, length. It is never acknowledged so no TRACE_EVENT_WRITTEN follows it
+const quint8 TRACE_EVENT_WRITTEN         = 2; //TRACE_EVENT_WRITE acknowledged, length
+const quint8 TRACE_EVENT_NOTIFY          = 3; //TX characteristic notification received, length
+const quint8 TRACE_EVENT_FLOW            = 4; //Modem out characteristic changed, 1 if the module has stopped the flow of data
+const quint8 TRACE_EVENT_TIMER           = 5; //Timer fired, one of the TRACE_TIMER_ values
+const quint8 TRACE_EVENT_MODE            = 6; //Mode changed, the new mode
+
+//Timers
+const quint32 TRACE_TIMER_RESPONSE       = 0;
+const quint32 TRACE_TIMER_DISPLAY        = 1;
+const quint32 TRACE_TIMER_DISCONNECT     = 2;
+
+/******************************************************************************/
+// Structures
+/******************************************************************************/
+//A single traced event
+struct PacketTraceEvent
+{
+    qint64 nTime;   //Microseconds since tracing was enabled
+    quint32 unValue;
+    quint8 unType;  //One of the TRACE_EVENT_ values
+};
+
+/******************************************************************************/
+// Class definitions
+/******************************************************************************/
+//Records writes, acknowledgements, notifications, flow control and timers with microsecond timestamps for finding throughput stalls. Events are kept in a fixed size
+//ring so tracing can be left enabled, and are saved in the Chrome trace event format (chrome://tracing or https://ui.perfetto.dev) on demand.
+//Bluetooth signals and timers are delivered on the thread which owns the tracer, so events are recorded without locking
+class PacketTracer : public QObject
+{
+    Q_OBJECT
+public:
+    explicit
+    PacketTracer(
+        QObject *parent = nullptr
+        );
+    ~PacketTracer(
+        );
+    void
+    SetEnabled(
+        bool bNewEnabled
+        );
+    bool
+    IsEnabled(
+        );
+    static QString
+    DefaultFilename(
+        );
+    bool
+    Save(
+        const QString &strFilename
+        );
+    void
+    Record(
+        quint8 unType,
+        quint32 unValue
+        );
+
+private:
+    bool bEnabled;                       //True if events are being recorded
+    QElapsedTimer tmrTraceTimer;         //Monotonic time events are stamped with
+    QDateTime dtStarted;                 //When tracing was enabled
+    QVector<PacketTraceEvent> vecEvents; //Ring of the last PACKET_TRACE_CAPACITY events
+    quint64 unRecorded;                  //Number of events recorded since tracing was enabled
+};
+
+#endif // PACKETTRACER_H
+
+/******************************************************************************/
+// END OF FILE
+/******************************************************************************/
@@ -12,36 +12,75 @@ TARGET = qtbluetooth
 TEMPLATE = app
 
 SOURCES += \
-        main.cpp               \
-        mainwindow.cpp         \
-        scanselection.cpp      \
-        downloader.cpp         \
-        settingsdialog.cpp     \
-        settingsstorage.cpp    \
-        errorlookup.cpp        \
-        filetypeselection.cpp  \
-        checksumcalculator.cpp
+        main.cpp                 \
+        mainwindow.cpp           \
+        scanselection.cpp        \
+        downloader.cpp           \
+        otasession.cpp           \
+        xcompilecache.cpp        \
+        modulestatecache.cpp     \
+        vsptransport.cpp         \
+        blevsptransport.cpp      \
+        sessioncapture.cpp       \
+        recordingvsptransport.cpp \
+        sessiontiminglog.cpp     \
+        packettracer.cpp         \
+        settingsdialog.cpp       \
+        settingsstorage.cpp      \
+        errorlookup.cpp          \
+        filetypeselection.cpp    \
+        checksumcalculator.cpp   \
+        otacommandencoder.cpp    \
+        outputqueue.cpp          \
+        commandpipeline.cpp      \
+        transfercheckpoint.cpp   \
+        moduleresponseparser.cpp \
+        scrollbackbuffer.cpp
 
 HEADERS  += \
-        mainwindow.h           \
-        scanselection.h        \
-        downloader.h           \
-        settingsdialog.h       \
-        target.h               \
-        settingsstorage.h      \
-        errorlookup.h          \
-        filetypeselection.h    \
-        checksumcalculator.h
+        mainwindow.h             \
+        scanselection.h          \
+        downloader.h             \
+        otasession.h             \
+        xcompilecache.h          \
+        modulestatecache.h       \
+        vsptransport.h           \
+        blevsptransport.h        \
+        sessioncapture.h         \
+        recordingvsptransport.h  \
+        sessiontiminglog.h       \
+        packettracer.h           \
+        settingsdialog.h         \
+        target.h                 \
+        settingsstorage.h        \
+        errorlookup.h            \
+        errorcodes.h             \
+        filetypeselection.h      \
+        checksumcalculator.h     \
+        otacommandencoder.h      \
+        outputqueue.h            \
+        commandpipeline.h        \
+        transfercheckpoint.h     \
+        moduleresponseparser.h   \
+        scrollbackbuffer.h
 
 FORMS    += \
-        mainwindow.ui          \
-        scanselection.ui       \
-        settingsdialog.ui      \
+        mainwindow.ui            \
+        scanselection.ui         \
+        settingsdialog.ui        \
         filetypeselection.ui
 
 RESOURCES += \
     resources.qrc
 
+#Error code table, generated from codes.csv and committed so Python is only needed when codes.csv changes: "make errorcodes" regenerates it and "make check" runs
+#errorcodes_check, which fails if it is out of date
+errorcodes.commands = python3 $$PWD/generate_errorcodes.py $$PWD/codes.csv $$PWD/errorcodes.h
+errorcodes.depends = $$PWD/codes.csv $$PWD/generate_errorcodes.py
+errorcodes_check.commands = python3 $$PWD/generate_errorcodes.py --check $$PWD/codes.csv $$PWD/errorcodes.h
+check.depends = errorcodes_check
+QMAKE_EXTRA_TARGETS += errorcodes errorcodes_check check
+
 android {
     QT += androidextras
     SOURCES += androidfiledialog.cpp
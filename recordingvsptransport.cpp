@@ -0,0 +1,223 @@
+/******************************************************************************
+** Copyright (C) 2018 Laird
+**
+** Project: UwVSP-OTA
+**
+** Module: recordingvsptransport.cpp
+**
+** Notes:
+**
+** License: This program is free software: you can redistribute it and/or
+**          modify it under the terms of the GNU General Public License as
+**          published by the Free Software Foundation, version 3.
+**
+**          This program is distributed in the hope that it will be useful,
+**          but WITHOUT ANY WARRANTY; without even the implied warranty of
+**          MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+**          GNU General Public License for more details.
+**
+**          You should have received a copy of the GNU General Public License
+**          along with this program.  If not, see http://www.gnu.org/licenses/
+**
+*******************************************************************************/
+#include "recordingvsptransport.h"
+
+//=============================================================================
+//=============================================================================
+RecordingVspTransport::RecordingVspTransport(VspTransport *vtpNewTransport, QObject *parent) : VspTransport(parent)
+{
+    //Constructor, takes ownership of the transport being recorded
+    vtpTransport = vtpNewTransport;
+    vtpTransport->setParent(this);
+    connect(vtpTransport, SIGNAL(Connected()), this, SLOT(TransportConnected()));
+    connect(vtpTransport, SIGNAL(Opened()), this, SLOT(TransportOpened()));
+    connect(vtpTransport, SIGNAL(Closed()), this, SLOT(TransportClosed()));
+    connect(vtpTransport, SIGNAL(DataReceived(QByteArray)), this, SLOT(TransportDataReceived(QByteArray)));
+    connect(vtpTransport, SIGNAL(DataWritten(qint32)), this, SLOT(TransportDataWritten(qint32)));
+    connect(vtpTransport, SIGNAL(FlowChanged(bool)), this, SLOT(TransportFlowChanged(bool)));
+    connect(vtpTransport, SIGNAL(MTUChanged(int)), this, SLOT(TransportMTUChanged(int)));
+    connect(vtpTransport, SIGNAL(Error(QString)), this, SLOT(TransportError(QString)));
+}
+
+//=============================================================================
+//=============================================================================
+RecordingVspTransport::~RecordingVspTransport(
+    )
+{
+    //Destructor
+}
+
+//=============================================================================
+//=============================================================================
+void
+RecordingVspTransport::Open(
+    )
+{
+    //Opens the recorded transport, the capture times start from here
+    scpCapture.Clear();
+    vtpTransport->Open();
+}
+
+//=============================================================================
+//=============================================================================
+void
+RecordingVspTransport::Close(
+    )
+{
+    //Closes the recorded transport
+    vtpTransport->Close();
+}
+
+//=============================================================================
+//=============================================================================
+void
+RecordingVspTransport::Write(
+    const QByteArray &baData
+    )
+{
+    //Records the packet and writes it
+    scpCapture.Append(CAPTURE_RECORD_WRITE, 0, baData);
+    vtpTransport->Write(baData);
+}
+
+//=============================================================================
+//=============================================================================
+bool
+RecordingVspTransport::CanStream(
+    )
+{
+    //Streams if the recorded transport does
+    return vtpTransport->CanStream();
+}
+
+//=============================================================================
+//=============================================================================
+void
+RecordingVspTransport::Stream(
+    const QByteArray &baData
+    )
+{
+    //Records the packet and writes it without response
+    scpCapture.Append(CAPTURE_RECORD_STREAM, 0, baData);
+    vtpTransport->Stream(baData);
+}
+
+//=============================================================================
+//=============================================================================
+void
+RecordingVspTransport::Restart(
+    )
+{
+    //Starts a new capture on the open transport, as if it had just connected, so a session run over a connection which was opened earlier replays on its own
+    scpCapture.Clear();
+    scpCapture.Append(CAPTURE_RECORD_CONNECTED, 0);
+    scpCapture.Append(CAPTURE_RECORD_MTU, vtpTransport->MTU());
+    scpCapture.Append(CAPTURE_RECORD_OPENED, 0);
+}
+
+//=============================================================================
+//=============================================================================
+SessionCapture *
+RecordingVspTransport::Capture(
+    )
+{
+    //Returns what has been recorded
+    return &scpCapture;
+}
+
+//=============================================================================
+//=============================================================================
+void
+RecordingVspTransport::TransportConnected(
+    )
+{
+    //Linked to the module
+    scpCapture.Append(CAPTURE_RECORD_CONNECTED, 0);
+    emit Connected();
+}
+
+//=============================================================================
+//=============================================================================
+void
+RecordingVspTransport::TransportOpened(
+    )
+{
+    //Notifications enabled
+    scpCapture.Append(CAPTURE_RECORD_OPENED, 0);
+    emit Opened();
+}
+
+//=============================================================================
+//=============================================================================
+void
+RecordingVspTransport::TransportClosed(
+    )
+{
+    //Disconnected
+    scpCapture.Append(CAPTURE_RECORD_CLOSED, 0);
+    emit Closed();
+}
+
+//=============================================================================
+//=============================================================================
+void
+RecordingVspTransport::TransportDataReceived(
+    QByteArray baData
+    )
+{
+    //Module output
+    scpCapture.Append(CAPTURE_RECORD_RECEIVED, 0, baData);
+    emit DataReceived(baData);
+}
+
+//=============================================================================
+//=============================================================================
+void
+RecordingVspTransport::TransportDataWritten(
+    qint32 nLength
+    )
+{
+    //Write completed
+    scpCapture.Append(CAPTURE_RECORD_WRITTEN, nLength);
+    emit DataWritten(nLength);
+}
+
+//=============================================================================
+//=============================================================================
+void
+RecordingVspTransport::TransportFlowChanged(
+    bool bBlocked
+    )
+{
+    //Modem out changed
+    scpCapture.Append(CAPTURE_RECORD_FLOW, (bBlocked == true ? 1 : 0));
+    emit FlowChanged(bBlocked);
+}
+
+//=============================================================================
+//=============================================================================
+void
+RecordingVspTransport::TransportMTUChanged(
+    int nMTU
+    )
+{
+    //MTU exchanged
+    scpCapture.Append(CAPTURE_RECORD_MTU, nMTU);
+    ReportMTU(nMTU);
+}
+
+//=============================================================================
+//=============================================================================
+void
+RecordingVspTransport::TransportError(
+    QString strMessage
+    )
+{
+    //Link failed
+    scpCapture.Append(CAPTURE_RECORD_ERROR, 0, strMessage.toUtf8());
+    emit Error(strMessage);
+}
+
+/******************************************************************************/
+// END OF FILE
+/******************************************************************************/
@@ -0,0 +1,114 @@
+/******************************************************************************
+** Copyright (C) 2018 Laird
+**
+** Project: UwVSP-OTA
+**
+** Module: recordingvsptransport.h
+**
+** Notes:
+**
+** License: This program is free software: you can redistribute it and/or
+**          modify it under the terms of the GNU General Public License as
+**          published by the Free Software Foundation, version 3.
+**
+**          This program is distributed in the hope that it will be useful,
+**          but WITHOUT ANY WARRANTY; without even the implied warranty of
+**          MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+**          GNU General Public License for more details.
+**
+**          You should have received a copy of the GNU General Public License
+**          along with this program.  If not, see http://www.gnu.org/licenses/
+**
+*******************************************************************************/
+#ifndef RECORDINGVSPTRANSPORT_H
+#define RECORDINGVSPTRANSPORT_H
+
+/******************************************************************************/
+// Include Files
+/******************************************************************************/
+#include <QObject>
+#include <QByteArray>
+#include "vsptransport.h"
+#include "sessioncapture.h"
+#include "target.h"
+
+/******************************************************************************/
+// Class definitions
+/******************************************************************************/
+//Passes everything through to another transport, recording the packets written and every event from the module with its time so the session can be replayed
+class RecordingVspTransport : public VspTransport
+{
+    Q_OBJECT
+public:
+    explicit
+    RecordingVspTransport(
+        VspTransport *vtpNewTransport,
+        QObject *parent = nullptr
+        );
+    ~RecordingVspTransport(
+        );
+    void
+    Open(
+        ) override;
+    void
+    Close(
+        ) override;
+    void
+    Write(
+        const QByteArray &baData
+        ) override;
+    bool
+    CanStream(
+        ) override;
+    void
+    Stream(
+        const QByteArray &baData
+        ) override;
+    void
+    Restart(
+        );
+    SessionCapture *
+    Capture(
+        );
+
+private slots:
+    void
+    TransportConnected(
+        );
+    void
+    TransportOpened(
+        );
+    void
+    TransportClosed(
+        );
+    void
+    TransportDataReceived(
+        QByteArray baData
+        );
+    void
+    TransportDataWritten(
+        qint32 nLength
+        );
+    void
+    TransportFlowChanged(
+        bool bBlocked
+        );
+    void
+    TransportMTUChanged(
+        int nMTU
+        );
+    void
+    TransportError(
+        QString strMessage
+        );
+
+private:
+    VspTransport *vtpTransport; //Transport being recorded, owned by this transport
+    SessionCapture scpCapture;
+};
+
+#endif // RECORDINGVSPTRANSPORT_H
+
+/******************************************************************************/
+// END OF FILE
+/******************************************************************************/
@@ -0,0 +1,302 @@
+/******************************************************************************
+** Copyright (C) 2018 Laird
+**
+** Project: UwVSP-OTA
+**
+** Module: replayvsptransport.cpp
+**
+** Notes:
+**
+** License: This program is free software: you can redistribute it and/or
+**          modify it under the terms of the GNU General Public License as
+**          published by the Free Software Foundation, version 3.
+**
+**          This program is distributed in the hope that it will be useful,
+**          but WITHOUT ANY WARRANTY; without even the implied warranty of
+**          MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+**          GNU General Public License for more details.
+**
+**          You should have received a copy of the GNU General Public License
+**          along with this program.  If not, see http://www.gnu.org/licenses/
+**
+*******************************************************************************/
+#include "replayvsptransport.h"
+
+//=============================================================================
+//=============================================================================
+ReplayVspTransport::ReplayVspTransport(SessionCapture *scpNewCapture, bool bNewRecordedSpeed, QObject *parent) : VspTransport(parent)
+{
+    //Constructor
+    scpCapture = scpNewCapture;
+    bRecordedSpeed = bNewRecordedSpeed;
+    bOpen = false;
+    nPlayIndex = 0;
+    nWriteIndex = 0;
+    nWritesMatched = 0;
+    nWritesMismatched = 0;
+    nFirstMismatch = -1;
+    tmrPlayTimer.setSingleShot(true);
+    connect(&tmrPlayTimer, SIGNAL(timeout()), this, SLOT(PlayNext()));
+}
+
+//=============================================================================
+//=============================================================================
+ReplayVspTransport::~ReplayVspTransport(
+    )
+{
+    //Destructor
+}
+
+//=============================================================================
+//=============================================================================
+void
+ReplayVspTransport::Open(
+    )
+{
+    //Starts playing the capture from the beginning
+    if (bOpen == true)
+    {
+        return;
+    }
+    bOpen = true;
+    nPlayIndex = 0;
+    nWriteIndex = 0;
+    nWritesMatched = 0;
+    nWritesMismatched = 0;
+    nFirstMismatch = -1;
+    tmrReplayTimer.start();
+    tmrPlayTimer.start(0);
+}
+
+//=============================================================================
+//=============================================================================
+void
+ReplayVspTransport::Close(
+    )
+{
+    //Stops playing, the rest of the capture is not delivered
+    if (bOpen == false)
+    {
+        return;
+    }
+    bOpen = false;
+    tmrPlayTimer.stop();
+    QMetaObject::invokeMethod(this, "Closed", Qt::QueuedConnection);
+}
+
+//=============================================================================
+//=============================================================================
+void
+ReplayVspTransport::Write(
+    const QByteArray &baData
+    )
+{
+    //Compares the packet with the next recorded write
+    Match(CAPTURE_RECORD_WRITE, baData);
+}
+
+//=============================================================================
+//=============================================================================
+bool
+ReplayVspTransport::CanStream(
+    )
+{
+    //Streams if the recorded session streamed
+    for (qint32 i = 0; i < scpCapture->Count(); ++i)
+    {
+        if (scpCapture->Record(i).unType == CAPTURE_RECORD_STREAM)
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+//=============================================================================
+//=============================================================================
+void
+ReplayVspTransport::Stream(
+    const QByteArray &baData
+    )
+{
+    //Compares the packet with the next recorded write, which must also have been streamed
+    Match(CAPTURE_RECORD_STREAM, baData);
+}
+
+//=============================================================================
+//=============================================================================
+void
+ReplayVspTransport::Match(
+    quint8 unType,
+    const QByteArray &baData
+    )
+{
+    //Compares a packet with the next recorded write, which may have been recorded after events the session has not yet been given
+    if (bOpen == false)
+    {
+        return;
+    }
+
+    qint32 nIndex = nWriteIndex;
+    while (nIndex < scpCapture->Count() && IsWrite(scpCapture->Record(nIndex).unType) == false)
+    {
+        ++nIndex;
+    }
+    if (nIndex < scpCapture->Count() && scpCapture->Record(nIndex).unType == unType && scpCapture->Record(nIndex).baData == baData)
+    {
+        ++nWritesMatched;
+    }
+    else
+    {
+        //Different, or there are no more writes in the recording
+        ++nWritesMismatched;
+        if (nFirstMismatch == -1)
+        {
+            nFirstMismatch = nIndex;
+        }
+        if (nIndex >= scpCapture->Count())
+        {
+            return;
+        }
+    }
+    nWriteIndex = nIndex + 1;
+
+    if (!tmrPlayTimer.isActive())
+    {
+        //Playing may have been waiting for this write
+        tmrPlayTimer.start(0);
+    }
+}
+
+//=============================================================================
+//=============================================================================
+qint32
+ReplayVspTransport::WritesMatched(
+    )
+{
+    //Returns the number of writes which were the same as the recording
+    return nWritesMatched;
+}
+
+//=============================================================================
+//=============================================================================
+qint32
+ReplayVspTransport::WritesMismatched(
+    )
+{
+    //Returns the number of writes which differed from the recording or were not in it
+    return nWritesMismatched;
+}
+
+//=============================================================================
+//=============================================================================
+qint32
+ReplayVspTransport::WritesMissing(
+    )
+{
+    //Returns the number of recorded writes the session did not make
+    qint32 nMissing = 0;
+    for (qint32 i = nWriteIndex; i < scpCapture->Count(); ++i)
+    {
+        if (IsWrite(scpCapture->Record(i).unType) == true)
+        {
+            ++nMissing;
+        }
+    }
+    return nMissing;
+}
+
+//=============================================================================
+//=============================================================================
+qint32
+ReplayVspTransport::FirstMismatch(
+    )
+{
+    //Returns the index of the first record the session wrote differently, -1 if every write matched
+    return nFirstMismatch;
+}
+
+//=============================================================================
+//=============================================================================
+void
+ReplayVspTransport::PlayNext(
+    )
+{
+    //Delivers the next event from the module, one per call so the session runs from the event loop as it does with a real module
+    if (bOpen == false)
+    {
+        return;
+    }
+
+    while (nPlayIndex < nWriteIndex && IsWrite(scpCapture->Record(nPlayIndex).unType) == true)
+    {
+        //Already written
+        ++nPlayIndex;
+    }
+    if (nPlayIndex >= scpCapture->Count() || IsWrite(scpCapture->Record(nPlayIndex).unType) == true)
+    {
+        //Finished, or waiting for the session to write
+        return;
+    }
+
+    const SessionCaptureRecord &scrRecord = scpCapture->Record(nPlayIndex);
+    if (bRecordedSpeed == true)
+    {
+        qint64 nDue = scrRecord.nTime / 1000 - tmrReplayTimer.elapsed();
+        if (nDue > 0)
+        {
+            //Not yet
+            tmrPlayTimer.start(nDue);
+            return;
+        }
+    }
+    ++nPlayIndex;
+    tmrPlayTimer.start(0);
+
+    switch (scrRecord.unType)
+    {
+        case CAPTURE_RECORD_CONNECTED:
+            emit Connected();
+            break;
+        case CAPTURE_RECORD_MTU:
+            ReportMTU(scrRecord.unValue);
+            break;
+        case CAPTURE_RECORD_OPENED:
+            emit Opened();
+            break;
+        case CAPTURE_RECORD_WRITTEN:
+            emit DataWritten(scrRecord.unValue);
+            break;
+        case CAPTURE_RECORD_RECEIVED:
+            emit DataReceived(scrRecord.baData);
+            break;
+        case CAPTURE_RECORD_FLOW:
+            emit FlowChanged(scrRecord.unValue != 0);
+            break;
+        case CAPTURE_RECORD_ERROR:
+            emit Error(QString::fromUtf8(scrRecord.baData));
+            break;
+        case CAPTURE_RECORD_CLOSED:
+            bOpen = false;
+            tmrPlayTimer.stop();
+            emit Closed();
+            break;
+        default:
+            break;
+    }
+}
+
+//=============================================================================
+//=============================================================================
+bool
+ReplayVspTransport::IsWrite(
+    quint8 unType
+    )
+{
+    //Returns true if the record is a packet written by the session, with or without response
+    return (unType == CAPTURE_RECORD_WRITE || unType == CAPTURE_RECORD_STREAM);
+}
+
+/******************************************************************************/
+// END OF FILE
+/******************************************************************************/
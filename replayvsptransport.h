@@ -0,0 +1,117 @@
+/******************************************************************************
+** Copyright (C) 2018 Laird
+**
+** Project: UwVSP-OTA
+**
+** Module: replayvsptransport.h
+**
+** Notes:
+**
+** License: This program is free software: you can redistribute it and/or
+**          modify it under the terms of the GNU General Public License as
+**          published by the Free Software Foundation, version 3.
+**
+**          This program is distributed in the hope that it will be useful,
+**          but WITHOUT ANY WARRANTY; without even the implied warranty of
+**          MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+**          GNU General Public License for more details.
+**
+**          You should have received a copy of the GNU General Public License
+**          along with this program.  If not, see http://www.gnu.org/licenses/
+**
+*******************************************************************************/
+#ifndef REPLAYVSPTRANSPORT_H
+#define REPLAYVSPTRANSPORT_H
+
+/******************************************************************************/
+// Include Files
+/******************************************************************************/
+#include <QObject>
+#include <QByteArray>
+#include <QTimer>
+#include <QElapsedTimer>
+#include "vsptransport.h"
+#include "sessioncapture.h"
+#include "target.h"
+
+/******************************************************************************/
+// Class definitions
+/******************************************************************************/
+//Plays the module side of a recorded connection back to a session. Events from the module are delivered in their recorded order, each one that followed a write
+//in the recording waits for the session to make that write, so a session given the same options and application runs exactly as it did when it was recorded.
+//Events are delivered as fast as the session handles them, or at the times they were recorded
+class ReplayVspTransport : public VspTransport
+{
+    Q_OBJECT
+public:
+    explicit
+    ReplayVspTransport(
+        SessionCapture *scpNewCapture,
+        bool bNewRecordedSpeed = false,
+        QObject *parent = nullptr
+        );
+    ~ReplayVspTransport(
+        );
+    void
+    Open(
+        ) override;
+    void
+    Close(
+        ) override;
+    void
+    Write(
+        const QByteArray &baData
+        ) override;
+    bool
+    CanStream(
+        ) override;
+    void
+    Stream(
+        const QByteArray &baData
+        ) override;
+    qint32
+    WritesMatched(
+        );
+    qint32
+    WritesMismatched(
+        );
+    qint32
+    WritesMissing(
+        );
+    qint32
+    FirstMismatch(
+        );
+
+private slots:
+    void
+    PlayNext(
+        );
+
+private:
+    void
+    Match(
+        quint8 unType,
+        const QByteArray &baData
+        );
+    static bool
+    IsWrite(
+        quint8 unType
+        );
+
+    SessionCapture *scpCapture; //Capture being played, not owned by the transport
+    bool bRecordedSpeed;        //True to deliver events at their recorded times
+    bool bOpen;                 //True from Open() until Close() or the recorded disconnection
+    qint32 nPlayIndex;          //Next record to play
+    qint32 nWriteIndex;         //Records before this have been played or written
+    qint32 nWritesMatched;      //Writes which were the same as the recorded write
+    qint32 nWritesMismatched;   //Writes which differed from the recorded write, or were not in the recording
+    qint32 nFirstMismatch;      //Index of the first record written differently, -1 if none
+    QTimer tmrPlayTimer;
+    QElapsedTimer tmrReplayTimer; //Time since Open()
+};
+
+#endif // REPLAYVSPTRANSPORT_H
+
+/******************************************************************************/
+// END OF FILE
+/******************************************************************************/
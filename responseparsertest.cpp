@@ -0,0 +1,219 @@
+/******************************************************************************
+** Copyright (C) 2018 Laird
+**
+** Project: UwVSP-OTA
+**
+** Module: responseparsertest.cpp
+**
+** Notes:
+**
+** License: This program is free software: you can redistribute it and/or
+**          modify it under the terms of the GNU General Public License as
+**          published by the Free Software Foundation, version 3.
+**
+**          This program is distributed in the hope that it will be useful,
+**          but WITHOUT ANY WARRANTY; without even the implied warranty of
+**          MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+**          GNU General Public License for more details.
+**
+**          You should have received a copy of the GNU General Public License
+**          along with this program.  If not, see http://www.gnu.org/licenses/
+**
+*******************************************************************************/
+#include "responseparsertest.h"
+
+/******************************************************************************/
+// Constants
+/******************************************************************************/
+//Responses to the query made before a load, as the module sends them
+static const QByteArray baQueryTranscript = "\n10\t0\tBL654\r\n00\r"
+                                            "\n10\t3\t29.4.6.0\r\n00\r"
+                                            "\n10\t6\t487424,212992,4096\r\n00\r"
+                                            "\n10\t13\t1A2B 3C4D\r\n00\r"
+                                            "\n06\t$autorun$\r\n06\tapp\r\n00\r"
+                                            "\n10\t49452\tC3E1\r\n00\r"
+                                            "\n01\tE00C\r";
+
+//Responses found in baQueryTranscript
+static const QStringList lstQueryResponses = QStringList() << "INFO 0 BL654" << "OK" << "INFO 3 29.4.6.0" << "OK" << "INFO 6 487424,212992,4096" << "OK"
+                                                           << "INFO 13 1A2B 3C4D" << "OK" << "DIR $autorun$" << "DIR app" << "OK" << "INFO 49452 C3E1" << "OK"
+                                                           << "ERROR E00C E00C";
+
+//=============================================================================
+//=============================================================================
+QStringList
+ResponseParserTest::Describe(
+    const QVector<ModuleResponse> &vecResponses
+    )
+{
+    //Returns each response as text so lists of responses can be compared
+    QStringList lstDescriptions;
+    for (qint32 i = 0; i < vecResponses.count(); ++i)
+    {
+        const ModuleResponse &mrResponse = vecResponses.at(i);
+        if (mrResponse.unType == RESPONSE_TYPE_OK)
+        {
+            lstDescriptions << "OK";
+        }
+        else if (mrResponse.unType == RESPONSE_TYPE_ERROR)
+        {
+            lstDescriptions << QString("ERROR %1 %2").arg(mrResponse.unCode, 4, 16, QChar('0')).toUpper().arg(QString(mrResponse.baValue));
+        }
+        else if (mrResponse.unType == RESPONSE_TYPE_INFO)
+        {
+            lstDescriptions << QString("INFO %1 %2").arg(mrResponse.unCode).arg(QString(mrResponse.baValue));
+        }
+        else if (mrResponse.unType == RESPONSE_TYPE_DIRECTORY)
+        {
+            lstDescriptions << QString("DIR %1").arg(QString(mrResponse.baValue));
+        }
+    }
+    return lstDescriptions;
+}
+
+//=============================================================================
+//=============================================================================
+QStringList
+ResponseParserTest::ParseAll(
+    ModuleResponseParser *mrpParser,
+    const QByteArrayList &balNotifications
+    )
+{
+    //Parses each notification in turn and returns the responses from all of them
+    QVector<ModuleResponse> vecResponses;
+    for (qint32 i = 0; i < balNotifications.count(); ++i)
+    {
+        vecResponses += mrpParser->Parse(balNotifications.at(i));
+    }
+    return Describe(vecResponses);
+}
+
+//=============================================================================
+//=============================================================================
+void
+ResponseParserTest::SuccessSplitAcrossNotifications(
+    )
+{
+    //A success response split at any point is returned once, when its carriage return arrives
+    const QByteArray baSuccess = "\n00\r";
+    for (qint32 nSplit = 1; nSplit < baSuccess.length(); ++nSplit)
+    {
+        ModuleResponseParser mrpParser;
+        QVERIFY(mrpParser.Parse(baSuccess.left(nSplit)).isEmpty());
+        QCOMPARE(Describe(mrpParser.Parse(baSuccess.mid(nSplit))), QStringList() << "OK");
+    }
+
+    //Split over three notifications
+    ModuleResponseParser mrpParser;
+    QCOMPARE(ParseAll(&mrpParser, QByteArrayList() << "\n0" << "0" << "\r"), QStringList() << "OK");
+
+    //The end of one response and the start of the next in the same notification
+    QCOMPARE(ParseAll(&mrpParser, QByteArrayList() << "\n00\r\n0" << "0\r"), QStringList() << "OK" << "OK");
+}
+
+//=============================================================================
+//=============================================================================
+void
+ResponseParserTest::QueryTranscriptSplitAtEveryPosition(
+    )
+{
+    //The transcript is split into two notifications at every position
+    for (qint32 nSplit = 0; nSplit <= baQueryTranscript.length(); ++nSplit)
+    {
+        ModuleResponseParser mrpParser;
+        QCOMPARE(ParseAll(&mrpParser, QByteArrayList() << baQueryTranscript.left(nSplit) << baQueryTranscript.mid(nSplit)), lstQueryResponses);
+
+        const ModuleInformation &mdiInfo = mrpParser.Information();
+        QCOMPARE(mdiInfo.strDevice, QString("BL654"));
+        QCOMPARE(mdiInfo.strFirmware, QString("29.4.6.0"));
+        QCOMPARE(mdiInfo.strStorageTotal, QString("487424"));
+        QCOMPARE(mdiInfo.strStorageFree, QString("212992"));
+        QCOMPARE(mdiInfo.strXCompilerA, QString("1A2B"));
+        QCOMPARE(mdiInfo.strXCompilerB, QString("3C4D"));
+        QCOMPARE(mdiInfo.strCRC, QString("C3E1"));
+        QCOMPARE(mdiInfo.balFiles, QByteArrayList() << "$autorun$" << "app");
+    }
+}
+
+//=============================================================================
+//=============================================================================
+void
+ResponseParserTest::QueryTranscriptOneByteAtATime(
+    )
+{
+    //Every byte of the transcript arrives in its own notification
+    QByteArrayList balNotifications;
+    for (qint32 i = 0; i < baQueryTranscript.length(); ++i)
+    {
+        balNotifications << baQueryTranscript.mid(i, 1);
+    }
+    ModuleResponseParser mrpParser;
+    QCOMPARE(ParseAll(&mrpParser, balNotifications), lstQueryResponses);
+}
+
+//=============================================================================
+//=============================================================================
+void
+ResponseParserTest::ErrorCodes_data(
+    )
+{
+    //Error responses and what is returned for them, error codes are in hex
+    QTest::addColumn<QByteArray>("baData");
+    QTest::addColumn<QStringList>("lstExpected");
+    QTest::newRow("file not open") << QByteArray("\n01\tE00C\r") << (QStringList() << "ERROR E00C E00C");
+    QTest::newRow("lower case") << QByteArray("\n01\te00c\r") << (QStringList() << "ERROR E00C e00c");
+    QTest::newRow("numeric") << QByteArray("\n01\t1809\r") << (QStringList() << "ERROR 1809 1809");
+    QTest::newRow("after success") << QByteArray("\n00\r\n01\t0013\r") << (QStringList() << "OK" << "ERROR 0013 0013");
+    QTest::newRow("not hex") << QByteArray("\n01\tXYZ\r") << QStringList();
+    QTest::newRow("no code") << QByteArray("\n01\r") << QStringList();
+    QTest::newRow("no tab") << QByteArray("\n01E00C\r") << QStringList();
+}
+
+//=============================================================================
+//=============================================================================
+void
+ResponseParserTest::ErrorCodes(
+    )
+{
+    //Error responses whole and split at every position
+    QFETCH(QByteArray, baData);
+    QFETCH(QStringList, lstExpected);
+    for (qint32 nSplit = 0; nSplit <= baData.length(); ++nSplit)
+    {
+        ModuleResponseParser mrpParser;
+        QCOMPARE(ParseAll(&mrpParser, QByteArrayList() << baData.left(nSplit) << baData.mid(nSplit)), lstExpected);
+    }
+}
+
+//=============================================================================
+//=============================================================================
+void
+ResponseParserTest::OverlongLineIsSkipped(
+    )
+{
+    //A line longer than any response is skipped up to its end, without losing the response after it
+    ModuleResponseParser mrpParser;
+    QByteArray baOverlong(RESPONSE_MAX_LINE_LENGTH + 10, 'x');
+    QCOMPARE(ParseAll(&mrpParser, QByteArrayList() << baOverlong.left(100) << baOverlong.mid(100) << "\n00\r" << "\n00\r"), QStringList() << "OK");
+    QCOMPARE(ParseAll(&mrpParser, QByteArrayList() << "\n00\r"), QStringList() << "OK");
+}
+
+//=============================================================================
+//=============================================================================
+void
+ResponseParserTest::ResetDiscardsPartialLine(
+    )
+{
+    //The start of a line received before a reset does not join the data after it
+    ModuleResponseParser mrpParser;
+    QCOMPARE(ParseAll(&mrpParser, QByteArrayList() << "\n10\t3\t29.4.6.0\r\n0"), QStringList() << "INFO 3 29.4.6.0");
+    mrpParser.Reset();
+    QVERIFY(mrpParser.Information().strFirmware.isEmpty());
+    QCOMPARE(ParseAll(&mrpParser, QByteArrayList() << "1\tE00C\r" << "\n00\r"), QStringList() << "OK");
+}
+
+QTEST_GUILESS_MAIN(ResponseParserTest)
+
+/******************************************************************************/
+// END OF FILE
+/******************************************************************************/
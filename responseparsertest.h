@@ -0,0 +1,82 @@
+/******************************************************************************
+** Copyright (C) 2018 Laird
+**
+** Project: UwVSP-OTA
+**
+** Module: responseparsertest.h
+**
+** Notes:
+**
+** License: This program is free software: you can redistribute it and/or
+**          modify it under the terms of the GNU General Public License as
+**          published by the Free Software Foundation, version 3.
+**
+**          This program is distributed in the hope that it will be useful,
+**          but WITHOUT ANY WARRANTY; without even the implied warranty of
+**          MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+**          GNU General Public License for more details.
+**
+**          You should have received a copy of the GNU General Public License
+**          along with this program.  If not, see http://www.gnu.org/licenses/
+**
+*******************************************************************************/
+#ifndef RESPONSEPARSERTEST_H
+#define RESPONSEPARSERTEST_H
+
+/******************************************************************************/
+// Include Files
+/******************************************************************************/
+#include <QObject>
+#include <QStringList>
+#include <QtTest>
+#include "moduleresponseparser.h"
+
+/******************************************************************************/
+// Class definitions
+/******************************************************************************/
+//Parses transcripts of module responses delivered in notifications split at every position, checking the same responses and module details are found
+//however the lines are divided between notifications
+class ResponseParserTest : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    void
+    SuccessSplitAcrossNotifications(
+        );
+    void
+    QueryTranscriptSplitAtEveryPosition(
+        );
+    void
+    QueryTranscriptOneByteAtATime(
+        );
+    void
+    ErrorCodes(
+        );
+    void
+    ErrorCodes_data(
+        );
+    void
+    OverlongLineIsSkipped(
+        );
+    void
+    ResetDiscardsPartialLine(
+        );
+
+private:
+    static QStringList
+    Describe(
+        const QVector<ModuleResponse> &vecResponses
+        );
+    static QStringList
+    ParseAll(
+        ModuleResponseParser *mrpParser,
+        const QByteArrayList &balNotifications
+        );
+};
+
+#endif // RESPONSEPARSERTEST_H
+
+/******************************************************************************/
+// END OF FILE
+/******************************************************************************/
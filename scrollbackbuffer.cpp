@@ -0,0 +1,207 @@
+/******************************************************************************
+** Copyright (C) 2018 Laird
+**
+** Project: UwVSP-OTA
+**
+** Module: scrollbackbuffer.cpp
+**
+** Notes:
+**
+** License: This program is free software: you can redistribute it and/or
+**          modify it under the terms of the GNU General Public License as
+**          published by the Free Software Foundation, version 3.
+**
+**          This program is distributed in the hope that it will be useful,
+**          but WITHOUT ANY WARRANTY; without even the implied warranty of
+**          MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+**          GNU General Public License for more details.
+**
+**          You should have received a copy of the GNU General Public License
+**          along with this program.  If not, see http://www.gnu.org/licenses/
+**
+*******************************************************************************/
+#include "scrollbackbuffer.h"
+#include <string.h>
+
+//=============================================================================
+//=============================================================================
+ScrollbackBuffer::ScrollbackBuffer(QObject *parent) : QObject(parent)
+{
+    //Constructor
+    nBasePosition = 0;
+    nStartPosition = 0;
+    unCapacity = 0;
+    nOldestLine = 0;
+    nLineCount = 0;
+    nShownPosition = 0;
+    bShownInvalid = false;
+}
+
+//=============================================================================
+//=============================================================================
+ScrollbackBuffer::~ScrollbackBuffer(
+    )
+{
+    //Destructor
+}
+
+//=============================================================================
+//=============================================================================
+void
+ScrollbackBuffer::SetCapacity(
+    quint32 unNewCapacity
+    )
+{
+    //Sets the maximum number of lines to keep, the kept text is re-indexed once and the oldest lines are dropped if there are too many
+    if (unNewCapacity == unCapacity)
+    {
+        return;
+    }
+
+    QByteArray baKept = Text();
+    Clear();
+    unCapacity = unNewCapacity;
+    Append(baKept);
+}
+
+//=============================================================================
+//=============================================================================
+void
+ScrollbackBuffer::Append(
+    const QByteArray &baNewData
+    )
+{
+    //Adds text to the end of the buffer, only the new data is scanned for line feeds and each line beyond the capacity drops the oldest line
+    const qint64 nAppendPosition = nBasePosition + baData.length();
+    baData.append(baNewData);
+    if (unCapacity == 0)
+    {
+        //No limit so lines do not need to be tracked
+        return;
+    }
+
+    const char *pData = baNewData.constData();
+    const char *pEnd = pData + baNewData.length();
+    while (pData < pEnd)
+    {
+        const char *pLineFeed = (const char *)memchr(pData, '\n', pEnd - pData);
+        if (pLineFeed == NULL)
+        {
+            break;
+        }
+        pData = pLineFeed + 1;
+
+        const qint64 nLineEnd = nAppendPosition + (pData - baNewData.constData());
+        if ((quint32)nLineCount < unCapacity)
+        {
+            //Room for another line, the ring only grows whilst filling so no lines have been dropped yet
+            vecLineEnds.append(nLineEnd);
+            ++nLineCount;
+        }
+        else
+        {
+            //Drop the oldest line and reuse its slot
+            nStartPosition = vecLineEnds.at(nOldestLine);
+            vecLineEnds[nOldestLine] = nLineEnd;
+            nOldestLine = (nOldestLine + 1) % unCapacity;
+        }
+    }
+
+    Compact();
+}
+
+//=============================================================================
+//=============================================================================
+void
+ScrollbackBuffer::Clear(
+    )
+{
+    //Removes all text
+    baData.clear();
+    vecLineEnds.clear();
+    nBasePosition = 0;
+    nStartPosition = 0;
+    nOldestLine = 0;
+    nLineCount = 0;
+    nShownPosition = 0;
+    bShownInvalid = true;
+}
+
+//=============================================================================
+//=============================================================================
+QByteArray
+ScrollbackBuffer::Text(
+    )
+{
+    //Returns the kept text
+    return baData.mid(nStartPosition - nBasePosition);
+}
+
+//=============================================================================
+//=============================================================================
+qint32
+ScrollbackBuffer::Length(
+    )
+{
+    //Returns the length of the kept text
+    return baData.length() - (nStartPosition - nBasePosition);
+}
+
+//=============================================================================
+//=============================================================================
+QByteArray
+ScrollbackBuffer::TakeUnshown(
+    bool *pbReplace
+    )
+{
+    //Returns the text added since the last call so the display only has to append it. If text which was never shown has since been dropped, all kept text is returned and pbReplace is set to show the display must be replaced. A UTF-8 sequence which is not complete yet is held back until the rest of it arrives
+    qint64 nEndPosition = nBasePosition + baData.length();
+    const unsigned char *pucData = (const unsigned char *)baData.constData();
+    qint32 nCheck = baData.length() - 1;
+    qint32 nContinuation = 0;
+    while (nCheck >= 0 && nContinuation < 3 && (pucData[nCheck] & 0xC0) == 0x80)
+    {
+        //Continuation byte
+        --nCheck;
+        ++nContinuation;
+    }
+    if (nCheck >= 0 && pucData[nCheck] >= 0xC0)
+    {
+        //Lead byte, work out how long its sequence is
+        qint32 nSequenceLength = (pucData[nCheck] >= 0xF0 ? 4 : (pucData[nCheck] >= 0xE0 ? 3 : 2));
+        if (nContinuation + 1 < nSequenceLength)
+        {
+            nEndPosition -= nContinuation + 1;
+        }
+    }
+
+    *pbReplace = (bShownInvalid == true || nShownPosition < nStartPosition);
+    qint64 nFrom = (*pbReplace == true ? nStartPosition : nShownPosition);
+    if (nEndPosition < nFrom)
+    {
+        //The held back sequence started before the first kept byte
+        nEndPosition = nFrom;
+    }
+    nShownPosition = nEndPosition;
+    bShownInvalid = false;
+    return baData.mid(nFrom - nBasePosition, nEndPosition - nFrom);
+}
+
+//=============================================================================
+//=============================================================================
+void
+ScrollbackBuffer::Compact(
+    )
+{
+    //Releases dropped lines once they take up over half of the buffer, so each byte is only moved a constant number of times
+    const qint32 nDropped = nStartPosition - nBasePosition;
+    if (nDropped > 0 && nDropped >= baData.length() / 2)
+    {
+        baData.remove(0, nDropped);
+        nBasePosition = nStartPosition;
+    }
+}
+
+/******************************************************************************/
+// END OF FILE
+/******************************************************************************/
@@ -0,0 +1,89 @@
+/******************************************************************************
+** Copyright (C) 2018 Laird
+**
+** Project: UwVSP-OTA
+**
+** Module: scrollbackbuffer.h
+**
+** Notes:
+**
+** License: This program is free software: you can redistribute it and/or
+**          modify it under the terms of the GNU General Public License as
+**          published by the Free Software Foundation, version 3.
+**
+**          This program is distributed in the hope that it will be useful,
+**          but WITHOUT ANY WARRANTY; without even the implied warranty of
+**          MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+**          GNU General Public License for more details.
+**
+**          You should have received a copy of the GNU General Public License
+**          along with this program.  If not, see http://www.gnu.org/licenses/
+**
+*******************************************************************************/
+#ifndef SCROLLBACKBUFFER_H
+#define SCROLLBACKBUFFER_H
+
+/******************************************************************************/
+// Include Files
+/******************************************************************************/
+#include <QObject>
+#include <QByteArray>
+#include <QVector>
+#include "target.h"
+
+/******************************************************************************/
+// Class definitions
+/******************************************************************************/
+class ScrollbackBuffer : public QObject
+{
+    Q_OBJECT
+public:
+    explicit
+    ScrollbackBuffer(
+        QObject *parent = nullptr
+        );
+    ~ScrollbackBuffer(
+        );
+    void
+    SetCapacity(
+        quint32 unNewCapacity
+        );
+    void
+    Append(
+        const QByteArray &baNewData
+        );
+    void
+    Clear(
+        );
+    QByteArray
+    Text(
+        );
+    qint32
+    Length(
+        );
+    QByteArray
+    TakeUnshown(
+        bool *pbReplace
+        );
+
+private:
+    void
+    Compact(
+        );
+
+    QByteArray baData;           //Buffered text, the start may hold lines which have already been dropped
+    qint64 nBasePosition;        //Stream position of the first byte in baData
+    qint64 nStartPosition;       //Stream position of the first line which is kept
+    quint32 unCapacity;          //Maximum number of lines kept, 0 for no limit
+    QVector<qint64> vecLineEnds; //Ring of stream positions just after each kept line feed
+    qint32 nOldestLine;          //Index in vecLineEnds of the oldest kept line
+    qint32 nLineCount;           //Number of line feeds in vecLineEnds
+    qint64 nShownPosition;       //Stream position up to which text has been passed to the display
+    bool bShownInvalid;          //True if the display must be replaced as text it has not shown has been dropped or cleared
+};
+
+#endif // SCROLLBACKBUFFER_H
+
+/******************************************************************************/
+// END OF FILE
+/******************************************************************************/
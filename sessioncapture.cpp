@@ -0,0 +1,264 @@
+/******************************************************************************
+** Copyright (C) 2018 Laird
+**
+** Project: UwVSP-OTA
+**
+** Module: sessioncapture.cpp
+**
+** Notes:
+**
+** License: This program is free software: you can redistribute it and/or
+**          modify it under the terms of the GNU General Public License as
+**          published by the Free Software Foundation, version 3.
+**
+**          This program is distributed in the hope that it will be useful,
+**          but WITHOUT ANY WARRANTY; without even the implied warranty of
+**          MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+**          GNU General Public License for more details.
+**
+**          You should have received a copy of the GNU General Public License
+**          along with this program.  If not, see http://www.gnu.org/licenses/
+**
+*******************************************************************************/
+#include "sessioncapture.h"
+
+//=============================================================================
+//=============================================================================
+SessionCapture::SessionCapture(QObject *parent) : QObject(parent)
+{
+    //Constructor
+    nLastTime = 0;
+}
+
+//=============================================================================
+//=============================================================================
+SessionCapture::~SessionCapture(
+    )
+{
+    //Destructor
+}
+
+//=============================================================================
+//=============================================================================
+void
+SessionCapture::Clear(
+    )
+{
+    //Removes everything, the next record starts the capture time again
+    joHeader = QJsonObject();
+    baSourceData.clear();
+    baCompiledData.clear();
+    baRecords.clear();
+    vecRecords.clear();
+    tmrCaptureTimer.invalidate();
+    nLastTime = 0;
+}
+
+//=============================================================================
+//=============================================================================
+void
+SessionCapture::Append(
+    quint8 unType,
+    quint32 unValue,
+    const QByteArray &baData
+    )
+{
+    //Encodes a record at the end of the capture, data is limited to 65535 bytes which is far larger than any packet
+    if (!tmrCaptureTimer.isValid())
+    {
+        tmrCaptureTimer.start();
+    }
+    qint64 nTime = tmrCaptureTimer.nsecsElapsed() / 1000;
+    quint32 unDelta = (quint32)qMin(nTime - nLastTime, (qint64)0xFFFFFFFF);
+    nLastTime += unDelta;
+    quint16 unLength = (quint16)qMin(baData.isEmpty() ? unValue : (quint32)baData.length(), (quint32)0xFFFF);
+
+    char cRecord[7];
+    cRecord[0] = (char)unType;
+    cRecord[1] = (char)(unDelta >> 24);
+    cRecord[2] = (char)(unDelta >> 16);
+    cRecord[3] = (char)(unDelta >> 8);
+    cRecord[4] = (char)unDelta;
+    cRecord[5] = (char)(unLength >> 8);
+    cRecord[6] = (char)unLength;
+    baRecords.append(cRecord, sizeof(cRecord));
+    if (!baData.isEmpty())
+    {
+        baRecords.append(baData.constData(), unLength);
+    }
+}
+
+//=============================================================================
+//=============================================================================
+void
+SessionCapture::SetHeader(
+    const QJsonObject &joNewHeader
+    )
+{
+    //Sets the details of the session that was recorded
+    joHeader = joNewHeader;
+}
+
+//=============================================================================
+//=============================================================================
+QJsonObject
+SessionCapture::Header(
+    )
+{
+    //Returns the details of the session that was recorded
+    return joHeader;
+}
+
+//=============================================================================
+//=============================================================================
+void
+SessionCapture::SetApplication(
+    const QByteArray &baNewSourceData,
+    const QByteArray &baNewCompiledData
+    )
+{
+    //Sets the application the session was given and the XCompiled application, which is empty if it was not XCompiled
+    baSourceData = baNewSourceData;
+    baCompiledData = baNewCompiledData;
+}
+
+//=============================================================================
+//=============================================================================
+QByteArray
+SessionCapture::SourceData(
+    )
+{
+    //Returns the application the session was given
+    return baSourceData;
+}
+
+//=============================================================================
+//=============================================================================
+QByteArray
+SessionCapture::CompiledData(
+    )
+{
+    //Returns the XCompiled application, empty if it was not XCompiled
+    return baCompiledData;
+}
+
+//=============================================================================
+//=============================================================================
+qint32
+SessionCapture::Count(
+    )
+{
+    //Returns the number of records loaded
+    return vecRecords.count();
+}
+
+//=============================================================================
+//=============================================================================
+const SessionCaptureRecord &
+SessionCapture::Record(
+    qint32 nIndex
+    )
+{
+    //Returns a loaded record
+    return vecRecords.at(nIndex);
+}
+
+//=============================================================================
+//=============================================================================
+bool
+SessionCapture::Save(
+    const QString &strFilename
+    )
+{
+    //Writes the capture, returns false if it could not be written
+    QDir().mkpath(QFileInfo(strFilename).absolutePath());
+    QFile fileCapture(strFilename);
+    if (!fileCapture.open(QIODevice::WriteOnly | QIODevice::Truncate))
+    {
+        return false;
+    }
+    QDataStream dsCapture(&fileCapture);
+    dsCapture.setVersion(QDataStream::Qt_5_0);
+    dsCapture << CAPTURE_FILE_MAGIC << CAPTURE_FILE_VERSION << QJsonDocument(joHeader).toJson(QJsonDocument::Compact) << baSourceData << baCompiledData << baRecords;
+    fileCapture.close();
+    return (dsCapture.status() == QDataStream::Ok);
+}
+
+//=============================================================================
+//=============================================================================
+bool
+SessionCapture::Load(
+    const QString &strFilename
+    )
+{
+    //Reads a capture and decodes its records, returns false if it is not a valid capture
+    Clear();
+    QFile fileCapture(strFilename);
+    if (!fileCapture.open(QIODevice::ReadOnly))
+    {
+        return false;
+    }
+    QDataStream dsCapture(&fileCapture);
+    dsCapture.setVersion(QDataStream::Qt_5_0);
+    quint32 unMagic = 0;
+    quint16 unVersion = 0;
+    QByteArray baHeader;
+    dsCapture >> unMagic >> unVersion;
+    if (unMagic != CAPTURE_FILE_MAGIC || unVersion == 0 || unVersion > CAPTURE_FILE_VERSION)
+    {
+        return false;
+    }
+    dsCapture >> baHeader >> baSourceData >> baCompiledData >> baRecords;
+    fileCapture.close();
+    if (dsCapture.status() != QDataStream::Ok)
+    {
+        Clear();
+        return false;
+    }
+    joHeader = QJsonDocument::fromJson(baHeader).object();
+
+    const uchar *pucRecords = (const uchar *)baRecords.constData();
+    qint32 nPosition = 0;
+    qint64 nTime = 0;
+    while (nPosition + 7 <= baRecords.length())
+    {
+        SessionCaptureRecord scrRecord;
+        scrRecord.unType = pucRecords[nPosition];
+        nTime += ((quint32)pucRecords[nPosition + 1] << 24) | ((quint32)pucRecords[nPosition + 2] << 16) | ((quint32)pucRecords[nPosition + 3] << 8) | pucRecords[nPosition + 4];
+        scrRecord.nTime = nTime;
+        quint16 unLength = ((quint16)pucRecords[nPosition + 5] << 8) | pucRecords[nPosition + 6];
+        nPosition += 7;
+        if (scrRecord.unType == CAPTURE_RECORD_WRITE || scrRecord.unType == CAPTURE_RECORD_STREAM || scrRecord.unType == CAPTURE_RECORD_RECEIVED || scrRecord.unType == CAPTURE_RECORD_ERROR)
+        {
+            //Record has data
+            if (nPosition + unLength > baRecords.length())
+            {
+                //Truncated
+                break;
+            }
+            scrRecord.unValue = unLength;
+            scrRecord.baData = baRecords.mid(nPosition, unLength);
+            nPosition += unLength;
+        }
+        else
+        {
+            scrRecord.unValue = unLength;
+        }
+        vecRecords.append(scrRecord);
+    }
+    return true;
+}
+
+//=============================================================================
+//=============================================================================
+QString
+SessionCapture::DefaultDirectory(
+    )
+{
+    //Returns the directory in the user data directory recorded sessions are saved to
+    return QStandardPaths::writableLocation(QStandardPaths::GenericDataLocation).append('/').append(SESSION_CAPTURE_DIRECTORY);
+}
+
+/******************************************************************************/
+// END OF FILE
+/******************************************************************************/
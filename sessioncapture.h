@@ -0,0 +1,153 @@
+/******************************************************************************
+** Copyright (C) 2018 Laird
+**
+** Project: UwVSP-OTA
+**
+** Module: sessioncapture.h
+**
+** Notes:
+**
+** License: This program is free software: you can redistribute it and/or
+**          modify it under the terms of the GNU General Public License as
+**          published by the Free Software Foundation, version 3.
+**
+**          This program is distributed in the hope that it will be useful,
+**          but WITHOUT ANY WARRANTY; without even the implied warranty of
+**          MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+**          GNU General Public License for more details.
+**
+**          You should have received a copy of the GNU General Public License
+**          along with this program.  If not, see http://www.gnu.org/licenses/
+**
+*******************************************************************************/
+#ifndef SESSIONCAPTURE_H
+#define SESSIONCAPTURE_H
+
+/******************************************************************************/
+// Include Files
+/******************************************************************************/
+#include <QObject>
+#include <QByteArray>
+#include <QString>
+#include <QVector>
+#include <QElapsedTimer>
+#include <QJsonObject>
+#include <QJsonDocument>
+#include <QDataStream>
+#include <QFile>
+#include <QFileInfo>
+#include <QDir>
+#include <QStandardPaths>
+#include "target.h"
+
+/******************************************************************************/
+// Constants
+/******************************************************************************/
+//Identifies a capture file and the version of its layout
+const quint32 CAPTURE_FILE_MAGIC         = 0x56535043; //"VSPC"
+const quint16 CAPTURE_FILE_VERSION       = 2; //Version 2 added CAPTURE_RECORD_STREAM
+
+//Extension of capture files
+const char CAPTURE_FILE_EXTENSION[]      = ".vspcap";
+
+//Recorded transport events, the value recorded with each is given
+const quint8 CAPTURE_RECORD_CONNECTED    = 0;
+const quint8 CAPTURE_RECORD_MTU          = 1; //MTU
+const quint8 CAPTURE_RECORD_OPENED       = 2;
+const quint8 CAPTURE_RECORD_WRITE        = 3; //Packet written to the module, data
+const quint8 CAPTURE_RECORD_WRITTEN      = 4; //Length
+const quint8 CAPTURE_RECORD_RECEIVED     = 5; //Data received from the module, data
+const quint8 CAPTURE_RECORD_FLOW         = 6; //1 if the module has stopped the flow of data
+const quint8 CAPTURE_RECORD_ERROR        = 7; //Message, data
+const quint8 CAPTURE_RECORD_CLOSED       = 8;
+const quint8 CAPTURE_RECORD_STREAM       = 9; //Packet written to the module without response, data
+
+/******************************************************************************/
+// Structures
+/******************************************************************************/
+//A single recorded event
+struct SessionCaptureRecord
+{
+    qint64 nTime;      //Microseconds since recording started
+    quint8 unType;     //One of the CAPTURE_RECORD_ values
+    quint32 unValue;   //Value of events without data
+    QByteArray baData; //Data of events with data
+};
+
+/******************************************************************************/
+// Class definitions
+/******************************************************************************/
+//Events of one connection to a module with their timing, and what is needed to run the same session again against them: the session options (header), the
+//application data given to the session and, if it was XCompiled, the XCompiled application. Records are kept encoded as they are added, each is the type, the
+//time since the previous record (microseconds), the value or data length (16 bits) and the data, so a transfer costs little more than its own size
+class SessionCapture : public QObject
+{
+    Q_OBJECT
+public:
+    explicit
+    SessionCapture(
+        QObject *parent = nullptr
+        );
+    ~SessionCapture(
+        );
+    void
+    Clear(
+        );
+    void
+    Append(
+        quint8 unType,
+        quint32 unValue,
+        const QByteArray &baData = QByteArray()
+        );
+    void
+    SetHeader(
+        const QJsonObject &joNewHeader
+        );
+    QJsonObject
+    Header(
+        );
+    void
+    SetApplication(
+        const QByteArray &baNewSourceData,
+        const QByteArray &baNewCompiledData
+        );
+    QByteArray
+    SourceData(
+        );
+    QByteArray
+    CompiledData(
+        );
+    qint32
+    Count(
+        );
+    const SessionCaptureRecord &
+    Record(
+        qint32 nIndex
+        );
+    bool
+    Save(
+        const QString &strFilename
+        );
+    bool
+    Load(
+        const QString &strFilename
+        );
+    static QString
+    DefaultDirectory(
+        );
+
+private:
+    QJsonObject joHeader;
+    QByteArray baSourceData;    //Application data given to the session
+    QByteArray baCompiledData;  //XCompiled application, empty if it was not XCompiled
+    QByteArray baRecords;       //Encoded records
+    QVector<SessionCaptureRecord> vecRecords; //Decoded records, filled by Load()
+    QElapsedTimer tmrCaptureTimer; //Started by the first record
+    qint64 nLastTime;           //Time of the last record added
+};
+
+#endif // SESSIONCAPTURE_H
+
+/******************************************************************************/
+// END OF FILE
+/******************************************************************************/
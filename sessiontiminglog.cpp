@@ -0,0 +1,309 @@
+/******************************************************************************
+** Copyright (C) 2018 Laird
+**
+** Project: UwVSP-OTA
+**
+** Module: sessiontiminglog.cpp
+**
+** Notes:
+**
+** License: This program is free software: you can redistribute it and/or
+**          modify it under the terms of the GNU General Public License as
+**          published by the Free Software Foundation, version 3.
+**
+**          This program is distributed in the hope that it will be useful,
+**          but WITHOUT ANY WARRANTY; without even the implied warranty of
+**          MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+**          GNU General Public License for more details.
+**
+**          You should have received a copy of the GNU General Public License
+**          along with this program.  If not, see http://www.gnu.org/licenses/
+**
+*******************************************************************************/
+#include "sessiontiminglog.h"
+
+//=============================================================================
+//=============================================================================
+SessionTimingLog::SessionTimingLog(QObject *parent) : QObject(parent)
+{
+    //Constructor, nothing is written until a filename is set
+    nMode = MAIN_MODE_IDLE;
+    Clear();
+}
+
+//=============================================================================
+//=============================================================================
+SessionTimingLog::~SessionTimingLog(
+    )
+{
+    //Destructor
+}
+
+//=============================================================================
+//=============================================================================
+void
+SessionTimingLog::SetFilename(
+    const QString &strNewFilename
+    )
+{
+    //Sets the file records are appended to, an empty filename disables the log
+    strFilename = strNewFilename;
+}
+
+//=============================================================================
+//=============================================================================
+QString
+SessionTimingLog::DefaultFilename(
+    )
+{
+    //Returns the log file in the user data directory
+    return QStandardPaths::writableLocation(QStandardPaths::GenericDataLocation).append('/').append(SESSION_LOG_FILENAME);
+}
+
+//=============================================================================
+//=============================================================================
+QString
+SessionTimingLog::ModeName(
+    qint8 nMode
+    )
+{
+    //Returns the name a mode is recorded under
+    switch (nMode)
+    {
+        case MAIN_MODE_CONNECTING:
+            return "connect";
+        case MAIN_MODE_DISCOVERING:
+            return "discovery";
+        case MAIN_MODE_VERSION:
+            return "version";
+        case MAIN_MODE_SPACECHECK:
+            return "spacecheck";
+        case MAIN_MODE_XCOMPILING:
+            return "xcompile";
+        case MAIN_MODE_ONLINE_DOWNLOAD:
+            return "online_download";
+        case MAIN_MODE_COMPARING:
+            return "compare";
+        case MAIN_MODE_DOWNLOADING:
+            return "transfer";
+        case MAIN_MODE_VERIFYING:
+            return "verify";
+        case MAIN_MODE_QUERY:
+            return "query";
+        case MAIN_MODE_FIRMWAREVERSION:
+            return "firmware_check";
+        default:
+            return "idle";
+    }
+}
+
+//=============================================================================
+//=============================================================================
+void
+SessionTimingLog::ModeChanged(
+    qint8 nNewMode
+    )
+{
+    //Adds the time spent in the previous mode. Connecting starts a new record, a load starts when it enters a mode other than those of the module information query and is written when it returns to idle
+    bool bConnectionMode = (nMode == MAIN_MODE_CONNECTING || nMode == MAIN_MODE_DISCOVERING);
+    if (nMode != MAIN_MODE_IDLE && tmrModeTimer.isValid() && (bLoadActive == true || bConnectionMode == true))
+    {
+        mapModeTimes[ModeName(nMode)] += tmrModeTimer.elapsed();
+    }
+
+    if (nNewMode == MAIN_MODE_CONNECTING)
+    {
+        //New connection, a load which was interrupted by a disconnection is written first and nothing carries over from the previous module
+        if (bLoadActive == true)
+        {
+            Write();
+        }
+        Clear();
+        strDevice.clear();
+        strModule.clear();
+        strFirmware.clear();
+        dtStarted = QDateTime::currentDateTimeUtc();
+    }
+    else if (nNewMode == MAIN_MODE_IDLE && bLoadActive == true)
+    {
+        //Load has ended
+        Write();
+        Clear();
+    }
+    else if (bLoadActive == false && nNewMode != MAIN_MODE_IDLE && nNewMode != MAIN_MODE_DISCOVERING && nNewMode != MAIN_MODE_QUERY && nNewMode != MAIN_MODE_FIRMWAREVERSION)
+    {
+        //Load has started
+        bLoadActive = true;
+        if (!dtStarted.isValid())
+        {
+            dtStarted = QDateTime::currentDateTimeUtc();
+        }
+    }
+
+    nMode = nNewMode;
+    tmrModeTimer.start();
+}
+
+//=============================================================================
+//=============================================================================
+void
+SessionTimingLog::SetDevice(
+    const QString &strNewDevice
+    )
+{
+    //Sets the address of the connected module
+    strDevice = strNewDevice;
+}
+
+//=============================================================================
+//=============================================================================
+void
+SessionTimingLog::SetModule(
+    const QString &strNewModule,
+    const QString &strNewFirmware
+    )
+{
+    //Sets the module type and firmware version once they are known
+    strModule = strNewModule;
+    strFirmware = strNewFirmware;
+}
+
+//=============================================================================
+//=============================================================================
+void
+SessionTimingLog::SetTransfer(
+    const QString &strNewTarget,
+    qint32 nNewPayloadSize,
+    quint16 unNewPacketSize,
+    bool bNewResumed
+    )
+{
+    //Sets the details of the file being written as the transfer starts
+    strTarget = strNewTarget;
+    nPayloadSize = nNewPayloadSize;
+    unPacketSize = unNewPacketSize;
+    bResumed = bNewResumed;
+}
+
+//=============================================================================
+//=============================================================================
+void
+SessionTimingLog::PacketWritten(
+    qint32 nLength
+    )
+{
+    //Counts data written to the module during a load
+    if (bLoadActive == true)
+    {
+        nWireBytes += nLength;
+    }
+}
+
+//=============================================================================
+//=============================================================================
+void
+SessionTimingLog::FlowStopped(
+    )
+{
+    //Module has stopped the flow of data
+    if (bLoadActive == true)
+    {
+        ++unModemOutStops;
+    }
+}
+
+//=============================================================================
+//=============================================================================
+void
+SessionTimingLog::PipelineStalled(
+    )
+{
+    //Command window is full, sending has paused until the module acknowledges commands
+    if (bLoadActive == true)
+    {
+        ++unCommandWindowStalls;
+    }
+}
+
+//=============================================================================
+//=============================================================================
+void
+SessionTimingLog::SetResult(
+    const QString &strNewResult
+    )
+{
+    //Sets how the load ended ("complete", "skipped" or "cancelled")
+    strResult = strNewResult;
+}
+
+//=============================================================================
+//=============================================================================
+void
+SessionTimingLog::Write(
+    )
+{
+    //Appends the record to the log as a single line of JSON, the previous log is kept as a backup once the file reaches its maximum size
+    if (strFilename.isEmpty())
+    {
+        return;
+    }
+
+    QJsonObject joModes;
+    qint64 nTotalTime = 0;
+    QMap<QString, qint64>::const_iterator itMode = mapModeTimes.constBegin();
+    while (itMode != mapModeTimes.constEnd())
+    {
+        joModes.insert(itMode.key(), itMode.value());
+        nTotalTime += itMode.value();
+        ++itMode;
+    }
+
+    //Payload throughput is over the time spent writing the file data, the verification which follows is reported separately
+    qint64 nTransferTime = mapModeTimes.value(ModeName(MAIN_MODE_DOWNLOADING));
+    QJsonObject joRecord{{"time", dtStarted.toString(Qt::ISODate)}, {"device", strDevice}, {"module", strModule}, {"firmware", strFirmware}, {"target", strTarget}, {"result", strResult}, {"modes", joModes}, {"total_ms", nTotalTime},
+                         {"transfer_ms", nTransferTime}, {"verify_ms", mapModeTimes.value(ModeName(MAIN_MODE_VERIFYING))}, {"payload_bytes", nPayloadSize}, {"wire_bytes", nWireBytes}, {"packet_size", unPacketSize}, {"resumed", bResumed},
+                         {"modem_out_stops", (qint64)unModemOutStops}, {"command_window_stalls", (qint64)unCommandWindowStalls}};
+    if (nTransferTime > 0 && nPayloadSize > 0)
+    {
+        joRecord.insert("throughput", (qint64)nPayloadSize * 1000 / nTransferTime);
+    }
+
+    QFileInfo fiLog(strFilename);
+    QDir().mkpath(fiLog.absolutePath());
+    if (fiLog.exists() && fiLog.size() >= SESSION_LOG_MAX_SIZE)
+    {
+        QFile::remove(QString(strFilename).append(".1"));
+        QFile::rename(strFilename, QString(strFilename).append(".1"));
+    }
+
+    QFile fileLog(strFilename);
+    if (fileLog.open(QIODevice::WriteOnly | QIODevice::Append))
+    {
+        fileLog.write(QJsonDocument(joRecord).toJson(QJsonDocument::Compact).append('\n'));
+        fileLog.close();
+    }
+}
+
+//=============================================================================
+//=============================================================================
+void
+SessionTimingLog::Clear(
+    )
+{
+    //Clears the details of a load, the module details are kept for the next load on the same connection
+    bLoadActive = false;
+    mapModeTimes.clear();
+    dtStarted = QDateTime();
+    strTarget.clear();
+    strResult = "failed";
+    nPayloadSize = 0;
+    unPacketSize = 0;
+    bResumed = false;
+    nWireBytes = 0;
+    unModemOutStops = 0;
+    unCommandWindowStalls = 0;
+}
+
+/******************************************************************************/
+// END OF FILE
+/******************************************************************************/
@@ -0,0 +1,134 @@
+/******************************************************************************
+** Copyright (C) 2018 Laird
+**
+** Project: UwVSP-OTA
+**
+** Module: sessiontiminglog.h
+**
+** Notes:
+**
+** License: This program is free software: you can redistribute it and/or
+**          modify it under the terms of the GNU General Public License as
+**          published by the Free Software Foundation, version 3.
+**
+**          This program is distributed in the hope that it will be useful,
+**          but WITHOUT ANY WARRANTY; without even the implied warranty of
+**          MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+**          GNU General Public License for more details.
+**
+**          You should have received a copy of the GNU General Public License
+**          along with this program.  If not, see http://www.gnu.org/licenses/
+**
+*******************************************************************************/
+#ifndef SESSIONTIMINGLOG_H
+#define SESSIONTIMINGLOG_H
+
+/******************************************************************************/
+// Include Files
+/******************************************************************************/
+#include <QObject>
+#include <QString>
+#include <QMap>
+#include <QElapsedTimer>
+#include <QDateTime>
+#include <QStandardPaths>
+#include <QJsonObject>
+#include <QJsonDocument>
+#include <QFile>
+#include <QFileInfo>
+#include <QDir>
+#include "target.h"
+
+/******************************************************************************/
+// Class definitions
+/******************************************************************************/
+//Time spent in each mode whilst loading a module, written as one line of JSON per load so where the time goes can be compared across many modules.
+//Connecting and service discovery are counted in the first load after connecting
+class SessionTimingLog : public QObject
+{
+    Q_OBJECT
+public:
+    explicit
+    SessionTimingLog(
+        QObject *parent = nullptr
+        );
+    ~SessionTimingLog(
+        );
+    void
+    SetFilename(
+        const QString &strNewFilename
+        );
+    static QString
+    DefaultFilename(
+        );
+    static QString
+    ModeName(
+        qint8 nMode
+        );
+    void
+    ModeChanged(
+        qint8 nNewMode
+        );
+    void
+    SetDevice(
+        const QString &strNewDevice
+        );
+    void
+    SetModule(
+        const QString &strNewModule,
+        const QString &strNewFirmware
+        );
+    void
+    SetTransfer(
+        const QString &strNewTarget,
+        qint32 nNewPayloadSize,
+        quint16 unNewPacketSize,
+        bool bNewResumed
+        );
+    void
+    PacketWritten(
+        qint32 nLength
+        );
+    void
+    FlowStopped(
+        );
+    void
+    PipelineStalled(
+        );
+    void
+    SetResult(
+        const QString &strNewResult
+        );
+
+private:
+    void
+    Write(
+        );
+    void
+    Clear(
+        );
+
+    QString strFilename;          //File the records are appended to, empty if disabled
+    qint8 nMode;                  //Mode being timed
+    QElapsedTimer tmrModeTimer;   //Time since the mode changed
+    QDateTime dtStarted;          //When the first timed mode of the record started
+    bool bLoadActive;             //True once a load has started, the record is written when it returns to idle
+    QMap<QString, qint64> mapModeTimes; //Total ms spent in each mode
+    QString strDevice;            //Bluetooth address (or device UUID) of the module
+    QString strModule;            //Module type
+    QString strFirmware;
+    QString strTarget;            //Name of the file on the module
+    QString strResult;            //How the load ended, "failed" unless set otherwise
+    qint32 nPayloadSize;          //Size of the application data written
+    quint16 unPacketSize;         //Size of packets written to the RX characteristic
+    bool bResumed;                //True if an interrupted transfer was resumed
+    qint64 nWireBytes;            //Bytes written to the RX characteristic, including commands
+    quint32 unModemOutStops;      //Number of times the module stopped the flow using the modem out characteristic
+    quint32 unCommandWindowStalls; //Number of times the command window filled
+};
+
+#endif // SESSIONTIMINGLOG_H
+
+/******************************************************************************/
+// END OF FILE
+/******************************************************************************/
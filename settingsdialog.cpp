@@ -58,16 +58,25 @@ SettingsDialog::SetValues(
 #ifdef Q_OS_ANDROID
     bool bCompatibleScanning,
 #endif
-    quint8 unPacketSize,
+    quint16 unPacketSize,
     bool bDelFile,
     bool bVerifyChecksum,
     quint8 unDownloadAction,
     bool bSkipDownloadDisplay,
-    quint8 unScrollbackSize,
+    quint32 unScrollbackSize,
     bool bXCompile,
     bool bSSL,
     bool bCheckFirmware,
     bool bFreeSpaceCheck,
+    bool bStreamWrites,
+    quint8 unStreamWindow,
+    quint8 unCommandWindow,
+    quint16 unXCompileCacheSize,
+    bool bPrefetchXCompile,
+    quint32 unModuleCacheTTL,
+    bool bSkipIdentical,
+    bool bPacketTrace,
+    bool bRecordSessions,
     QString strDatabaseVersion
     )
 {
@@ -105,6 +114,15 @@ SettingsDialog::SetValues(
     ui->check_SSL->setChecked(bSSL);
     ui->check_FirmwareCheck->setChecked(bCheckFirmware);
     ui->check_FreeSpaceCheck->setChecked(bFreeSpaceCheck);
+    ui->check_StreamWrites->setChecked(bStreamWrites);
+    ui->edit_StreamWindow->setValue(unStreamWindow);
+    ui->edit_CommandWindow->setValue(unCommandWindow);
+    ui->edit_XCompileCache->setValue(unXCompileCacheSize);
+    ui->check_PrefetchXCompile->setChecked(bPrefetchXCompile);
+    ui->edit_ModuleCacheTTL->setValue(unModuleCacheTTL);
+    ui->check_SkipIdentical->setChecked(bSkipIdentical);
+    ui->check_PacketTrace->setChecked(bPacketTrace);
+    ui->check_RecordSessions->setChecked(bRecordSessions);
     ui->label_ErrorCodeVersion->setText(ui->label_ErrorCodeVersion->text().append(strDatabaseVersion));
 
 #ifndef UseSSL
@@ -125,7 +143,7 @@ SettingsDialog::on_btn_Save_clicked(
 #ifdef Q_OS_ANDROID
         ui->check_CompatibleScan->isChecked(),
 #endif
-        ui->edit_PacketSize->value(), ui->check_DelFile->isChecked(), ui->check_VerifyChecksum->isChecked(), (ui->rdo_DownloadNothing->isChecked() ? DOWNLOAD_ACTION_NOTHING : (ui->rdo_DownloadDisconnect->isChecked() ? DOWNLOAD_ACTION_DISCONNECT : (ui->rdo_DownloadRestart->isChecked() ? DOWNLOAD_ACTION_RESTART : DOWNLOAD_ACTION_NOTHING))), ui->check_SkipDownloadDisplay->isChecked(), ui->edit_Scrollback->value(), ui->check_XCompile->isChecked(), ui->check_SSL->isChecked(), ui->check_FirmwareCheck->isChecked(), ui->check_FreeSpaceCheck->isChecked());
+        ui->edit_PacketSize->value(), ui->check_DelFile->isChecked(), ui->check_VerifyChecksum->isChecked(), (ui->rdo_DownloadNothing->isChecked() ? DOWNLOAD_ACTION_NOTHING : (ui->rdo_DownloadDisconnect->isChecked() ? DOWNLOAD_ACTION_DISCONNECT : (ui->rdo_DownloadRestart->isChecked() ? DOWNLOAD_ACTION_RESTART : DOWNLOAD_ACTION_NOTHING))), ui->check_SkipDownloadDisplay->isChecked(), ui->edit_Scrollback->value(), ui->check_XCompile->isChecked(), ui->check_SSL->isChecked(), ui->check_FirmwareCheck->isChecked(), ui->check_FreeSpaceCheck->isChecked(), ui->check_StreamWrites->isChecked(), ui->edit_StreamWindow->value(), ui->edit_CommandWindow->value(), ui->edit_XCompileCache->value(), ui->check_PrefetchXCompile->isChecked(), ui->edit_ModuleCacheTTL->value(), ui->check_SkipIdentical->isChecked(), ui->check_PacketTrace->isChecked(), ui->check_RecordSessions->isChecked());
     this->close();
 }
 
@@ -140,7 +158,7 @@ SettingsDialog::on_btn_Discard_clicked(
 #ifdef Q_OS_ANDROID
         NULL,
 #endif
-        0, NULL, NULL, 0, NULL, 0, NULL, NULL, NULL, NULL);
+        0, NULL, NULL, 0, NULL, 0, NULL, NULL, NULL, NULL, NULL, 0, 0, 0, NULL, 0, NULL, NULL);
     this->close();
 }
 
@@ -179,9 +197,28 @@ SettingsDialog::on_btn_Defaults_clicked(
         ui->check_SSL->setChecked(SETTINGS_VALUE_SSL);
         ui->check_FirmwareCheck->setChecked(SETTINGS_VALUE_CHECKFWVERSION);
         ui->check_FreeSpaceCheck->setChecked(SETTINGS_VALUE_CHECKFREESPACE);
+        ui->check_StreamWrites->setChecked(SETTINGS_VALUE_STREAMWRITES);
+        ui->edit_StreamWindow->setValue(SETTINGS_VALUE_STREAMWINDOW);
+        ui->edit_CommandWindow->setValue(SETTINGS_VALUE_COMMANDWINDOW);
+        ui->edit_XCompileCache->setValue(SETTINGS_VALUE_XCOMPILECACHE);
+        ui->check_PrefetchXCompile->setChecked(SETTINGS_VALUE_PREFETCHXCOMP);
+        ui->edit_ModuleCacheTTL->setValue(SETTINGS_VALUE_MODULECACHETTL);
+        ui->check_SkipIdentical->setChecked(SETTINGS_VALUE_SKIPIDENTICAL);
+        ui->check_PacketTrace->setChecked(SETTINGS_VALUE_PACKETTRACE);
+        ui->check_RecordSessions->setChecked(SETTINGS_VALUE_RECORDSESSIONS);
     }
 }
 
+//=============================================================================
+//=============================================================================
+void
+SettingsDialog::on_btn_SavePacketTrace_clicked(
+    )
+{
+    //Save the packet trace recorded so far
+    emit SavePacketTrace();
+}
+
 //=============================================================================
 //=============================================================================
 void
@@ -64,16 +64,25 @@ public:
 #ifdef Q_OS_ANDROID
         bool bCompatibleScanning,
 #endif
-        quint8 unPacketSize,
+        quint16 unPacketSize,
         bool bDelFile,
         bool bVerifyChecksum,
         quint8 unDownloadAction,
         bool bSkipDownloadDisplay,
-        quint8 unScrollbackSize,
+        quint32 unScrollbackSize,
         bool bXCompile,
         bool bSSL,
         bool bCheckFirmware,
         bool bFreeSpaceCheck,
+        bool bStreamWrites,
+        quint8 unStreamWindow,
+        quint8 unCommandWindow,
+        quint16 unXCompileCacheSize,
+        bool bPrefetchXCompile,
+        quint32 unModuleCacheTTL,
+        bool bSkipIdentical,
+        bool bPacketTrace,
+        bool bRecordSessions,
         QString strDatabaseVersion
         );
 #ifdef Q_OS_ANDROID
@@ -94,16 +103,28 @@ signals:
 #ifdef Q_OS_ANDROID
         bool bCompatibleScanning,
 #endif
-        quint8 unPacketSize,
+        quint16 unPacketSize,
         bool bDelFile,
         bool bVerifyChecksum,
         quint8 unDownloadActions,
         bool bSkipDownloadDisplay,
-        quint8 unScrollbackSize,
+        quint32 unScrollbackSize,
         bool bXCompile,
         bool bSSL,
         bool bCheckFirmware,
-        bool bFreeSpaceCheck
+        bool bFreeSpaceCheck,
+        bool bStreamWrites,
+        quint8 unStreamWindow,
+        quint8 unCommandWindow,
+        quint16 unXCompileCacheSize,
+        bool bPrefetchXCompile,
+        quint32 unModuleCacheTTL,
+        bool bSkipIdentical,
+        bool bPacketTrace,
+        bool bRecordSessions
+        );
+    void
+    SavePacketTrace(
         );
 
 private slots:
@@ -117,6 +138,9 @@ private slots:
     on_btn_Defaults_clicked(
         );
     void
+    on_btn_SavePacketTrace_clicked(
+        );
+    void
     on_btn_About_clicked(
         );
 
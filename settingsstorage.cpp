@@ -21,6 +21,7 @@
 **
 *******************************************************************************/
 #include "settingsstorage.h"
+#include <string.h>
 
 //=============================================================================
 //=============================================================================
@@ -28,6 +29,7 @@ SettingsStorage::SettingsStorage(QObject *parent) : QObject(parent)
 {
     //Constructor
     stgSettingsHandle = NULL;
+    memset(&ssSnapshot, 0, sizeof(ssSnapshot));
 }
 
 //=============================================================================
@@ -63,6 +65,7 @@ SettingsStorage::LoadSettings(
     }
 
     //Settings loaded successfully
+    RefreshSnapshot();
     return SETTINGS_LOAD_OK;
 }
 
@@ -105,6 +108,16 @@ SettingsStorage::DefaultSettings(
     stgSettingsHandle->setValue(SETTINGS_KEY_SCROLLBACKSIZE, SETTINGS_VALUE_SCROLLBACKSIZE);
     stgSettingsHandle->setValue(SETTINGS_KEY_CHECKFWVERSION, SETTINGS_VALUE_CHECKFWVERSION);
     stgSettingsHandle->setValue(SETTINGS_KEY_CHECKFREESPACE, SETTINGS_VALUE_CHECKFREESPACE);
+    stgSettingsHandle->setValue(SETTINGS_KEY_STREAMWRITES, SETTINGS_VALUE_STREAMWRITES);
+    stgSettingsHandle->setValue(SETTINGS_KEY_STREAMWINDOW, SETTINGS_VALUE_STREAMWINDOW);
+    stgSettingsHandle->setValue(SETTINGS_KEY_COMMANDWINDOW, SETTINGS_VALUE_COMMANDWINDOW);
+    stgSettingsHandle->setValue(SETTINGS_KEY_XCOMPILECACHE, SETTINGS_VALUE_XCOMPILECACHE);
+    stgSettingsHandle->setValue(SETTINGS_KEY_PREFETCHXCOMP, SETTINGS_VALUE_PREFETCHXCOMP);
+    stgSettingsHandle->setValue(SETTINGS_KEY_MODULECACHETTL, SETTINGS_VALUE_MODULECACHETTL);
+    stgSettingsHandle->setValue(SETTINGS_KEY_SKIPIDENTICAL, SETTINGS_VALUE_SKIPIDENTICAL);
+    stgSettingsHandle->setValue(SETTINGS_KEY_PACKETTRACE, SETTINGS_VALUE_PACKETTRACE);
+    stgSettingsHandle->setValue(SETTINGS_KEY_RECORDSESSIONS, SETTINGS_VALUE_RECORDSESSIONS);
+    RefreshSnapshot();
 }
 
 //=============================================================================
@@ -161,7 +174,7 @@ SettingsStorage::SetInt(
 
 //=============================================================================
 //=============================================================================
-quint8
+quint32
 SettingsStorage::GetUInt(
     QString strKey
     )
@@ -175,7 +188,7 @@ SettingsStorage::GetUInt(
 void
 SettingsStorage::SetUInt(
     QString strKey,
-    quint8 unNewValue
+    quint32 unNewValue
     )
 {
     //Set an unsigned integer value
@@ -211,6 +224,51 @@ SettingsStorage::SetBool(
     }
 }
 
+//=============================================================================
+//=============================================================================
+void
+SettingsStorage::RefreshSnapshot(
+    )
+{
+    //Reads the settings used whilst transferring data into the snapshot, this must be called after settings are changed. Settings missing from an older version take their defaults
+    ssSnapshot.bRestrictUUID = stgSettingsHandle->value(SETTINGS_KEY_RESTRICTUUID, SETTINGS_VALUE_RESTRICTUUID).toBool();
+    ssSnapshot.bCompatibleScan = stgSettingsHandle->value(SETTINGS_KEY_COMPATIBLESCAN, SETTINGS_VALUE_COMPATIBLESCAN).toBool();
+    ssSnapshot.unPacketSize = stgSettingsHandle->value(SETTINGS_KEY_PACKETSIZE, SETTINGS_VALUE_PACKETSIZE).toUInt();
+    ssSnapshot.bOnlineXCompile = stgSettingsHandle->value(SETTINGS_KEY_ONLINEXCOMP, SETTINGS_VALUE_ONLINEXCOMP).toBool();
+    ssSnapshot.bSSL = stgSettingsHandle->value(SETTINGS_KEY_SSL, SETTINGS_VALUE_SSL).toBool();
+    ssSnapshot.bDeleteFile = stgSettingsHandle->value(SETTINGS_KEY_DELFILE, SETTINGS_VALUE_DELFILE).toBool();
+    ssSnapshot.bVerifyFile = stgSettingsHandle->value(SETTINGS_KEY_VERIFYFILE, SETTINGS_VALUE_VERIFYFILE).toBool();
+    ssSnapshot.unDownloadAction = stgSettingsHandle->value(SETTINGS_KEY_DOWNLOADACTION, SETTINGS_VALUE_DOWNLOADACTION).toUInt();
+    ssSnapshot.bSkipDownloadDisplay = stgSettingsHandle->value(SETTINGS_KEY_SKIPDLDISPLAY, SETTINGS_VALUE_SKIPDLDISPLAY).toBool();
+    ssSnapshot.unScrollbackSize = stgSettingsHandle->value(SETTINGS_KEY_SCROLLBACKSIZE, SETTINGS_VALUE_SCROLLBACKSIZE).toUInt();
+    ssSnapshot.bCheckFirmwareVersion = stgSettingsHandle->value(SETTINGS_KEY_CHECKFWVERSION, SETTINGS_VALUE_CHECKFWVERSION).toBool();
+    ssSnapshot.bCheckFreeSpace = stgSettingsHandle->value(SETTINGS_KEY_CHECKFREESPACE, SETTINGS_VALUE_CHECKFREESPACE).toBool();
+    ssSnapshot.bStreamWrites = stgSettingsHandle->value(SETTINGS_KEY_STREAMWRITES, SETTINGS_VALUE_STREAMWRITES).toBool();
+    ssSnapshot.unStreamWindow = stgSettingsHandle->value(SETTINGS_KEY_STREAMWINDOW, SETTINGS_VALUE_STREAMWINDOW).toUInt();
+    if (ssSnapshot.unStreamWindow == 0)
+    {
+        //At least one packet must be streamed at a time
+        ssSnapshot.unStreamWindow = SETTINGS_VALUE_STREAMWINDOW;
+    }
+    ssSnapshot.unCommandWindow = stgSettingsHandle->value(SETTINGS_KEY_COMMANDWINDOW, SETTINGS_VALUE_COMMANDWINDOW).toUInt();
+    ssSnapshot.unXCompileCacheSize = stgSettingsHandle->value(SETTINGS_KEY_XCOMPILECACHE, SETTINGS_VALUE_XCOMPILECACHE).toUInt();
+    ssSnapshot.bPrefetchXCompile = stgSettingsHandle->value(SETTINGS_KEY_PREFETCHXCOMP, SETTINGS_VALUE_PREFETCHXCOMP).toBool();
+    ssSnapshot.unModuleCacheTTL = stgSettingsHandle->value(SETTINGS_KEY_MODULECACHETTL, SETTINGS_VALUE_MODULECACHETTL).toUInt();
+    ssSnapshot.bSkipIdentical = stgSettingsHandle->value(SETTINGS_KEY_SKIPIDENTICAL, SETTINGS_VALUE_SKIPIDENTICAL).toBool();
+    ssSnapshot.bPacketTrace = stgSettingsHandle->value(SETTINGS_KEY_PACKETTRACE, SETTINGS_VALUE_PACKETTRACE).toBool();
+    ssSnapshot.bRecordSessions = stgSettingsHandle->value(SETTINGS_KEY_RECORDSESSIONS, SETTINGS_VALUE_RECORDSESSIONS).toBool();
+}
+
+//=============================================================================
+//=============================================================================
+const SettingsSnapshot *
+SettingsStorage::GetSnapshot(
+    )
+{
+    //Returns the settings snapshot, the pointer remains valid for the lifetime of this object
+    return &ssSnapshot;
+}
+
 /******************************************************************************/
 // END OF FILE
 /******************************************************************************/
@@ -31,6 +31,35 @@
 #include <QFile>
 #include "target.h"
 
+/******************************************************************************/
+// Structures
+/******************************************************************************/
+//Copy of the non-string settings which are read whilst transferring data, refreshed whenever settings are loaded or changed
+struct SettingsSnapshot
+{
+    bool bRestrictUUID;
+    bool bCompatibleScan;
+    quint16 unPacketSize;
+    bool bOnlineXCompile;
+    bool bSSL;
+    bool bDeleteFile;
+    bool bVerifyFile;
+    quint8 unDownloadAction;
+    bool bSkipDownloadDisplay;
+    quint32 unScrollbackSize;
+    bool bCheckFirmwareVersion;
+    bool bCheckFreeSpace;
+    bool bStreamWrites;
+    quint8 unStreamWindow;
+    quint8 unCommandWindow;
+    quint16 unXCompileCacheSize;
+    bool bPrefetchXCompile;
+    quint32 unModuleCacheTTL;
+    bool bSkipIdentical;
+    bool bPacketTrace;
+    bool bRecordSessions;
+};
+
 /******************************************************************************/
 // Class definitions
 /******************************************************************************/
@@ -72,14 +101,14 @@ public:
         QString strKey,
         qint8 nNewValue
         );
-    quint8
+    quint32
     GetUInt(
         QString strKey
         );
     void
     SetUInt(
         QString strKey,
-        quint8 unNewValue
+        quint32 unNewValue
         );
     bool
     GetBool(
@@ -90,9 +119,16 @@ public:
         QString strKey,
         bool bNewValue
         );
+    void
+    RefreshSnapshot(
+        );
+    const SettingsSnapshot *
+    GetSnapshot(
+        );
 
 private:
     QSettings *stgSettingsHandle;
+    SettingsSnapshot ssSnapshot; //Cached copy of settings used on hot paths
 };
 
 #endif // SETTINGSSTORAGE_H
@@ -0,0 +1,674 @@
+/******************************************************************************
+** Copyright (C) 2018 Laird
+**
+** Project: UwVSP-OTA
+**
+** Module: simulatedvsptransport.cpp
+**
+** Notes:
+**
+** License: This program is free software: you can redistribute it and/or
+**          modify it under the terms of the GNU General Public License as
+**          published by the Free Software Foundation, version 3.
+**
+**          This program is distributed in the hope that it will be useful,
+**          but WITHOUT ANY WARRANTY; without even the implied warranty of
+**          MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+**          GNU General Public License for more details.
+**
+**          You should have received a copy of the GNU General Public License
+**          along with this program.  If not, see http://www.gnu.org/licenses/
+**
+*******************************************************************************/
+#include "simulatedvsptransport.h"
+
+/******************************************************************************/
+// Local Functions or Private Members
+/******************************************************************************/
+static const QByteArray baResponseOK = "\n00\r";
+
+//=============================================================================
+//=============================================================================
+static QByteArray
+ResponseError(
+    quint16 unErrorCode
+    )
+{
+    //Returns an error response, the code is in hex
+    return QByteArray("\n01\t").append(QByteArray::number(unErrorCode, 16).toUpper().rightJustified(4, '0')).append('\r');
+}
+
+//=============================================================================
+//=============================================================================
+static QByteArray
+ResponseInfo(
+    quint32 unTag,
+    const QByteArray &baValue
+    )
+{
+    //Returns an AT I response followed by the success response
+    return QByteArray("\n10\t").append(QByteArray::number(unTag)).append('\t').append(baValue).append('\r').append(baResponseOK);
+}
+
+//=============================================================================
+//=============================================================================
+static bool
+QuotedParameter(
+    const QByteArray &baCommand,
+    qint32 nCommandLength,
+    QByteArray *pbaParameter
+    )
+{
+    //Gets the quoted parameter which follows a command, returns false if it is not quoted
+    if (baCommand.length() < nCommandLength + 1 || baCommand.at(nCommandLength - 1) != '"' || !baCommand.endsWith('"'))
+    {
+        return false;
+    }
+    *pbaParameter = baCommand.mid(nCommandLength, baCommand.length() - nCommandLength - 1);
+    return true;
+}
+
+//=============================================================================
+//=============================================================================
+static qint32
+HexValue(
+    char cDigit
+    )
+{
+    //Returns the value of a hex digit, -1 if it is not one
+    if (cDigit >= '0' && cDigit <= '9')
+    {
+        return cDigit - '0';
+    }
+    else if (cDigit >= 'A' && cDigit <= 'F')
+    {
+        return cDigit - 'A' + 10;
+    }
+    else if (cDigit >= 'a' && cDigit <= 'f')
+    {
+        return cDigit - 'a' + 10;
+    }
+    return -1;
+}
+
+//=============================================================================
+//=============================================================================
+SimulatedVspTransport::SimulatedVspTransport(const SimulatedVspSettings &svsNewSettings, QObject *parent) : VspTransport(parent)
+{
+    //Constructor
+    svsSettings = svsNewSettings;
+    bOpen = false;
+    nNow = 0;
+    unSequence = 0;
+    unRandom = svsSettings.unSeed;
+    bRunPending = false;
+    nLinkTime = -1;
+    unLinkPackets = 0;
+    nPacketsWritten = 0;
+    nPacketsStreamed = 0;
+    nPacketsRetransmitted = 0;
+    nFlowStops = 0;
+    bModuleBusy = false;
+    bFlowStopped = false;
+}
+
+//=============================================================================
+//=============================================================================
+SimulatedVspTransport::~SimulatedVspTransport(
+    )
+{
+    //Destructor
+}
+
+//=============================================================================
+//=============================================================================
+void
+SimulatedVspTransport::Open(
+    )
+{
+    //Connects to the simulated module, which takes a connection event to link, one to exchange the MTU and three to discover the service and enable notifications
+    if (bOpen == true)
+    {
+        return;
+    }
+    bOpen = true;
+    Schedule(NextConnectionEvent(nNow), SIMULATED_EVENT_CONNECTED);
+    Schedule(NextConnectionEvent(nNow) + svsSettings.unConnectionInterval, SIMULATED_EVENT_MTU);
+    Schedule(NextConnectionEvent(nNow) + 4 * svsSettings.unConnectionInterval, SIMULATED_EVENT_OPENED);
+}
+
+//=============================================================================
+//=============================================================================
+void
+SimulatedVspTransport::Close(
+    )
+{
+    //Disconnects, anything still in flight is lost. The module runs the complete commands it has received, as a real one carries on after the link drops, and
+    //discards the rest so it can be connected to again
+    if (bOpen == false)
+    {
+        return;
+    }
+    bOpen = false;
+    mapEvents.clear();
+    qint32 nEnd;
+    while ((nEnd = baModuleInput.indexOf('\r')) >= 0)
+    {
+        qint32 nBytesWritten = 0;
+        ModuleExecute(baModuleInput.left(nEnd), &nBytesWritten);
+        baModuleInput.remove(0, nEnd + 1);
+    }
+    baModuleInput.clear();
+    bModuleBusy = false;
+    bFlowStopped = false;
+    nLinkTime = -1;
+    unLinkPackets = 0;
+    Schedule(NextConnectionEvent(nNow), SIMULATED_EVENT_CLOSED);
+}
+
+//=============================================================================
+//=============================================================================
+void
+SimulatedVspTransport::Write(
+    const QByteArray &baData
+    )
+{
+    //Sends a packet at the next connection event (or a later one for each time it is lost), the write response follows one connection event after it arrives
+    if (bOpen == false)
+    {
+        return;
+    }
+    Schedule(DeliveryTime(), SIMULATED_EVENT_DELIVERED, baData);
+}
+
+//=============================================================================
+//=============================================================================
+bool
+SimulatedVspTransport::CanStream(
+    )
+{
+    //Returns true if the simulated module accepts writes without response
+    return svsSettings.bWriteWithoutResponse;
+}
+
+//=============================================================================
+//=============================================================================
+void
+SimulatedVspTransport::Stream(
+    const QByteArray &baData
+    )
+{
+    //Sends a packet without response, several are sent in each connection event. Nothing tells the host it has arrived, the module stops the flow if its buffer fills
+    if (bOpen == false)
+    {
+        return;
+    }
+    else if (svsSettings.bWriteWithoutResponse == false)
+    {
+        Write(baData);
+        return;
+    }
+    ++nPacketsStreamed;
+    Schedule(DeliveryTime(), SIMULATED_EVENT_STREAMED, baData);
+}
+
+//=============================================================================
+//=============================================================================
+qint64
+SimulatedVspTransport::Elapsed(
+    )
+{
+    //Returns the simulated time since the transport was created in microseconds
+    return nNow;
+}
+
+//=============================================================================
+//=============================================================================
+qint32
+SimulatedVspTransport::PacketsWritten(
+    )
+{
+    //Returns the number of packets written
+    return nPacketsWritten;
+}
+
+//=============================================================================
+//=============================================================================
+qint32
+SimulatedVspTransport::PacketsStreamed(
+    )
+{
+    //Returns the number of packets written without response
+    return nPacketsStreamed;
+}
+
+//=============================================================================
+//=============================================================================
+qint32
+SimulatedVspTransport::PacketsRetransmitted(
+    )
+{
+    //Returns the number of times a packet was lost and sent again
+    return nPacketsRetransmitted;
+}
+
+//=============================================================================
+//=============================================================================
+qint32
+SimulatedVspTransport::FlowStops(
+    )
+{
+    //Returns the number of times the module stopped the flow of data
+    return nFlowStops;
+}
+
+//=============================================================================
+//=============================================================================
+QByteArray
+SimulatedVspTransport::File(
+    const QByteArray &baFilename
+    )
+{
+    //Returns the contents of a file on the simulated module
+    return mapFiles.value(baFilename);
+}
+
+//=============================================================================
+//=============================================================================
+void
+SimulatedVspTransport::RunNextEvent(
+    )
+{
+    //Moves the simulated time on to the next event and runs it. Only one event runs per pass of the event loop so that the host reacts to each in turn
+    bRunPending = false;
+    if (mapEvents.isEmpty())
+    {
+        return;
+    }
+
+    QMap<QPair<qint64, quint64>, SimulatedEvent>::iterator itEvent = mapEvents.begin();
+    nNow = itEvent.key().first;
+    SimulatedEvent sevEvent = itEvent.value();
+    mapEvents.erase(itEvent);
+    if (!mapEvents.isEmpty())
+    {
+        bRunPending = true;
+        QTimer::singleShot(0, this, SLOT(RunNextEvent()));
+    }
+
+    switch (sevEvent.unType)
+    {
+        case SIMULATED_EVENT_CONNECTED:
+            emit Connected();
+            break;
+        case SIMULATED_EVENT_MTU:
+            ReportMTU(svsSettings.nMTU);
+            break;
+        case SIMULATED_EVENT_OPENED:
+            emit Opened();
+            break;
+        case SIMULATED_EVENT_DELIVERED:
+            ModuleReceive(sevEvent.baData);
+            Schedule(NextConnectionEvent(nNow), SIMULATED_EVENT_WRITTEN, sevEvent.baData);
+            break;
+        case SIMULATED_EVENT_STREAMED:
+            ModuleReceive(sevEvent.baData);
+            break;
+        case SIMULATED_EVENT_WRITTEN:
+            emit DataWritten(sevEvent.baData.length());
+            break;
+        case SIMULATED_EVENT_PROCESS:
+            ModuleProcess();
+            break;
+        case SIMULATED_EVENT_NOTIFY:
+            emit DataReceived(sevEvent.baData);
+            break;
+        case SIMULATED_EVENT_FLOW:
+            emit FlowChanged(sevEvent.baData.at(0) == 0x00);
+            break;
+        case SIMULATED_EVENT_CLOSED:
+            emit Closed();
+            break;
+        default:
+            break;
+    }
+}
+
+//=============================================================================
+//=============================================================================
+void
+SimulatedVspTransport::Schedule(
+    qint64 nTime,
+    quint8 unType,
+    const QByteArray &baData
+    )
+{
+    //Adds an event, events at the same time run in the order they were added
+    SimulatedEvent sevEvent;
+    sevEvent.unType = unType;
+    sevEvent.baData = baData;
+    mapEvents.insert(qMakePair(nTime, unSequence++), sevEvent);
+    if (bRunPending == false)
+    {
+        bRunPending = true;
+        QTimer::singleShot(0, this, SLOT(RunNextEvent()));
+    }
+}
+
+//=============================================================================
+//=============================================================================
+qint64
+SimulatedVspTransport::NextConnectionEvent(
+    qint64 nTime
+    )
+{
+    //Returns the time of the first connection event after a time
+    return (nTime / svsSettings.unConnectionInterval + 1) * svsSettings.unConnectionInterval;
+}
+
+//=============================================================================
+//=============================================================================
+qint64
+SimulatedVspTransport::DeliveryTime(
+    )
+{
+    //Returns when the next packet written reaches the module: the next connection event with room for it after the previous packet, and a later one for each time it is lost
+    qint64 nDelivered = NextConnectionEvent(nNow);
+    if (nDelivered < nLinkTime || (nDelivered == nLinkTime && unLinkPackets >= svsSettings.unPacketsPerEvent))
+    {
+        //Queued behind packets which have not been sent yet
+        nDelivered = (unLinkPackets >= svsSettings.unPacketsPerEvent ? nLinkTime + svsSettings.unConnectionInterval : nLinkTime);
+    }
+    ++nPacketsWritten;
+    while (PacketLost())
+    {
+        nDelivered += svsSettings.unConnectionInterval;
+        ++nPacketsRetransmitted;
+    }
+    if (nDelivered != nLinkTime)
+    {
+        nLinkTime = nDelivered;
+        unLinkPackets = 0;
+    }
+    ++unLinkPackets;
+    return nDelivered;
+}
+
+//=============================================================================
+//=============================================================================
+bool
+SimulatedVspTransport::PacketLost(
+    )
+{
+    //Returns true if a packet is lost, using a linear congruential generator so that runs can be repeated
+    if (svsSettings.unPacketLoss == 0)
+    {
+        return false;
+    }
+    unRandom = unRandom * 1103515245 + 12345;
+    return (((unRandom >> 16) & 0x7FFF) % 1000) < svsSettings.unPacketLoss;
+}
+
+//=============================================================================
+//=============================================================================
+void
+SimulatedVspTransport::ModuleReceive(
+    const QByteArray &baData
+    )
+{
+    //Data has arrived at the module, it stops the flow once the receive buffer is nearly full
+    if (baModuleInput.length() + baData.length() > svsSettings.nRxBufferSize)
+    {
+        //Buffer overrun, the data is lost as it would be on a module
+        return;
+    }
+    baModuleInput.append(baData);
+
+    if (svsSettings.bModem == true && bFlowStopped == false && baModuleInput.length() > svsSettings.nRxBufferSize - 2 * svsSettings.nMTU)
+    {
+        bFlowStopped = true;
+        ++nFlowStops;
+        Schedule(NextConnectionEvent(nNow), SIMULATED_EVENT_FLOW, QByteArray(1, 0x00));
+    }
+
+    if (bModuleBusy == false)
+    {
+        bModuleBusy = true;
+        Schedule(nNow, SIMULATED_EVENT_PROCESS);
+    }
+}
+
+//=============================================================================
+//=============================================================================
+void
+SimulatedVspTransport::ModuleProcess(
+    )
+{
+    //Runs the next complete command in the receive buffer, the response is sent at the first connection event after the command has finished
+    qint32 nEnd = baModuleInput.indexOf('\r');
+    if (nEnd < 0)
+    {
+        //Waiting for the rest of the command
+        bModuleBusy = false;
+        return;
+    }
+
+    QByteArray baCommand = baModuleInput.left(nEnd);
+    baModuleInput.remove(0, nEnd + 1);
+    if (bFlowStopped == true && baModuleInput.length() < svsSettings.nRxBufferSize / 4)
+    {
+        //Room for more data
+        bFlowStopped = false;
+        Schedule(NextConnectionEvent(nNow), SIMULATED_EVENT_FLOW, QByteArray(1, 0x01));
+    }
+
+    qint32 nBytesWritten = 0;
+    QByteArray baResponse = ModuleExecute(baCommand, &nBytesWritten);
+    qint64 nFinished = nNow + svsSettings.unCommandTime + (qint64)nBytesWritten * svsSettings.unFlashByteTime;
+    if (!baResponse.isEmpty())
+    {
+        //Module output is split into notifications which fit in the MTU
+        const qint32 nNotifySize = svsSettings.nMTU - BLE_ATT_HEADER_SIZE;
+        for (qint32 i = 0; i < baResponse.length(); i += nNotifySize)
+        {
+            Schedule(NextConnectionEvent(nFinished), SIMULATED_EVENT_NOTIFY, baResponse.mid(i, nNotifySize));
+        }
+    }
+    Schedule(nFinished, SIMULATED_EVENT_PROCESS);
+}
+
+//=============================================================================
+//=============================================================================
+QByteArray
+SimulatedVspTransport::ModuleExecute(
+    const QByteArray &baCommand,
+    qint32 *pnBytesWritten
+    )
+{
+    //Runs a command on the simulated module and returns its response
+    const QByteArray baLower = baCommand.toLower();
+    QByteArray baParameter;
+
+    if (baLower == "at i 0")
+    {
+        return ResponseInfo(0, svsSettings.strDevice.toUtf8());
+    }
+    else if (baLower == "at i 1")
+    {
+        return ResponseInfo(1, "0");
+    }
+    else if (baLower == "at i 3")
+    {
+        return ResponseInfo(3, svsSettings.strFirmware.toUtf8());
+    }
+    else if (baLower == "at i 6")
+    {
+        return ResponseInfo(6, QByteArray::number(svsSettings.nStorageTotal).append(',').append(QByteArray::number(svsSettings.nStorageTotal - StorageUsed())).append(",0"));
+    }
+    else if (baLower == "at i 13")
+    {
+        return ResponseInfo(13, svsSettings.strXCompiler.toUtf8());
+    }
+    else if (baLower == "at i 0xc12c")
+    {
+        return ResponseInfo(0xc12c, strLastCRC.isEmpty() ? QByteArray("0000") : strLastCRC.toUtf8());
+    }
+    else if (baLower == "at+dir")
+    {
+        //One entry per file then success
+        QByteArray baResponse;
+        QMap<QByteArray, QByteArray>::const_iterator itFile = mapFiles.constBegin();
+        while (itFile != mapFiles.constEnd())
+        {
+            baResponse.append("\n06\t").append(itFile.key()).append('\r');
+            ++itFile;
+        }
+        return baResponse.append(baResponseOK);
+    }
+    else if (baLower == "at+fcl")
+    {
+        //Close the file, the CRC covers the data written whilst it was open
+        if (!baOpenFile.isEmpty())
+        {
+            strLastCRC = chkChecksum.GetChecksumHexString();
+            baOpenFile.clear();
+        }
+        return baResponseOK;
+    }
+    else if (baLower == "atz")
+    {
+        //Restart, nothing is output over VSP
+        baOpenFile.clear();
+        return QByteArray();
+    }
+    else if (baLower.startsWith("at+del \""))
+    {
+        if (!QuotedParameter(baCommand, 8, &baParameter))
+        {
+            return ResponseError(SIMULATED_ERROR_INVALID_PARAM);
+        }
+        mapFiles.remove(baParameter);
+        return baResponseOK;
+    }
+    else if (baLower.startsWith("at+fow \"") || baLower.startsWith("at+foa \""))
+    {
+        //Open for writing, append mode requires the file to exist
+        if (!QuotedParameter(baCommand, 8, &baParameter) || baParameter.isEmpty())
+        {
+            return ResponseError(SIMULATED_ERROR_INVALID_PARAM);
+        }
+        if (baLower.at(5) == 'a')
+        {
+            if (svsSettings.bAppend == false)
+            {
+                return ResponseError(SIMULATED_ERROR_UNKNOWN_COMMAND);
+            }
+            else if (!mapFiles.contains(baParameter))
+            {
+                return ResponseError(SIMULATED_ERROR_FILE_MISSING);
+            }
+        }
+        else
+        {
+            mapFiles.insert(baParameter, QByteArray());
+        }
+        baOpenFile = baParameter;
+        chkChecksum.ResetChecksum();
+        return baResponseOK;
+    }
+    else if (baLower.startsWith("at+fwrh \""))
+    {
+        //Hex-encoded data
+        if (!QuotedParameter(baCommand, 9, &baParameter) || (baParameter.length() % 2) != 0)
+        {
+            return ResponseError(SIMULATED_ERROR_INVALID_PARAM);
+        }
+        QByteArray baData;
+        baData.reserve(baParameter.length() / 2);
+        for (qint32 i = 0; i < baParameter.length(); i += 2)
+        {
+            qint32 nHigh = HexValue(baParameter.at(i));
+            qint32 nLow = HexValue(baParameter.at(i + 1));
+            if (nHigh < 0 || nLow < 0)
+            {
+                return ResponseError(SIMULATED_ERROR_INVALID_PARAM);
+            }
+            baData.append((char)((nHigh << 4) | nLow));
+        }
+        *pnBytesWritten = baData.length();
+        return ModuleWriteFile(baData);
+    }
+    else if (baLower.startsWith("at+fwr \""))
+    {
+        //Printable data with other bytes escaped as \HH
+        if (!QuotedParameter(baCommand, 8, &baParameter))
+        {
+            return ResponseError(SIMULATED_ERROR_INVALID_PARAM);
+        }
+        QByteArray baData;
+        baData.reserve(baParameter.length());
+        for (qint32 i = 0; i < baParameter.length(); ++i)
+        {
+            if (baParameter.at(i) != '\\')
+            {
+                baData.append(baParameter.at(i));
+                continue;
+            }
+            qint32 nHigh = (i + 2 < baParameter.length() ? HexValue(baParameter.at(i + 1)) : -1);
+            qint32 nLow = (i + 2 < baParameter.length() ? HexValue(baParameter.at(i + 2)) : -1);
+            if (nHigh < 0 || nLow < 0)
+            {
+                return ResponseError(SIMULATED_ERROR_INVALID_PARAM);
+            }
+            baData.append((char)((nHigh << 4) | nLow));
+            i += 2;
+        }
+        *pnBytesWritten = baData.length();
+        return ModuleWriteFile(baData);
+    }
+
+    //Not a supported command
+    return ResponseError(SIMULATED_ERROR_UNKNOWN_COMMAND);
+}
+
+//=============================================================================
+//=============================================================================
+QByteArray
+SimulatedVspTransport::ModuleWriteFile(
+    const QByteArray &baData
+    )
+{
+    //Appends data to the open file
+    if (baOpenFile.isEmpty())
+    {
+        return ResponseError(SIMULATED_ERROR_FILE_NOT_OPEN);
+    }
+    if (StorageUsed() + baData.length() > svsSettings.nStorageTotal)
+    {
+        return ResponseError(SIMULATED_ERROR_FILESYSTEM_FULL);
+    }
+    mapFiles[baOpenFile].append(baData);
+    chkChecksum.AddBlock(baData.constData(), baData.length());
+    return baResponseOK;
+}
+
+//=============================================================================
+//=============================================================================
+qint32
+SimulatedVspTransport::StorageUsed(
+    )
+{
+    //Returns the space taken up by files
+    qint32 nUsed = 0;
+    QMap<QByteArray, QByteArray>::const_iterator itFile = mapFiles.constBegin();
+    while (itFile != mapFiles.constEnd())
+    {
+        nUsed += itFile.value().length();
+        ++itFile;
+    }
+    return nUsed;
+}
+
+/******************************************************************************/
+// END OF FILE
+/******************************************************************************/
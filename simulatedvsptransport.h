@@ -0,0 +1,211 @@
+/******************************************************************************
+** Copyright (C) 2018 Laird
+**
+** Project: UwVSP-OTA
+**
+** Module: simulatedvsptransport.h
+**
+** Notes:
+**
+** License: This program is free software: you can redistribute it and/or
+**          modify it under the terms of the GNU General Public License as
+**          published by the Free Software Foundation, version 3.
+**
+**          This program is distributed in the hope that it will be useful,
+**          but WITHOUT ANY WARRANTY; without even the implied warranty of
+**          MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+**          GNU General Public License for more details.
+**
+**          You should have received a copy of the GNU General Public License
+**          along with this program.  If not, see http://www.gnu.org/licenses/
+**
+*******************************************************************************/
+#ifndef SIMULATEDVSPTRANSPORT_H
+#define SIMULATEDVSPTRANSPORT_H
+
+/******************************************************************************/
+// Include Files
+/******************************************************************************/
+#include <QObject>
+#include <QByteArray>
+#include <QMap>
+#include <QPair>
+#include <QTimer>
+#include "vsptransport.h"
+#include "checksumcalculator.h"
+#include "target.h"
+
+/******************************************************************************/
+// Constants
+/******************************************************************************/
+//Simulated events, in the order they happen for a connection
+const quint8 SIMULATED_EVENT_CONNECTED           = 0;
+const quint8 SIMULATED_EVENT_MTU                 = 1;
+const quint8 SIMULATED_EVENT_OPENED              = 2;
+const quint8 SIMULATED_EVENT_DELIVERED           = 3; //Written packet has reached the module
+const quint8 SIMULATED_EVENT_STREAMED            = 4; //Packet written without response has reached the module
+const quint8 SIMULATED_EVENT_WRITTEN             = 5; //Write response has reached the host
+const quint8 SIMULATED_EVENT_PROCESS             = 6; //Module is ready to run its next command
+const quint8 SIMULATED_EVENT_NOTIFY              = 7; //Module output has reached the host
+const quint8 SIMULATED_EVENT_FLOW                = 8; //Modem out notification has reached the host
+const quint8 SIMULATED_EVENT_CLOSED              = 9;
+
+//Error codes returned by the simulated module, as a real module would
+const quint16 SIMULATED_ERROR_INVALID_PARAM      = 0x0211;
+const quint16 SIMULATED_ERROR_FILE_MISSING       = 0x180A;
+const quint16 SIMULATED_ERROR_FILESYSTEM_FULL    = 0x180D;
+const quint16 SIMULATED_ERROR_FILE_NOT_OPEN      = 0x1912;
+const quint16 SIMULATED_ERROR_UNKNOWN_COMMAND    = 0xE007;
+
+/******************************************************************************/
+// Structures
+/******************************************************************************/
+//Link and module behaviour, times are in microseconds of simulated time
+struct SimulatedVspSettings
+{
+    int nMTU = 247;                          //Negotiated ATT MTU
+    quint32 unConnectionInterval = 15000;    //Packets and responses are exchanged at connection events
+    quint32 unPacketLoss = 0;                //Packets lost per 1000, each is retransmitted at the next connection event
+    bool bModem = true;                      //True to use the modem out characteristic for flow control
+    bool bWriteWithoutResponse = true;       //True if the RX characteristic accepts writes without response
+    quint32 unPacketsPerEvent = 4;           //Packets written without response which can be sent in one connection event
+    qint32 nRxBufferSize = 2048;             //Size of the module receive buffer, data which does not fit is lost
+    quint32 unCommandTime = 400;             //Time taken by the module to run a command
+    quint32 unFlashByteTime = 20;            //Additional time for each byte written to a file
+    qint32 nStorageTotal = 524288;           //Size of the file system
+    bool bAppend = true;                     //False for firmware without append mode file open support, AT+FOA is then an unknown command
+    quint32 unSeed = 1;                      //Seed for packet loss, runs with the same seed are identical
+    QString strDevice = "BL654";             //AT I 0
+    QString strFirmware = "29.4.6.0";        //AT I 3
+    QString strXCompiler = "F4A5 8C3D";      //AT I 13
+};
+
+//Event waiting for its time in the simulation
+struct SimulatedEvent
+{
+    quint8 unType;
+    QByteArray baData;
+};
+
+/******************************************************************************/
+// Class definitions
+/******************************************************************************/
+class SimulatedVspTransport : public VspTransport
+{
+    Q_OBJECT
+public:
+    explicit
+    SimulatedVspTransport(
+        const SimulatedVspSettings &svsNewSettings = SimulatedVspSettings(),
+        QObject *parent = nullptr
+        );
+    ~SimulatedVspTransport(
+        );
+    void
+    Open(
+        ) override;
+    void
+    Close(
+        ) override;
+    void
+    Write(
+        const QByteArray &baData
+        ) override;
+    bool
+    CanStream(
+        ) override;
+    void
+    Stream(
+        const QByteArray &baData
+        ) override;
+    qint64
+    Elapsed(
+        );
+    qint32
+    PacketsWritten(
+        );
+    qint32
+    PacketsStreamed(
+        );
+    qint32
+    PacketsRetransmitted(
+        );
+    qint32
+    FlowStops(
+        );
+    QByteArray
+    File(
+        const QByteArray &baFilename
+        );
+
+private slots:
+    void
+    RunNextEvent(
+        );
+
+private:
+    void
+    Schedule(
+        qint64 nTime,
+        quint8 unType,
+        const QByteArray &baData = QByteArray()
+        );
+    qint64
+    NextConnectionEvent(
+        qint64 nTime
+        );
+    qint64
+    DeliveryTime(
+        );
+    bool
+    PacketLost(
+        );
+    void
+    ModuleReceive(
+        const QByteArray &baData
+        );
+    void
+    ModuleProcess(
+        );
+    QByteArray
+    ModuleExecute(
+        const QByteArray &baCommand,
+        qint32 *pnBytesWritten
+        );
+    QByteArray
+    ModuleWriteFile(
+        const QByteArray &baData
+        );
+    qint32
+    StorageUsed(
+        );
+
+    SimulatedVspSettings svsSettings;
+    bool bOpen;                    //True from Open() until Close()
+    qint64 nNow;                   //Current simulated time
+    quint64 unSequence;            //Orders events which happen at the same time
+    quint32 unRandom;              //State of the packet loss generator
+    QMap<QPair<qint64, quint64>, SimulatedEvent> mapEvents;
+    bool bRunPending;              //True if RunNextEvent() has been queued
+    qint64 nLinkTime;              //Connection event the last packet written was delivered at, packets arrive in the order they were written
+    quint32 unLinkPackets;         //Number of packets delivered at that connection event
+    qint32 nPacketsWritten;
+    qint32 nPacketsStreamed;
+    qint32 nPacketsRetransmitted;
+    qint32 nFlowStops;
+
+    //Simulated module
+    QByteArray baModuleInput;      //Received data which has not been run
+    bool bModuleBusy;              //True whilst a command is running
+    bool bFlowStopped;             //True if the module has stopped the flow of data
+    QMap<QByteArray, QByteArray> mapFiles;
+    QByteArray baOpenFile;         //Name of the file open for writing, empty if none
+    ChecksumCalculator chkChecksum; //CRC of the data written since the file was opened
+    QString strLastCRC;            //CRC of the last closed file
+};
+
+#endif // SIMULATEDVSPTRANSPORT_H
+
+/******************************************************************************/
+// END OF FILE
+/******************************************************************************/
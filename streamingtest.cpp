@@ -0,0 +1,301 @@
+/******************************************************************************
+** Copyright (C) 2018 Laird
+**
+** Project: UwVSP-OTA
+**
+** Module: streamingtest.cpp
+**
+** Notes:
+**
+** License: This program is free software: you can redistribute it and/or
+**          modify it under the terms of the GNU General Public License as
+**          published by the Free Software Foundation, version 3.
+**
+**          This program is distributed in the hope that it will be useful,
+**          but WITHOUT ANY WARRANTY; without even the implied warranty of
+**          MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+**          GNU General Public License for more details.
+**
+**          You should have received a copy of the GNU General Public License
+**          along with this program.  If not, see http://www.gnu.org/licenses/
+**
+*******************************************************************************/
+#include "streamingtest.h"
+
+/******************************************************************************/
+// Constants
+/******************************************************************************/
+//Time a load is given to finish, the simulation runs as fast as the event loop
+const int STREAMING_TEST_TIMEOUT = 60000;
+
+//=============================================================================
+//=============================================================================
+bool
+StreamingTest::Load(
+    const SimulatedVspSettings &svsSettings,
+    const OtaSessionOptions &osoOptions,
+    SimulatedVspTransport **psvtTransport,
+    OtaSession *otsSession
+    )
+{
+    //Loads the application in the options onto a new simulated module, returns true if the session succeeded and the progress never went past the total
+    QSignalSpy sspFinished(otsSession, SIGNAL(Finished(bool,QString)));
+    QSignalSpy sspProgress(otsSession, SIGNAL(Progress(qint32,qint32)));
+    *psvtTransport = new SimulatedVspTransport(svsSettings);
+    otsSession->Start(osoOptions, false);
+    otsSession->Open(*psvtTransport);
+    if (sspFinished.isEmpty() && !sspFinished.wait(STREAMING_TEST_TIMEOUT))
+    {
+        qWarning() << "Session did not finish.";
+        return false;
+    }
+
+    for (qint32 i = 0; i < sspProgress.count(); ++i)
+    {
+        if (sspProgress.at(i).at(0).toInt() > sspProgress.at(i).at(1).toInt())
+        {
+            qWarning() << "Progress" << sspProgress.at(i).at(0).toInt() << "exceeds total" << sspProgress.at(i).at(1).toInt();
+            return false;
+        }
+    }
+    if (sspFinished.first().at(0).toBool() == false)
+    {
+        qWarning() << sspFinished.first().at(1).toString();
+        return false;
+    }
+    return true;
+}
+
+//=============================================================================
+//=============================================================================
+QByteArray
+StreamingTest::Application(
+    qint32 nSize
+    )
+{
+    //Returns pseudo-random application data
+    QByteArray baData(nSize, 0);
+    quint32 unRandom = (quint32)nSize;
+    for (qint32 i = 0; i < nSize; ++i)
+    {
+        unRandom = unRandom * 1103515245 + 12345;
+        baData[i] = (char)(unRandom >> 16);
+    }
+    return baData;
+}
+
+//=============================================================================
+//=============================================================================
+void
+StreamingTest::StreamedLoadIsIdentical_data(
+    )
+{
+    //Application sizes and MTUs, the smallest MTU gives the most packets per command
+    QTest::addColumn<qint32>("nSize");
+    QTest::addColumn<int>("nMTU");
+    QTest::newRow("1 KB, MTU 247") << 1024 << 247;
+    QTest::newRow("64 KB, MTU 247") << 65536 << 247;
+    QTest::newRow("16 KB, MTU 23") << 16384 << 23;
+}
+
+//=============================================================================
+//=============================================================================
+void
+StreamingTest::StreamedLoadIsIdentical(
+    )
+{
+    //The file data is streamed and the module ends up with the application
+    QFETCH(qint32, nSize);
+    QFETCH(int, nMTU);
+    SimulatedVspSettings svsSettings;
+    svsSettings.nMTU = nMTU;
+    OtaSessionOptions osoOptions;
+    osoOptions.strTargetName = "stream";
+    osoOptions.baFileData = Application(nSize);
+    osoOptions.bSkipIdentical = false;
+    osoOptions.bStreamWrites = true;
+
+    OtaSession otsSession;
+    SimulatedVspTransport *svtTransport;
+    QVERIFY(Load(svsSettings, osoOptions, &svtTransport, &otsSession));
+    QCOMPARE(svtTransport->File("stream"), osoOptions.baFileData);
+    QVERIFY(svtTransport->PacketsStreamed() > 0);
+    QCOMPARE(otsSession.Statistics().nFileSize, nSize);
+}
+
+//=============================================================================
+//=============================================================================
+void
+StreamingTest::StreamingFollowsFlowControl(
+    )
+{
+    //A slow module lets its receive buffer fill whilst streaming, it stops the flow and no data is lost as the window (8 packets) fits in its buffer
+    SimulatedVspSettings svsSettings;
+    svsSettings.unCommandTime = 5000;
+    svsSettings.unPacketsPerEvent = 6;
+    OtaSessionOptions osoOptions;
+    osoOptions.strTargetName = "stream";
+    osoOptions.baFileData = Application(32768);
+    osoOptions.bSkipIdentical = false;
+    osoOptions.bStreamWrites = true;
+    osoOptions.unStreamWindow = 8;
+
+    OtaSession otsSession;
+    SimulatedVspTransport *svtTransport;
+    QVERIFY(Load(svsSettings, osoOptions, &svtTransport, &otsSession));
+    QCOMPARE(svtTransport->File("stream"), osoOptions.baFileData);
+    QVERIFY(svtTransport->PacketsStreamed() > 0);
+    QVERIFY(svtTransport->FlowStops() > 0);
+}
+
+//=============================================================================
+//=============================================================================
+void
+StreamingTest::StreamingWindowOfOnePacket(
+    )
+{
+    //With a window smaller than a command the whole of the next command is still streamed, so the module can acknowledge it and the load completes
+    SimulatedVspSettings svsSettings;
+    OtaSessionOptions osoOptions;
+    osoOptions.strTargetName = "stream";
+    osoOptions.baFileData = Application(8192);
+    osoOptions.bSkipIdentical = false;
+    osoOptions.bStreamWrites = true;
+    osoOptions.unStreamWindow = 1;
+    osoOptions.unPacketSize = 20;
+
+    OtaSession otsSession;
+    SimulatedVspTransport *svtTransport;
+    QVERIFY(Load(svsSettings, osoOptions, &svtTransport, &otsSession));
+    QCOMPARE(svtTransport->File("stream"), osoOptions.baFileData);
+    QVERIFY(svtTransport->PacketsStreamed() > 0);
+}
+
+//=============================================================================
+//=============================================================================
+void
+StreamingTest::WritesWithoutStreamingSupport(
+    )
+{
+    //A module which does not accept writes without response has every packet written with response
+    SimulatedVspSettings svsSettings;
+    svsSettings.bWriteWithoutResponse = false;
+    OtaSessionOptions osoOptions;
+    osoOptions.strTargetName = "stream";
+    osoOptions.baFileData = Application(4096);
+    osoOptions.bSkipIdentical = false;
+    osoOptions.bStreamWrites = true;
+
+    OtaSession otsSession;
+    SimulatedVspTransport *svtTransport;
+    QVERIFY(Load(svsSettings, osoOptions, &svtTransport, &otsSession));
+    QCOMPARE(svtTransport->File("stream"), osoOptions.baFileData);
+    QCOMPARE(svtTransport->PacketsStreamed(), 0);
+}
+
+//=============================================================================
+//=============================================================================
+void
+StreamingTest::StreamingWithCheckpoint(
+    )
+{
+    //The application keeps a transfer checkpoint for every load, which must not change how the file data is streamed: the load takes the same simulated time
+    //with and without one
+    SimulatedVspSettings svsSettings;
+    OtaSessionOptions osoOptions;
+    osoOptions.strTargetName = "stream";
+    osoOptions.baFileData = Application(32768);
+    osoOptions.bSkipIdentical = false;
+    osoOptions.bStreamWrites = true;
+
+    OtaSession otsPlainSession;
+    SimulatedVspTransport *svtPlainTransport;
+    QVERIFY(Load(svsSettings, osoOptions, &svtPlainTransport, &otsPlainSession));
+
+    TransferCheckpoint trcCheckpoint;
+    OtaSession otsSession;
+    otsSession.SetTransferCheckpoint(&trcCheckpoint);
+    SimulatedVspTransport *svtTransport;
+    QVERIFY(Load(svsSettings, osoOptions, &svtTransport, &otsSession));
+    QCOMPARE(svtTransport->File("stream"), osoOptions.baFileData);
+    QVERIFY(svtTransport->PacketsStreamed() > 0);
+    QCOMPARE(svtTransport->PacketsStreamed(), svtPlainTransport->PacketsStreamed());
+    QCOMPARE(svtTransport->Elapsed(), svtPlainTransport->Elapsed());
+}
+
+//=============================================================================
+//=============================================================================
+void
+StreamingTest::ResumeAfterDisconnect_data(
+    )
+{
+    //Streamed and written with response, the module has run commands whose responses are lost in both. Firmware which cannot append has the file loaded in full
+    QTest::addColumn<bool>("bStreamWrites");
+    QTest::addColumn<bool>("bAppend");
+    QTest::newRow("streamed") << true << true;
+    QTest::newRow("written") << false << true;
+    QTest::newRow("streamed, no append support") << true << false;
+}
+
+//=============================================================================
+//=============================================================================
+void
+StreamingTest::ResumeAfterDisconnect(
+    )
+{
+    //The link drops half way through the transfer with the command window unlimited, after reconnecting the transfer resumes from what the module wrote (or
+    //starts again) and the module ends up with the application
+    QFETCH(bool, bStreamWrites);
+    QFETCH(bool, bAppend);
+    SimulatedVspSettings svsSettings;
+    svsSettings.bAppend = bAppend;
+    const QString strAddress = "00:16:A4:00:00:01";
+    OtaSessionOptions osoOptions;
+    osoOptions.strTargetName = "stream";
+    osoOptions.baFileData = Application(16384);
+    osoOptions.bSkipIdentical = false;
+    osoOptions.bStreamWrites = bStreamWrites;
+
+    TransferCheckpoint trcCheckpoint;
+    OtaSession otsSession;
+    otsSession.SetTransferCheckpoint(&trcCheckpoint);
+    SimulatedVspTransport svtTransport(svsSettings);
+    QSignalSpy sspOpened(&svtTransport, SIGNAL(Opened()));
+    QSignalSpy sspFinished(&otsSession, SIGNAL(Finished(bool,QString)));
+    QMetaObject::Connection conProgress = connect(&otsSession, &OtaSession::Progress, [&svtTransport](qint32 nSent, qint32 nTotal) {
+        if (nSent > nTotal / 2)
+        {
+            svtTransport.Close();
+        }
+    });
+
+    svtTransport.Open();
+    QVERIFY(sspOpened.wait(STREAMING_TEST_TIMEOUT));
+    otsSession.Load(osoOptions, &svtTransport, strAddress);
+    QVERIFY(sspFinished.count() == 1 || sspFinished.wait(STREAMING_TEST_TIMEOUT));
+    QCOMPARE(sspFinished.first().at(0).toBool(), false);
+    QVERIFY(trcCheckpoint.IsResumable(strAddress));
+    qint32 nAcknowledged = trcCheckpoint.FileOffset();
+    disconnect(conProgress);
+
+    svtTransport.Open();
+    QVERIFY(sspOpened.count() == 2 || sspOpened.wait(STREAMING_TEST_TIMEOUT));
+    otsSession.Resume(osoOptions, &svtTransport, strAddress);
+    QVERIFY(sspFinished.count() == 2 || sspFinished.wait(STREAMING_TEST_TIMEOUT));
+    QVERIFY2(sspFinished.at(1).at(0).toBool() == true, qPrintable(sspFinished.at(1).at(1).toString()));
+    if (bAppend == true)
+    {
+        QVERIFY(otsSession.Statistics().nFileOffset >= nAcknowledged);
+    }
+    else
+    {
+        QCOMPARE(otsSession.Statistics().nFileOffset, 0);
+    }
+    QCOMPARE(svtTransport.File("stream"), osoOptions.baFileData);
+}
+
+QTEST_GUILESS_MAIN(StreamingTest)
+
+/******************************************************************************/
+// END OF FILE
+/******************************************************************************/
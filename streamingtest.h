@@ -0,0 +1,87 @@
+/******************************************************************************
+** Copyright (C) 2018 Laird
+**
+** Project: UwVSP-OTA
+**
+** Module: streamingtest.h
+**
+** Notes:
+**
+** License: This program is free software: you can redistribute it and/or
+**          modify it under the terms of the GNU General Public License as
+**          published by the Free Software Foundation, version 3.
+**
+**          This program is distributed in the hope that it will be useful,
+**          but WITHOUT ANY WARRANTY; without even the implied warranty of
+**          MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+**          GNU General Public License for more details.
+**
+**          You should have received a copy of the GNU General Public License
+**          along with this program.  If not, see http://www.gnu.org/licenses/
+**
+*******************************************************************************/
+#ifndef STREAMINGTEST_H
+#define STREAMINGTEST_H
+
+/******************************************************************************/
+// Include Files
+/******************************************************************************/
+#include <QObject>
+#include <QtTest>
+#include "otasession.h"
+#include "simulatedvsptransport.h"
+
+/******************************************************************************/
+// Class definitions
+/******************************************************************************/
+//Loads applications onto the simulated module with the file data written without response, checking the module ends up with the application, that packets
+//were streamed, that the progress reported by the session is not counted twice and that an interrupted transfer resumes
+class StreamingTest : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    void
+    StreamedLoadIsIdentical(
+        );
+    void
+    StreamedLoadIsIdentical_data(
+        );
+    void
+    StreamingFollowsFlowControl(
+        );
+    void
+    StreamingWindowOfOnePacket(
+        );
+    void
+    WritesWithoutStreamingSupport(
+        );
+    void
+    StreamingWithCheckpoint(
+        );
+    void
+    ResumeAfterDisconnect(
+        );
+    void
+    ResumeAfterDisconnect_data(
+        );
+
+private:
+    bool
+    Load(
+        const SimulatedVspSettings &svsSettings,
+        const OtaSessionOptions &osoOptions,
+        SimulatedVspTransport **psvtTransport,
+        OtaSession *otsSession
+        );
+    static QByteArray
+    Application(
+        qint32 nSize
+        );
+};
+
+#endif // STREAMINGTEST_H
+
+/******************************************************************************/
+// END OF FILE
+/******************************************************************************/
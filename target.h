@@ -28,6 +28,7 @@
 /******************************************************************************/
 #define ENABLE_DEBUG                     //Set to allow debugging messages using QDebug
 #define UseSSL                           //Set to enable SSL (requires OpenSSL libraries)
+#define CHECKSUM_SLICE_BY_8              //Set to calculate checksums of blocks 8 bytes at a time
 
 /******************************************************************************/
 // Include Files
@@ -68,7 +69,7 @@ const bool    SETTINGS_VALUE_RESTRICTUUID    = true;
 const QString SETTINGS_KEY_COMPATIBLESCAN    = "CompatibleScan";
 const bool    SETTINGS_VALUE_COMPATIBLESCAN  = false;
 const QString SETTINGS_KEY_PACKETSIZE        = "PacketSize";
-const quint8  SETTINGS_VALUE_PACKETSIZE      = 20;
+const quint16 SETTINGS_VALUE_PACKETSIZE      = 0; //0 = automatic (from negotiated MTU)
 const QString SETTINGS_KEY_ONLINEXCOMP       = "OnlineXComp";
 const bool    SETTINGS_VALUE_ONLINEXCOMP     = true;
 const QString SETTINGS_KEY_SSL               = "EnableSSL";
@@ -84,11 +85,29 @@ const quint8  SETTINGS_VALUE_DOWNLOADACTION  = DOWNLOAD_ACTION_DISCONNECT;
 const QString SETTINGS_KEY_SKIPDLDISPLAY     = "SkipDownloadDisplay";
 const bool    SETTINGS_VALUE_SKIPDLDISPLAY   = false;
 const QString SETTINGS_KEY_SCROLLBACKSIZE    = "ScrollbackSize";
-const quint8  SETTINGS_VALUE_SCROLLBACKSIZE  = 32;
+const quint32 SETTINGS_VALUE_SCROLLBACKSIZE  = 32;
 const QString SETTINGS_KEY_CHECKFWVERSION     = "CheckFirmwareVersion";
 const bool    SETTINGS_VALUE_CHECKFWVERSION   = true;
 const QString SETTINGS_KEY_CHECKFREESPACE     = "CheckFreeSpace";
 const bool    SETTINGS_VALUE_CHECKFREESPACE   = true;
+const QString SETTINGS_KEY_STREAMWRITES      = "StreamWrites";
+const bool    SETTINGS_VALUE_STREAMWRITES    = false;
+const QString SETTINGS_KEY_STREAMWINDOW      = "StreamWindow";
+const quint8  SETTINGS_VALUE_STREAMWINDOW    = 8;
+const QString SETTINGS_KEY_COMMANDWINDOW     = "CommandWindow";
+const quint8  SETTINGS_VALUE_COMMANDWINDOW   = 0; //0 = unlimited
+const QString SETTINGS_KEY_XCOMPILECACHE     = "XCompileCacheSize";
+const quint16 SETTINGS_VALUE_XCOMPILECACHE   = 16; //MB, 0 = disabled
+const QString SETTINGS_KEY_PREFETCHXCOMP     = "PrefetchXComp";
+const bool    SETTINGS_VALUE_PREFETCHXCOMP   = true;
+const QString SETTINGS_KEY_MODULECACHETTL    = "ModuleCacheTTL";
+const quint32 SETTINGS_VALUE_MODULECACHETTL  = 300; //Seconds, 0 = disabled
+const QString SETTINGS_KEY_SKIPIDENTICAL     = "SkipIdentical";
+const bool    SETTINGS_VALUE_SKIPIDENTICAL   = true;
+const QString SETTINGS_KEY_PACKETTRACE       = "PacketTrace";
+const bool    SETTINGS_VALUE_PACKETTRACE     = false;
+const QString SETTINGS_KEY_RECORDSESSIONS    = "RecordSessions";
+const bool    SETTINGS_VALUE_RECORDSESSIONS  = false;
 
 //Values for application status
 const quint8  STATUS_STANDBY                 = 0;
@@ -146,6 +165,7 @@ const quint8  MAIN_MODE_DOWNLOADING          = 7;
 const quint8  MAIN_MODE_VERIFYING            = 8;
 const quint8  MAIN_MODE_QUERY                = 9;
 const quint8  MAIN_MODE_FIRMWAREVERSION      = 10;
+const quint8  MAIN_MODE_COMPARING            = 11;
 
 //What mode the downloader module is in
 const quint8  DOWNLOAD_MODE_IDLE             = 0;
@@ -163,6 +183,11 @@ const quint8  FIRMWARE_CHECK_UNSUPPORTED     = 99;
 //Timeout interval for a timeout response
 const quint16 TIMEOUT_TIMER_INTERVAL         = 3000;
 
+//Default ATT MTU, size of the ATT write header and largest packet size which fits in one link layer packet with data length extension
+const quint16 BLE_DEFAULT_MTU                = 23;
+const quint16 BLE_ATT_HEADER_SIZE            = 3;
+const quint16 BLE_MAX_PACKET_SIZE            = 244;
+
 //Timeout for scanning for devices
 const quint16 TIMEOUT_BLE_SCAN               = 20000;
 
@@ -178,9 +203,33 @@ const qint8   SETTINGS_SAVE_ERROR            = 1;
 //Filename of settings file (on supported platforms)
 const QString SETTINGS_FILENAME              = "OTA_VSP.ini";
 
+//Directory (inside the user cache directory) and index filename of the XCompiled application cache
+const QString XCOMPILE_CACHE_DIRECTORY       = "UwVSP-OTA/xcompile";
+const QString XCOMPILE_CACHE_INDEX           = "index.ini";
+
+//Total size of the XCompiled applications held in memory if none are stored between runs, otherwise the storage size limit is used
+const qint64  XCOMPILE_CACHE_MEMORY_SIZE     = 16777216;
+
+//File (inside the user cache directory) module details from earlier connections are kept in
+const QString MODULE_CACHE_FILENAME          = "UwVSP-OTA/modules.ini";
+
+//File (inside the user data directory) the timing of each load is logged to, and the size at which it is moved to a backup and a new log is started
+const QString SESSION_LOG_FILENAME           = "UwVSP-OTA/sessions.jsonl";
+const qint64  SESSION_LOG_MAX_SIZE           = 1048576;
+
+//Directory (inside the user data directory) packet traces are saved to, and the number of events kept (must be a power of 2)
+const QString PACKET_TRACE_DIRECTORY         = "UwVSP-OTA/traces";
+const quint32 PACKET_TRACE_CAPACITY          = 65536;
+
+//Directory (inside the user data directory) recorded sessions are saved to
+const QString SESSION_CAPTURE_DIRECTORY      = "UwVSP-OTA/captures";
+
 //Specifies the maximum length of a command sent to the module
 const qint8   MODULE_MAX_COMMAND_LENGTH      = 56;
 
+//Number of success responses after the file data when verifying a download (at+fcl, at i 0xc12c and at+dir)
+const qint32  VERIFY_TRAILING_RESPONSES      = 3;
+
 #ifdef Q_OS_ANDROID
 //Duration for displaying notifications on Android (1 = long, 0 = short)
 const jint    ANDROID_TOAST_DURATION_SHORT   = 0;
@@ -0,0 +1,196 @@
+/******************************************************************************
+** Copyright (C) 2018 Laird
+**
+** Project: UwVSP-OTA
+**
+** Module: transfercheckpoint.cpp
+**
+** Notes:
+**
+** License: This program is free software: you can redistribute it and/or
+**          modify it under the terms of the GNU General Public License as
+**          published by the Free Software Foundation, version 3.
+**
+**          This program is distributed in the hope that it will be useful,
+**          but WITHOUT ANY WARRANTY; without even the implied warranty of
+**          MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+**          GNU General Public License for more details.
+**
+**          You should have received a copy of the GNU General Public License
+**          along with this program.  If not, see http://www.gnu.org/licenses/
+**
+*******************************************************************************/
+#include "transfercheckpoint.h"
+
+//=============================================================================
+//=============================================================================
+TransferCheckpoint::TransferCheckpoint(QObject *parent) : QObject(parent)
+{
+    //Constructor
+    unFormat = 0;
+    nOpenOffset = 0;
+    bSaved = false;
+}
+
+//=============================================================================
+//=============================================================================
+TransferCheckpoint::~TransferCheckpoint(
+    )
+{
+    //Destructor
+}
+
+//=============================================================================
+//=============================================================================
+void
+TransferCheckpoint::Start(
+    const QString &strNewFilename,
+    const QByteArray &baNewFileData,
+    const QString &strNewChecksum,
+    quint8 unNewFormat
+    )
+{
+    //Records the details of a new transfer so it can be resumed if the connection is lost, replacing any earlier checkpoint
+    strDevice.clear();
+    strFilename = strNewFilename;
+    baFileData = baNewFileData;
+    strChecksum = strNewChecksum;
+    unFormat = unNewFormat;
+    vecFileOffsets.clear();
+    nOpenOffset = 0;
+    bSaved = false;
+}
+
+//=============================================================================
+//=============================================================================
+void
+TransferCheckpoint::Save(
+    const QString &strNewDevice,
+    const QVector<qint32> &vecNewFileOffsets
+    )
+{
+    //Saves how far the transfer may have got when it was interrupted, it can only be resumed once the module has acknowledged the file being opened. The module
+    //may have run commands whose responses were lost, the CRC it reports on reconnection shows which of the offsets it reached
+    if (strFilename.isEmpty() || vecNewFileOffsets.isEmpty() || vecNewFileOffsets.last() <= 0)
+    {
+        //Nothing on the module to resume
+        Clear();
+        return;
+    }
+    strDevice = strNewDevice;
+    vecFileOffsets = vecNewFileOffsets;
+    bSaved = true;
+}
+
+//=============================================================================
+//=============================================================================
+void
+TransferCheckpoint::Reopen(
+    qint32 nNewOpenOffset
+    )
+{
+    //Records that the file has been opened again in append mode to resume the transfer
+    nOpenOffset = nNewOpenOffset;
+}
+
+//=============================================================================
+//=============================================================================
+void
+TransferCheckpoint::Clear(
+    )
+{
+    //Discards the checkpoint
+    strDevice.clear();
+    strFilename.clear();
+    baFileData.clear();
+    strChecksum.clear();
+    vecFileOffsets.clear();
+    nOpenOffset = 0;
+    bSaved = false;
+}
+
+//=============================================================================
+//=============================================================================
+bool
+TransferCheckpoint::IsResumable(
+    const QString &strConnectedDevice
+    )
+{
+    //Returns true if an interrupted transfer was saved for the connected module. Only verified transfers are resumed, the CRC shows whether the module had run
+    //a command whose response was lost when the link dropped
+    return (bSaved == true && strDevice == strConnectedDevice && !strChecksum.isEmpty());
+}
+
+//=============================================================================
+//=============================================================================
+const QString &
+TransferCheckpoint::Filename(
+    )
+{
+    //Returns the name of the file on the module
+    return strFilename;
+}
+
+//=============================================================================
+//=============================================================================
+const QByteArray &
+TransferCheckpoint::FileData(
+    )
+{
+    //Returns the complete file data
+    return baFileData;
+}
+
+//=============================================================================
+//=============================================================================
+const QString &
+TransferCheckpoint::Checksum(
+    )
+{
+    //Returns the expected CRC of the complete file, empty if it is not being verified
+    return strChecksum;
+}
+
+//=============================================================================
+//=============================================================================
+quint8
+TransferCheckpoint::Format(
+    )
+{
+    //Returns the format the file data was being written in
+    return unFormat;
+}
+
+//=============================================================================
+//=============================================================================
+qint32
+TransferCheckpoint::FileOffset(
+    )
+{
+    //Returns the number of bytes of the file the module acknowledged writing
+    return (vecFileOffsets.isEmpty() ? 0 : vecFileOffsets.first());
+}
+
+//=============================================================================
+//=============================================================================
+const QVector<qint32> &
+TransferCheckpoint::FileOffsets(
+    )
+{
+    //Returns the offsets the file may have been written up to, in order
+    return vecFileOffsets;
+}
+
+//=============================================================================
+//=============================================================================
+qint32
+TransferCheckpoint::OpenOffset(
+    )
+{
+    //Returns the offset the file was last opened at, 0 unless the transfer has already been resumed
+    return nOpenOffset;
+}
+
+/******************************************************************************/
+// END OF FILE
+/******************************************************************************/
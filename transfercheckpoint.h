@@ -0,0 +1,108 @@
+/******************************************************************************
+** Copyright (C) 2018 Laird
+**
+** Project: UwVSP-OTA
+**
+** Module: transfercheckpoint.h
+**
+** Notes:
+**
+** License: This program is free software: you can redistribute it and/or
+**          modify it under the terms of the GNU General Public License as
+**          published by the Free Software Foundation, version 3.
+**
+**          This program is distributed in the hope that it will be useful,
+**          but WITHOUT ANY WARRANTY; without even the implied warranty of
+**          MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+**          GNU General Public License for more details.
+**
+**          You should have received a copy of the GNU General Public License
+**          along with this program.  If not, see http://www.gnu.org/licenses/
+**
+*******************************************************************************/
+#ifndef TRANSFERCHECKPOINT_H
+#define TRANSFERCHECKPOINT_H
+
+/******************************************************************************/
+// Include Files
+/******************************************************************************/
+#include <QObject>
+#include <QString>
+#include <QByteArray>
+#include <QVector>
+#include "target.h"
+
+/******************************************************************************/
+// Class definitions
+/******************************************************************************/
+class TransferCheckpoint : public QObject
+{
+    Q_OBJECT
+public:
+    explicit
+    TransferCheckpoint(
+        QObject *parent = nullptr
+        );
+    ~TransferCheckpoint(
+        );
+    void
+    Start(
+        const QString &strNewFilename,
+        const QByteArray &baNewFileData,
+        const QString &strNewChecksum,
+        quint8 unNewFormat
+        );
+    void
+    Save(
+        const QString &strNewDevice,
+        const QVector<qint32> &vecNewFileOffsets
+        );
+    void
+    Reopen(
+        qint32 nNewOpenOffset
+        );
+    void
+    Clear(
+        );
+    bool
+    IsResumable(
+        const QString &strConnectedDevice
+        );
+    const QString &
+    Filename(
+        );
+    const QByteArray &
+    FileData(
+        );
+    const QString &
+    Checksum(
+        );
+    quint8
+    Format(
+        );
+    qint32
+    FileOffset(
+        );
+    const QVector<qint32> &
+    FileOffsets(
+        );
+    qint32
+    OpenOffset(
+        );
+
+private:
+    QString strDevice;     //Address (or UUID) of the module the transfer was interrupted on
+    QString strFilename;   //Name of the file on the module
+    QByteArray baFileData; //Complete file data being transferred
+    QString strChecksum;   //Expected CRC of the complete file, empty if it is not being verified
+    quint8 unFormat;       //Format the file data is being written in
+    QVector<qint32> vecFileOffsets; //Offsets the file may have been written up to when the transfer was interrupted, starting with the acknowledged data
+    qint32 nOpenOffset;    //Offset the file was last opened at, non-zero once the transfer has been resumed
+    bool bSaved;           //True if an interrupted transfer has been saved
+};
+
+#endif // TRANSFERCHECKPOINT_H
+
+/******************************************************************************/
+// END OF FILE
+/******************************************************************************/
@@ -0,0 +1,64 @@
+#-------------------------------------------------
+#
+# OTA throughput benchmark against a simulated
+# VSP module, no Bluetooth adapter is needed
+#
+#-------------------------------------------------
+
+QT       += core bluetooth network
+QT       -= gui
+
+TARGET = vspota-bench
+TEMPLATE = app
+CONFIG += console
+CONFIG -= app_bundle
+
+SOURCES += \
+        benchmain.cpp            \
+        otabenchmark.cpp         \
+        otasession.cpp           \
+        xcompilecache.cpp        \
+        modulestatecache.cpp     \
+        vsptransport.cpp         \
+        blevsptransport.cpp      \
+        sessioncapture.cpp       \
+        recordingvsptransport.cpp \
+        packettracer.cpp         \
+        sessiontiminglog.cpp     \
+        transfercheckpoint.cpp   \
+        replayvsptransport.cpp   \
+        simulatedvsptransport.cpp \
+        downloader.cpp           \
+        errorlookup.cpp          \
+        checksumcalculator.cpp   \
+        otacommandencoder.cpp    \
+        outputqueue.cpp          \
+        commandpipeline.cpp      \
+        moduleresponseparser.cpp
+
+HEADERS  += \
+        otabenchmark.h           \
+        otasession.h             \
+        xcompilecache.h          \
+        modulestatecache.h       \
+        vsptransport.h           \
+        blevsptransport.h        \
+        sessioncapture.h         \
+        recordingvsptransport.h  \
+        packettracer.h           \
+        sessiontiminglog.h       \
+        transfercheckpoint.h     \
+        replayvsptransport.h     \
+        simulatedvsptransport.h  \
+        downloader.h             \
+        target.h                 \
+        errorlookup.h            \
+        errorcodes.h             \
+        checksumcalculator.h     \
+        otacommandencoder.h      \
+        outputqueue.h            \
+        commandpipeline.h        \
+        moduleresponseparser.h
+
+RESOURCES += \
+    resources.qrc
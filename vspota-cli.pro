@@ -0,0 +1,62 @@
+#-------------------------------------------------
+#
+# Headless command-line OTA loader, shares the
+# protocol code with qtbluetooth.pro
+#
+#-------------------------------------------------
+
+QT       += core bluetooth network
+QT       -= gui
+
+TARGET = vspota-cli
+TEMPLATE = app
+CONFIG += console
+CONFIG -= app_bundle
+
+SOURCES += \
+        climain.cpp              \
+        otacli.cpp               \
+        otasession.cpp           \
+        otasessionmanager.cpp    \
+        xcompilecache.cpp        \
+        modulestatecache.cpp     \
+        vsptransport.cpp         \
+        blevsptransport.cpp      \
+        sessioncapture.cpp       \
+        recordingvsptransport.cpp \
+        packettracer.cpp         \
+        sessiontiminglog.cpp     \
+        transfercheckpoint.cpp   \
+        downloader.cpp           \
+        errorlookup.cpp          \
+        checksumcalculator.cpp   \
+        otacommandencoder.cpp    \
+        outputqueue.cpp          \
+        commandpipeline.cpp      \
+        moduleresponseparser.cpp
+
+HEADERS  += \
+        otacli.h                 \
+        otasession.h             \
+        otasessionmanager.h      \
+        xcompilecache.h          \
+        modulestatecache.h       \
+        vsptransport.h           \
+        blevsptransport.h        \
+        sessioncapture.h         \
+        recordingvsptransport.h  \
+        packettracer.h           \
+        sessiontiminglog.h       \
+        transfercheckpoint.h     \
+        downloader.h             \
+        target.h                 \
+        errorlookup.h            \
+        errorcodes.h             \
+        checksumcalculator.h     \
+        otacommandencoder.h      \
+        outputqueue.h            \
+        commandpipeline.h        \
+        moduleresponseparser.h
+
+RESOURCES += \
+    resources.qrc
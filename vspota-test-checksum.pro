@@ -0,0 +1,24 @@
+#-------------------------------------------------
+#
+# Tests the table-driven and slice-by-8 checksum
+# calculations against the bit-serial calculation,
+# "make check" runs them
+#
+#-------------------------------------------------
+
+QT       += core testlib
+QT       -= gui
+
+TARGET = vspota-test-checksum
+TEMPLATE = app
+CONFIG += console testcase
+CONFIG -= app_bundle
+
+SOURCES += \
+        checksumtest.cpp         \
+        checksumcalculator.cpp
+
+HEADERS  += \
+        checksumtest.h           \
+        checksumcalculator.h     \
+        target.h
@@ -0,0 +1,23 @@
+#-------------------------------------------------
+#
+# Tests parsing module responses split across
+# notifications, "make check" runs them
+#
+#-------------------------------------------------
+
+QT       += core testlib
+QT       -= gui
+
+TARGET = vspota-test-responseparser
+TEMPLATE = app
+CONFIG += console testcase
+CONFIG -= app_bundle
+
+SOURCES += \
+        responseparsertest.cpp   \
+        moduleresponseparser.cpp
+
+HEADERS  += \
+        responseparsertest.h     \
+        moduleresponseparser.h   \
+        target.h
@@ -0,0 +1,59 @@
+#-------------------------------------------------
+#
+# Tests streaming the file data without response
+# to a simulated VSP module, "make check" runs them
+#
+#-------------------------------------------------
+
+QT       += core bluetooth network testlib
+QT       -= gui
+
+TARGET = vspota-test-streaming
+TEMPLATE = app
+CONFIG += console testcase
+CONFIG -= app_bundle
+
+SOURCES += \
+        streamingtest.cpp        \
+        otasession.cpp           \
+        xcompilecache.cpp        \
+        modulestatecache.cpp     \
+        vsptransport.cpp         \
+        blevsptransport.cpp      \
+        sessioncapture.cpp       \
+        recordingvsptransport.cpp \
+        packettracer.cpp         \
+        transfercheckpoint.cpp   \
+        simulatedvsptransport.cpp \
+        downloader.cpp           \
+        errorlookup.cpp          \
+        checksumcalculator.cpp   \
+        otacommandencoder.cpp    \
+        outputqueue.cpp          \
+        commandpipeline.cpp      \
+        moduleresponseparser.cpp
+
+HEADERS  += \
+        streamingtest.h          \
+        otasession.h             \
+        xcompilecache.h          \
+        modulestatecache.h       \
+        vsptransport.h           \
+        blevsptransport.h        \
+        sessioncapture.h         \
+        recordingvsptransport.h  \
+        packettracer.h           \
+        transfercheckpoint.h     \
+        simulatedvsptransport.h  \
+        downloader.h             \
+        target.h                 \
+        errorlookup.h            \
+        errorcodes.h             \
+        checksumcalculator.h     \
+        otacommandencoder.h      \
+        outputqueue.h            \
+        commandpipeline.h        \
+        moduleresponseparser.h
+
+RESOURCES += \
+    resources.qrc
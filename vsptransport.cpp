@@ -0,0 +1,86 @@
+/******************************************************************************
+** Copyright (C) 2018 Laird
+**
+** Project: UwVSP-OTA
+**
+** Module: vsptransport.cpp
+**
+** Notes:
+**
+** License: This program is free software: you can redistribute it and/or
+**          modify it under the terms of the GNU General Public License as
+**          published by the Free Software Foundation, version 3.
+**
+**          This program is distributed in the hope that it will be useful,
+**          but WITHOUT ANY WARRANTY; without even the implied warranty of
+**          MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+**          GNU General Public License for more details.
+**
+**          You should have received a copy of the GNU General Public License
+**          along with this program.  If not, see http://www.gnu.org/licenses/
+**
+*******************************************************************************/
+#include "vsptransport.h"
+
+//=============================================================================
+//=============================================================================
+VspTransport::VspTransport(QObject *parent) : QObject(parent)
+{
+    //Constructor
+    nMTU = BLE_DEFAULT_MTU;
+}
+
+//=============================================================================
+//=============================================================================
+VspTransport::~VspTransport(
+    )
+{
+    //Destructor
+}
+
+//=============================================================================
+//=============================================================================
+bool
+VspTransport::CanStream(
+    )
+{
+    //Returns true if packets can be written without response, which is not supported unless a transport provides it
+    return false;
+}
+
+//=============================================================================
+//=============================================================================
+void
+VspTransport::Stream(
+    const QByteArray &baData
+    )
+{
+    //Writes a packet without response, a transport which cannot stream writes it normally
+    Write(baData);
+}
+
+//=============================================================================
+//=============================================================================
+int
+VspTransport::MTU(
+    )
+{
+    //Returns the ATT MTU of the connection
+    return nMTU;
+}
+
+//=============================================================================
+//=============================================================================
+void
+VspTransport::ReportMTU(
+    int nNewMTU
+    )
+{
+    //Records a new ATT MTU (-1 if it is not known) and reports it
+    nMTU = (nNewMTU > BLE_DEFAULT_MTU ? nNewMTU : BLE_DEFAULT_MTU);
+    emit MTUChanged(nNewMTU);
+}
+
+/******************************************************************************/
+// END OF FILE
+/******************************************************************************/
@@ -0,0 +1,117 @@
+/******************************************************************************
+** Copyright (C) 2018 Laird
+**
+** Project: UwVSP-OTA
+**
+** Module: vsptransport.h
+**
+** Notes:
+**
+** License: This program is free software: you can redistribute it and/or
+**          modify it under the terms of the GNU General Public License as
+**          published by the Free Software Foundation, version 3.
+**
+**          This program is distributed in the hope that it will be useful,
+**          but WITHOUT ANY WARRANTY; without even the implied warranty of
+**          MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+**          GNU General Public License for more details.
+**
+**          You should have received a copy of the GNU General Public License
+**          along with this program.  If not, see http://www.gnu.org/licenses/
+**
+*******************************************************************************/
+#ifndef VSPTRANSPORT_H
+#define VSPTRANSPORT_H
+
+/******************************************************************************/
+// Include Files
+/******************************************************************************/
+#include <QObject>
+#include <QByteArray>
+#include <QString>
+#include "target.h"
+
+/******************************************************************************/
+// Class definitions
+/******************************************************************************/
+//Link to the VSP service of a module, over Bluetooth or simulated. Open() emits Connected() once linked and Opened() once notifications are enabled.
+//Each Write() is one packet to the RX characteristic and only one is outstanding until DataWritten(), data from the TX characteristic arrives through DataReceived().
+//If CanStream() is true, Stream() writes a packet without response: no DataWritten() follows it and the module stops the flow through FlowChanged() when it cannot keep up
+class VspTransport : public QObject
+{
+    Q_OBJECT
+public:
+    explicit
+    VspTransport(
+        QObject *parent = nullptr
+        );
+    virtual
+    ~VspTransport(
+        );
+    virtual void
+    Open(
+        ) = 0;
+    virtual void
+    Close(
+        ) = 0;
+    virtual void
+    Write(
+        const QByteArray &baData
+        ) = 0;
+    virtual bool
+    CanStream(
+        );
+    virtual void
+    Stream(
+        const QByteArray &baData
+        );
+    int
+    MTU(
+        );
+
+signals:
+    void
+    Connected(
+        );
+    void
+    Opened(
+        );
+    void
+    Closed(
+        );
+    void
+    DataReceived(
+        QByteArray baData
+        );
+    void
+    DataWritten(
+        qint32 nLength
+        );
+    void
+    FlowChanged(
+        bool bBlocked
+        );
+    void
+    MTUChanged(
+        int nMTU
+        );
+    void
+    Error(
+        QString strMessage
+        );
+
+protected slots:
+    void
+    ReportMTU(
+        int nNewMTU
+        );
+
+private:
+    int nMTU; //ATT MTU of the connection, BLE_DEFAULT_MTU until it is known
+};
+
+#endif // VSPTRANSPORT_H
+
+/******************************************************************************/
+// END OF FILE
+/******************************************************************************/
@@ -0,0 +1,357 @@
+/******************************************************************************
+** Copyright (C) 2018 Laird
+**
+** Project: UwVSP-OTA
+**
+** Module: xcompilecache.cpp
+**
+** Notes:
+**
+** License: This program is free software: you can redistribute it and/or
+**          modify it under the terms of the GNU General Public License as
+**          published by the Free Software Foundation, version 3.
+**
+**          This program is distributed in the hope that it will be useful,
+**          but WITHOUT ANY WARRANTY; without even the implied warranty of
+**          MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+**          GNU General Public License for more details.
+**
+**          You should have received a copy of the GNU General Public License
+**          along with this program.  If not, see http://www.gnu.org/licenses/
+**
+*******************************************************************************/
+#include "xcompilecache.h"
+
+//=============================================================================
+//=============================================================================
+XCompileCache::XCompileCache(QObject *parent) : QObject(parent)
+{
+    //Constructor, compiled applications are only kept in memory until SetStorage() is called
+    nStorageMaxSize = 0;
+    nMemorySize = 0;
+    nMemoryMaxSize = XCOMPILE_CACHE_MEMORY_SIZE;
+    connect(&dwnDownloader, SIGNAL(XCompileComplete(quint32,bool,qint16,QByteArray)), this, SLOT(DownloaderComplete(quint32,bool,qint16,QByteArray)));
+}
+
+//=============================================================================
+//=============================================================================
+XCompileCache::~XCompileCache(
+    )
+{
+    //Destructor, outstanding requests are deleted with the downloader
+}
+
+//=============================================================================
+//=============================================================================
+QString
+XCompileCache::Key(
+    const QString &strDevice,
+    const QString &strHashA,
+    const QString &strHashB,
+    const QByteArray &baSourceData
+    )
+{
+    //Returns the key of an application compiled for a module type and XCompiler. Every field is hashed, each preceded by its length so that different fields
+    //never give the same key, and the key can be used as a filename
+    QCryptographicHash hshKey(QCryptographicHash::Sha256);
+    const QByteArrayList balFields = QByteArrayList() << strDevice.toUtf8() << strHashA.toUtf8() << strHashB.toUtf8() << baSourceData;
+    for (qint32 i = 0; i < balFields.count(); ++i)
+    {
+        hshKey.addData(QByteArray::number(balFields.at(i).length()).append(':'));
+        hshKey.addData(balFields.at(i));
+    }
+    return QString::fromLatin1(hshKey.result().toHex());
+}
+
+//=============================================================================
+//=============================================================================
+bool
+XCompileCache::Lookup(
+    const QString &strKey,
+    QByteArray &baCompiledData
+    )
+{
+    //Returns true and the compiled application if it has already been XCompiled, by this run or a previous one
+    QHash<QString, QByteArray>::const_iterator itCompiled = hshCompiled.constFind(strKey);
+    if (itCompiled != hshCompiled.constEnd())
+    {
+        baCompiledData = itCompiled.value();
+        lstRecentlyUsed.removeOne(strKey);
+        lstRecentlyUsed.append(strKey);
+        MarkUsed(strKey);
+        return true;
+    }
+    if (!ReadStored(strKey, baCompiledData))
+    {
+        return false;
+    }
+    KeepInMemory(strKey, baCompiledData);
+    MarkUsed(strKey);
+    return true;
+}
+
+//=============================================================================
+//=============================================================================
+void
+XCompileCache::Store(
+    const QString &strKey,
+    const QByteArray &baCompiledData
+    )
+{
+    //Adds an application which has been XCompiled elsewhere
+    if (baCompiledData.isEmpty())
+    {
+        return;
+    }
+    KeepInMemory(strKey, baCompiledData);
+    WriteStored(strKey, baCompiledData);
+}
+
+//=============================================================================
+//=============================================================================
+void
+XCompileCache::SetStorage(
+    const QString &strDirectory,
+    qint64 nMaxSize
+    )
+{
+    //Sets where compiled applications are kept between runs and the total size they can use, which also limits those held in memory. A size of 0 disables storage
+    if (strDirectory.isEmpty() || nMaxSize <= 0 || !QDir().mkpath(strDirectory))
+    {
+        strStorageDirectory.clear();
+        nStorageMaxSize = 0;
+        nMemoryMaxSize = XCOMPILE_CACHE_MEMORY_SIZE;
+        return;
+    }
+    strStorageDirectory = strDirectory;
+    nStorageMaxSize = nMaxSize;
+    nMemoryMaxSize = nMaxSize;
+    while (nMemorySize > nMemoryMaxSize && !lstRecentlyUsed.isEmpty())
+    {
+        nMemorySize -= hshCompiled.take(lstRecentlyUsed.takeFirst()).size();
+    }
+
+    //Remove applications if the size limit has been reduced
+    EvictStored();
+}
+
+//=============================================================================
+//=============================================================================
+QString
+XCompileCache::DefaultDirectory(
+    )
+{
+    //Returns the directory shared by the GUI and command line applications
+    return QStandardPaths::writableLocation(QStandardPaths::GenericCacheLocation).append('/').append(XCOMPILE_CACHE_DIRECTORY);
+}
+
+//=============================================================================
+//=============================================================================
+void
+XCompileCache::Request(
+    const QString &strKey,
+    const QString &strDevice,
+    const QString &strHashA,
+    const QString &strHashB,
+    const QByteArray &baSourceData,
+    bool bSSL
+    )
+{
+    //XCompiles an application, XCompileComplete is emitted with the key once done. Requests for a key which is already being compiled share that request
+    QByteArray baCompiledData;
+    if (Lookup(strKey, baCompiledData))
+    {
+        emit XCompileComplete(strKey, true, 0, baCompiledData);
+        return;
+    }
+    if (hshActive.key(strKey, 0) == 0)
+    {
+        //Requests for different modules are outstanding at the same time
+        dwnDownloader.SetSSLSupport(bSSL);
+        QByteArray baSource = baSourceData;
+        hshActive.insert(dwnDownloader.XCompileFile(strDevice, strHashA, strHashB, &baSource), strKey);
+    }
+}
+
+//=============================================================================
+//=============================================================================
+void
+XCompileCache::ConnectToServer(
+    bool bSSL
+    )
+{
+    //Opens the connection to the XCompile server whilst the module is queried, so a request made once the query completes does not wait for it
+    dwnDownloader.SetSSLSupport(bSSL);
+    dwnDownloader.ConnectToServer();
+}
+
+//=============================================================================
+//=============================================================================
+void
+XCompileCache::Clear(
+    )
+{
+    //Discards the compiled applications held in memory, stored applications and outstanding requests are kept
+    hshCompiled.clear();
+    lstRecentlyUsed.clear();
+    nMemorySize = 0;
+}
+
+//=============================================================================
+//=============================================================================
+void
+XCompileCache::DownloaderComplete(
+    quint32 unRequestID,
+    bool bSuccess,
+    qint16 nErrorCode,
+    QByteArray baCompiledData
+    )
+{
+    //XCompile server response received, only successful results are kept so a failed request is retried by the next session
+    if (!hshActive.contains(unRequestID))
+    {
+        return;
+    }
+
+    QString strKey = hshActive.take(unRequestID);
+    if (bSuccess == true && !baCompiledData.isEmpty())
+    {
+        Store(strKey, baCompiledData);
+    }
+    emit XCompileComplete(strKey, bSuccess, nErrorCode, baCompiledData);
+}
+
+//=============================================================================
+//=============================================================================
+bool
+XCompileCache::ReadStored(
+    const QString &strKey,
+    QByteArray &baCompiledData
+    )
+{
+    //Reads an application compiled by a previous run
+    if (strStorageDirectory.isEmpty())
+    {
+        return false;
+    }
+    QFile fileStored(QString(strStorageDirectory).append('/').append(strKey).append(".uwc"));
+    if (!fileStored.open(QIODevice::ReadOnly))
+    {
+        return false;
+    }
+    baCompiledData = fileStored.readAll();
+    fileStored.close();
+    return !baCompiledData.isEmpty();
+}
+
+//=============================================================================
+//=============================================================================
+void
+XCompileCache::WriteStored(
+    const QString &strKey,
+    const QByteArray &baCompiledData
+    )
+{
+    //Keeps an application for later runs, the file is replaced in one step so an interrupted write is never read back
+    if (strStorageDirectory.isEmpty() || baCompiledData.size() > nStorageMaxSize)
+    {
+        return;
+    }
+    QSaveFile fileStored(QString(strStorageDirectory).append('/').append(strKey).append(".uwc"));
+    if (!fileStored.open(QIODevice::WriteOnly) || fileStored.write(baCompiledData) != baCompiledData.size() || !fileStored.commit())
+    {
+        return;
+    }
+    MarkUsed(strKey);
+    EvictStored();
+}
+
+//=============================================================================
+//=============================================================================
+void
+XCompileCache::KeepInMemory(
+    const QString &strKey,
+    const QByteArray &baCompiledData
+    )
+{
+    //Holds an application in memory as the most recently used, removing the least recently used until they fit in the size limit. One larger than the limit is not kept
+    if (hshCompiled.contains(strKey))
+    {
+        nMemorySize -= hshCompiled.take(strKey).size();
+        lstRecentlyUsed.removeOne(strKey);
+    }
+    if (baCompiledData.size() > nMemoryMaxSize)
+    {
+        return;
+    }
+    while (nMemorySize + baCompiledData.size() > nMemoryMaxSize && !lstRecentlyUsed.isEmpty())
+    {
+        nMemorySize -= hshCompiled.take(lstRecentlyUsed.takeFirst()).size();
+    }
+    hshCompiled.insert(strKey, baCompiledData);
+    lstRecentlyUsed.append(strKey);
+    nMemorySize += baCompiledData.size();
+}
+
+//=============================================================================
+//=============================================================================
+void
+XCompileCache::MarkUsed(
+    const QString &strKey
+    )
+{
+    //Records that an application has been used, the index holds an increasing sequence number per application
+    if (strStorageDirectory.isEmpty())
+    {
+        return;
+    }
+    QSettings stgIndex(QString(strStorageDirectory).append('/').append(XCOMPILE_CACHE_INDEX), QSettings::IniFormat);
+    quint64 unSequence = stgIndex.value("Sequence", 0).toULongLong() + 1;
+    stgIndex.setValue("Sequence", unSequence);
+    stgIndex.setValue(QString("LastUsed/").append(strKey), unSequence);
+}
+
+//=============================================================================
+//=============================================================================
+void
+XCompileCache::EvictStored(
+    )
+{
+    //Removes the least recently used applications until the stored applications fit in the size limit
+    QDir dirStorage(strStorageDirectory);
+    QFileInfoList lstStored = dirStorage.entryInfoList(QStringList("*.uwc"), QDir::Files);
+    qint64 nTotalSize = 0;
+    for (QFileInfoList::const_iterator itStored = lstStored.constBegin(); itStored != lstStored.constEnd(); ++itStored)
+    {
+        nTotalSize += itStored->size();
+    }
+    if (nTotalSize <= nStorageMaxSize)
+    {
+        return;
+    }
+
+    //Order the applications by when they were last used, files missing from the index are removed first
+    QSettings stgIndex(dirStorage.filePath(XCOMPILE_CACHE_INDEX), QSettings::IniFormat);
+    stgIndex.beginGroup("LastUsed");
+    QMultiMap<quint64, QFileInfo> mapByUse;
+    for (QFileInfoList::const_iterator itStored = lstStored.constBegin(); itStored != lstStored.constEnd(); ++itStored)
+    {
+        mapByUse.insert(stgIndex.value(itStored->completeBaseName(), 0).toULongLong(), *itStored);
+    }
+
+    QMultiMap<quint64, QFileInfo>::const_iterator itOldest = mapByUse.constBegin();
+    while (nTotalSize > nStorageMaxSize && itOldest != mapByUse.constEnd())
+    {
+        if (QFile::remove(itOldest.value().absoluteFilePath()))
+        {
+            nTotalSize -= itOldest.value().size();
+            stgIndex.remove(itOldest.value().completeBaseName());
+        }
+        ++itOldest;
+    }
+    stgIndex.endGroup();
+}
+
+/******************************************************************************/
+// END OF FILE
+/******************************************************************************/
@@ -0,0 +1,155 @@
+/******************************************************************************
+** Copyright (C) 2018 Laird
+**
+** Project: UwVSP-OTA
+**
+** Module: xcompilecache.h
+**
+** Notes:
+**
+** License: This program is free software: you can redistribute it and/or
+**          modify it under the terms of the GNU General Public License as
+**          published by the Free Software Foundation, version 3.
+**
+**          This program is distributed in the hope that it will be useful,
+**          but WITHOUT ANY WARRANTY; without even the implied warranty of
+**          MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+**          GNU General Public License for more details.
+**
+**          You should have received a copy of the GNU General Public License
+**          along with this program.  If not, see http://www.gnu.org/licenses/
+**
+*******************************************************************************/
+#ifndef XCOMPILECACHE_H
+#define XCOMPILECACHE_H
+
+/******************************************************************************/
+// Include Files
+/******************************************************************************/
+#include <QObject>
+#include <QByteArray>
+#include <QByteArrayList>
+#include <QHash>
+#include <QCryptographicHash>
+#include <QStandardPaths>
+#include <QSettings>
+#include <QSaveFile>
+#include <QFile>
+#include <QDir>
+#include <QMultiMap>
+#include <QStringList>
+#include "downloader.h"
+#include "target.h"
+
+/******************************************************************************/
+// Class definitions
+/******************************************************************************/
+class XCompileCache : public QObject
+{
+    Q_OBJECT
+public:
+    explicit
+    XCompileCache(
+        QObject *parent = nullptr
+        );
+    ~XCompileCache(
+        );
+    static QString
+    Key(
+        const QString &strDevice,
+        const QString &strHashA,
+        const QString &strHashB,
+        const QByteArray &baSourceData
+        );
+    bool
+    Lookup(
+        const QString &strKey,
+        QByteArray &baCompiledData
+        );
+    void
+    Store(
+        const QString &strKey,
+        const QByteArray &baCompiledData
+        );
+    void
+    SetStorage(
+        const QString &strDirectory,
+        qint64 nMaxSize
+        );
+    static QString
+    DefaultDirectory(
+        );
+    void
+    Request(
+        const QString &strKey,
+        const QString &strDevice,
+        const QString &strHashA,
+        const QString &strHashB,
+        const QByteArray &baSourceData,
+        bool bSSL
+        );
+    void
+    ConnectToServer(
+        bool bSSL
+        );
+    void
+    Clear(
+        );
+
+signals:
+    void
+    XCompileComplete(
+        QString strKey,
+        bool bSuccess,
+        qint16 nErrorCode,
+        QByteArray baCompiledData
+        );
+
+private slots:
+    void
+    DownloaderComplete(
+        quint32 unRequestID,
+        bool bSuccess,
+        qint16 nErrorCode,
+        QByteArray baCompiledData
+        );
+
+private:
+    bool
+    ReadStored(
+        const QString &strKey,
+        QByteArray &baCompiledData
+        );
+    void
+    WriteStored(
+        const QString &strKey,
+        const QByteArray &baCompiledData
+        );
+    void
+    KeepInMemory(
+        const QString &strKey,
+        const QByteArray &baCompiledData
+        );
+    void
+    MarkUsed(
+        const QString &strKey
+        );
+    void
+    EvictStored(
+        );
+
+    QHash<QString, QByteArray> hshCompiled;  //Successfully compiled applications
+    QStringList lstRecentlyUsed;             //Keys of hshCompiled, least recently used first
+    qint64 nMemorySize;                      //Total size of the applications in hshCompiled
+    qint64 nMemoryMaxSize;                   //Total size of hshCompiled before the least recently used are removed
+    Downloader dwnDownloader;                //Shared by all requests so they use the same connection to the server
+    QHash<quint32, QString> hshActive;       //Requests awaiting the XCompile server by request ID, one per key
+    QString strStorageDirectory;             //Directory compiled applications are kept in between runs, empty if disabled
+    qint64 nStorageMaxSize;                  //Total size of stored applications (in bytes) before the least recently used are removed
+};
+
+#endif // XCOMPILECACHE_H
+
+/******************************************************************************/
+// END OF FILE
+/******************************************************************************/